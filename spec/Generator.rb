@@ -18,10 +18,17 @@ def aggregateFields( type, major, minor, sp, aggregator )
   Processor.new(xml, [aggregator]).processFields
 end
 
+# messages that also get a flyweight decoder, by version
+DECODERS = { "FIX44" => [ "ExecutionReport", "MarketDataIncrementalRefresh" ] }
+# messages that also get an encoder, by version
+ENCODERS = { "FIX44" => [ "NewOrderSingle", "OrderCancelRequest" ] }
+
 def generateVersion( type, major, minor, sp, verid, aggregator )
   dir = "../src"
   xml = versionXML( type, major, minor, sp )
-  cpp = GeneratorCPP.new(type, major.to_s, minor.to_s, sp.to_s, verid.to_s, "#{dir}/C++")
+  decoders = DECODERS[ xml.chomp(".xml") ] || []
+  encoders = ENCODERS[ xml.chomp(".xml") ] || []
+  cpp = GeneratorCPP.new(type, major.to_s, minor.to_s, sp.to_s, verid.to_s, "#{dir}/C++", decoders, encoders)
   python = GeneratorPython.new(type, major.to_s, minor.to_s, sp.to_s, verid.to_s, "#{dir}/python")
   ruby = GeneratorRuby.new(type, major.to_s, minor.to_s, sp.to_s, verid.to_s, "#{dir}/ruby")
   processor = Processor.new(xml, [cpp, python, ruby]).process( aggregator )
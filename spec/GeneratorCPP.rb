@@ -1,7 +1,11 @@
 require 'PrintFile'
 
 class GeneratorCPP
-  def initialize(type, major, minor, sp, verid, basedir)
+  # Fields and groups of a message, recorded for the flyweight decoders
+  # and the encoders.
+  DecoderNode = Struct.new(:name, :number, :delim, :fields, :groups, :order, :required)
+
+  def initialize(type, major, minor, sp, verid, basedir, decoders = [], encoders = [])
     @type = type
     @major = major
     @minor = minor
@@ -18,6 +22,12 @@ class GeneratorCPP
     @dir = basedir + "/" + @namespace.downcase
     @basefile = createVersionFile("Message.h")
     @f = @basefile
+    @decoders = decoders
+    @encoders = encoders
+    @decoderNodes = []
+    @decoderMessages = []
+    @fieldTypes = Hash.new
+    @fieldNames = Hash.new
   end
 
   def createBaseFile(name)
@@ -43,9 +53,12 @@ class GeneratorCPP
     @f.indent
     @f.puts "FIELD_SET(*this, FIX::" + name + ");"
     @f.dedent
+    @decoderNodes.last.fields.push(name) if !@decoderNodes.empty?
   end
 
   def headerStart
+    @header = DecoderNode.new(nil, nil, nil, [], [])
+    @decoderNodes = [@header]
     @f.indent
     @f.puts "class Header : public FIX::Header"
     @f.puts "{"
@@ -53,12 +66,15 @@ class GeneratorCPP
   end
 
   def headerEnd
+    @decoderNodes = []
     @f.puts "};"
     @f.puts
     @f.dedent
   end
 
   def trailerStart
+    @trailer = DecoderNode.new(nil, nil, nil, [], [])
+    @decoderNodes = [@trailer]
     @f.indent
     @f.puts "class Trailer : public FIX::Trailer"
     @f.puts "{"
@@ -66,6 +82,7 @@ class GeneratorCPP
   end
 
   def trailerEnd
+    @decoderNodes = []
     @f.puts "};"
     @f.puts
     @f.dedent
@@ -102,21 +119,32 @@ class GeneratorCPP
   end
 
   def groupStart(name, number, delim, order)
+    if !@decoderNodes.empty?
+      group = DecoderNode.new(name, number, delim, [], [], order)
+      @decoderNodes.last.groups.push(group)
+      @decoderNodes.push(group)
+    end
     @f.indent    
     @f.puts "class " + name + ": public FIX::Group"
     @f.puts "{"
     @f.puts "public:"
-    @f.print name + "() : FIX::Group(" + number + "," + delim + "," + "FIX::message_order("
+    @f.puts name + "() : FIX::Group(" + number + "," + delim + ",order()) {}"
+    @f.print "static const FIX::message_order& order() { static const FIX::message_order instance("
     order.each { |field| @f.printInline field + "," }
-    @f.putsInline "0)) {}"
+    @f.putsInline "0); return instance; }"
   end
 
   def groupEnd
+    @decoderNodes.pop if @decoderNodes.size > 1
     @f.puts "};"
     @f.dedent
   end
 
   def messageStart(name, msgtype, required)
+    @decoderNodes = []
+    if @decoders.include?(name) || @encoders.include?(name)
+      @decoderNodes = [DecoderNode.new(name, msgtype, nil, [], [], nil, required)]
+    end
     @f = createVersionFile(name + ".h")
     @f.puts "#ifndef " + @namespace + "_" + name.upcase + "_H"
     @f.puts "#define " + @namespace + "_" + name.upcase + "_H"
@@ -165,6 +193,8 @@ class GeneratorCPP
   end
 
   def messageEnd
+    @decoderMessages.push(@decoderNodes.first) if !@decoderNodes.empty?
+    @decoderNodes = []
     @f.puts "};"
     @f.puts
     @f.dedent
@@ -191,6 +221,8 @@ class GeneratorCPP
   end
 
   def fields(name, number, type, values)
+    @fieldTypes[name] = type
+    @fieldNames[number] = name
     fixFields(@ff, name, number, type)
     fixFieldNumbers(@fn, name, number, type)
     fixFieldValues(@fv, name, number, type, values)
@@ -203,6 +235,414 @@ class GeneratorCPP
     @ff.close
     @fn.close
     @fv.close
+    @decoderMessages.each { |message|
+      decoder(message) if @decoders.include?(message.name)
+      encoder(message) if @encoders.include?(message.name)
+    }
+  end
+
+  # Flyweight decoders: a class per message with a typed member and a
+  # presence bit per field, filled by one switch over the raw message.
+
+  def decoder(message)
+    name = message.name + "Decoder"
+    top = DecoderNode.new(message.name, message.number, nil,
+      (@header.fields + message.fields + @trailer.fields).uniq,
+      @header.groups + message.groups + @trailer.groups)
+
+    f = createVersionFile(name + ".h")
+    f.puts "#ifndef " + @namespace + "_" + name.upcase + "_H"
+    f.puts "#define " + @namespace + "_" + name.upcase + "_H"
+    f.puts
+    f.puts "#include \"../FlyweightDecoder.h\""
+    f.puts "#include \"Message.h\""
+    f.puts
+    f.puts "namespace " + @namespace
+    f.puts "{"
+    f.puts
+    f.indent
+    f.puts "/// Decodes a raw " + message.name + " in a single pass without building a FIX::Message."
+    f.puts "/// Values point into the decoded buffer, which must outlive the decoder."
+    decoderClass(f, top, name, message.number)
+    f.dedent
+    f.puts
+    f.puts "}"
+    f.puts
+    f.puts "#endif"
+    f.close
+  end
+
+  def decoderClass(f, node, name, msgtype)
+    fields = node.fields.uniq
+    groups = node.groups
+    f.puts "class " + name
+    f.puts "{"
+    f.puts "public:"
+    f.indent
+    groups.each { |group|
+      decoderClass(f, group, group.name, nil)
+      f.puts "typedef FIX::InlineVector< " + group.name + ", " +
+        (msgtype ? "8" : "2") + " > " + group.name + "Entries;"
+      f.puts
+    }
+
+    if msgtype
+      f.puts name + "() : m_data( 0 ), m_size( 0 ) {}"
+      f.puts
+      f.puts "void decode( const std::string& message )"
+      f.puts "{ decode( message.data(), message.size() ); }"
+      f.puts "void decode( const char* data, size_t size )"
+      f.puts "{"
+      f.indent
+      f.puts "m_data = data;"
+      f.puts "m_size = size;"
+      f.puts "clear();"
+      f.puts "FIX::FieldCursor cursor( data, data + size );"
+      f.puts "while( cursor.valid() )"
+      f.puts "{"
+      f.indent
+      decoderSwitch(f, fields, groups, msgtype, "break;")
+      f.puts "cursor.next();"
+      f.dedent
+      f.puts "}"
+      f.dedent
+      f.puts "}"
+      f.puts
+      f.puts "/// Parse the decoded buffer into a full message."
+      f.puts "void toMessage( FIX::Message& message, const FIX::DataDictionary* pDataDictionary = 0 ) const"
+      f.puts "{ message.setString( FIX::INCOMING_DIRECTION, std::string( m_data, m_size ), 0, pDataDictionary ); }"
+      f.puts
+    else
+      f.puts "void decode( FIX::FieldCursor& cursor )"
+      f.puts "{"
+      f.indent
+      f.puts "do"
+      f.puts "{"
+      f.indent
+      decoderSwitch(f, fields, groups, nil, "return;")
+      f.puts "cursor.next();"
+      f.dedent
+      f.puts "}"
+      f.puts "while( cursor.valid() && cursor.tag() != " + node.delim + " );"
+      f.dedent
+      f.puts "}"
+      f.puts
+    end
+
+    f.puts "void clear()" if !msgtype
+    decoderClear(f, groups) if !msgtype
+    fields.each_index { |i|
+      field = fields[i]
+      group = groups.find { |g| g.name == field }
+      f.puts "bool isSet" + field + "() const { return m_present[ " + i.to_s + " ]; }"
+      if group
+        f.puts "const " + field + "Entries& get" + field + "() const { return m_" + field + "; }"
+      else
+        f.puts decoderReturnType(field) + " get" + field + "() const"
+        f.puts "{ if( !m_present[ " + i.to_s + " ] ) throw FIX::FieldNotFound( FIX::FIELD::" + field + " ); return m_" + field + "; }"
+      end
+    }
+    f.dedent
+    f.puts
+    f.puts "private:"
+    f.indent
+    if msgtype
+      f.puts "void clear()"
+      decoderClear(f, groups)
+      f.puts
+      f.puts "const char* m_data;"
+      f.puts "size_t m_size;"
+    end
+    f.puts "std::bitset< " + fields.size.to_s + " > m_present;"
+    fields.each { |field|
+      if groups.find { |g| g.name == field }
+        f.puts field + "Entries m_" + field + ";"
+      else
+        f.puts decoderMemberType(field) + " m_" + field + ";"
+      end
+    }
+    f.dedent
+    f.puts "};"
+  end
+
+  def decoderClear(f, groups)
+    f.puts "{"
+    f.indent
+    f.puts "m_present.reset();"
+    groups.each { |group| f.puts "m_" + group.name + ".clear();" }
+    f.dedent
+    f.puts "}"
+  end
+
+  def decoderSwitch(f, fields, groups, msgtype, otherwise)
+    f.puts "switch( cursor.tag() )"
+    f.puts "{"
+    fields.each_index { |i|
+      field = fields[i]
+      number = @fieldNames.key(field)
+      group = groups.find { |g| g.name == field }
+      f.puts "case " + number + ":"
+      f.indent
+      f.puts "m_present.set( " + i.to_s + " );"
+      if group
+        f.puts "FIX::decodeGroups( cursor, m_" + field + ", " + number + ", " + group.delim + " );"
+        f.puts "continue;"
+      else
+        f.puts "m_" + field + " = " + decoderConvert(field) + ";"
+        if msgtype && field == "MsgType"
+          f.puts "if( m_MsgType != \"" + msgtype + "\" )"
+          f.puts "  throw FIX::InvalidMessageType( m_MsgType.str() );"
+        end
+        data = decoderDataField(field, number)
+        f.puts "cursor.setDataLength( " + data + ", m_" + field + " );" if data
+        f.puts "break;"
+      end
+      f.dedent
+    }
+    f.puts "default:"
+    f.puts "  " + otherwise
+    f.puts "}"
+  end
+
+  # Data fields follow their length field, which is numbered one below
+  # them except for Signature.
+  def decoderDataField(field, number)
+    return nil if @fieldTypes[field] != "LENGTH"
+    return @fieldNames.key("Signature") if field == "SignatureLength"
+    data = @fieldNames[(number.to_i + 1).to_s]
+    return nil if data == nil
+    return nil if @fieldTypes[data] != "DATA" && @fieldTypes[data] != "XMLDATA"
+    return (number.to_i + 1).to_s
+  end
+
+  def decoderKind(field)
+    case @fieldTypes[field]
+      when "INT", "LENGTH", "NUMINGROUP", "SEQNUM", "TAGNUM", "DAYOFMONTH"
+        "Int"
+      when "PRICE", "QTY", "AMT", "FLOAT", "PRICEOFFSET", "PERCENTAGE"
+        "Double"
+      when "CHAR"
+        "Char"
+      when "BOOLEAN"
+        "Bool"
+      else
+        nil
+    end
+  end
+
+  def decoderMemberType(field)
+    case decoderKind(field)
+      when "Int" then "int"
+      when "Double" then "double"
+      when "Char" then "char"
+      when "Bool" then "bool"
+      else "FIX::FieldView"
+    end
+  end
+
+  def decoderReturnType(field)
+    type = decoderMemberType(field)
+    return "const " + type + "&" if type == "FIX::FieldView"
+    return type
+  end
+
+  def decoderConvert(field)
+    kind = decoderKind(field)
+    return "cursor.value()" if kind == nil
+    return "cursor.get" + kind + "()"
+  end
+
+  # Encoders: a class per message with a typed member and a presence bit
+  # per body field, written out in dictionary order.  Required fields are
+  # only accepted through the constructor and reset().
+
+  def encoder(message)
+    name = message.name + "Encoder"
+    f = createVersionFile(name + ".h")
+    f.puts "#ifndef " + @namespace + "_" + name.upcase + "_H"
+    f.puts "#define " + @namespace + "_" + name.upcase + "_H"
+    f.puts
+    f.puts "#include \"../MessageEncoder.h\""
+    f.puts "#include \"../FlyweightDecoder.h\""
+    f.puts
+    f.puts "namespace " + @namespace
+    f.puts "{"
+    f.puts
+    f.indent
+    f.puts "/// Writes " + message.name + " bodies without building a FIX::Message."
+    f.puts "/// Reuse one instance through reset() to avoid allocating per message."
+    encoderClass(f, message, name)
+    f.dedent
+    f.puts
+    f.puts "}"
+    f.puts
+    f.puts "#endif"
+    f.close
+  end
+
+  def encoderClass(f, node, name)
+    fields = encoderOrder(node)
+    groups = node.groups
+    top = node.delim == nil
+    required = node.required ? fields.select { |field| node.required.include?(field) } : []
+    delim = encoderDelim(node)
+    required = [delim] if delim
+    f.puts "class " + name + (top ? " : public FIX::MessageEncoder" : "")
+    f.puts "{"
+    f.puts "public:"
+    f.indent
+    groups.each { |group|
+      encoderClass(f, group, group.name)
+      f.puts "typedef FIX::InlineVector< " + group.name + ", " +
+        (top ? "8" : "2") + " > " + group.name + "Entries;"
+      f.puts
+    }
+
+    if top
+      params = required.map { |field| encoderParamType(field) + " a" + field }
+      args = required.map { |field| "a" + field }
+      f.puts name + "( " + params.join(", ") + " )"
+      f.puts ": FIX::MessageEncoder( \"" + node.number + "\" )"
+      f.puts "{ reset( " + args.join(", ") + " ); }"
+      f.puts
+      f.puts "/// Start a new message, keeping the buffers of the last one."
+      f.puts "void reset( " + params.join(", ") + " )"
+      f.puts "{"
+      f.indent
+      f.puts "clear();"
+      required.each { |field|
+        f.puts "m_" + field + " = a" + field + ";"
+        f.puts "m_present.set( " + fields.index(field).to_s + " );"
+      }
+      f.dedent
+      f.puts "}"
+      f.puts
+    else
+      f.puts "void clear()"
+      encoderClear(f, groups)
+      f.puts
+      if delim
+        f.puts "/// Start an entry with its delimiter, which is always written first."
+        f.puts "void reset( " + encoderParamType(delim) + " a" + delim + " )"
+        f.puts "{"
+        f.indent
+        f.puts "clear();"
+        f.puts "m_" + delim + " = a" + delim + ";"
+        f.puts "m_present.set( 0 );"
+        f.dedent
+        f.puts "}"
+        f.puts
+      end
+    end
+
+    fields.each_index { |i|
+      field = fields[i]
+      next if required.include?(field)
+      group = groups.find { |g| g.name == field }
+      groupDelim = group ? encoderDelim(group) : nil
+      if groupDelim
+        f.puts field + "& add" + field + "( " + encoderParamType(groupDelim) + " a" + groupDelim + " )"
+        f.puts "{"
+        f.indent
+        f.puts field + "& entry = m_" + field + ".push_back();"
+        f.puts "entry.reset( a" + groupDelim + " );"
+        f.puts "return entry;"
+        f.dedent
+        f.puts "}"
+      elsif group
+        f.puts field + "& add" + field + "() { return m_" + field + ".push_back(); }"
+      else
+        f.puts "void set" + field + "( " + encoderParamType(field) + " value )"
+        f.puts "{ m_" + field + " = value; m_present.set( " + i.to_s + " ); }"
+      end
+    }
+    f.puts
+
+    if top
+      f.dedent
+      f.puts "protected:"
+      f.indent
+      f.puts "void encode()"
+    else
+      f.puts "void encode( FIX::MessageEncoder& encoder ) const"
+    end
+    f.puts "{"
+    f.indent
+    target = top ? "" : "encoder."
+    fields.each_index { |i|
+      field = fields[i]
+      number = @fieldNames.key(field)
+      group = groups.find { |g| g.name == field }
+      if group
+        f.puts "if( !m_" + field + ".empty() )"
+        f.puts "{"
+        f.indent
+        f.puts target + "append( \"" + number + "=\", (int)m_" + field + ".size() );"
+        f.puts "for( size_t i = 0; i < m_" + field + ".size(); ++i )"
+        f.puts "  m_" + field + "[ i ].encode( " + (top ? "*this" : "encoder") + " );"
+        f.dedent
+        f.puts "}"
+      else
+        f.puts "if( m_present[ " + i.to_s + " ] ) " + target +
+          "append( \"" + number + "=\", m_" + field + " );"
+      end
+    }
+    f.dedent
+    f.puts "}"
+    f.dedent
+    f.puts
+    f.puts "private:"
+    f.indent
+    if top
+      f.puts "void clear()"
+      encoderClear(f, groups)
+      f.puts
+    end
+    f.puts "std::bitset< " + fields.size.to_s + " > m_present;"
+    fields.each { |field|
+      if groups.find { |g| g.name == field }
+        f.puts field + "Entries m_" + field + ";"
+      else
+        f.puts encoderMemberType(field) + " m_" + field + ";"
+      end
+    }
+    f.dedent
+    f.puts "};"
+  end
+
+  alias encoderClear decoderClear
+
+  # Groups are written in the order of their definition, the message
+  # body in the order its fields were declared.
+  def encoderOrder(node)
+    fields = node.fields.uniq
+    return fields if node.order == nil
+    ordered = node.order.map { |number| @fieldNames[number] }.select { |field| fields.include?(field) }
+    return ordered + (fields - ordered)
+  end
+
+  # The field every entry of a group must start with, so each entry only
+  # gets one through reset().  Nil for messages and for groups that start
+  # with a nested group.
+  def encoderDelim(node)
+    return nil if node.delim == nil
+    delim = @fieldNames[node.delim]
+    return nil if node.groups.find { |g| g.name == delim }
+    return nil if encoderOrder(node).first != delim
+    return delim
+  end
+
+  def encoderMemberType(field)
+    return "FIX::UtcTimeStamp" if @fieldTypes[field] == "UTCTIMESTAMP"
+    type = decoderMemberType(field)
+    return "std::string" if type == "FIX::FieldView"
+    return type
+  end
+
+  def encoderParamType(field)
+    type = encoderMemberType(field)
+    return "const " + type + "&" if type.include?("::")
+    return type
   end
 
   def fixFieldsStart(f)
@@ -28,6 +28,7 @@
 #include "Session.h"
 #include "SessionFactory.h"
 #include "HttpServer.h"
+#include "HeaderSniffer.h"
 #include <algorithm>
 #include <fstream>
 
@@ -43,6 +44,7 @@ throw( ConfigError )
   m_settings( settings ),
   m_pLogFactory( 0 ),
   m_pLog( 0 ),
+  m_log( m_nullLog ),
   m_firstPoll( true ),
   m_stop( true )
 {
@@ -60,6 +62,7 @@ throw( ConfigError )
   m_settings( settings ),
   m_pLogFactory( &logFactory ),
   m_pLog( logFactory.create() ),
+  m_log( m_pLog ? *m_pLog : m_nullLog ),
   m_firstPoll( true ),
   m_stop( true )
 {
@@ -103,34 +106,24 @@ Acceptor::~Acceptor()
 Session* Acceptor::getSession
 ( const std::string& msg, Responder& responder )
 {
-  Message message;
-  if ( !message.setStringHeader( msg ) )
+  HeaderSniffer header( msg );
+  if ( !header.valid()
+       || header.msgType() != MsgType_Logon
+       || !header.senderCompID().found()
+       || !header.targetCompID().found() )
     return 0;
 
-  BeginString beginString;
-  SenderCompID clSenderCompID;
-  TargetCompID clTargetCompID;
-  MsgType msgType;
-  try
+  BeginString beginString( header.beginString().str() );
+  SenderCompID senderCompID( header.targetCompID().str() );
+  TargetCompID targetCompID( header.senderCompID().str() );
+  SessionID sessionID( beginString, senderCompID, targetCompID );
+
+  Sessions::iterator i = m_sessions.find( sessionID );
+  if ( i != m_sessions.end() )
   {
-    message.getHeader().getField( beginString );
-    message.getHeader().getField( clSenderCompID );
-    message.getHeader().getField( clTargetCompID );
-    message.getHeader().getField( msgType );
-    if ( msgType != "A" ) return 0;
-
-    SenderCompID senderCompID( clTargetCompID );
-    TargetCompID targetCompID( clSenderCompID );
-    SessionID sessionID( beginString, senderCompID, targetCompID );
-
-    Sessions::iterator i = m_sessions.find( sessionID );
-    if ( i != m_sessions.end() )
-    {
-      i->second->setResponder( &responder );
-      return i->second;
-    }
+    i->second->setResponder( &responder );
+    return i->second;
   }
-  catch ( FieldNotFound& ) {}
   return 0;
 }
 
@@ -56,10 +56,10 @@ public:
 
   virtual ~Acceptor();
 
+  /// Safe to call from any thread, writes are serialized.
   Log* getLog() 
   { 
-    if( m_pLog ) return m_pLog;
-    return &m_nullLog;
+    return &m_log;
   }
 
   /// Start acceptor.
@@ -118,6 +118,7 @@ private:
   LogFactory* m_pLogFactory;
   Log* m_pLog;
   NullLog m_nullLog;
+  SynchronizedLog m_log;
   bool m_firstPoll;
   bool m_stop;
 };
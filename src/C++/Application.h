@@ -28,6 +28,8 @@
 
 namespace FIX
 {
+class MessageEncoder;
+
 /**
  * This interface must be implemented to define what your %FIX application
  * does.
@@ -55,6 +57,12 @@ public:
   /// Notification of app message being sent to target
   virtual void toApp( Message&, const SessionID& )
   throw( DoNotSend ) = 0;
+  /// Notification of app message written by a generated encoder being sent.
+  /// Return true to send it as encoded.  The default returns false, so the
+  /// message is built into a Message and passed to toApp above, which costs
+  /// what sending a Message does; override this to opt in to the encoder path.
+  virtual bool toApp( MessageEncoder&, const SessionID& )
+  throw( DoNotSend ) { return false; }
   /// Notification of reset
   virtual void onReset( const SessionID& ) = 0;
   /// Notification of admin message being received from target
@@ -91,6 +99,9 @@ public:
   void toApp( Message& message, const SessionID& sessionID )
   throw( DoNotSend )
   { Locker l( m_mutex ); app().toApp( message, sessionID ); }
+  bool toApp( MessageEncoder& encoder, const SessionID& sessionID )
+  throw( DoNotSend )
+  { Locker l( m_mutex ); return app().toApp( encoder, sessionID ); }
   void onReset( const SessionID& sessionID )
   { Locker l( m_mutex ); app().onReset( sessionID ); }
   void fromAdmin( const Message& message, const SessionID& sessionID )
@@ -0,0 +1,225 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "ConnectScheduler.h"
+#include <algorithm>
+#include <stdlib.h>
+
+namespace FIX
+{
+ConnectScheduler::ConnectScheduler()
+: m_maxInterval( 0 ), m_jitter( 0 ), m_hostLimit( 0 ) {}
+
+void ConnectScheduler::add( const SessionID& sessionID, const std::string& host,
+                            int interval, time_t when )
+{
+  Entry& entry = m_entries[ sessionID ];
+  entry.host = host;
+  entry.interval = interval > 0 ? interval : 1;
+  entry.failures = 0;
+  entry.loggedOn = false;
+  entry.generation = 0;
+  schedule( m_entries.find( sessionID ), when );
+}
+
+bool ConnectScheduler::next( time_t now, SessionID& sessionID )
+{
+  while( !m_attempts.empty() && m_attempts.top().when <= now )
+  {
+    Attempt attempt = m_attempts.top();
+    m_attempts.pop();
+
+    Entry& entry = attempt.entry->second;
+    if( attempt.generation != entry.generation || entry.state != SCHEDULED )
+      continue;
+
+    // a full host queues the session until an attempt on it finishes
+    if( m_hostLimit > 0 && !entry.host.empty() )
+    {
+      Host& host = m_hosts[ entry.host ];
+      if( host.active >= m_hostLimit )
+      {
+        entry.state = WAITING;
+        host.waiting.push_back( std::make_pair( entry.generation, attempt.entry ) );
+        continue;
+      }
+    }
+
+    entry.state = DUE;
+    ++entry.generation;
+    sessionID = attempt.entry->first;
+    return true;
+  }
+  return false;
+}
+
+void ConnectScheduler::retry( const SessionID& sessionID, time_t now )
+{
+  Entries::iterator i = m_entries.find( sessionID );
+  if( i == m_entries.end() || i->second.state != DUE )
+    return;
+
+  schedule( i, now + i->second.interval );
+  // the host room it was given goes to the next in line
+  release( i->second, now, false );
+}
+
+void ConnectScheduler::wake( const SessionID& sessionID, time_t now )
+{
+  Entries::iterator i = m_entries.find( sessionID );
+  if( i == m_entries.end() || i->second.state != SCHEDULED || i->second.when <= now )
+    return;
+
+  schedule( i, now );
+}
+
+void ConnectScheduler::pending( const SessionID& sessionID, time_t now )
+{
+  Entries::iterator i = m_entries.find( sessionID );
+  if( i == m_entries.end() || i->second.state == PENDING )
+    return;
+
+  Entry& entry = i->second;
+  entry.state = PENDING;
+  ++entry.generation;
+  if( !entry.host.empty() )
+    ++m_hosts[ entry.host ].active;
+}
+
+void ConnectScheduler::connected( const SessionID& sessionID, time_t now )
+{
+  Entries::iterator i = m_entries.find( sessionID );
+  if( i == m_entries.end() )
+    return;
+
+  Entry& entry = i->second;
+  if( entry.state == PENDING )
+    release( entry, now, true );
+  entry.state = CONNECTED;
+  entry.loggedOn = false;
+  ++entry.generation;
+  m_awaitingLogon.insert( sessionID );
+}
+
+void ConnectScheduler::disconnected( const SessionID& sessionID, time_t now )
+{
+  Entries::iterator i = m_entries.find( sessionID );
+  if( i == m_entries.end() )
+    return;
+
+  Entry& entry = i->second;
+  if( entry.state == PENDING )
+  {
+    release( entry, now, true );
+    ++entry.failures;
+    schedule( i, now + delay( entry ) );
+  }
+  else if( entry.state == CONNECTED )
+  {
+    // dropped before logging on, the host is refusing us
+    if( !entry.loggedOn )
+      ++entry.failures;
+    m_awaitingLogon.erase( sessionID );
+    schedule( i, now + delay( entry ) );
+  }
+}
+
+void ConnectScheduler::loggedOn( const SessionID& sessionID )
+{
+  Entries::iterator i = m_entries.find( sessionID );
+  if( i == m_entries.end() || i->second.state != CONNECTED )
+    return;
+
+  i->second.loggedOn = true;
+  i->second.failures = 0;
+  m_awaitingLogon.erase( sessionID );
+}
+
+time_t ConnectScheduler::getNextAttempt( const SessionID& sessionID ) const
+{
+  Entries::const_iterator i = m_entries.find( sessionID );
+  if( i == m_entries.end() || i->second.state != SCHEDULED )
+    return 0;
+  return i->second.when;
+}
+
+int ConnectScheduler::getFailures( const SessionID& sessionID ) const
+{
+  Entries::const_iterator i = m_entries.find( sessionID );
+  return i == m_entries.end() ? 0 : i->second.failures;
+}
+
+void ConnectScheduler::schedule( Entries::iterator i, time_t when )
+{
+  Entry& entry = i->second;
+  entry.state = SCHEDULED;
+  entry.when = when;
+  ++entry.generation;
+
+  Attempt attempt;
+  attempt.when = when;
+  attempt.generation = entry.generation;
+  attempt.entry = i;
+  m_attempts.push( attempt );
+}
+
+void ConnectScheduler::release( Entry& entry, time_t now, bool active )
+{
+  if( entry.host.empty() )
+    return;
+
+  Hosts::iterator i = m_hosts.find( entry.host );
+  if( i == m_hosts.end() )
+    return;
+  Host& host = i->second;
+  if( active && host.active > 0 )
+    --host.active;
+
+  // next() checks the room again, so waking one too many is harmless
+  while( !host.waiting.empty() )
+  {
+    std::pair < unsigned, Entries::iterator > waiter = host.waiting.front();
+    host.waiting.pop_front();
+    const Entry& waiting = waiter.second->second;
+    if( waiter.first != waiting.generation || waiting.state != WAITING )
+      continue;
+    schedule( waiter.second, now );
+    break;
+  }
+}
+
+time_t ConnectScheduler::delay( const Entry& entry ) const
+{
+  const time_t limit = std::max( m_maxInterval, entry.interval );
+  time_t seconds = entry.interval;
+  for( int i = 0; i < entry.failures && seconds < limit; ++i )
+    seconds *= 2;
+  seconds = std::min( seconds, limit );
+
+  if( m_jitter > 0 )
+    seconds += rand() % ( m_jitter + 1 );
+  return seconds;
+}
+}
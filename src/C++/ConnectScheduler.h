@@ -0,0 +1,143 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_CONNECTSCHEDULER_H
+#define FIX_CONNECTSCHEDULER_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "SessionID.h"
+#include <deque>
+#include <map>
+#include <queue>
+#include <set>
+#include <string>
+#include <vector>
+#include <time.h>
+
+namespace FIX
+{
+/**
+ * Decides when each initiator session next tries to connect.
+ *
+ * Sessions waiting to connect sit in a priority queue ordered by the time
+ * of their next attempt, so a tick only looks at the sessions that are
+ * due.  Each failed attempt doubles the wait, up to a limit, and a random
+ * jitter spreads out sessions that dropped together.  Attempts count as
+ * failed until the session logs on, so a host that accepts connections
+ * but drops or rejects the logon is backed off as well.  A limit on the
+ * attempts in flight to one host holds back the rest of a burst until
+ * earlier attempts finish.
+ *
+ * Not thread safe, the Initiator serializes calls.
+ */
+class ConnectScheduler
+{
+public:
+  ConnectScheduler();
+
+  /// Longest wait between attempts once backing off, 0 never backs off.
+  void setMaxInterval( int seconds ) { m_maxInterval = seconds; }
+  /// Up to this many seconds are added at random to each wait.
+  void setJitter( int seconds ) { m_jitter = seconds; }
+  /// Attempts in flight to one host, 0 for no limit.
+  void setHostLimit( int limit ) { m_hostLimit = limit; }
+
+  /// Track a session connecting to host, due for its first attempt at when.
+  void add( const SessionID&, const std::string& host, int interval, time_t when );
+
+  /// Take the next session due by now whose host has room, false if none.
+  bool next( time_t now, SessionID& );
+  /// A session from next() that did not start connecting waits an interval.
+  void retry( const SessionID&, time_t now );
+  /// A session waiting for its next attempt is due at now instead.
+  void wake( const SessionID&, time_t now );
+
+  void pending( const SessionID&, time_t now );
+  void connected( const SessionID&, time_t now );
+  void disconnected( const SessionID&, time_t now );
+  /// A connected session logged on, its failures are forgotten.
+  void loggedOn( const SessionID& );
+
+  /// Connected sessions that have not been reported as logged on.
+  const std::set < SessionID >& getAwaitingLogon() const
+  { return m_awaitingLogon; }
+
+  /// When the session is next due, 0 unless it is waiting for an attempt.
+  time_t getNextAttempt( const SessionID& ) const;
+  /// Attempts that failed since the session last logged on.
+  int getFailures( const SessionID& ) const;
+
+private:
+  enum State { SCHEDULED, WAITING, DUE, PENDING, CONNECTED };
+
+  struct Entry
+  {
+    std::string host;
+    int interval;
+    int failures;
+    bool loggedOn;
+    State state;
+    time_t when;
+    /// changes whenever queued references to the entry become stale
+    unsigned generation;
+  };
+
+  typedef std::map < SessionID, Entry > Entries;
+
+  struct Attempt
+  {
+    time_t when;
+    unsigned generation;
+    Entries::iterator entry;
+
+    bool operator<( const Attempt& rhs ) const
+    { return when > rhs.when; }
+  };
+
+  struct Host
+  {
+    Host() : active( 0 ) {}
+    int active;
+    std::deque < std::pair < unsigned, Entries::iterator > > waiting;
+  };
+
+  typedef std::priority_queue < Attempt > Attempts;
+  typedef std::map < std::string, Host > Hosts;
+
+  void schedule( Entries::iterator, time_t when );
+  /// Free a host slot, if the entry held one, and wake a waiting session.
+  void release( Entry&, time_t now, bool active );
+  time_t delay( const Entry& ) const;
+
+  Entries m_entries;
+  Attempts m_attempts;
+  Hosts m_hosts;
+  std::set < SessionID > m_awaitingLogon;
+  int m_maxInterval;
+  int m_jitter;
+  int m_hostLimit;
+};
+}
+
+#endif //FIX_CONNECTSCHEDULER_H
@@ -27,6 +27,7 @@
 #include "Message.h"
 #include <fstream>
 #include <memory>
+#include <algorithm>
 
 #include "PUGIXML_DOMDocument.h"
 
@@ -105,6 +106,7 @@ DataDictionary& DataDictionary::operator=( const DataDictionary& rhs )
       addGroup( iter->first, i->first, iter->second.first, *iter->second.second );
   }
   }
+  compileAdminLayouts();
   return *this;
 }
 
@@ -112,11 +114,14 @@ void DataDictionary::validate( int direction,
                                const Message& message,
                                const DataDictionary* const pSessionDD,
                                const DataDictionary* const pAppDD,
-                               const ValidationRules* vrptr )
+                               const ValidationRules* vrptr,
+                               bool lazily )
 throw( FIX::Exception )
 {  
   if ( !ValidationRules::shouldValidate(vrptr) ) 
     return;
+  if ( pSessionDD != 0 && pSessionDD == pAppDD && pSessionDD->isValidAdmin( message ) )
+    return;
   const Header& header = message.getHeader();
   const BeginString& beginString = FIELD_GET_REF( header, BeginString );
   const MsgType& msgType = FIELD_GET_REF( header, MsgType );
@@ -147,11 +152,153 @@ throw( FIX::Exception )
 
   if( pAppDD != 0 )
   {
-    pAppDD->iterate( direction, message, msgType, vrptr );
+    // header and trailer are always checked in full since the session
+    // layer reads them, lazy validation only defers body field checks
+    const bool checkFormat = !lazily && !ValidationRules::shouldValidateLazily(vrptr);
+    pAppDD->iterate( direction, message, msgType, vrptr, checkFormat );
+
+    // typed getters check formats themselves, values are checked by the
+    // message when a field is first read
+    message.m_pDeferredDD = !checkFormat && pAppDD->m_hasVersion ? pAppDD : 0;
+    message.m_pDeferredRules = vrptr;
+    message.m_deferredDirection = direction;
   }
 }
 
-void DataDictionary::iterate( int direction, const FieldMap& map, const MsgType& msgType, const ValidationRules* vrptr ) const
+void DataDictionary::compileAdminLayouts()
+{
+  static const char* const adminMsgTypes[] =
+    { MsgType_Heartbeat, MsgType_TestRequest, MsgType_ResendRequest,
+      MsgType_SequenceReset, MsgType_Logout, MsgType_Logon };
+
+  m_adminLayouts.clear();
+  if ( !m_hasVersion )
+    return;
+
+  for ( size_t i = 0; i < sizeof(adminMsgTypes) / sizeof(adminMsgTypes[0]); ++i )
+  {
+    const std::string msgType = adminMsgTypes[ i ];
+    if ( !isMsgType( msgType ) )
+      continue;
+
+    AdminLayout layout;
+    layout.msgType = msgType;
+    layout.required = 0;
+
+    NonBodyFields::const_iterator j;
+    for ( j = m_headerFields.begin(); j != m_headerFields.end(); ++j )
+    {
+      addAdminFields( layout.header, j->first, j->second );
+      layout.required += j->second;
+    }
+    for ( j = m_trailerFields.begin(); j != m_trailerFields.end(); ++j )
+    {
+      addAdminFields( layout.trailer, j->first, j->second );
+      layout.required += j->second;
+    }
+
+    MsgTypeToField::const_iterator fields = m_messageFields.find( msgType );
+    if ( fields != m_messageFields.end() )
+    {
+      MsgFields::const_iterator k;
+      for ( k = fields->second.begin(); k != fields->second.end(); ++k )
+      {
+        if ( !isGroup( msgType, *k ) )
+          addAdminFields( layout.body, *k, isRequiredField( msgType, *k ) );
+      }
+    }
+    MsgTypeToField::const_iterator required = m_requiredFields.find( msgType );
+    if ( required != m_requiredFields.end() )
+      layout.required += (int)required->second.size();
+
+    m_adminLayouts.push_back( layout );
+  }
+}
+
+void DataDictionary::addAdminFields( AdminFields& fields, int tag, bool required ) const
+{
+  // fields the generic checks treat specially are left out, so that a
+  // message carrying one always takes the full validation path
+  if ( !isField( tag ) )
+    return;
+
+  AdminField field;
+  field.tag = tag;
+  field.type = TYPE::Unknown;
+  getFieldType( tag, field.type );
+  field.required = required;
+  field.values = 0;
+
+  FieldToValue::const_iterator values = m_fieldValues.find( tag );
+  if ( values != m_fieldValues.end() )
+  {
+    if ( isMultipleValueField( tag ) )
+      return;
+    field.values = &values->second;
+  }
+
+  fields.insert( std::lower_bound( fields.begin(), fields.end(), tag ), field );
+}
+
+bool DataDictionary::isValidAdmin( const Message& message ) const
+{
+  if ( m_adminLayouts.empty() )
+    return false;
+
+  const Header& header = message.getHeader();
+  if ( !header.isSetField( FIELD::MsgType ) || !header.isSetField( FIELD::BeginString ) )
+    return false;
+
+  const std::string& msgType = header.getFieldRef( FIELD::MsgType ).getString();
+  AdminLayouts::const_iterator layout = m_adminLayouts.begin();
+  while ( layout != m_adminLayouts.end() && layout->msgType != msgType )
+    ++layout;
+  if ( layout == m_adminLayouts.end() )
+    return false;
+
+  if ( header.getFieldRef( FIELD::BeginString ).getString() != m_beginString.getString() )
+    return false;
+
+  int tag = 0;
+  if ( !message.hasValidStructure( tag ) )
+    return false;
+
+  int required = 0;
+  return matchesAdminFields( header, layout->header, required )
+    && matchesAdminFields( message, layout->body, required )
+    && matchesAdminFields( message.getTrailer(), layout->trailer, required )
+    && required == layout->required;
+}
+
+bool DataDictionary::matchesAdminFields( const FieldMap& map, const AdminFields& fields, int& required )
+{
+  if ( map.g_begin() != map.g_end() )
+    return false;
+
+  int lastField = 0;
+  FieldMap::iterator i;
+  for ( i = map.begin(); i != map.end(); ++i )
+  {
+    const FieldBase& field = i->second;
+    const std::string& value = field.getString();
+    if ( field.getTag() == lastField || value.empty() )
+      return false;
+    lastField = field.getTag();
+
+    AdminFields::const_iterator entry =
+      std::lower_bound( fields.begin(), fields.end(), lastField );
+    if ( entry == fields.end() || entry->tag != lastField )
+      return false;
+    if ( !isValidFormat( entry->type, value ) )
+      return false;
+    if ( entry->values && entry->values->find( value ) == entry->values->end() )
+      return false;
+    required += entry->required;
+  }
+  return true;
+}
+
+void DataDictionary::iterate( int direction, const FieldMap& map, const MsgType& msgType, const ValidationRules* vrptr, bool checkFormat ) const
 {
   if ( !ValidationRules::shouldValidate(vrptr) ) 
     return;
@@ -165,7 +312,7 @@ void DataDictionary::iterate( int direction, const FieldMap& map, const MsgType&
       throw RepeatedTag( lastField );
     checkHasValue( direction, msgType, field, vrptr );
 
-    if ( m_hasVersion )
+    if ( m_hasVersion && checkFormat )
     {
       checkValidFormat( direction, msgType, field, vrptr );
       checkValue( direction, msgType, field, vrptr );
@@ -419,6 +566,8 @@ throw( ConfigError )
     }
     RESET_AUTO_PTR(pMessageNode, pMessageNode->getNextSiblingNode());
   }
+
+  compileAdminLayouts();
 }
 
 message_order const& DataDictionary::getOrderedFields() const
@@ -797,80 +946,89 @@ throw( RequiredTagMissing )
 
 void DataDictionary::checkValidFormat( int direction, const std::string& msgType, const FieldBase& field, const ValidationRules* vrptr ) const
   throw( IncorrectDataFormat )
+{
+  TYPE::Type type = TYPE::Unknown;
+  getFieldType( field.getTag(), type );
+  if ( !isValidFormat( type, field.getString() ) )
+  {
+    if( !ValidationRules::shouldTolerateBadFormatTag( vrptr, direction, msgType, field.getTag() ) )
+      throw IncorrectDataFormat( field.getTag(), field.getTagAsString() );
+  }
+}
+
+bool DataDictionary::isValidFormat( TYPE::Type type, const std::string& value )
 {
   try
   {
-    TYPE::Type type = TYPE::Unknown;
-    getFieldType( field.getTag(), type );
     switch ( type )
     {
     case TYPE::String:
-      STRING_CONVERTOR::convert( field.getString() ); break;
+      STRING_CONVERTOR::convert( value ); break;
     case TYPE::Char:
-      CHAR_CONVERTOR::convert( field.getString() ); break;
+      CHAR_CONVERTOR::convert( value ); break;
     case TYPE::Price:
-      PRICE_CONVERTOR::convert( field.getString() ); break;
+      PRICE_CONVERTOR::convert( value ); break;
     case TYPE::Int:
-      INT_CONVERTOR::convert( field.getString() ); break;
+      INT_CONVERTOR::convert( value ); break;
     case TYPE::Amt:
-      AMT_CONVERTOR::convert( field.getString() ); break;
+      AMT_CONVERTOR::convert( value ); break;
     case TYPE::Qty:
-      QTY_CONVERTOR::convert( field.getString() ); break;
+      QTY_CONVERTOR::convert( value ); break;
     case TYPE::Currency:
-      CURRENCY_CONVERTOR::convert( field.getString() ); break;
+      CURRENCY_CONVERTOR::convert( value ); break;
     case TYPE::MultipleValueString:
-      MULTIPLEVALUESTRING_CONVERTOR::convert( field.getString() ); break;
+      MULTIPLEVALUESTRING_CONVERTOR::convert( value ); break;
     case TYPE::MultipleStringValue:
-      MULTIPLESTRINGVALUE_CONVERTOR::convert( field.getString() ); break;
+      MULTIPLESTRINGVALUE_CONVERTOR::convert( value ); break;
     case TYPE::MultipleCharValue:
-      MULTIPLECHARVALUE_CONVERTOR::convert( field.getString() ); break;
+      MULTIPLECHARVALUE_CONVERTOR::convert( value ); break;
     case TYPE::Exchange:
-      EXCHANGE_CONVERTOR::convert( field.getString() ); break;
+      EXCHANGE_CONVERTOR::convert( value ); break;
     case TYPE::UtcTimeStamp:
-      UTCTIMESTAMP_CONVERTOR::convert( field.getString() ); break;
+      UTCTIMESTAMP_CONVERTOR::convert( value ); break;
     case TYPE::Boolean:
-      BOOLEAN_CONVERTOR::convert( field.getString() ); break;
+      BOOLEAN_CONVERTOR::convert( value ); break;
     case TYPE::LocalMktDate:
-      LOCALMKTDATE_CONVERTOR::convert( field.getString() ); break;
+      LOCALMKTDATE_CONVERTOR::convert( value ); break;
     case TYPE::Data:
-      DATA_CONVERTOR::convert( field.getString() ); break;
+      DATA_CONVERTOR::convert( value ); break;
     case TYPE::Float:
-      FLOAT_CONVERTOR::convert( field.getString() ); break;
+      FLOAT_CONVERTOR::convert( value ); break;
     case TYPE::PriceOffset:
-      PRICEOFFSET_CONVERTOR::convert( field.getString() ); break;
+      PRICEOFFSET_CONVERTOR::convert( value ); break;
     case TYPE::MonthYear:
-      MONTHYEAR_CONVERTOR::convert( field.getString() ); break;
+      MONTHYEAR_CONVERTOR::convert( value ); break;
     case TYPE::DayOfMonth:
-      DAYOFMONTH_CONVERTOR::convert( field.getString() ); break;
+      DAYOFMONTH_CONVERTOR::convert( value ); break;
     case TYPE::UtcDate:
-      UTCDATE_CONVERTOR::convert( field.getString() ); break;
+      UTCDATE_CONVERTOR::convert( value ); break;
     case TYPE::UtcTimeOnly:
-      UTCTIMEONLY_CONVERTOR::convert( field.getString() ); break;
+      UTCTIMEONLY_CONVERTOR::convert( value ); break;
     case TYPE::NumInGroup:
-      NUMINGROUP_CONVERTOR::convert( field.getString() ); break;
+      NUMINGROUP_CONVERTOR::convert( value ); break;
     case TYPE::Percentage:
-      PERCENTAGE_CONVERTOR::convert( field.getString() ); break;
+      PERCENTAGE_CONVERTOR::convert( value ); break;
     case TYPE::SeqNum:
-      SEQNUM_CONVERTOR::convert( field.getString() ); break;
+      SEQNUM_CONVERTOR::convert( value ); break;
     case TYPE::Length:
-      LENGTH_CONVERTOR::convert( field.getString() ); break;
+      LENGTH_CONVERTOR::convert( value ); break;
     case TYPE::Country:
-      COUNTRY_CONVERTOR::convert( field.getString() ); break;
+      COUNTRY_CONVERTOR::convert( value ); break;
     case TYPE::TzTimeOnly:
-      TZTIMEONLY_CONVERTOR::convert( field.getString() ); break;
+      TZTIMEONLY_CONVERTOR::convert( value ); break;
     case TYPE::TzTimeStamp:
-      TZTIMESTAMP_CONVERTOR::convert( field.getString() ); break;
+      TZTIMESTAMP_CONVERTOR::convert( value ); break;
     case TYPE::XmlData:
-      XMLDATA_CONVERTOR::convert( field.getString() ); break;
+      XMLDATA_CONVERTOR::convert( value ); break;
     case TYPE::Language:
-      LANGUAGE_CONVERTOR::convert( field.getString() ); break;
+      LANGUAGE_CONVERTOR::convert( value ); break;
     case TYPE::Unknown: break;
     }
   }
   catch ( FieldConvertError& )
-  { 
-    if( !ValidationRules::shouldTolerateBadFormatTag( vrptr, direction, msgType, field.getTag() ) )
-      throw IncorrectDataFormat( field.getTag(), field.getTagAsString() );
+  {
+    return false;
   }
+  return true;
 }
 }
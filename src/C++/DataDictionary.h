@@ -70,6 +70,30 @@ class DataDictionary
   typedef std::map < std::string, std::pair < int, DataDictionary* > > FieldPresenceMap;
   typedef std::map < int, FieldPresenceMap > FieldToGroup;
 
+  /// Dictionary entry for one field of a session level message.
+  struct AdminField
+  {
+    int tag;
+    TYPE::Type type;
+    bool required;
+    const Values* values;
+    bool operator<( int rhs ) const { return tag < rhs; }
+  };
+  typedef std::vector < AdminField > AdminFields;
+
+  /// Fields of a session level message flattened into sorted arrays, so
+  /// heartbeats and the rest of the admin traffic can be confirmed valid
+  /// without a map lookup per field.
+  struct AdminLayout
+  {
+    std::string msgType;
+    AdminFields header;
+    AdminFields body;
+    AdminFields trailer;
+    int required;
+  };
+  typedef std::vector < AdminLayout > AdminLayouts;
+
 public:
   DataDictionary();
   DataDictionary( const DataDictionary& copy );
@@ -229,6 +253,9 @@ public:
   {
     DataDictionary * pDD = new DataDictionary( dataDictionary );
     pDD->setVersion( getVersion() );
+    // build the field order now so a loaded dictionary is never written
+    // to again and can be shared between sessions on different threads
+    pDD->getOrderedFields();
 
     FieldPresenceMap& presenceMap = m_groups[ field ];
     presenceMap[ msg ] = std::make_pair( delim, pDD );
@@ -254,12 +281,13 @@ public:
           || i->second == TYPE::MultipleStringValue );
   }
 
-  /// Validate a message.
+  /// Validate a message, skipping body format and value checks if lazily is set.
   static void validate( int direction,
                         const Message& message,
                         const DataDictionary* const pSessionDD,
                         const DataDictionary* const pAppID,
-                        const ValidationRules* vrptr ) throw( FIX::Exception );
+                        const ValidationRules* vrptr,
+                        bool lazily = false ) throw( FIX::Exception );
 
   void validate( int direction, const Message& message, const ValidationRules* vrptr = 0 ) const throw ( FIX::Exception )
   { validate( direction, message, false, vrptr ); }
@@ -268,9 +296,24 @@ public:
 
   DataDictionary& operator=( const DataDictionary& rhs );
 
+  /// True if the message is an admin message passing every check without
+  /// any tolerance. False only means the full validation has to run.
+  bool isValidAdmin( const Message& message ) const;
+
+  /// Check a field holds one of the values listed for it, if any are.
+  void checkValue( int direction, const std::string& msgType, const FieldBase& field, const ValidationRules* vrptr = 0 ) const
+  throw( IncorrectTagValue );
+
 private:
+  /// Build the admin layouts once the dictionary has been read.
+  void compileAdminLayouts();
+  void addAdminFields( AdminFields& fields, int tag, bool required ) const;
+  static bool matchesAdminFields( const FieldMap& map, const AdminFields& fields, int& required );
+  static bool isValidFormat( TYPE::Type type, const std::string& value );
+
   /// Iterate through fields while applying checks.
-  void iterate( int direction, const FieldMap& map, const MsgType& msgType, const ValidationRules* vrptr = 0 ) const;
+  /// Format and value checks are skipped when checkFormat is false.
+  void iterate( int direction, const FieldMap& map, const MsgType& msgType, const ValidationRules* vrptr = 0, bool checkFormat = true ) const;
 
   /// Check if message type is defined in spec.
   void checkMsgType( int direction, const MsgType& msgType, const ValidationRules* vrptr ) const
@@ -291,9 +334,6 @@ private:
   void checkValidFormat( int direction, const std::string& msgType, const FieldBase& field, const ValidationRules* vrptr = 0 ) const
   throw( IncorrectDataFormat );
 
-  void checkValue( int direction, const std::string& msgType, const FieldBase& field, const ValidationRules* vrptr = 0 ) const
-  throw( IncorrectTagValue );
-
   /// Check if a field has a value.
   void checkHasValue( int direction, const std::string& msgType, const FieldBase& field, const ValidationRules* vrptr = 0 ) const
   throw( NoTagValue );
@@ -340,6 +380,7 @@ private:
   ValueToName m_valueNames;
   FieldToGroup m_groups;
   MsgFields m_dataFields;
+  AdminLayouts m_adminLayouts;
 };
 }
 
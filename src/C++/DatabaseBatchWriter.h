@@ -0,0 +1,195 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_DATABASEBATCHWRITER_H
+#define FIX_DATABASEBATCHWRITER_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "Utility.h"
+#include "Exceptions.h"
+#include "FieldTypes.h"
+#include "Event.h"
+#include "Mutex.h"
+#include <deque>
+#include <vector>
+#include <string>
+
+namespace FIX
+{
+/// A line waiting to be written to one of the database log tables.
+struct DatabaseLogRecord
+{
+  DatabaseLogRecord( const std::string& table, const std::string& text )
+  : table( table ), text( text ) {}
+
+  std::string table;
+  UtcTimeStamp time;
+  std::string text;
+};
+
+/// Receives batches from a DatabaseBatchWriter on its writer thread.
+template < typename T > class DatabaseBatchSink
+{
+public:
+  virtual ~DatabaseBatchSink() {}
+  virtual void write( const std::vector < T > & ) = 0;
+};
+
+/**
+ * Queues records and writes them to a sink in batches from a background thread.
+ *
+ * A batch is handed to the sink once batchSize records are waiting or
+ * flushInterval milliseconds have passed, whichever comes first.  push()
+ * blocks while queueSize records are waiting, so a stalled database slows
+ * the caller down instead of growing the queue without bound.
+ */
+template < typename T > class DatabaseBatchWriter
+{
+public:
+  DatabaseBatchWriter( DatabaseBatchSink < T > & sink, int flushInterval,
+                       int batchSize, int queueSize )
+  throw ( RuntimeError )
+  : m_sink( sink ),
+    m_flushInterval( flushInterval > 0 ? flushInterval : 1 ),
+    m_batchSize( batchSize > 0 ? batchSize : 1 ),
+    m_queueSize( queueSize > (int)m_batchSize ? queueSize : m_batchSize ),
+    m_pushed( 0 ), m_written( 0 ), m_stopped( false )
+  {
+    if( !thread_spawn( &startThread, this, m_thread ) )
+      throw RuntimeError( "Unable to spawn database writer thread" );
+  }
+
+  /// Writes everything still queued before returning
+  ~DatabaseBatchWriter()
+  {
+    {
+      Locker locker( m_mutex );
+      m_stopped = true;
+    }
+    m_wakeup.signal();
+    thread_join( m_thread );
+  }
+
+  void push( const T& value )
+  {
+    Locker locker( m_mutex );
+    while( m_queue.size() >= m_queueSize )
+    {
+      ReverseLocker unlocker( m_mutex );
+      m_wakeup.signal();
+      m_drained.wait( WAIT_SECONDS );
+    }
+
+    m_queue.push_back( value );
+    ++m_pushed;
+    if( m_queue.size() == m_batchSize )
+      m_wakeup.signal();
+  }
+
+  /// Block until everything pushed so far has been written
+  void flush()
+  {
+    Locker locker( m_mutex );
+    unsigned long target = m_pushed;
+    while( m_written < target )
+    {
+      ReverseLocker unlocker( m_mutex );
+      m_wakeup.signal();
+      m_drained.wait( WAIT_SECONDS );
+    }
+  }
+
+  size_t size()
+  {
+    Locker locker( m_mutex );
+    return m_queue.size();
+  }
+
+private:
+  static THREAD_PROC startThread( void* p )
+  {
+    static_cast < DatabaseBatchWriter* > ( p )->run();
+    return 0;
+  }
+
+  void run()
+  {
+    std::vector < T > batch;
+    bool stopped = false;
+    while( !stopped )
+    {
+      if( idle() )
+        m_wakeup.wait( m_flushInterval / 1000.0 );
+
+      while( take( batch, stopped ) )
+      {
+        // a failed batch is dropped, like a failed insert on the
+        // synchronous path, rather than stalling every later record
+        try { m_sink.write( batch ); }
+        catch( std::exception& ) {}
+
+        Locker locker( m_mutex );
+        m_written += batch.size();
+      }
+      m_drained.signal();
+    }
+  }
+
+  bool idle()
+  {
+    Locker locker( m_mutex );
+    return !m_stopped && m_queue.size() < m_batchSize;
+  }
+
+  bool take( std::vector < T > & batch, bool& stopped )
+  {
+    Locker locker( m_mutex );
+    stopped = m_stopped;
+    size_t count = m_queue.size() < m_batchSize ? m_queue.size() : m_batchSize;
+    batch.assign( m_queue.begin(), m_queue.begin() + count );
+    m_queue.erase( m_queue.begin(), m_queue.begin() + count );
+    return count > 0;
+  }
+
+  static const double WAIT_SECONDS;
+
+  DatabaseBatchSink < T > & m_sink;
+  int m_flushInterval;
+  size_t m_batchSize;
+  size_t m_queueSize;
+  std::deque < T > m_queue;
+  unsigned long m_pushed;
+  unsigned long m_written;
+  bool m_stopped;
+  thread_id m_thread;
+  Mutex m_mutex;
+  Event m_wakeup;
+  Event m_drained;
+};
+
+template < typename T >
+const double DatabaseBatchWriter < T > ::WAIT_SECONDS = 0.01;
+}
+
+#endif //FIX_DATABASEBATCHWRITER_H
@@ -27,6 +27,7 @@
 
 #ifndef _MSC_VER
 #include <pthread.h>
+#include <time.h>
 #include <cmath>
 #endif
 
@@ -73,10 +74,13 @@ public:
     WaitForSingleObject( m_event, (long)(s * 1000) );
 #else
     pthread_mutex_lock( &m_mutex );
-    timespec time, remainder;
+    // pthread_cond_timedwait takes an absolute deadline, not a duration
+    timespec time;
     double intpart;
-    time.tv_nsec = (long)(modf(s, &intpart) * 1e9);
-    time.tv_sec = (int)intpart;
+    clock_gettime( CLOCK_REALTIME, &time );
+    time.tv_nsec += (long)(modf(s, &intpart) * 1e9);
+    time.tv_sec += (time_t)intpart + time.tv_nsec / 1000000000L;
+    time.tv_nsec %= 1000000000L;
     pthread_cond_timedwait( &m_event, &m_mutex, &time );
     pthread_mutex_unlock( &m_mutex );
 #endif
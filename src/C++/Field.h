@@ -44,57 +44,52 @@ namespace FIX
  */
 class FieldBase
 {
-
-  /// Class used to store field metrics like total length and checksum
-  class field_metrics
-  {
-  public:
-
-    field_metrics( const size_t length, const int checksum )
-      : m_length( length )
-      , m_checksum( checksum )
-    {}
-
-    size_t getLength() const
-    { return m_length; }
-
-    int getCheckSum() const
-    { return m_checksum; }
-
-    bool isValid() const
-    { return m_length > 0; }
-
-  private:
-
-    size_t m_length;
-    int m_checksum;
-  };
-
   friend class Message;
 
-  /// Constructor which also calculates field metrics
-  FieldBase( int tag, 
-             std::string::const_iterator valueStart, 
-             std::string::const_iterator valueEnd,
-             std::string::const_iterator tagStart, 
-             std::string::const_iterator tagEnd )
+  /// Constructor used when parsing, copying the value straight out of the message
+  FieldBase( int tag,
+             std::string::const_iterator valueStart,
+             std::string::const_iterator valueEnd )
     : m_tag( tag )
     , m_string( valueStart, valueEnd )
-    , m_metrics( calculateMetrics( tagStart, tagEnd ) )
   {}
 
 public:
   FieldBase( int tag, const std::string& string )
-    : m_tag( tag ), m_string(string), m_metrics( no_metrics() )
+    : m_tag( tag ), m_string(string)
+  {}
+
+  FieldBase( int tag, std::string&& string )
+    : m_tag( tag ), m_string( std::move( string ) )
+  {}
+
+  FieldBase( const FieldBase& copy )
+    : m_tag( copy.m_tag ), m_string( copy.m_string )
+  {}
+
+  FieldBase( FieldBase&& rhs ) NOEXCEPT
+    : m_tag( rhs.m_tag ), m_string( std::move( rhs.m_string ) )
   {}
 
   virtual ~FieldBase() {}
 
+  FieldBase& operator=( const FieldBase& rhs )
+  {
+    m_tag = rhs.m_tag;
+    m_string = rhs.m_string;
+    return *this;
+  }
+
+  FieldBase& operator=( FieldBase&& rhs ) NOEXCEPT
+  {
+    m_tag = rhs.m_tag;
+    m_string = std::move( rhs.m_string );
+    return *this;
+  }
+
   void setTag( int tag )
   {
     m_tag = tag;
-    m_metrics = no_metrics();
-    m_data.clear();
   }
 
   /// @deprecated Use setTag
@@ -106,8 +101,11 @@ public:
   void setString( const std::string& string )
   {
     m_string = string;
-    m_metrics = no_metrics();
-    m_data.clear();
+  }
+
+  void setString( std::string&& string )
+  {
+    m_string = std::move( string );
   }
 
   /// Get the fields integer tag.
@@ -126,26 +124,47 @@ public:
   { return m_string; }
 
   /// Get the string representation of the Field (i.e.) 55=MSFT[SOH]
-  const std::string& getFixString() const
+  std::string getFixString() const
   {
-    if( m_data.empty() )
-      encodeTo( m_data );
+    std::string result;
+    encodeTo( result );
+    return result;
+  }
 
-    return m_data;
+  /// Append the string representation of the Field to a buffer
+  std::string& encodeTo( std::string& result ) const
+  {
+    char tag[ std::numeric_limits<signed_int>::digits10 + 3 ];
+    const char* tagStart = integer_to_string( tag, sizeof( tag ), m_tag );
+
+    result.append( tagStart, tag + sizeof( tag ) - 1 - tagStart );
+    result += '=';
+    result.append( m_string );
+    result += '\001';
+    return result;
   }
 
   /// Get the length of the fields string representation
   size_t getLength() const
   {
-    calculate();
-    return m_metrics.getLength();
+    return number_of_symbols_in( m_tag ) + m_string.length() + 2;
   }
 
   /// Get the total value the fields characters added together
   int getTotal() const
   {
-    calculate();
-    return m_metrics.getCheckSum();
+    int checksum = '=' + '\001';
+    unsigned_int tag = UNSIGNED_VALUE_OF( m_tag );
+    do
+    {
+      checksum += '0' + tag % 10;
+      tag /= 10;
+    }
+    while( tag );
+
+    for ( std::string::const_iterator str = m_string.begin(); str != m_string.end(); ++str )
+      checksum += (unsigned char)( *str );
+    return checksum;
   }
 
   /// Compares fields based on their tag numbers
@@ -153,56 +172,8 @@ public:
   { return m_tag < field.m_tag; }
 
 private:
-
-  void calculate() const
-  {
-    if( m_metrics.isValid() ) return;
-
-    m_metrics = calculateMetrics( getFixString() );
-  }
-
-  /// Serializes string representation of the Field to input string
-  void encodeTo( std::string& result ) const
-  {
-    size_t tagLength = FIX::number_of_symbols_in( m_tag ) + 1;
-    size_t totalLength = tagLength + m_string.length() + 1;
-
-    result.resize( totalLength );
-
-    char * buf = (char*)result.c_str();
-    FIX::integer_to_string( buf, tagLength, m_tag );
-
-    buf[tagLength - 1] = '=';
-    memcpy( buf + tagLength, m_string.data(), m_string.length() );
-    buf[totalLength - 1] = '\001';
-  }
-
-  static field_metrics no_metrics()
-  {
-    return field_metrics( 0, 0 );
-  }
-
-  /// Calculate metrics for any input string
-  static field_metrics calculateMetrics( 
-    std::string::const_iterator const start,
-    std::string::const_iterator const end )
-  {
-    int checksum = 0;
-    for ( std::string::const_iterator str = start; str != end; ++str )
-      checksum += (unsigned char)( *str );
-
-    return field_metrics( std::distance( start, end ), checksum );
-  }
-
-  static field_metrics calculateMetrics( const std::string& field )
-  {
-    return calculateMetrics( field.begin(), field.end() );
-  }
-
   int m_tag;
   std::string m_string;
-  mutable std::string m_data;
-  mutable field_metrics m_metrics;
 };
 /*! @} */
 
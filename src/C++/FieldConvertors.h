@@ -161,10 +161,8 @@ struct IntConvertor
     return std::string( start, buffer + sizeof (buffer) - start - 1 );
   }
 
-  static bool convert(     
-    std::string::const_iterator str, 
-    std::string::const_iterator end, 
-    signed_int& result )
+  template< typename Iterator >
+  static bool convert( Iterator str, Iterator end, signed_int& result )
   {
     bool isNegative = false;
     signed_int x = 0;
@@ -401,6 +399,12 @@ public:
   static std::string convert( double value, int padding = 0 )
   {
     char result[32];
+    return std::string( result, convert( value, padding, result ) );
+  }
+
+  /// Format into a buffer of at least 32 characters, returning the length.
+  static size_t convert( double value, int padding, char* result )
+  {
     char *end = 0;
 
     int size;
@@ -457,12 +461,14 @@ public:
      }
    }
 
-   return std::string( result, size );
+   return size;
 }
 
-static bool convert( const std::string& value, double& result )
-{
-  const char * i = value.c_str();
+private:
+
+  static bool parse( const char* value, double& result )
+  {
+  const char * i = value;
 
   // Catch null strings
   if( !*i ) return false;
@@ -485,10 +491,29 @@ static bool convert( const std::string& value, double& result )
 
   if( *i || !haveDigit ) return false;
     
-  result = fast_atof( value.c_str() );
+  result = fast_atof( value );
   return true;
   }
 
+public:
+
+  static bool convert( const std::string& value, double& result )
+  {
+    return parse( value.c_str(), result );
+  }
+
+  /// Converts a value that is not null terminated, e.g. inside a raw message
+  static bool convert( const char* begin, const char* end, double& result )
+  {
+    char buffer[ 64 ];
+    const size_t size = end - begin;
+    if( size >= sizeof( buffer ) )
+      return parse( std::string( begin, end ).c_str(), result );
+    memcpy( buffer, begin, size );
+    buffer[ size ] = '\0';
+    return parse( buffer, result );
+  }
+
   static double convert( const std::string& value )
   throw( FieldConvertError )
   {
@@ -568,6 +593,14 @@ struct UtcTimeStampConvertor
   throw( FieldConvertError )
   {
     char result[ 18+4 ];
+    return std::string( result, convert( value, showMilliseconds, result ) );
+  }
+
+  /// Format into a buffer of at least 22 characters, returning the length.
+  static size_t convert( const UtcTimeStamp& value, bool showMilliseconds,
+                         char* result )
+  throw( FieldConvertError )
+  {
     int year, month, day, hour, minute, second, millis;
 
     value.getYMD( year, month, day );
@@ -593,7 +626,7 @@ struct UtcTimeStampConvertor
       }
     }
 
-    return result;
+    return showMilliseconds ? 21 : 17;
   }
 
   static UtcTimeStamp convert( const std::string& value,
@@ -37,9 +37,14 @@ FieldMap::~FieldMap()
 
 FieldMap& FieldMap::operator=( const FieldMap& rhs )
 {
+  if( this == &rhs )
+    return *this;
+
   clear();
 
   m_fields = rhs.m_fields;
+  m_length = rhs.m_length;
+  m_total = rhs.m_total;
 
   Groups::const_iterator i;
   for ( i = rhs.m_groups.begin(); i != rhs.m_groups.end(); ++i )
@@ -55,6 +60,22 @@ FieldMap& FieldMap::operator=( const FieldMap& rhs )
   return *this;
 }
 
+FieldMap& FieldMap::operator=( FieldMap&& rhs ) NOEXCEPT
+{
+  if( this == &rhs )
+    return *this;
+
+  clear();
+
+  m_fields = std::move( rhs.m_fields );
+  m_groups.swap( rhs.m_groups );
+  m_length = rhs.m_length;
+  m_total = rhs.m_total;
+  rhs.m_fields.clear();
+  rhs.m_length = -1;
+  return *this;
+}
+
 void FieldMap::addGroup( int field, const FieldMap& group, bool setCount )
 {
   FieldMap * pGroup = new FieldMap( group );
@@ -62,6 +83,13 @@ void FieldMap::addGroup( int field, const FieldMap& group, bool setCount )
   addGroupPtr( field, pGroup, setCount );
 }
 
+void FieldMap::addGroup( int field, FieldMap&& group, bool setCount )
+{
+  FieldMap * pGroup = new FieldMap( std::move( group ) );
+
+  addGroupPtr( field, pGroup, setCount );
+}
+
 void FieldMap::addGroupPtr( int field, FieldMap * group, bool setCount )
 {
     if( group == 0 )
@@ -118,7 +146,10 @@ void FieldMap::removeField( int field )
 {
   Fields::iterator i = m_fields.find( field );
   if ( i != m_fields.end() )
+  {
+    count( i->second, -1 );
     m_fields.erase( i );
+  }
 }
 
 bool FieldMap::hasGroup( int num, int field ) const
@@ -143,6 +174,8 @@ size_t FieldMap::groupCount( int field ) const
 void FieldMap::clear()
 {
   m_fields.clear();
+  m_length = -1;
+  m_total = 0;
 
   Groups::iterator i;
   for ( i = m_groups.begin(); i != m_groups.end(); ++i )
@@ -178,7 +211,7 @@ std::string& FieldMap::calculateString( std::string& result ) const
   Fields::const_iterator i;
   for ( i = m_fields.begin(); i != m_fields.end(); ++i )
   {
-    result += i->second.getFixString();
+    i->second.encodeTo( result );
 
     // add groups if they exist
     if( !m_groups.size() ) continue;
@@ -191,18 +224,35 @@ std::string& FieldMap::calculateString( std::string& result ) const
   return result;
 }
 
+void FieldMap::countFields() const
+{
+  if ( m_length >= 0 ) return;
+
+  m_length = 0;
+  m_total = 0;
+  Fields::const_iterator i;
+  for ( i = m_fields.begin(); i != m_fields.end(); ++i )
+  {
+    m_length += (int)i->second.getLength();
+    m_total += i->second.getTotal();
+  }
+}
+
 int FieldMap::calculateLength( int beginStringField,
                                int bodyLengthField,
                                int checkSumField ) const
 {
-  int result = 0;
-  Fields::const_iterator i;
-  for ( i = m_fields.begin(); i != m_fields.end(); ++i )
+  countFields();
+
+  // the totals cover every field, take back the ones BodyLength excludes
+  int result = m_length;
+  const int excluded[] = { beginStringField, bodyLengthField, checkSumField };
+  for ( int e = 0; e < 3; ++e )
   {
-    if ( i->first != beginStringField
-         && i->first != bodyLengthField
-         && i->first != checkSumField )
-    { result += i->second.getLength(); }
+    std::pair < Fields::const_iterator, Fields::const_iterator > range =
+      m_fields.equal_range( excluded[ e ] );
+    for ( Fields::const_iterator i = range.first; i != range.second; ++i )
+      result -= (int)i->second.getLength();
   }
 
   Groups::const_iterator j;
@@ -217,13 +267,13 @@ int FieldMap::calculateLength( int beginStringField,
 
 int FieldMap::calculateTotal( int checkSumField ) const
 {
-  int result = 0;
-  Fields::const_iterator i;
-  for ( i = m_fields.begin(); i != m_fields.end(); ++i )
-  {
-    if ( i->first != checkSumField )
-      result += i->second.getTotal();
-  }
+  countFields();
+
+  int result = m_total;
+  std::pair < Fields::const_iterator, Fields::const_iterator > range =
+    m_fields.equal_range( checkSumField );
+  for ( Fields::const_iterator i = range.first; i != range.second; ++i )
+    result -= i->second.getTotal();
 
   Groups::const_iterator j;
   for ( j = m_groups.begin(); j != m_groups.end(); ++j )
@@ -64,39 +64,77 @@ public:
 
   FieldMap( const message_order& order =
             message_order( message_order::normal ) )
-  : m_fields( order ) {}
+  : m_fields( order ), m_length( -1 ), m_total( 0 ) {}
 
   FieldMap( const int order[] )
-  : m_fields( message_order(order) ) {}
+  : m_fields( message_order(order) ), m_length( -1 ), m_total( 0 ) {}
 
   FieldMap( const FieldMap& copy )
+  : m_length( -1 ), m_total( 0 )
   { *this = copy; }
 
+  /// Take over the fields and groups, leaving the source empty
+  FieldMap( FieldMap&& rhs ) NOEXCEPT
+  : m_fields( std::move( rhs.m_fields ) ),
+    m_groups( std::move( rhs.m_groups ) ),
+    m_length( rhs.m_length ), m_total( rhs.m_total )
+  {
+    rhs.m_fields.clear();
+    rhs.m_groups.clear();
+    rhs.m_length = -1;
+  }
+
   virtual ~FieldMap();
 
   FieldMap& operator=( const FieldMap& rhs );
+  FieldMap& operator=( FieldMap&& rhs ) NOEXCEPT;
 
   /// Set a field without type checking
   void setField( const FieldBase& field, bool overwrite = true )
   throw( RepeatedTag )
   {
+      // hinted at the end, fields arriving in order are appended without a search
       if(!overwrite)
-          m_fields.insert( Fields::value_type( field.getTag(), field ) );
+          m_fields.insert( m_fields.end(), Fields::value_type( field.getTag(), field ) );
       else
       {
-          Fields::iterator i = m_fields.find( field.getTag() );
-          if( i == m_fields.end() )
-              m_fields.insert( Fields::value_type( field.getTag(), field ) );
+          Fields::iterator i = m_fields.lower_bound( field.getTag() );
+          if( i == m_fields.end() || i->first != field.getTag() )
+              m_fields.insert( i, Fields::value_type( field.getTag(), field ) );
           else
+          {
+              count( i->second, -1 );
               i->second = field;
+          }
+      }
+      count( field, 1 );
+  }
+  /// Set a field without type checking, taking over its value
+  void setField( FieldBase&& field, bool overwrite = true )
+  throw( RepeatedTag )
+  {
+      const int tag = field.getTag();
+      Fields::iterator i;
+      if(!overwrite)
+          i = m_fields.insert( m_fields.end(), Fields::value_type( tag, std::move( field ) ) );
+      else
+      {
+          i = m_fields.lower_bound( tag );
+          if( i == m_fields.end() || i->first != tag )
+              i = m_fields.insert( i, Fields::value_type( tag, std::move( field ) ) );
+          else
+          {
+              count( i->second, -1 );
+              i->second = std::move( field );
+          }
       }
+      count( i->second, 1 );
   }
   /// Set a field without a field class
   void setField( int tag, const std::string& value )
   throw( RepeatedTag, NoTagValue )
   {
-    FieldBase fieldBase( tag, value );
-    setField( fieldBase );
+    setField( FieldBase( tag, value ) );
   }
 
   /// Get a field if set
@@ -156,6 +194,17 @@ public:
 
   /// Add a group.
   void addGroup( int tag, const FieldMap& group, bool setCount = true );
+  /// Add a group, taking over its fields instead of copying them.
+  void addGroup( int tag, FieldMap&& group, bool setCount = true );
+
+  /// Construct a group in place and return it to be filled in.
+  template< typename GROUP >
+  GROUP& emplaceGroup( bool setCount = true )
+  {
+    GROUP* pGroup = new GROUP;
+    addGroupPtr( pGroup->field(), pGroup, setCount );
+    return *pGroup;
+  }
 
   /// Acquire ownership of Group object
   void addGroupPtr( int tag, FieldMap * group, bool setCount = true );
@@ -221,8 +270,21 @@ public:
   g_iterator g_end() const { return m_groups.end(); }
 
 private:
+  /// Keep the cached totals, once counted, in step with a field change
+  void count( const FieldBase& field, int sign )
+  {
+    if( m_length < 0 ) return;
+    m_length += sign * (int)field.getLength();
+    m_total += sign * field.getTotal();
+  }
+
+  void countFields() const;
+
   Fields m_fields;
   Groups m_groups;
+  /// Length and byte sum of the fields, not counted yet while negative
+  mutable int m_length;
+  mutable int m_total;
 };
 /*! @} */
 }
@@ -232,6 +294,8 @@ bool isSet( const FIELD& field ) const    \
 { return (MAP).isSetField(field); }       \
 void set( const FIELD& field )            \
 { (MAP).setField(field); }                \
+void set( FIELD&& field )                 \
+{ (MAP).setField(std::move(field)); }     \
 FIELD& get( FIELD& field ) const          \
 { return (FIELD&)(MAP).getField(field); } \
 bool getIfSet( FIELD& field ) const       \
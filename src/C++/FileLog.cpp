@@ -27,6 +27,24 @@
 
 namespace FIX
 {
+FileLogFactory::~FileLogFactory()
+{
+  IOExecutor::release( m_pExecutor );
+}
+
+IOExecutor* FileLogFactory::getExecutor( const Dictionary& settings )
+{
+  int threads = 0;
+  if( settings.has( FILE_IO_THREADS ) )
+    threads = settings.getInt( FILE_IO_THREADS );
+  if( threads <= 0 )
+    return 0;
+
+  if( !m_pExecutor )
+    m_pExecutor = IOExecutor::acquire( threads );
+  return m_pExecutor;
+}
+
 Log* FileLogFactory::create()
 {
   m_globalLogCount++;
@@ -44,7 +62,9 @@ Log* FileLogFactory::create()
     if( settings.has( FILE_LOG_BACKUP_PATH ) )
       backupPath = settings.getString( FILE_LOG_BACKUP_PATH );
 
-    return m_globalLog = new FileLog( path, backupPath );
+    FileLog* pLog = new FileLog( path, backupPath );
+    pLog->setExecutor( getExecutor( settings ) );
+    return m_globalLog = pLog;
   }
   catch( ConfigError& )
   {
@@ -68,7 +88,9 @@ Log* FileLogFactory::create( const SessionID& s )
   if( settings.has( FILE_LOG_BACKUP_PATH ) )
     backupPath = settings.getString( FILE_LOG_BACKUP_PATH );
 
-  return new FileLog( path, backupPath, s );
+  FileLog* pLog = new FileLog( path, backupPath, s );
+  pLog->setExecutor( getExecutor( settings ) );
+  return pLog;
 }
 
 void FileLogFactory::destroy( Log* pLog )
@@ -89,25 +111,25 @@ void FileLogFactory::destroy( Log* pLog )
 }
 
 FileLog::FileLog( const std::string& path )
-: m_millisecondsInTimeStamp( true )
+: m_millisecondsInTimeStamp( true ), m_batching( false ), m_pExecutor( 0 )
 {
   init( path, path, "GLOBAL" );
 }
 
 FileLog::FileLog( const std::string& path, const std::string& backupPath )
-: m_millisecondsInTimeStamp( true )
+: m_millisecondsInTimeStamp( true ), m_batching( false ), m_pExecutor( 0 )
 {
   init( path, backupPath, "GLOBAL" );
 }
 
 FileLog::FileLog( const std::string& path, const SessionID& s )
-: m_millisecondsInTimeStamp( true )
+: m_millisecondsInTimeStamp( true ), m_batching( false ), m_pExecutor( 0 )
 {
   init( path, path, generatePrefix(s) );
 }
 
 FileLog::FileLog( const std::string& path, const std::string& backupPath, const SessionID& s )
-: m_millisecondsInTimeStamp( true )
+: m_millisecondsInTimeStamp( true ), m_batching( false ), m_pExecutor( 0 )
 {
   init( path, backupPath, generatePrefix(s) );
 }
@@ -157,13 +179,61 @@ void FileLog::init( std::string path, std::string backupPath, const std::string&
 
 FileLog::~FileLog()
 {
+  if( m_pExecutor ) m_pExecutor->wait( *this );
   m_messages.close();
   m_rejects.close();
   m_event.close();
 }
 
+void FileLog::setExecutor( IOExecutor* pExecutor )
+{
+  if( m_pExecutor ) m_pExecutor->wait( *this );
+  m_pExecutor = pExecutor;
+}
+
+void FileLog::line( std::ofstream& stream, std::string& pending,
+                    const char* separator, const std::string& text )
+{
+  std::string time =
+    UtcTimeStampConvertor::convert( UtcTimeStamp(), m_millisecondsInTimeStamp );
+
+  if( !m_pExecutor )
+  {
+    stream << time << separator << text;
+    endLine( stream );
+    return;
+  }
+
+  {
+    Locker locker( m_pendingMutex );
+    pending.append( time ).append( separator ).append( text ) += '\n';
+  }
+  m_pExecutor->schedule( *this );
+}
+
+void FileLog::write()
+{
+  std::string messages;
+  std::string rejects;
+  std::string events;
+  {
+    Locker locker( m_pendingMutex );
+    messages.swap( m_pendingMessages );
+    rejects.swap( m_pendingRejects );
+    events.swap( m_pendingEvents );
+  }
+
+  if( messages.size() )
+    m_messages.write( messages.data(), messages.size() ).flush();
+  if( rejects.size() )
+    m_rejects.write( rejects.data(), rejects.size() ).flush();
+  if( events.size() )
+    m_event.write( events.data(), events.size() ).flush();
+}
+
 void FileLog::clear()
 {
+  if( m_pExecutor ) m_pExecutor->wait( *this );
   m_messages.close();
   m_rejects.close();
   m_event.close();
@@ -175,6 +245,7 @@ void FileLog::clear()
 
 void FileLog::backup()
 {
+  if( m_pExecutor ) m_pExecutor->wait( *this );
   m_messages.close();
   m_rejects.close();
   m_event.close();
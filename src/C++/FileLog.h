@@ -28,6 +28,7 @@
 
 #include "Log.h"
 #include "SessionSettings.h"
+#include "IOExecutor.h"
 #include <fstream>
 
 namespace FIX
@@ -41,11 +42,12 @@ class FileLogFactory : public LogFactory
 {
 public:
   FileLogFactory( const SessionSettings& settings )
-: m_settings( settings ), m_globalLog(0), m_globalLogCount(0) {};
+: m_settings( settings ), m_globalLog(0), m_globalLogCount(0), m_pExecutor(0) {};
   FileLogFactory( const std::string& path )
-: m_path( path ), m_backupPath( path ), m_globalLog(0), m_globalLogCount(0) {};
+: m_path( path ), m_backupPath( path ), m_globalLog(0), m_globalLogCount(0), m_pExecutor(0) {};
   FileLogFactory( const std::string& path, const std::string& backupPath )
-: m_path( path ), m_backupPath( backupPath ), m_globalLog(0), m_globalLogCount(0) {};
+: m_path( path ), m_backupPath( backupPath ), m_globalLog(0), m_globalLogCount(0), m_pExecutor(0) {};
+  ~FileLogFactory();
 
 public:
   Log* create();
@@ -53,11 +55,15 @@ public:
   void destroy( Log* log );
 
 private:
+  /// The shared executor when the settings ask for one, otherwise 0.
+  IOExecutor* getExecutor( const Dictionary& );
+
   std::string m_path;
   std::string m_backupPath;
   SessionSettings m_settings;
   Log* m_globalLog;
   int m_globalLogCount;
+  IOExecutor* m_pExecutor;
 };
 
 /**
@@ -66,8 +72,10 @@ private:
  * Two files are created by this implementation.  One for messages, 
  * and one for events.
  *
+ * Given an IOExecutor, lines are buffered and written by its threads
+ * instead of the caller's.
  */
-class FileLog : public Log
+class FileLog : public Log, private IOExecutor::Writer
 {
 public:
   FileLog( const std::string& path );
@@ -79,19 +87,29 @@ public:
   void clear();
   void backup();
 
+  /// Hand writes to an executor, or 0 to write on the caller's thread.
+  void setExecutor( IOExecutor* );
+
   void onIncoming( const std::string& value )
-  { m_messages << UtcTimeStampConvertor::convert(UtcTimeStamp(), m_millisecondsInTimeStamp) << " received: " << value << std::endl; }
+  { line( m_messages, m_pendingMessages, " received: ", value ); }
   void onOutgoing( const std::string& value )
-  { m_messages << UtcTimeStampConvertor::convert(UtcTimeStamp(), m_millisecondsInTimeStamp) << " sent: " << value << std::endl; }
+  { line( m_messages, m_pendingMessages, " sent: ", value ); }
   void onIncomingRejected( const std::string& value, const std::string& reason )
-  { m_rejects << UtcTimeStampConvertor::convert(UtcTimeStamp(), m_millisecondsInTimeStamp) << ": " << reason << " on incoming: " << value << std::endl; }
+  { line( m_rejects, m_pendingRejects, ": ", reason + " on incoming: " + value ); }
   void onOutgoingRejected( const std::string& value, const std::string& reason )
-  { m_rejects << UtcTimeStampConvertor::convert(UtcTimeStamp(), m_millisecondsInTimeStamp) << ": " << reason << " on outgoing: " << value << std::endl; }
+  { line( m_rejects, m_pendingRejects, ": ", reason + " on outgoing: " + value ); }
   void onEvent( const std::string& value )
+  { line( m_event, m_pendingEvents, " : ", value ); }
+
+  /// Lines handed to an executor are already written together.
+  void beginBatch() { if( !m_pExecutor ) m_batching = true; }
+  void endBatch()
   {
-    UtcTimeStamp now;
-    m_event << UtcTimeStampConvertor::convert( now, m_millisecondsInTimeStamp )
-            << " : " << value << std::endl;
+    if( m_pExecutor ) return;
+    m_batching = false;
+    m_messages.flush();
+    m_rejects.flush();
+    m_event.flush();
   }
 
   bool getMillisecondsInTimeStamp() const
@@ -100,6 +118,18 @@ public:
   { m_millisecondsInTimeStamp = value; }
 
 private:
+  /// Lines are flushed one at a time unless a batch is open.
+  void endLine( std::ofstream& stream )
+  {
+    stream << '\n';
+    if( !m_batching ) stream.flush();
+  }
+
+  /// Write or queue the time, a separator and text as one line.
+  void line( std::ofstream& stream, std::string& pending,
+             const char* separator, const std::string& text );
+  void write();
+
   std::string generatePrefix( const SessionID& sessionID );
   void init( std::string path, std::string backupPath, const std::string& prefix );
 
@@ -112,6 +142,13 @@ private:
   std::string m_fullPrefix;
   std::string m_fullBackupPrefix;
   bool m_millisecondsInTimeStamp;
+  bool m_batching;
+
+  IOExecutor* m_pExecutor;
+  std::string m_pendingMessages;
+  std::string m_pendingRejects;
+  std::string m_pendingEvents;
+  Mutex m_pendingMutex;
 };
 }
 
@@ -31,8 +31,78 @@
 
 namespace FIX
 {
+/**
+ * Reads a range of the body file through its own buffered handle.
+ *
+ * Messages are appended in sequence number order, so consecutive reads
+ * are contiguous and only need a seek when the index skips around.  Once
+ * the store is reset or refreshed the files it read may be gone, so it
+ * reads nothing more.
+ */
+class FileStoreCursor : public MessageStoreCursor
+{
+public:
+  FileStoreCursor( const FileStore& store, int begin, int end )
+  : m_store( store ), m_generation( store.m_generation ),
+    m_next( begin ), m_end( end ), m_position( -1 )
+  {
+    m_file = file_fopen( m_store.m_msgFileName.c_str(), "rb" );
+    if ( !m_file )
+      throw IOException( "Unable to open file " + m_store.m_msgFileName );
+    setvbuf( m_file, 0, _IOFBF, BUFFER_SIZE );
+  }
+
+  ~FileStoreCursor()
+  {
+    fclose( m_file );
+  }
+
+  bool next( std::string& msg ) throw ( IOException )
+  {
+    if ( m_next > m_end ) return false;
+    if ( m_generation != m_store.m_generation )
+    {
+      m_next = m_end + 1;
+      return false;
+    }
+    FileStore::NumToOffset::const_iterator find =
+      m_store.m_offsets.lower_bound( m_next );
+    if ( find == m_store.m_offsets.end() || find->first > m_end )
+    {
+      m_next = m_end + 1;
+      return false;
+    }
+
+    const FileStore::OffsetSize& offset = find->second;
+    if ( m_position != offset.first
+         && fseek( m_file, offset.first, SEEK_SET ) )
+      throw IOException( "Unable to seek in file " + m_store.m_msgFileName );
+
+    msg.resize( offset.second );
+    size_t result = offset.second
+      ? fread( &msg[ 0 ], sizeof( char ), offset.second, m_file ) : 0;
+    if ( ferror( m_file ) || result != (size_t)offset.second )
+      throw IOException( "Unable to read from file " + m_store.m_msgFileName );
+
+    m_position = offset.first + offset.second;
+    m_next = find->first + 1;
+    return true;
+  }
+
+private:
+  enum { BUFFER_SIZE = 64 * 1024 };
+
+  const FileStore& m_store;
+  unsigned m_generation;
+  FILE* m_file;
+  int m_next;
+  int m_end;
+  long m_position;
+};
+
 FileStore::FileStore( std::string path, const SessionID& s )
-: m_msgFile( 0 ), m_headerFile( 0 ), m_seqNumsFile( 0 ), m_sessionFile( 0 )
+: m_msgFile( 0 ), m_headerFile( 0 ), m_seqNumsFile( 0 ), m_sessionFile( 0 ),
+  m_generation( 0 )
 {
   file_mkdir( path.c_str() );
 
@@ -78,6 +148,7 @@ FileStore::~FileStore()
 
 void FileStore::open( bool deleteFile )
 {
+  ++m_generation;
   if ( m_msgFile ) fclose( m_msgFile );
   if ( m_headerFile ) fclose( m_headerFile );
   if ( m_seqNumsFile ) fclose( m_seqNumsFile );
@@ -220,6 +291,12 @@ throw ( IOException )
   }
 }
 
+MessageStoreCursor* FileStore::cursor( int begin, int end ) const
+throw ( IOException )
+{
+  return new FileStoreCursor( *this, begin, end );
+}
+
 int FileStore::getNextSenderMsgSeqNum() const throw ( IOException )
 {
   return m_cache.getNextSenderMsgSeqNum();
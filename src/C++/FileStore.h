@@ -86,6 +86,7 @@ public:
 
   bool set( int, const std::string& ) throw ( IOException );
   void get( int, int, std::vector < std::string > & ) const throw ( IOException );
+  MessageStoreCursor* cursor( int, int ) const throw ( IOException );
 
   int getNextSenderMsgSeqNum() const throw ( IOException );
   int getNextTargetMsgSeqNum() const throw ( IOException );
@@ -103,6 +104,7 @@ public:
 private:
   typedef std::pair < int, int > OffsetSize;
   typedef std::map < int, OffsetSize > NumToOffset;
+  friend class FileStoreCursor;
 
   void open( bool deleteFile );
   void populateCache();
@@ -124,6 +126,8 @@ private:
   FILE* m_headerFile;
   FILE* m_seqNumsFile;
   FILE* m_sessionFile;
+  /// bumped each time the files are reopened, cursors stop reading then
+  unsigned m_generation;
 };
 }
 
@@ -0,0 +1,105 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "FlyweightDecoder.h"
+#include "FieldConvertors.h"
+
+namespace FIX
+{
+void FieldCursor::next()
+throw( InvalidMessage )
+{
+  if( m_pos == m_end )
+  {
+    m_tag = 0;
+    return;
+  }
+
+  const char* equalSign = (const char*)memchr( m_pos, '=', m_end - m_pos );
+  if( !equalSign )
+    throw InvalidMessage("Equal sign not found in field");
+
+  int tag = 0;
+  if( !IntConvertor::convert( m_pos, equalSign, tag ) || tag <= 0 )
+    throw InvalidMessage("Invalid tag number");
+
+  const char* value = equalSign + 1;
+  const char* soh = 0;
+  if( tag == m_dataTag )
+  {
+    if( m_dataLength >= 0 && m_dataLength < m_end - value
+        && value[ m_dataLength ] == '\001' )
+      soh = value + m_dataLength;
+    m_dataTag = 0;
+  }
+  else
+  {
+    soh = (const char*)memchr( value, '\001', m_end - value );
+  }
+  if( !soh )
+    throw InvalidMessage("SOH not found at end of field");
+
+  m_tag = tag;
+  m_value.data = value;
+  m_value.size = soh - value;
+  m_pos = soh + 1;
+}
+
+int FieldCursor::getInt() const
+throw( IncorrectDataFormat )
+{
+  int result = 0;
+  if( !IntConvertor::convert( m_value.data, m_value.data + m_value.size, result ) )
+    throw IncorrectDataFormat( m_tag, m_value.str() );
+  return result;
+}
+
+double FieldCursor::getDouble() const
+throw( IncorrectDataFormat )
+{
+  double result = 0;
+  if( !DoubleConvertor::convert( m_value.data, m_value.data + m_value.size, result ) )
+    throw IncorrectDataFormat( m_tag, m_value.str() );
+  return result;
+}
+
+char FieldCursor::getChar() const
+throw( IncorrectDataFormat )
+{
+  if( m_value.size != 1 )
+    throw IncorrectDataFormat( m_tag, m_value.str() );
+  return m_value.data[ 0 ];
+}
+
+bool FieldCursor::getBool() const
+throw( IncorrectDataFormat )
+{
+  if( m_value == "Y" )
+    return true;
+  if( m_value == "N" )
+    return false;
+  throw IncorrectDataFormat( m_tag, m_value.str() );
+}
+}
@@ -0,0 +1,156 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_FLYWEIGHTDECODER_H
+#define FIX_FLYWEIGHTDECODER_H
+
+#ifdef _MSC_VER
+#pragma warning( disable: 4786 )
+#endif
+
+#include "Exceptions.h"
+#include <string>
+#include <vector>
+#include <bitset>
+#include <cstring>
+
+namespace FIX
+{
+/// View of a field value inside a decoded buffer.
+struct FieldView
+{
+  FieldView() : data( 0 ), size( 0 ) {}
+
+  std::string str() const
+  { return std::string( data, size ); }
+
+  bool operator==( const char* value ) const
+  { return strlen( value ) == size && memcmp( data, value, size ) == 0; }
+  bool operator!=( const char* value ) const
+  { return !( *this == value ); }
+
+  const char* data;
+  size_t size;
+};
+
+/**
+ * Walks the fields of a raw %FIX message one at a time.
+ *
+ * Used by the flyweight decoders generated from the data dictionaries.
+ * Nothing is copied; values point into the caller's buffer.
+ */
+class FieldCursor
+{
+public:
+  FieldCursor( const char* begin, const char* end )
+  throw( InvalidMessage )
+  : m_pos( begin ), m_end( end ), m_tag( 0 ), m_dataTag( 0 ), m_dataLength( 0 )
+  { next(); }
+
+  /// False once every field has been read.
+  bool valid() const { return m_tag != 0; }
+  int tag() const { return m_tag; }
+  const FieldView& value() const { return m_value; }
+
+  /// Move to the next field.
+  void next() throw( InvalidMessage );
+  /// Read the value of the given data field using the length just decoded.
+  void setDataLength( int tag, int length )
+  { m_dataTag = tag; m_dataLength = length; }
+
+  int getInt() const throw( IncorrectDataFormat );
+  double getDouble() const throw( IncorrectDataFormat );
+  char getChar() const throw( IncorrectDataFormat );
+  bool getBool() const throw( IncorrectDataFormat );
+
+private:
+  const char* m_pos;
+  const char* m_end;
+  int m_tag;
+  FieldView m_value;
+  int m_dataTag;
+  int m_dataLength;
+};
+
+/**
+ * Repeating group entries stored in place.
+ *
+ * The first N entries live inside the object, the rest spill into a
+ * vector.  Entries are recycled between decodes so a decoder that is
+ * reused stops allocating once it has seen its largest message.
+ */
+template< typename T, size_t N >
+class InlineVector
+{
+public:
+  InlineVector() : m_size( 0 ) {}
+
+  size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+  void clear() { m_size = 0; }
+
+  const T& operator[]( size_t index ) const
+  { return index < N ? m_inline[ index ] : m_overflow[ index - N ]; }
+
+  /// Append a cleared entry and return it.
+  T& push_back()
+  {
+    T* pEntry = 0;
+    if( m_size < N )
+      pEntry = &m_inline[ m_size ];
+    else
+    {
+      if( m_size - N == m_overflow.size() )
+        m_overflow.push_back( T() );
+      pEntry = &m_overflow[ m_size - N ];
+    }
+    ++m_size;
+    pEntry->clear();
+    return *pEntry;
+  }
+
+private:
+  T m_inline[ N ];
+  std::vector< T > m_overflow;
+  size_t m_size;
+};
+
+/**
+ * Decode the entries of a group starting at its NumInGroup field.
+ *
+ * Exactly the announced number of entries is read; fewer (an unknown
+ * field ending the group early) or more is a RepeatingGroupCountMismatch.
+ */
+template< typename T, size_t N >
+inline void decodeGroups( FieldCursor& cursor, InlineVector< T, N >& groups,
+                          int field, int delim )
+{
+  const int count = cursor.getInt();
+  cursor.next();
+  for( int i = 0; i < count && cursor.valid() && cursor.tag() == delim; ++i )
+    groups.push_back().decode( cursor );
+  if( count < 0 || groups.size() != static_cast< size_t >( count )
+      || ( cursor.valid() && cursor.tag() == delim ) )
+    throw RepeatingGroupCountMismatch( field );
+}
+}
+
+#endif //FIX_FLYWEIGHTDECODER_H
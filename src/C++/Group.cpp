@@ -32,6 +32,11 @@ void Group::addGroup( const Group& group )
   FieldMap::addGroup( group.field(), group );
 }
 
+void Group::addGroup( Group&& group )
+{
+  FieldMap::addGroup( group.field(), std::move( group ) );
+}
+
 void Group::replaceGroup( unsigned num, const FIX::Group& group )
 {
   FieldMap::replaceGroup( num, group.field(), group ); 
@@ -53,10 +53,30 @@ public:
   Group( const Group& copy )
   : FieldMap( copy ), m_field( copy.m_field ), m_delim( copy.m_delim ) {}
 
+  Group( Group&& rhs ) NOEXCEPT
+  : FieldMap( std::move( rhs ) ), m_field( rhs.m_field ), m_delim( rhs.m_delim ) {}
+
+  Group& operator=( const Group& rhs )
+  {
+    FieldMap::operator=( rhs );
+    m_field = rhs.m_field;
+    m_delim = rhs.m_delim;
+    return *this;
+  }
+
+  Group& operator=( Group&& rhs ) NOEXCEPT
+  {
+    FieldMap::operator=( std::move( rhs ) );
+    m_field = rhs.m_field;
+    m_delim = rhs.m_delim;
+    return *this;
+  }
+
   int field() const { return m_field; }
   int delim() const { return m_delim; }
 
   void addGroup( const Group& group );
+  void addGroup( Group&& group );
   void replaceGroup( unsigned num, const Group& group );
   Group& getGroup( unsigned num, Group& group ) const throw( FieldNotFound );
   void removeGroup( unsigned num, const Group& group );
@@ -0,0 +1,119 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "HeaderSniffer.h"
+#include "Message.h"
+
+namespace FIX
+{
+bool HeaderSniffer::Value::getInt( int& result ) const
+{
+  if( !found() || size == 0 || size > 9 )
+    return false;
+
+  int value = 0;
+  for( const char* p = data; p != data + size; ++p )
+  {
+    if( *p < '0' || *p > '9' )
+      return false;
+    value = value * 10 + ( *p - '0' );
+  }
+  result = value;
+  return true;
+}
+
+bool HeaderSniffer::isAdmin() const
+{
+  const Value& type = msgType();
+  return type.size == 1 && strchr( "0A12345", type.data[ 0 ] ) != 0;
+}
+
+int HeaderSniffer::slot( int tag )
+{
+  switch( tag )
+  {
+  case FIELD::BeginString: return BEGIN_STRING;
+  case FIELD::BodyLength: return BODY_LENGTH;
+  case FIELD::MsgType: return MSG_TYPE;
+  case FIELD::MsgSeqNum: return MSG_SEQ_NUM;
+  case FIELD::SenderCompID: return SENDER_COMP_ID;
+  case FIELD::TargetCompID: return TARGET_COMP_ID;
+  case FIELD::PossDupFlag: return POSS_DUP_FLAG;
+  case FIELD::ApplVerID: return APPL_VER_ID;
+  default: return SLOTS;
+  }
+}
+
+void HeaderSniffer::sniff( const char* message, size_t size )
+{
+  static const int headerOrder[] =
+    { FIELD::BeginString, FIELD::BodyLength, FIELD::MsgType };
+
+  m_valid = false;
+  const char* pos = message;
+  const char* end = message + size;
+  int count = 0;
+  int remaining = SLOTS;
+
+  while( pos < end && remaining )
+  {
+    // tags are short, so parse them inline rather than searching for '=';
+    // nine digits always fit in an int, anything longer is not a tag
+    int tag = 0;
+    const char* equals = pos;
+    const char* last = end - pos > 9 ? pos + 9 : end;
+    while( equals < last && *equals >= '0' && *equals <= '9' )
+      tag = tag * 10 + ( *equals++ - '0' );
+    if( equals == pos || equals == end || *equals != '=' || tag == 0 )
+      return;
+
+    // values can be long, memchr lets the C library scan them a word at a time
+    const char* value = equals + 1;
+    const char* soh = static_cast<const char*>
+      ( memchr( value, '\001', end - value ) );
+    if( !soh )
+      return;
+
+    if( !Message::isHeaderField( tag ) )
+      return;
+    if( count < 3 )
+    {
+      // out of order messages are still scanned so the type can be reported
+      count = tag == headerOrder[ count ] ? count + 1 : 4;
+      m_valid = count == 3;
+    }
+
+    int index = slot( tag );
+    if( index != SLOTS && !m_values[ index ].found() )
+    {
+      m_values[ index ].data = value;
+      m_values[ index ].size = soh - value;
+      --remaining;
+    }
+
+    pos = soh + 1;
+  }
+}
+}
@@ -0,0 +1,101 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_HEADERSNIFFER_H
+#define FIX_HEADERSNIFFER_H
+
+#ifdef _MSC_VER
+#pragma warning( disable: 4786 )
+#endif
+
+#include <string>
+#include <cstring>
+
+namespace FIX
+{
+/**
+ * Locates the routing fields of a raw %FIX message without parsing it.
+ *
+ * Only the standard header is scanned and no memory is allocated; each
+ * field is returned as a pointer into the caller's buffer, which must
+ * outlive the sniffer.  The rules follow Message::setStringHeader: the
+ * message is only valid if it starts with BeginString, BodyLength and
+ * MsgType, and scanning stops at the first field that is not part of
+ * the standard header.
+ */
+class HeaderSniffer
+{
+public:
+  /// View of a field value inside the sniffed buffer.
+  struct Value
+  {
+    Value() : data( 0 ), size( 0 ) {}
+
+    bool found() const { return data != 0; }
+    std::string str() const
+    { return found() ? std::string( data, size ) : std::string(); }
+    bool getInt( int& result ) const;
+
+    bool operator==( const char* value ) const
+    { return found() && strlen( value ) == size
+             && memcmp( data, value, size ) == 0; }
+    bool operator!=( const char* value ) const
+    { return !( *this == value ); }
+
+    const char* data;
+    size_t size;
+  };
+
+  HeaderSniffer( const std::string& message )
+  { sniff( message.data(), message.size() ); }
+  HeaderSniffer( const char* message, size_t size )
+  { sniff( message, size ); }
+
+  /// True when the message begins with tags 8, 9 and 35 in that order
+  bool valid() const { return m_valid; }
+  /// True when the message type is one of the session level messages
+  bool isAdmin() const;
+
+  const Value& beginString() const { return m_values[ BEGIN_STRING ]; }
+  const Value& bodyLength() const { return m_values[ BODY_LENGTH ]; }
+  const Value& msgType() const { return m_values[ MSG_TYPE ]; }
+  const Value& msgSeqNum() const { return m_values[ MSG_SEQ_NUM ]; }
+  const Value& senderCompID() const { return m_values[ SENDER_COMP_ID ]; }
+  const Value& targetCompID() const { return m_values[ TARGET_COMP_ID ]; }
+  const Value& possDupFlag() const { return m_values[ POSS_DUP_FLAG ]; }
+  const Value& applVerID() const { return m_values[ APPL_VER_ID ]; }
+
+private:
+  enum Slot
+  {
+    BEGIN_STRING, BODY_LENGTH, MSG_TYPE, MSG_SEQ_NUM, SENDER_COMP_ID,
+    TARGET_COMP_ID, POSS_DUP_FLAG, APPL_VER_ID, SLOTS
+  };
+
+  void sniff( const char* message, size_t size );
+  static int slot( int tag );
+
+  Value m_values[ SLOTS ];
+  bool m_valid;
+};
+}
+
+#endif //FIX_HEADERSNIFFER_H
@@ -0,0 +1,201 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "HostResolver.h"
+
+namespace FIX
+{
+const double HostResolver::WAIT_SECONDS = 0.5;
+
+int SocketAddress::port() const
+{
+  if( family() == AF_INET6 )
+    return ntohs( reinterpret_cast < const sockaddr_in6* > ( &storage )->sin6_port );
+  return ntohs( reinterpret_cast < const sockaddr_in* > ( &storage )->sin_port );
+}
+
+std::string SocketAddress::toString() const
+{
+  char host[ NI_MAXHOST ];
+  if( getnameinfo( get(), length, host, sizeof( host ), 0, 0, NI_NUMERICHOST ) != 0 )
+    return "UNKNOWN";
+  return host;
+}
+
+HostResolver::HostResolver( int ttl )
+: m_ttl( ttl ), m_started( false ), m_stopped( false ) {}
+
+HostResolver::~HostResolver()
+{
+  bool started = false;
+  {
+    Locker locker( m_mutex );
+    m_stopped = true;
+    started = m_started;
+  }
+  m_wakeup.signal();
+  if( started )
+    thread_join( m_thread );
+}
+
+HostResolver::Result HostResolver::resolve
+( const std::string& host, int port, Addresses& addresses )
+throw( RuntimeError )
+{
+  addresses.clear();
+
+  // literal addresses are converted without touching the name service
+  Addresses numeric;
+  if( lookup( host, AI_NUMERICHOST, numeric ) )
+  {
+    copy( numeric, port, addresses );
+    return RESOLVED;
+  }
+
+  Locker locker( m_mutex );
+  Entry& entry = m_cache[ host ];
+  if( entry.failed )
+  {
+    m_cache.erase( host );
+    return FAILED;
+  }
+  if( entry.addresses.empty() )
+  {
+    queue( host, entry );
+    return PENDING;
+  }
+
+  if( time( 0 ) >= entry.expires )
+    queue( host, entry );
+  copy( entry.addresses, port, addresses );
+  return RESOLVED;
+}
+
+THREAD_PROC HostResolver::startThread( void* p )
+{
+  static_cast < HostResolver* > ( p )->run();
+  return 0;
+}
+
+void HostResolver::run()
+{
+  std::string host;
+  while( next( host ) )
+  {
+    Addresses addresses;
+    bool found = lookup( host, 0, addresses );
+
+    Locker locker( m_mutex );
+    Entry& entry = m_cache[ host ];
+    entry.pending = false;
+    if( found )
+    {
+      entry.addresses = addresses;
+      entry.expires = time( 0 ) + m_ttl;
+    }
+    // a failed refresh keeps the old answer until a lookup succeeds
+    else if( entry.addresses.empty() )
+      entry.failed = true;
+  }
+}
+
+bool HostResolver::next( std::string& host )
+{
+  Locker locker( m_mutex );
+  while( !m_stopped && m_queue.empty() )
+  {
+    ReverseLocker unlocker( m_mutex );
+    m_wakeup.wait( WAIT_SECONDS );
+  }
+
+  if( m_stopped )
+    return false;
+
+  host = m_queue.front();
+  m_queue.pop_front();
+  return true;
+}
+
+void HostResolver::queue( const std::string& host, Entry& entry )
+throw( RuntimeError )
+{
+  if( entry.pending )
+    return;
+
+  if( !m_started )
+  {
+    if( !thread_spawn( &startThread, this, m_thread ) )
+      throw RuntimeError( "Unable to spawn host resolver thread" );
+    m_started = true;
+  }
+
+  entry.pending = true;
+  m_queue.push_back( host );
+  m_wakeup.signal();
+}
+
+bool HostResolver::lookup( const std::string& host, int flags, Addresses& addresses )
+{
+  addrinfo hints;
+  memset( &hints, 0, sizeof( hints ) );
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  hints.ai_protocol = IPPROTO_TCP;
+  hints.ai_flags = flags;
+
+  addrinfo* result = 0;
+  if( getaddrinfo( host.c_str(), 0, &hints, &result ) != 0 )
+    return false;
+
+  for( addrinfo* i = result; i != 0; i = i->ai_next )
+  {
+    if( i->ai_family != AF_INET && i->ai_family != AF_INET6 )
+      continue;
+    if( i->ai_addrlen > sizeof( sockaddr_storage ) )
+      continue;
+
+    SocketAddress address;
+    memcpy( &address.storage, i->ai_addr, i->ai_addrlen );
+    address.length = (socklen_t)i->ai_addrlen;
+    addresses.push_back( address );
+  }
+
+  freeaddrinfo( result );
+  return !addresses.empty();
+}
+
+void HostResolver::copy( const Addresses& source, int port, Addresses& addresses )
+{
+  addresses = source;
+  Addresses::iterator i;
+  for( i = addresses.begin(); i != addresses.end(); ++i )
+  {
+    if( i->family() == AF_INET6 )
+      reinterpret_cast < sockaddr_in6* > ( &i->storage )->sin6_port = htons( port );
+    else
+      reinterpret_cast < sockaddr_in* > ( &i->storage )->sin_port = htons( port );
+  }
+}
+}
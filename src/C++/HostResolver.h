@@ -0,0 +1,115 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_HOSTRESOLVER_H
+#define FIX_HOSTRESOLVER_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "Utility.h"
+#include "Exceptions.h"
+#include "Event.h"
+#include "Mutex.h"
+#include <deque>
+#include <map>
+#include <vector>
+#include <string>
+
+namespace FIX
+{
+/// An IPv4 or IPv6 address and port to connect to.
+struct SocketAddress
+{
+  SocketAddress() : length( 0 )
+  { memset( &storage, 0, sizeof( storage ) ); }
+
+  int family() const { return storage.ss_family; }
+  const sockaddr* get() const
+  { return reinterpret_cast < const sockaddr* > ( &storage ); }
+
+  int port() const;
+  /// Numeric form of the address, for logging
+  std::string toString() const;
+
+  sockaddr_storage storage;
+  socklen_t length;
+};
+
+/**
+ * Resolves host names on a background thread and caches the answers.
+ *
+ * resolve() never blocks on DNS.  Numeric addresses are converted in
+ * place, cached names are answered from memory and anything else is
+ * queued for the resolver thread while the caller gets PENDING and asks
+ * again later.  Answers are kept for ttl seconds; once one expires it is
+ * still handed out while a fresh lookup runs, so a slow name server does
+ * not hold up reconnecting to a host that was reachable a moment ago.
+ */
+class HostResolver
+{
+public:
+  typedef std::vector < SocketAddress > Addresses;
+  enum Result { RESOLVED, PENDING, FAILED };
+
+  HostResolver( int ttl = 300 );
+  ~HostResolver();
+
+  void setTTL( int ttl ) { m_ttl = ttl; }
+
+  /// Addresses for a host and port, in the order they should be tried.
+  Result resolve( const std::string& host, int port, Addresses& addresses )
+  throw( RuntimeError );
+
+private:
+  struct Entry
+  {
+    Entry() : expires( 0 ), pending( false ), failed( false ) {}
+
+    Addresses addresses;
+    time_t expires;
+    bool pending;
+    bool failed;
+  };
+  typedef std::map < std::string, Entry > Cache;
+
+  static THREAD_PROC startThread( void* p );
+  void run();
+  bool next( std::string& host );
+  void queue( const std::string& host, Entry& entry ) throw( RuntimeError );
+  static bool lookup( const std::string& host, int flags, Addresses& addresses );
+  static void copy( const Addresses& source, int port, Addresses& addresses );
+
+  static const double WAIT_SECONDS;
+
+  int m_ttl;
+  Cache m_cache;
+  std::deque < std::string > m_queue;
+  bool m_started;
+  bool m_stopped;
+  thread_id m_thread;
+  Mutex m_mutex;
+  Event m_wakeup;
+};
+}
+
+#endif //FIX_HOSTRESOLVER_H
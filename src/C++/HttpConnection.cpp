@@ -27,12 +27,21 @@
 #include "HttpMessage.h"
 #include "HtmlBuilder.h"
 #include "Session.h"
+#include "SessionMetrics.h"
 #include "Utility.h"
 
 using namespace HTML;
 
 namespace FIX
 {
+/// Acceptor event loop serving a session, as shown on the admin pages.
+static std::string eventLoop( const Session& session )
+{
+  if( session.getEventLoop() < 0 )
+    return "none";
+  return IntConvertor::convert( session.getEventLoop() );
+}
+
 HttpConnection::HttpConnection( int s )
 : m_socket( s )
 {
@@ -125,6 +134,13 @@ void HttpConnection::processStream()
 
 void HttpConnection::processRequest( const HttpMessage& request )
 {
+  if( request.getRootString() == "/metrics"
+      || request.getRootString() == "/metrics.json" )
+  {
+    processMetrics( request );
+    return;
+  }
+
   int error = 200;
   std::stringstream h;
   std::stringstream b;
@@ -178,6 +194,33 @@ void HttpConnection::processRequest( const HttpMessage& request )
   disconnect();
 }
 
+void HttpConnection::processMetrics( const HttpMessage& request )
+{
+  SessionMetrics::Sessions sessions;
+  std::set<SessionID> sessionIDs = Session::getSessions();
+  std::set<SessionID>::const_iterator i;
+  for( i = sessionIDs.begin(); i != sessionIDs.end(); ++i )
+  {
+    Session* pSession = Session::lookupSession( *i );
+    if( pSession && pSession->getMetrics() )
+      sessions.push_back( std::make_pair( *i, pSession->getMetrics() ) );
+  }
+
+  std::stringstream b;
+  if( request.getRootString() == "/metrics.json" )
+  {
+    SessionMetrics::toJSON( b, sessions );
+    send( HttpMessage::createResponse( 200, b.str(), "application/json" ) );
+  }
+  else
+  {
+    SessionMetrics::toPrometheus( b, sessions );
+    send( HttpMessage::createResponse( 200, b.str(), "text/plain; version=0.0.4" ) );
+  }
+
+  disconnect();
+}
+
 void HttpConnection::processRoot
 ( const HttpMessage& request, std::stringstream& h, std::stringstream& b )
 {
@@ -201,6 +244,7 @@ void HttpConnection::processRoot
     { TD td(b); td.align("center").text("Logged On"); }
     { TD td(b); td.align("center").text("Next Incoming"); }
     { TD td(b); td.align("center").text("Next Outgoing"); }
+    { TD td(b); td.align("center").text("Event Loop"); }
   }
 
   std::set<SessionID> sessions = Session::getSessions();
@@ -226,6 +270,7 @@ void HttpConnection::processRoot
       { TD td(b); td.text(pSession->isLoggedOn() ? "yes" : "no"); }
       { TD td(b); td.text(pSession->getExpectedTargetNum()); }
       { TD td(b); td.text(pSession->getExpectedSenderNum()); }
+      { TD td(b); td.text(eventLoop(*pSession)); }
     }
   }
 }
@@ -521,6 +566,7 @@ void HttpConnection::processSession
     showRow( b, "Logged On", pSession->isLoggedOn() );
     showRow( b, "Next Incoming", (int)pSession->getExpectedTargetNum(), url );
     showRow( b, "Next Outgoing", (int)pSession->getExpectedSenderNum(), url );
+    showRow( b, "Event Loop", eventLoop(*pSession) );
     showRow( b, SEND_REDUNDANT_RESENDREQUESTS, pSession->getSendRedundantResendRequests(), url );
     showRow( b, CHECK_COMPID, pSession->getCheckCompId(), url );
     showRow( b, CHECK_LATENCY, pSession->getCheckLatency(), url );
@@ -46,6 +46,7 @@ private:
   bool readMessage( std::string& msg ) throw( SocketRecvFailed );
   void processStream();
   void processRequest( const HttpMessage& );
+  void processMetrics( const HttpMessage& );
   void processRoot( const HttpMessage&, std::stringstream& h, std::stringstream& b );
   void processResetSessions( const HttpMessage&, std::stringstream& h, std::stringstream& b );
   void processRefreshSessions( const HttpMessage&, std::stringstream& h, std::stringstream& b );
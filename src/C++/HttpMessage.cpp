@@ -84,6 +84,12 @@ throw( InvalidMessage )
 }
 
 std::string HttpMessage::createResponse( int error, const std::string& text )
+{
+  return createResponse( error, text, "text/html; charset=iso-8859-1" );
+}
+
+std::string HttpMessage::createResponse
+( int error, const std::string& text, const std::string& contentType )
 {
   std::string errorString;
   switch( error )
@@ -134,8 +140,12 @@ std::string HttpMessage::createResponse( int error, const std::string& text )
   std::stringstream response;
   response << "HTTP/1.1 " << error << " " << errorString << "\r\n"
            << "Server: QuickFIX" << "\r\n"
-           << "Content-Type: text/html; charset=iso-8859-1" << "\r\n\r\n"
-           << "<!DOCTYPE HTML PUBLIC \"-//IETF//DTD HTML 2.0//EN\">";
+           << "Content-Type: " << contentType << "\r\n\r\n";
+
+  if( contentType.compare( 0, 9, "text/html" ) != 0 )
+    return response.str() + text;
+
+  response << "<!DOCTYPE HTML PUBLIC \"-//IETF//DTD HTML 2.0//EN\">";
 
   if( error < 200 || error >= 300 )
     response << "<HTML><HEAD><TITLE>" << error << " " << errorString << "</TITLE></HEAD><BODY>"
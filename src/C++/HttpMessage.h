@@ -114,6 +114,8 @@ public:
   }  
 
   static std::string createResponse( int error = 0, const std::string& text = "" );
+  static std::string createResponse( int error, const std::string& text,
+                                     const std::string& contentType );
  
 private:
   std::string m_root;
@@ -0,0 +1,166 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "IOExecutor.h"
+
+namespace FIX
+{
+const double IOExecutor::WAIT_SECONDS = 0.01;
+
+IOExecutor* IOExecutor::s_shared = 0;
+int IOExecutor::s_users = 0;
+Mutex IOExecutor::s_mutex;
+
+IOExecutor::IOExecutor( int threads ) throw ( RuntimeError )
+: m_stopped( false )
+{
+  if( threads < 1 ) threads = 1;
+  for( int i = 0; i < threads; ++i )
+  {
+    thread_id thread;
+    if( !thread_spawn( &startThread, this, thread ) )
+    {
+      stop();
+      throw RuntimeError( "Unable to spawn I/O thread" );
+    }
+    m_threads.push_back( thread );
+  }
+}
+
+IOExecutor::~IOExecutor()
+{
+  stop();
+}
+
+void IOExecutor::stop()
+{
+  {
+    Locker locker( m_mutex );
+    m_stopped = true;
+  }
+  m_wakeup.signal();
+
+  std::vector < thread_id >::iterator i;
+  for( i = m_threads.begin(); i != m_threads.end(); ++i )
+    thread_join( *i );
+  m_threads.clear();
+}
+
+void IOExecutor::schedule( Writer& writer )
+{
+  Locker locker( m_mutex );
+  if( writer.m_running )
+  {
+    // picked up again when the running write returns
+    writer.m_again = true;
+    return;
+  }
+  if( writer.m_queued )
+    return;
+
+  writer.m_queued = true;
+  m_queue.push_back( &writer );
+  m_wakeup.signal();
+}
+
+void IOExecutor::wait( const Writer& writer )
+{
+  Locker locker( m_mutex );
+  while( writer.m_queued || writer.m_running || writer.m_again )
+  {
+    ReverseLocker unlocker( m_mutex );
+    m_done.wait( WAIT_SECONDS );
+  }
+}
+
+IOExecutor* IOExecutor::acquire( int threads ) throw ( RuntimeError )
+{
+  Locker locker( s_mutex );
+  if( !s_shared )
+    s_shared = new IOExecutor( threads );
+  ++s_users;
+  return s_shared;
+}
+
+void IOExecutor::release( IOExecutor* pExecutor )
+{
+  Locker locker( s_mutex );
+  if( !pExecutor || pExecutor != s_shared )
+    return;
+  if( --s_users == 0 )
+  {
+    delete s_shared;
+    s_shared = 0;
+  }
+}
+
+THREAD_PROC IOExecutor::startThread( void* p )
+{
+  static_cast < IOExecutor* > ( p )->run();
+  return 0;
+}
+
+void IOExecutor::run()
+{
+  Writer* pWriter = 0;
+  while( ( pWriter = next() ) != 0 )
+  {
+    pWriter->write();
+
+    {
+      Locker locker( m_mutex );
+      pWriter->m_running = false;
+      if( pWriter->m_again )
+      {
+        // to the back of the queue, so a busy session can not starve the rest
+        pWriter->m_again = false;
+        pWriter->m_queued = true;
+        m_queue.push_back( pWriter );
+        m_wakeup.signal();
+      }
+    }
+    m_done.signal();
+  }
+}
+
+IOExecutor::Writer* IOExecutor::next()
+{
+  Locker locker( m_mutex );
+  while( m_queue.empty() )
+  {
+    // writes scheduled before stopping are still finished
+    if( m_stopped )
+      return 0;
+    ReverseLocker unlocker( m_mutex );
+    m_wakeup.wait( WAIT_SECONDS );
+  }
+
+  Writer* pWriter = m_queue.front();
+  m_queue.pop_front();
+  pWriter->m_queued = false;
+  pWriter->m_running = true;
+  return pWriter;
+}
+}
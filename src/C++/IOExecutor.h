@@ -0,0 +1,108 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_IOEXECUTOR_H
+#define FIX_IOEXECUTOR_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "Utility.h"
+#include "Exceptions.h"
+#include "Event.h"
+#include "Mutex.h"
+#include <deque>
+#include <vector>
+
+namespace FIX
+{
+/**
+ * A small pool of threads that does file I/O for logs.
+ *
+ * Each log is a Writer that buffers what it has to write and asks to be
+ * scheduled.  A worker later calls write() to put everything buffered so
+ * far on disk, so lines that arrive while one write is running go out
+ * together in the next.  Calls for one writer
+ * never overlap and run in the order they were asked for, which keeps
+ * each session's files in order while different sessions are written in
+ * parallel.
+ *
+ * One executor is shared by every session in the process, see acquire().
+ */
+class IOExecutor
+{
+public:
+  /// Something with buffered writes, such as one session's log.
+  class Writer
+  {
+  public:
+    Writer() : m_queued( false ), m_running( false ), m_again( false ) {}
+    virtual ~Writer() {}
+
+    /// Write out everything buffered so far, called on a worker thread.
+    virtual void write() = 0;
+
+  private:
+    friend class IOExecutor;
+    bool m_queued;
+    bool m_running;
+    bool m_again;
+  };
+
+  IOExecutor( int threads ) throw ( RuntimeError );
+  /// Finishes every write already scheduled before returning.
+  ~IOExecutor();
+
+  /// Have a worker call writer.write(), a request while one is queued joins it.
+  void schedule( Writer& );
+  /// Block until the writer has nothing scheduled or running.
+  void wait( const Writer& );
+
+  int getThreads() const { return (int)m_threads.size(); }
+
+  /// The executor shared by the process, started with threads on first use.
+  static IOExecutor* acquire( int threads ) throw ( RuntimeError );
+  /// Stops the shared executor once its last user releases it.
+  static void release( IOExecutor* );
+
+private:
+  static THREAD_PROC startThread( void* p );
+  void stop();
+  void run();
+  Writer* next();
+
+  static const double WAIT_SECONDS;
+
+  std::deque < Writer* > m_queue;
+  std::vector < thread_id > m_threads;
+  bool m_stopped;
+  Mutex m_mutex;
+  Event m_wakeup;
+  Event m_done;
+
+  static IOExecutor* s_shared;
+  static int s_users;
+  static Mutex s_mutex;
+};
+}
+
+#endif //FIX_IOEXECUTOR_H
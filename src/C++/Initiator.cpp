@@ -33,6 +33,8 @@
 
 namespace FIX
 {
+const int Initiator::DEFAULT_RECONNECT_INTERVAL = 30;
+
 Initiator::Initiator( Application& application,
                       MessageStoreFactory& messageStoreFactory,
                       const SessionSettings& settings ) throw( ConfigError )
@@ -71,12 +73,29 @@ void Initiator::initialize() throw ( ConfigError )
   SessionFactory factory( m_application, m_messageStoreFactory,
                           m_pLogFactory );
 
+  const Dictionary& defaults = m_settings.get();
+  if ( defaults.has( RECONNECT_MAX_INTERVAL ) )
+    m_scheduler.setMaxInterval( defaults.getInt( RECONNECT_MAX_INTERVAL ) );
+  if ( defaults.has( RECONNECT_JITTER ) )
+    m_scheduler.setJitter( defaults.getInt( RECONNECT_JITTER ) );
+  if ( defaults.has( SOCKET_CONNECT_HOST_LIMIT ) )
+    m_scheduler.setHostLimit( defaults.getInt( SOCKET_CONNECT_HOST_LIMIT ) );
+
+  const time_t now = time( 0 );
   for ( i = sessions.begin(); i != sessions.end(); ++i )
   {
-    if ( m_settings.get( *i ).getString( "ConnectionType" ) == "initiator" )
+    const Dictionary& settings = m_settings.get( *i );
+    if ( settings.getString( "ConnectionType" ) == "initiator" )
     {
       m_sessionIDs.insert( *i );
-      m_sessions[ *i ] = factory.create( *i, m_settings.get( *i ) );
+      Session* pSession = factory.create( *i, settings );
+      m_sessions[ *i ] = pSession;
+      const int reconnectInterval = settings.has( RECONNECT_INTERVAL ) ?
+        settings.getInt( RECONNECT_INTERVAL ) : DEFAULT_RECONNECT_INTERVAL;
+      // the limit is on the primary host, failover hosts share it
+      m_scheduler.add( *i, settings.has( SOCKET_CONNECT_HOST ) ?
+                         settings.getString( SOCKET_CONNECT_HOST ) : "",
+                       reconnectInterval, now );
       setDisconnected( *i );
     }
   }
@@ -132,13 +151,26 @@ void Initiator::connect()
 {
   Locker l(m_mutex);
 
-  SessionIDs disconnected = m_disconnected;
-  SessionIDs::iterator i = disconnected.begin();
-  for ( ; i != disconnected.end(); ++i )
+  // failures are only forgotten once a connected session logs on
+  if ( !m_scheduler.getAwaitingLogon().empty() )
   {
-    Session* pSession = Session::lookupSession( *i );
-    if ( pSession->isConnectTime(UtcTimeStamp()) )
-      doConnect( *i, m_settings.get( *i ));
+    SessionIDs awaiting = m_scheduler.getAwaitingLogon();
+    SessionIDs::iterator i;
+    for ( i = awaiting.begin(); i != awaiting.end(); ++i )
+    {
+      Session* pSession = getSession( *i );
+      if ( pSession && pSession->isLoggedOn() )
+        m_scheduler.loggedOn( *i );
+    }
+  }
+
+  // only sessions due for an attempt are looked at
+  const time_t now = time( 0 );
+  SessionID sessionID;
+  while ( m_scheduler.next( now, sessionID ) )
+  {
+    doConnect( sessionID, m_settings.get( sessionID ) );
+    m_scheduler.retry( sessionID, now );
   }
 }
 
@@ -149,6 +181,7 @@ void Initiator::setPending( const SessionID& sessionID )
   m_pending.insert( sessionID );
   m_connected.erase( sessionID );
   m_disconnected.erase( sessionID );
+  m_scheduler.pending( sessionID, time( 0 ) );
 }
 
 void Initiator::setConnected( const SessionID& sessionID )
@@ -158,6 +191,7 @@ void Initiator::setConnected( const SessionID& sessionID )
   m_pending.erase( sessionID );
   m_connected.insert( sessionID );
   m_disconnected.erase( sessionID );
+  m_scheduler.connected( sessionID, time( 0 ) );
 }
 
 void Initiator::setDisconnected( const SessionID& sessionID )
@@ -167,6 +201,13 @@ void Initiator::setDisconnected( const SessionID& sessionID )
   m_pending.erase( sessionID );
   m_connected.erase( sessionID );
   m_disconnected.insert( sessionID );
+  m_scheduler.disconnected( sessionID, time( 0 ) );
+}
+
+void Initiator::wake( const SessionID& sessionID )
+{
+  Locker l(m_mutex);
+  m_scheduler.wake( sessionID, time( 0 ) );
 }
 
 bool Initiator::isPending( const SessionID& sessionID )
@@ -34,6 +34,7 @@
 #include "Exceptions.h"
 #include "Mutex.h"
 #include "Session.h"
+#include "ConnectScheduler.h"
 #include <set>
 #include <map>
 #include <string>
@@ -101,6 +102,8 @@ protected:
   bool isPending( const SessionID& );
   bool isConnected( const SessionID& );
   bool isDisconnected( const SessionID& );
+  /// Let a session try to connect on the next pass, within the host limit.
+  void wake( const SessionID& );
   void connect();
 
 private:
@@ -121,6 +124,8 @@ private:
 
   static THREAD_PROC startThread( void* p );
 
+  static const int DEFAULT_RECONNECT_INTERVAL;
+
   typedef std::set < SessionID > SessionIDs;
   typedef std::map < SessionID, int > SessionState;
   typedef std::map < SessionID, Session* > Sessions;
@@ -131,6 +136,7 @@ private:
   SessionIDs m_connected;
   SessionIDs m_disconnected;
   SessionState m_sessionState;
+  ConnectScheduler m_scheduler;
 
   thread_id m_threadid;
   Application& m_application;
@@ -90,6 +90,9 @@ public:
   virtual void onIncomingRejected( const std::string&, const std::string& ) = 0;
   virtual void onOutgoingRejected( const std::string&, const std::string& ) = 0;
   virtual void onEvent( const std::string& ) = 0;
+  /// Writes until endBatch may be held back and flushed together.
+  virtual void beginBatch() {}
+  virtual void endBatch() {}
 };
 /*! @} */
 
@@ -111,6 +114,37 @@ public:
   void onEvent( const std::string& ) {}
 };
 
+/**
+ * Serializes the calls made to a Log.
+ *
+ * Used for the log of an acceptor whose event loops run on several
+ * threads, since logs do not synchronize their own writes.
+ */
+class SynchronizedLog : public Log
+{
+public:
+  SynchronizedLog( Log& log ) : m_log( log ) {}
+
+  void clear()
+  { Locker l( m_mutex ); m_log.clear(); }
+  void backup()
+  { Locker l( m_mutex ); m_log.backup(); }
+  void onIncoming( const std::string& value )
+  { Locker l( m_mutex ); m_log.onIncoming( value ); }
+  void onOutgoing( const std::string& value )
+  { Locker l( m_mutex ); m_log.onOutgoing( value ); }
+  void onIncomingRejected( const std::string& value, const std::string& reason )
+  { Locker l( m_mutex ); m_log.onIncomingRejected( value, reason ); }
+  void onOutgoingRejected( const std::string& value, const std::string& reason )
+  { Locker l( m_mutex ); m_log.onOutgoingRejected( value, reason ); }
+  void onEvent( const std::string& value )
+  { Locker l( m_mutex ); m_log.onEvent( value ); }
+
+private:
+  Log& m_log;
+  Mutex m_mutex;
+};
+
 /**
  * Screen based implementation of Log.
  *
@@ -33,11 +33,11 @@ namespace FIX
 std::unique_ptr<DataDictionary> Message::s_dataDictionary;
 
 Message::Message()
-: m_validStructure( true ) {}
+: m_validStructure( true ), m_pDeferredDD( 0 ) {}
 
 Message::Message( int direction, const std::string& string, const ValidationRules* validationRules )
 throw( Exception )
-: m_validStructure( true )
+: m_validStructure( true ), m_pDeferredDD( 0 ), m_pDeferredRules( 0 ), m_deferredDirection( 0 )
 {
   setString( direction, string, validationRules );
 }
@@ -46,7 +46,7 @@ Message::Message( int direction, const std::string& string,
                   const DataDictionary& dataDictionary,
                   const ValidationRules* validationRules )
 throw( Exception )
-: m_validStructure( true )
+: m_validStructure( true ), m_pDeferredDD( 0 ), m_pDeferredRules( 0 ), m_deferredDirection( 0 )
 {
   setString( direction, string, validationRules, &dataDictionary, &dataDictionary );
 }
@@ -56,7 +56,7 @@ Message::Message( int direction, const std::string& string,
                   const DataDictionary& applicationDataDictionary,
                   const ValidationRules* validationRules )
 throw( Exception )
-: m_validStructure( true )
+: m_validStructure( true ), m_pDeferredDD( 0 ), m_pDeferredRules( 0 ), m_deferredDirection( 0 )
 {
   setStringHeader( string );
   if( isAdmin() )
@@ -269,6 +269,8 @@ throw( Exception )
   clear();
 
   std::string::size_type pos = 0;
+  std::string::size_type bodyStart = 0;
+  std::string::size_type checkSumStart = string.size();
   int count = 0;
   std::string msg;
 
@@ -285,7 +287,13 @@ throw( Exception )
 
   while ( pos < string.size() )
   {
+    std::string::size_type fieldStart = pos;
     FieldBase field = extractField( string, pos, pSessionDataDictionary, pApplicationDataDictionary );
+    if ( field.getTag() == FIELD::BodyLength && !bodyStart )
+      bodyStart = pos;
+    else if ( field.getTag() == FIELD::CheckSum )
+      checkSumStart = fieldStart;
+
     if ( count < 3 &&
          headerOrder[ count++ ] != field.getTag() && 
          !ValidationRules::shouldTolerateOutOfOrderTag(validationRules, OUTGOING_DIRECTION, safeMsgType(), field.getTag() ) 
@@ -306,18 +314,19 @@ throw( Exception )
       if ( field.getTag() == FIELD::MsgType )
         msg = field.getString();
 
-      m_header.setField( field, false );
-
       if ( pSessionDataDictionary )
         setGroup( "_header_", field, string, pos, getHeader(), *pSessionDataDictionary );
+
+      m_header.setField( std::move( field ), false );
     }
     else if ( isTrailerField( field, pSessionDataDictionary ) )
     {
       type = trailer;
-      m_trailer.setField( field, false );
 
       if ( pSessionDataDictionary )
         setGroup( "_trailer_", field, string, pos, getTrailer(), *pSessionDataDictionary );
+
+      m_trailer.setField( std::move( field ), false );
     }
     else
     {
@@ -328,16 +337,17 @@ throw( Exception )
       }
 
       type = body;
-      setField( field, false );
 
       if ( pApplicationDataDictionary )
       {
         setGroup( msg, field, string, pos, *this, *pApplicationDataDictionary );
       }
+
+      setField( std::move( field ), false );
     }
   }
 
-  validate( validationRules );
+  validate( validationRules, string, bodyStart, checkSumStart );
 }
 
 void Message::setGroup( const std::string& msg, const FieldBase& field,
@@ -379,8 +389,8 @@ void Message::setGroup( const std::string& msg, const FieldBase& field,
     }
 
     if ( !pGroup.get() ) return ;
-    pGroup->setField( field, false );
     setGroup( msg, field, string, pos, *pGroup, *pDD );
+    pGroup->setField( std::move( field ), false );
   }
 }
 
@@ -398,7 +408,7 @@ bool Message::setStringHeader( const std::string& string )
       return false;
 
     if ( isHeaderField( field ) )
-      m_header.setField( field, false );
+      m_header.setField( std::move( field ), false );
     else break;
   }
   return true;
@@ -505,7 +515,15 @@ const std::string& Message::safeMsgType () const
   }
 }
 
-void Message::validate( const ValidationRules* vrptr )
+void Message::checkDeferredValue( const FieldBase& field ) const
+throw( IncorrectTagValue )
+{
+  m_pDeferredDD->checkValue( m_deferredDirection, safeMsgType(), field, m_pDeferredRules );
+}
+
+void Message::validate( const ValidationRules* vrptr, const std::string& string,
+                        std::string::size_type bodyStart,
+                        std::string::size_type checkSumStart )
 {
   /*
   try
@@ -517,7 +535,7 @@ void Message::validate( const ValidationRules* vrptr )
       const BodyLength& aBodyLength = FIELD_GET_REF( m_header, BodyLength );
 
       const int expectedLength = (int)aBodyLength;
-      const int actualLength = bodyLength();
+      const int actualLength = (int)( checkSumStart - bodyStart );
 
       if ( expectedLength != actualLength )
       {
@@ -533,7 +551,10 @@ void Message::validate( const ValidationRules* vrptr )
       const CheckSum& aCheckSum = FIELD_GET_REF( m_trailer, CheckSum );
 
       const int expectedChecksum = (int)aCheckSum;
-      const int actualChecksum = checkSum();
+      int actualChecksum = 0;
+      for ( std::string::size_type i = 0; i < checkSumStart; ++i )
+        actualChecksum += (unsigned char)string[ i ];
+      actualChecksum %= 256;
 
       if ( expectedChecksum != actualChecksum )
       {
@@ -612,11 +633,6 @@ FIX::FieldBase Message::extractField( const std::string& string, std::string::si
   std::string::const_iterator const tagEnd = soh + 1;
   pos = std::distance( string.begin(), tagEnd );
 
-  return FieldBase (
-    field,
-    valueStart,
-    soh,
-    tagStart, 
-    tagEnd );
+  return FieldBase( field, valueStart, soh );
 }
 }
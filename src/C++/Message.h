@@ -32,6 +32,7 @@
 #include "SessionID.h"
 #include "DataDictionary.h"
 #include "Values.h"
+#include "HeaderSniffer.h"
 #include <vector>
 #include <memory>
 
@@ -99,6 +100,46 @@ public:
     m_trailer = copy.m_trailer;
     m_validStructure = copy.m_validStructure;
     m_tag = copy.m_tag;
+    m_pDeferredDD = copy.m_pDeferredDD;
+    m_pDeferredRules = copy.m_pDeferredRules;
+    m_deferredDirection = copy.m_deferredDirection;
+  }
+
+  Message( Message&& rhs ) NOEXCEPT
+  : FieldMap( std::move( rhs ) ),
+    m_header( std::move( rhs.m_header ) ),
+    m_trailer( std::move( rhs.m_trailer ) ),
+    m_validStructure( rhs.m_validStructure ),
+    m_tag( rhs.m_tag ),
+    m_pDeferredDD( rhs.m_pDeferredDD ),
+    m_pDeferredRules( rhs.m_pDeferredRules ),
+    m_deferredDirection( rhs.m_deferredDirection )
+  {}
+
+  Message& operator=( const Message& rhs )
+  {
+    FieldMap::operator=( rhs );
+    m_header = rhs.m_header;
+    m_trailer = rhs.m_trailer;
+    m_validStructure = rhs.m_validStructure;
+    m_tag = rhs.m_tag;
+    m_pDeferredDD = rhs.m_pDeferredDD;
+    m_pDeferredRules = rhs.m_pDeferredRules;
+    m_deferredDirection = rhs.m_deferredDirection;
+    return *this;
+  }
+
+  Message& operator=( Message&& rhs ) NOEXCEPT
+  {
+    FieldMap::operator=( std::move( rhs ) );
+    m_header = std::move( rhs.m_header );
+    m_trailer = std::move( rhs.m_trailer );
+    m_validStructure = rhs.m_validStructure;
+    m_tag = rhs.m_tag;
+    m_pDeferredDD = rhs.m_pDeferredDD;
+    m_pDeferredRules = rhs.m_pDeferredRules;
+    m_deferredDirection = rhs.m_deferredDirection;
+    return *this;
   }
 
   /// Set global data dictionary for encoding messages into XML
@@ -106,6 +147,8 @@ public:
 
   void addGroup( const FIX::Group& group )
   { FieldMap::addGroup( group.field(), group ); }
+  void addGroup( FIX::Group&& group )
+  { FieldMap::addGroup( group.field(), std::move( group ) ); }
 
   void replaceGroup( unsigned num, const FIX::Group& group )
   { FieldMap::replaceGroup( num, group.field(), group ); }
@@ -126,10 +169,49 @@ public:
   bool hasGroup( unsigned num, const FIX::Group& group ) const
   { return FieldMap::hasGroup( num, group.field() ); }
 
+  using FieldMap::getField;
+
+  /// Get a field, checking its value if lazy validation deferred that
+  FieldBase& getField( FieldBase& field ) const
+  throw( FieldNotFound, IncorrectTagValue )
+  {
+    field = getFieldRef( field.getTag() );
+    return field;
+  }
+
+  /// Get a field if set, checking its value if lazy validation deferred that
+  bool getFieldIfSet( FieldBase& field ) const
+  throw( IncorrectTagValue )
+  {
+    if( !FieldMap::getFieldIfSet( field ) )
+      return false;
+    if( m_pDeferredDD )
+      checkDeferredValue( field );
+    return true;
+  }
+
+  /// Get direct access to a field, checking its value if lazy validation
+  /// deferred that
+  const FieldBase& getFieldRef( int tag ) const
+  throw( FieldNotFound, IncorrectTagValue )
+  {
+    const FieldBase& field = FieldMap::getFieldRef( tag );
+    if( m_pDeferredDD )
+      checkDeferredValue( field );
+    return field;
+  }
+
+  const FieldBase* getFieldPtr( int tag ) const
+  throw( FieldNotFound, IncorrectTagValue )
+  {
+    return &getFieldRef( tag );
+  }
+
 protected:
   // Constructor for derived classes
   Message( const BeginString& beginString, const MsgType& msgType )
-  : m_validStructure( true )
+  : m_validStructure( true ), m_pDeferredDD( 0 ), m_pDeferredRules( 0 ),
+    m_deferredDirection( 0 )
   {
     m_header.setField( beginString );
     m_header.setField( msgType );
@@ -246,6 +328,7 @@ public:
   void clear()
   { 
     m_tag = 0;
+    m_pDeferredDD = 0;
     m_header.clear();
     FieldMap::clear();
     m_trailer.clear();
@@ -336,7 +419,11 @@ private:
   }
 
   const std::string& safeMsgType () const;
-  void validate( const ValidationRules* vrptr );
+  void checkDeferredValue( const FieldBase& field ) const
+  throw( IncorrectTagValue );
+  void validate( const ValidationRules* vrptr, const std::string& string,
+                 std::string::size_type bodyStart,
+                 std::string::size_type checkSumStart );
   std::string toXMLFields(const FieldMap& fields, int space) const;
 
 protected:
@@ -344,6 +431,11 @@ protected:
   mutable Trailer m_trailer;
   bool m_validStructure;
   int m_tag;
+  /// Dictionary and rules for the value checks lazy validation deferred,
+  /// which must outlive the message; none are pending without a dictionary
+  mutable const DataDictionary* m_pDeferredDD;
+  mutable const ValidationRules* m_pDeferredRules;
+  mutable int m_deferredDirection;
   static std::unique_ptr<DataDictionary> s_dataDictionary;
 };
 /*! @} */
@@ -360,6 +452,10 @@ inline std::ostream& operator <<
 inline MsgType identifyType( const std::string& message )
 throw( MessageParseError )
 {
+  HeaderSniffer header( message );
+  if ( header.msgType().found() ) return MsgType( header.msgType().str() );
+
+  // the sniffer stops at the body, a MsgType out of place is still found
   std::string::size_type pos = message.find( "\001" "35=" );
   if ( pos == std::string::npos ) throw MessageParseError();
 
@@ -367,8 +463,7 @@ throw( MessageParseError )
   std::string::size_type soh = message.find_first_of( '\001', startValue );
   if ( soh == std::string::npos ) throw MessageParseError();
 
-  std::string value = message.substr( startValue, soh - startValue );
-  return MsgType( value );
+  return MsgType( message.substr( startValue, soh - startValue ) );
 }
 }
 
@@ -0,0 +1,51 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "MessageEncoder.h"
+
+namespace FIX
+{
+std::string& MessageEncoder::toString( Header& header, std::string& str )
+{
+  const std::string& body = getBody();
+  header.setField( BodyLength( header.calculateLength() + (int)body.size() ) );
+
+  str.clear();
+  header.calculateString( str );
+  str += body;
+
+  // the header keeps its own running total, only the body needs summing
+  int checkSum = header.calculateTotal();
+  for( std::string::const_iterator i = body.begin(); i != body.end(); ++i )
+    checkSum += (unsigned char)*i;
+
+  char buffer[ 4 ];
+  integer_to_string_padded( buffer, sizeof( buffer ), checkSum % 256, 3 );
+  str.append( "10=", 3 );
+  str.append( buffer, 3 );
+  str += '\001';
+  return str;
+}
+}
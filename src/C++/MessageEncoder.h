@@ -0,0 +1,131 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_MESSAGEENCODER_H
+#define FIX_MESSAGEENCODER_H
+
+#ifdef _MSC_VER
+#pragma warning( disable: 4786 )
+#endif
+
+#include "Message.h"
+#include "FieldConvertors.h"
+#include <string>
+
+namespace FIX
+{
+/**
+ * Base class of the encoders generated from the data dictionaries.
+ *
+ * A generated encoder holds typed values for one message type and
+ * writes them straight into a reusable buffer in dictionary order,
+ * skipping the FieldMap a Message would build.  Keep one encoder per
+ * message type and reset it between messages; once its buffers have
+ * grown to fit, encoding does not allocate.
+ *
+ * The session only sends the encoded form when the application's
+ * toApp( MessageEncoder&, const SessionID& ) returns true.  The default
+ * returns false and the session builds a Message from the encoding for
+ * toApp( Message&, const SessionID& ), allocating as a Message send does.
+ */
+class MessageEncoder
+{
+public:
+  MessageEncoder( const char* msgType )
+  : m_msgType( msgType ), m_showMilliseconds( false ) {}
+  virtual ~MessageEncoder() {}
+
+  const std::string& getMsgType() const { return m_msgType; }
+
+  /// Write timestamps with milliseconds, the session sets this from its settings.
+  void setShowMilliseconds( bool value ) { m_showMilliseconds = value; }
+
+  /// Encode the body, returning the fields between the header and trailer.
+  const std::string& getBody()
+  {
+    m_body.clear();
+    encode();
+    return m_body;
+  }
+
+  /// Build the complete message around the header the session filled.
+  std::string& toString( Header& header, std::string& str );
+
+  template< size_t N >
+  void append( const char (&prefix)[ N ], const std::string& value )
+  {
+    m_body.append( prefix, N - 1 );
+    m_body.append( value );
+    m_body += '\001';
+  }
+
+  template< size_t N >
+  void append( const char (&prefix)[ N ], int value )
+  {
+    char buffer[ std::numeric_limits<signed_int>::digits10 + 3 ];
+    const char* start = integer_to_string( buffer, sizeof( buffer ), value );
+    m_body.append( prefix, N - 1 );
+    m_body.append( start, buffer + sizeof( buffer ) - 1 - start );
+    m_body += '\001';
+  }
+
+  template< size_t N >
+  void append( const char (&prefix)[ N ], double value )
+  {
+    char buffer[ 32 ];
+    m_body.append( prefix, N - 1 );
+    m_body.append( buffer, DoubleConvertor::convert( value, 0, buffer ) );
+    m_body += '\001';
+  }
+
+  template< size_t N >
+  void append( const char (&prefix)[ N ], char value )
+  {
+    m_body.append( prefix, N - 1 );
+    m_body += value;
+    m_body += '\001';
+  }
+
+  template< size_t N >
+  void append( const char (&prefix)[ N ], bool value )
+  { append( prefix, value ? 'Y' : 'N' ); }
+
+  template< size_t N >
+  void append( const char (&prefix)[ N ], const UtcTimeStamp& value )
+  {
+    char buffer[ 18+4 ];
+    m_body.append( prefix, N - 1 );
+    m_body.append( buffer, UtcTimeStampConvertor::convert( value, m_showMilliseconds, buffer ) );
+    m_body += '\001';
+  }
+
+protected:
+  /// Append every field that is set, in dictionary order.
+  virtual void encode() = 0;
+
+private:
+  std::string m_msgType;
+  std::string m_body;
+  bool m_showMilliseconds;
+};
+}
+
+#endif //FIX_MESSAGEENCODER_H
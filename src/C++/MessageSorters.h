@@ -131,7 +131,7 @@ public:
       case trailer:
       return trailer_order::compare( x, y );
       case group:
-      return group_order::compare( x, y, m_groupOrder, m_largest );
+      return position( x ) < position( y );
       case normal: default:
       return x < y;
     }
@@ -145,6 +145,17 @@ public:
 private:
   void setOrder( int size, const int order[] );
 
+  /// Rank of a field in group order, unordered fields follow by tag.
+  int position( const int field ) const
+  {
+    if ( field <= m_largest )
+    {
+      const int ordered = m_groupOrder[ field ];
+      if ( ordered ) return ordered;
+    }
+    return m_largest + field;
+  }
+
   cmp_mode m_mode;
   int m_delim;
   shared_array<int> m_groupOrder;
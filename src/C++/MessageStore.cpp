@@ -27,6 +27,60 @@
 
 namespace FIX
 {
+/// Walks the message map by sequence number so inserts during iteration are safe
+class MemoryStoreCursor : public MessageStoreCursor
+{
+public:
+  MemoryStoreCursor( const MemoryStore& store, int begin, int end )
+  : m_messages( store.m_messages ), m_next( begin ), m_end( end ) {}
+
+  bool next( std::string& msg ) throw ( IOException )
+  {
+    if ( m_next > m_end ) return false;
+    MemoryStore::Messages::const_iterator find = m_messages.lower_bound( m_next );
+    if ( find == m_messages.end() || find->first > m_end )
+    {
+      m_next = m_end + 1;
+      return false;
+    }
+    msg = find->second;
+    m_next = find->first + 1;
+    return true;
+  }
+
+private:
+  const MemoryStore::Messages& m_messages;
+  int m_next;
+  int m_end;
+};
+
+MessageStoreCursor* MessageStore::cursor( int begin, int end ) const
+throw ( IOException )
+{
+  return new MessageStoreRangeCursor( *this, begin, end );
+}
+
+bool PagedMessageStoreCursor::next( std::string& msg ) throw ( IOException )
+{
+  while ( m_index >= m_page.size() )
+  {
+    if ( m_next > m_end ) return false;
+    m_index = 0;
+    m_next = fetch( m_next, m_end, m_pageSize, m_page );
+  }
+  msg.swap( m_page[ m_index++ ] );
+  return true;
+}
+
+int MessageStoreRangeCursor::fetch( int begin, int end, int limit,
+                                    std::vector < std::string > & page )
+throw ( IOException )
+{
+  int last = end - begin < limit ? end : begin + limit - 1;
+  m_store.get( begin, last, page );
+  return last + 1;
+}
+
 MessageStore* MemoryStoreFactory::create( const SessionID& )
 {
   return new MemoryStore();
@@ -54,6 +108,12 @@ throw( IOException )
     messages.push_back( find->second );
 }
 
+MessageStoreCursor* MemoryStore::cursor( int begin, int end ) const
+throw( IOException )
+{
+  return new MemoryStoreCursor( *this, begin, end );
+}
+
 MessageStore* MessageStoreFactoryExceptionWrapper::create( const SessionID& sessionID, bool& threw, ConfigError& ex )
 {
   threw = false;
@@ -80,6 +140,13 @@ void MessageStoreExceptionWrapper::get( int begin, int end, std::vector < std::s
   catch ( IOException & e ) { threw = true; ex = e; }
 }
 
+MessageStoreCursor* MessageStoreExceptionWrapper::cursor( int begin, int end, bool& threw, IOException& ex ) const
+{
+  threw = false;
+  try { return m_pStore->cursor( begin, end ); }
+  catch ( IOException & e ) { threw = true; ex = e; return 0; }
+}
+
 int MessageStoreExceptionWrapper::getNextSenderMsgSeqNum( bool& threw, IOException& ex ) const
 {
   threw = false;
@@ -34,6 +34,7 @@
 namespace FIX
 {
 class MessageStore;
+class MessageStoreCursor;
 
 /**
  * This interface must be implemented to create a MessageStore.
@@ -72,6 +73,9 @@ public:
   throw ( IOException ) = 0;
   virtual void get( int, int, std::vector < std::string > & ) const
   throw ( IOException ) = 0;
+  /// Iterate over a range without reading it up front, caller deletes
+  virtual MessageStoreCursor* cursor( int, int ) const
+  throw ( IOException );
 
   virtual int getNextSenderMsgSeqNum() const throw ( IOException ) = 0;
   virtual int getNextTargetMsgSeqNum() const throw ( IOException ) = 0;
@@ -88,6 +92,63 @@ public:
 };
 /*! @} */
 
+/**
+ * Iterates over a range of stored messages in sequence number order.
+ *
+ * Cursors are obtained from MessageStore::cursor and are owned by the
+ * caller.  The store must outlive any cursor created from it.
+ */
+class MessageStoreCursor
+{
+public:
+  virtual ~MessageStoreCursor() {}
+
+  /// Get the next message in the range, false once it is exhausted
+  virtual bool next( std::string& ) throw ( IOException ) = 0;
+};
+
+/**
+ * Cursor that reads its range one page at a time.
+ *
+ * Implementations fetch up to a page of messages starting at a sequence
+ * number and return the sequence number the next page starts from.
+ */
+class PagedMessageStoreCursor : public MessageStoreCursor
+{
+public:
+  PagedMessageStoreCursor( int begin, int end, int pageSize )
+  : m_next( begin ), m_end( end ),
+    m_pageSize( pageSize > 0 ? pageSize : 1 ), m_index( 0 ) {}
+
+  bool next( std::string& ) throw ( IOException );
+
+protected:
+  virtual int fetch( int begin, int end, int limit,
+                     std::vector < std::string > & ) throw ( IOException ) = 0;
+
+private:
+  int m_next;
+  int m_end;
+  int m_pageSize;
+  std::vector < std::string > m_page;
+  size_t m_index;
+};
+
+/// Adapts MessageStore::get into a cursor for stores without a native one.
+class MessageStoreRangeCursor : public PagedMessageStoreCursor
+{
+public:
+  MessageStoreRangeCursor( const MessageStore& store, int begin, int end,
+                           int pageSize = 100 )
+  : PagedMessageStoreCursor( begin, end, pageSize ), m_store( store ) {}
+
+protected:
+  int fetch( int, int, int, std::vector < std::string > & ) throw ( IOException );
+
+private:
+  const MessageStore& m_store;
+};
+
 /**
  * Memory based implementation of MessageStore.
  *
@@ -101,6 +162,7 @@ public:
 
   bool set( int, const std::string& ) throw ( IOException );
   void get( int, int, std::vector < std::string > & ) const throw ( IOException );
+  MessageStoreCursor* cursor( int, int ) const throw ( IOException );
 
   int getNextSenderMsgSeqNum() const throw ( IOException )
   { return m_nextSenderMsgSeqNum; }
@@ -134,6 +196,7 @@ public:
 
 private:
   typedef std::map < int, std::string > Messages;
+  friend class MemoryStoreCursor;
 
   Messages m_messages;
   int m_nextSenderMsgSeqNum;
@@ -163,6 +226,7 @@ public:
 
   bool set( int, const std::string&, bool&, IOException& );
   void get( int, int, std::vector < std::string > &, bool&, IOException& ) const;
+  MessageStoreCursor* cursor( int, int, bool&, IOException& ) const;
   int getNextSenderMsgSeqNum( bool&, IOException& ) const;
   int getNextTargetMsgSeqNum( bool&, IOException& ) const;
   void setNextSenderMsgSeqNum( int, bool&, IOException& );
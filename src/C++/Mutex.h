@@ -31,11 +31,11 @@ class Mutex
 {
 public:
   Mutex()
+  : m_count( 0 )
   {
 #ifdef _MSC_VER
     InitializeCriticalSection( &m_mutex );
 #else
-    m_count = 0;
     m_threadID = 0;
     //pthread_mutexattr_t attr;
     //pthread_mutexattr_init(&attr);
@@ -58,6 +58,7 @@ public:
   {
 #ifdef _MSC_VER
     EnterCriticalSection( &m_mutex );
+    ++m_count;
 #else
     if ( m_count && m_threadID == pthread_self() )
     { ++m_count; return ; }
@@ -70,6 +71,7 @@ public:
   void unlock()
   {
 #ifdef _MSC_VER
+    --m_count;
     LeaveCriticalSection( &m_mutex );
 #else
     if ( m_count > 1 )
@@ -80,14 +82,18 @@ public:
 #endif
   }
 
+  /// How many times the owning thread holds the lock, only that thread
+  /// may ask.
+  int depth() const { return m_count; }
+
 private:
 
+  int m_count;
 #ifdef _MSC_VER
   CRITICAL_SECTION m_mutex;
 #else
   pthread_mutex_t m_mutex;
   pthread_t m_threadID;
-  int m_count;
 #endif
 };
 
@@ -36,7 +36,11 @@
 #include <errmsg.h>
 #include "DatabaseConnectionID.h"
 #include "DatabaseConnectionPool.h"
+#include "FieldConvertors.h"
 #include "Mutex.h"
+#include <cstring>
+#include <map>
+#include <vector>
 
 #undef MYSQL_PORT
 
@@ -114,6 +118,175 @@ private:
   std::vector<MYSQL_ROW> m_rows;
 };
 
+/**
+ * Parameterized statement executed through MySQLConnection.
+ *
+ * The connection prepares each distinct statement once and reuses the
+ * prepared handle, so only the bound values travel on later executions.
+ */
+class MySQLStatement
+{
+public:
+  MySQLStatement( const std::string& statement )
+  : m_status( 0 ), m_statement( statement )
+  {}
+
+  const std::string& statement() const
+  {
+    return m_statement;
+  }
+
+  MySQLStatement& bind( const std::string& value )
+  {
+    m_values.push_back( value );
+    m_nulls.push_back( false );
+    return *this;
+  }
+
+  MySQLStatement& bind( int value )
+  {
+    return bind( IntConvertor::convert( value ) );
+  }
+
+  MySQLStatement& bindNull()
+  {
+    m_values.push_back( "" );
+    m_nulls.push_back( true );
+    return *this;
+  }
+
+  void clear()
+  {
+    m_values.clear();
+    m_nulls.clear();
+  }
+
+  bool execute( MYSQL_STMT* pStatement )
+  {
+    std::vector<MYSQL_BIND> binds( m_values.size() );
+    std::vector<unsigned long> lengths( m_values.size() );
+    for( size_t i = 0; i < m_values.size(); ++i )
+    {
+      memset( &binds[i], 0, sizeof(MYSQL_BIND) );
+      lengths[i] = m_values[i].size();
+      binds[i].buffer_type = m_nulls[i] ? MYSQL_TYPE_NULL : MYSQL_TYPE_STRING;
+      binds[i].buffer = (void*)m_values[i].data();
+      binds[i].buffer_length = lengths[i];
+      binds[i].length = &lengths[i];
+    }
+
+    m_rows.clear();
+    if( ( binds.size() && mysql_stmt_bind_param( pStatement, &binds[0] ) )
+        || mysql_stmt_execute( pStatement ) )
+    {
+      fail( mysql_stmt_errno( pStatement ), mysql_stmt_error( pStatement ) );
+      return false;
+    }
+    m_status = 0;
+
+    MYSQL_RES* pMetadata = mysql_stmt_result_metadata( pStatement );
+    if( !pMetadata )
+      return true;
+    const unsigned int columns = mysql_num_fields( pMetadata );
+    mysql_free_result( pMetadata );
+    return fetch( pStatement, columns );
+  }
+
+  int rows()
+  {
+    return (int)m_rows.size();
+  }
+
+  const std::string& getValue( int row, int column )
+  {
+    return m_rows[row][column];
+  }
+
+  void fail( int status, const std::string& reason )
+  {
+    m_status = status;
+    m_reason = reason;
+  }
+
+  bool success()
+  {
+    return m_status == 0;
+  }
+
+  bool disconnected()
+  {
+    return m_status == CR_SERVER_GONE_ERROR || m_status == CR_SERVER_LOST;
+  }
+
+  const std::string& reason()
+  {
+    return m_reason;
+  }
+
+  void throwException() throw( IOException )
+  {
+    if( !success() )
+      throw IOException( "Statement failed [" + m_statement + "] " + reason() );
+  }
+
+private:
+  /// Copy out every row, asking for each column once its length is known
+  bool fetch( MYSQL_STMT* pStatement, unsigned int columns )
+  {
+    std::vector<MYSQL_BIND> results( columns );
+    std::vector<unsigned long> lengths( columns );
+    std::vector<my_bool> nulls( columns );
+    for( unsigned int i = 0; i < columns; ++i )
+    {
+      memset( &results[i], 0, sizeof(MYSQL_BIND) );
+      results[i].buffer_type = MYSQL_TYPE_STRING;
+      results[i].length = &lengths[i];
+      results[i].is_null = &nulls[i];
+    }
+
+    int status = columns ? mysql_stmt_bind_result( pStatement, &results[0] ) : 0;
+    while( !status )
+    {
+      status = mysql_stmt_fetch( pStatement );
+      if( status == MYSQL_NO_DATA )
+      {
+        mysql_stmt_free_result( pStatement );
+        return true;
+      }
+      if( status && status != MYSQL_DATA_TRUNCATED )
+        break;
+
+      status = 0;
+      m_rows.push_back( std::vector<std::string>( columns ) );
+      for( unsigned int i = 0; i < columns && !status; ++i )
+      {
+        if( nulls[i] || !lengths[i] )
+          continue;
+        std::string& value = m_rows.back()[i];
+        value.resize( lengths[i] );
+        MYSQL_BIND column;
+        memset( &column, 0, sizeof(MYSQL_BIND) );
+        column.buffer_type = MYSQL_TYPE_STRING;
+        column.buffer = &value[0];
+        column.buffer_length = lengths[i];
+        status = mysql_stmt_fetch_column( pStatement, &column, i, 0 );
+      }
+    }
+
+    fail( mysql_stmt_errno( pStatement ), mysql_stmt_error( pStatement ) );
+    m_rows.clear();
+    mysql_stmt_free_result( pStatement );
+    return false;
+  }
+
+  int m_status;
+  std::string m_statement;
+  std::string m_reason;
+  std::vector<std::string> m_values;
+  std::vector<bool> m_nulls;
+  std::vector< std::vector<std::string> > m_rows;
+};
+
 class MySQLConnection
 {
 public:
@@ -134,6 +307,7 @@ public:
 
   ~MySQLConnection()
   {
+    closeStatements();
     if( m_pConnection )
       mysql_close( m_pConnection );
   }
@@ -161,6 +335,65 @@ public:
     return pQuery.execute( m_pConnection );
   }
 
+  bool execute( MySQLStatement& statement )
+  {
+    Locker locker( m_mutex );
+    int retry = 0;
+
+    do
+    {
+      MYSQL_STMT* pStatement = prepare( statement );
+      if( pStatement && statement.execute( pStatement ) )
+        return true;
+      if( !statement.disconnected() )
+        return false;
+      // a reconnect invalidates every prepared handle on the connection
+      closeStatements();
+      mysql_ping( m_pConnection );
+      retry++;
+    } while( retry <= 1 );
+    return statement.success();
+  }
+
+  /// Run the queries in one transaction, rolling back if any of them fail
+  bool execute( const std::vector<std::string>& queries, std::string& reason )
+  {
+    Locker locker( m_mutex );
+    if( mysql_query( m_pConnection, "START TRANSACTION" ) )
+    {
+      reason = mysql_error( m_pConnection );
+      mysql_ping( m_pConnection );
+      return false;
+    }
+
+    std::vector<std::string>::const_iterator i;
+    for( i = queries.begin(); i != queries.end(); ++i )
+    {
+      if( mysql_real_query( m_pConnection, i->data(), i->size() ) )
+      {
+        reason = mysql_error( m_pConnection );
+        mysql_rollback( m_pConnection );
+        return false;
+      }
+    }
+
+    if( mysql_commit( m_pConnection ) )
+    {
+      reason = mysql_error( m_pConnection );
+      return false;
+    }
+    return true;
+  }
+
+  std::string escape( const std::string& value )
+  {
+    Locker locker( m_mutex );
+    std::vector<char> buffer( value.size() * 2 + 1 );
+    unsigned long length = mysql_real_escape_string
+      ( m_pConnection, &buffer[0], value.data(), value.size() );
+    return std::string( &buffer[0], length );
+  }
+
 private:
   void connect()
   {
@@ -179,8 +412,43 @@ private:
     #endif
   }
 
+  MYSQL_STMT* prepare( MySQLStatement& statement )
+  {
+    Statements::iterator i = m_statements.find( statement.statement() );
+    if( i != m_statements.end() )
+      return i->second;
+
+    MYSQL_STMT* pStatement = mysql_stmt_init( m_pConnection );
+    if( !pStatement )
+    {
+      statement.fail( mysql_errno( m_pConnection ), mysql_error( m_pConnection ) );
+      return 0;
+    }
+
+    const std::string& text = statement.statement();
+    if( mysql_stmt_prepare( pStatement, text.data(), text.size() ) )
+    {
+      statement.fail( mysql_stmt_errno( pStatement ), mysql_stmt_error( pStatement ) );
+      mysql_stmt_close( pStatement );
+      return 0;
+    }
+    m_statements[ text ] = pStatement;
+    return pStatement;
+  }
+
+  void closeStatements()
+  {
+    Statements::iterator i;
+    for( i = m_statements.begin(); i != m_statements.end(); ++i )
+      mysql_stmt_close( i->second );
+    m_statements.clear();
+  }
+
+  typedef std::map<std::string, MYSQL_STMT*> Statements;
+
   MYSQL* m_pConnection;
   DatabaseConnectionID m_connectionID;
+  Statements m_statements;
   Mutex m_mutex;
 };
 
@@ -31,15 +31,44 @@
 #include "Utility.h"
 #include "strptime.h"
 #include <fstream>
+#include <map>
 
 namespace FIX
 {
 
+static MySQLStatement& bindSessionID( MySQLStatement& statement, const SessionID* pSessionID )
+{
+  if( !pSessionID )
+    return statement.bindNull().bindNull().bindNull().bindNull();
+
+  statement
+    .bind( pSessionID->getBeginString().getValue() )
+    .bind( pSessionID->getSenderCompID().getValue() )
+    .bind( pSessionID->getTargetCompID().getValue() );
+  if( pSessionID->getSessionQualifier().empty() )
+    return statement.bindNull();
+  return statement.bind( pSessionID->getSessionQualifier() );
+}
+
+static std::string sqlTime( const UtcTimeStamp& time, int& millis )
+{
+  int year, month, day, hour, minute, second;
+  time.getYMD( year, month, day );
+  time.getHMS( hour, minute, second, millis );
+
+  char sqlTime[ 20 ];
+  STRING_SPRINTF( sqlTime, "%d-%02d-%02d %02d:%02d:%02d",
+           year, month, day, hour, minute, second );
+  return sqlTime;
+}
+
 const std::string MySQLLogFactory::DEFAULT_DATABASE = "quickfix";
 const std::string MySQLLogFactory::DEFAULT_USER = "root";
 const std::string MySQLLogFactory::DEFAULT_PASSWORD = "";
 const std::string MySQLLogFactory::DEFAULT_HOST = "localhost";
 const short MySQLLogFactory::DEFAULT_PORT = 0;
+const int MySQLLogFactory::DEFAULT_BATCH_SIZE = 100;
+const int MySQLLogFactory::DEFAULT_QUEUE_SIZE = 10000;
 
 MySQLLog::MySQLLog
 ( const SessionID& s, const DatabaseConnectionID& d, MySQLConnectionPool* p )
@@ -73,6 +102,7 @@ MySQLLog::MySQLLog
   const std::string& password, const std::string& host, short port )
   : m_pConnectionPool( 0 ), m_pSessionID( 0 )
 {
+  init();
   m_pConnection = new MySQLConnection( database, user, password, host, port );
 }
 
@@ -81,10 +111,13 @@ void MySQLLog::init()
   setIncomingTable( "messages_log" );
   setOutgoingTable( "messages_log" );
   setEventTable( "event_log" );
+  m_pWriter = 0;
 }
 
 MySQLLog::~MySQLLog()
 {
+  // drain the queue while the connection is still open
+  delete m_pWriter;
   if( m_pConnectionPool )
     m_pConnectionPool->destroy( m_pConnection );
   else
@@ -92,6 +125,12 @@ MySQLLog::~MySQLLog()
   delete m_pSessionID;
 }
 
+void MySQLLog::setBatching( int flushInterval, int batchSize, int queueSize )
+{
+  delete m_pWriter;
+  m_pWriter = new Writer( *this, flushInterval, batchSize, queueSize );
+}
+
 Log* MySQLLogFactory::create()
 {
   std::string database;
@@ -176,6 +215,22 @@ void MySQLLogFactory::initLog( const Dictionary& settings, MySQLLog& log )
 
   try { log.setEventTable( settings.getString( MYSQL_LOG_EVENT_TABLE ) ); }
   catch( ConfigError& ) {}
+
+  int flushInterval = 0;
+  int batchSize = DEFAULT_BATCH_SIZE;
+  int queueSize = DEFAULT_QUEUE_SIZE;
+
+  try { flushInterval = settings.getInt( MYSQL_LOG_FLUSH_INTERVAL ); }
+  catch( ConfigError& ) {}
+
+  try { batchSize = settings.getInt( MYSQL_LOG_BATCH_SIZE ); }
+  catch( ConfigError& ) {}
+
+  try { queueSize = settings.getInt( MYSQL_LOG_QUEUE_SIZE ); }
+  catch( ConfigError& ) {}
+
+  if( flushInterval > 0 )
+    log.setBatching( flushInterval, batchSize, queueSize );
 }
 
 void MySQLLogFactory::destroy( Log* pLog )
@@ -185,6 +240,9 @@ void MySQLLogFactory::destroy( Log* pLog )
 
 void MySQLLog::clear()
 {
+  if( m_pWriter )
+    m_pWriter->flush();
+
   std::stringstream whereClause;
 
   whereClause << "WHERE ";
@@ -229,45 +287,70 @@ void MySQLLog::backup()
 
 void MySQLLog::insert( const std::string& table, const std::string value )
 {
-  UtcTimeStamp time;
-  int year, month, day, hour, minute, second, millis;
-  time.getYMD( year, month, day );
-  time.getHMS( hour, minute, second, millis );
-
-  char sqlTime[ 20 ];
-  STRING_SPRINTF( sqlTime, "%d-%02d-%02d %02d:%02d:%02d",
-           year, month, day, hour, minute, second );
-
-  char* valueCopy = new char[ (value.size() * 2) + 1 ];
-  mysql_escape_string( valueCopy, value.c_str(), value.size() );
+  if( m_pWriter )
+    m_pWriter->push( DatabaseLogRecord( table, value ) );
+  else
+    insert( DatabaseLogRecord( table, value ) );
+}
 
-  std::stringstream queryString;
-  queryString << "INSERT INTO " << table << " "
-  << "(time, time_milliseconds, beginstring, sendercompid, targetcompid, session_qualifier, text) "
-  << "VALUES ("
-  << "'" << sqlTime << "','" << millis << "',";
+void MySQLLog::insert( const DatabaseLogRecord& record )
+{
+  MySQLStatement statement( "INSERT INTO " + record.table + " "
+    "(time, time_milliseconds, beginstring, sendercompid, targetcompid, session_qualifier, text) "
+    "VALUES (?,?,?,?,?,?,?)" );
+
+  int millis;
+  statement.bind( sqlTime( record.time, millis ) ).bind( millis );
+  bindSessionID( statement, m_pSessionID ).bind( record.text );
+  m_pConnection->execute( statement );
+}
 
+void MySQLLog::write( const std::vector < DatabaseLogRecord > & records )
+{
+  std::stringstream session;
   if( m_pSessionID )
   {
-    queryString
-    << "\"" << m_pSessionID->getBeginString().getValue() << "\","
-    << "\"" << m_pSessionID->getSenderCompID().getValue() << "\","
-    << "\"" << m_pSessionID->getTargetCompID().getValue() << "\",";
+    session
+    << "\"" << m_pConnection->escape( m_pSessionID->getBeginString().getValue() ) << "\","
+    << "\"" << m_pConnection->escape( m_pSessionID->getSenderCompID().getValue() ) << "\","
+    << "\"" << m_pConnection->escape( m_pSessionID->getTargetCompID().getValue() ) << "\",";
     if( m_pSessionID->getSessionQualifier() == "" )
-      queryString << "NULL" << ",";
+      session << "NULL";
     else
-      queryString << "\"" << m_pSessionID->getSessionQualifier() << "\",";
+      session << "\"" << m_pConnection->escape( m_pSessionID->getSessionQualifier() ) << "\"";
   }
   else
   {
-    queryString << "NULL, NULL, NULL, NULL, ";
+    session << "NULL, NULL, NULL, NULL";
+  }
+
+  // one multi-row INSERT per table, all committed together
+  std::map < std::string, std::string > inserts;
+  std::vector < DatabaseLogRecord > ::const_iterator i;
+  for( i = records.begin(); i != records.end(); ++i )
+  {
+    std::string& insert = inserts[ i->table ];
+    insert += insert.empty()
+      ? "INSERT INTO " + i->table + " "
+        "(time, time_milliseconds, beginstring, sendercompid, targetcompid, session_qualifier, text) "
+        "VALUES "
+      : ",";
+
+    int millis;
+    std::string time = sqlTime( i->time, millis );
+    std::stringstream row;
+    row << "('" << time << "','" << millis << "'," << session.str() << ","
+        << "\"" << m_pConnection->escape( i->text ) << "\")";
+    insert += row.str();
   }
 
-  queryString << "\"" << valueCopy << "\")";
-  delete [] valueCopy;
+  std::vector < std::string > queries;
+  std::map < std::string, std::string > ::const_iterator j;
+  for( j = inserts.begin(); j != inserts.end(); ++j )
+    queries.push_back( j->second );
 
-  MySQLQuery query( queryString.str() );
-  m_pConnection->execute( query );
+  std::string reason;
+  m_pConnection->execute( queries, reason );
 }
 
 } //namespace FIX
@@ -35,13 +35,14 @@
 #include "Log.h"
 #include "SessionSettings.h"
 #include "MySQLConnection.h"
+#include "DatabaseBatchWriter.h"
 #include <fstream>
 #include <string>
 
 namespace FIX
 {
 /// MySQL based implementation of Log.
-class MySQLLog : public Log
+class MySQLLog : public Log, private DatabaseBatchSink < DatabaseLogRecord >
 {
 public:
   MySQLLog( const SessionID& s, const DatabaseConnectionID& d, MySQLConnectionPool* p );
@@ -61,6 +62,8 @@ public:
   { m_outgoingTable = outgoingTable; }
   void setEventTable( const std::string& eventTable )
   { m_eventTable = eventTable; }
+  /// Write from a background thread, batchSize records at a time
+  void setBatching( int flushInterval, int batchSize, int queueSize );
 
   void onIncoming( const std::string& value )
   { insert( m_incomingTable, value ); }
@@ -70,8 +73,12 @@ public:
   { insert( m_eventTable, value ); }
 
 private:
+  typedef DatabaseBatchWriter < DatabaseLogRecord > Writer;
+
   void init();
   void insert( const std::string& table, const std::string value );
+  void insert( const DatabaseLogRecord& record );
+  void write( const std::vector < DatabaseLogRecord > & records );
 
   std::string m_incomingTable;
   std::string m_outgoingTable;
@@ -79,6 +86,7 @@ private:
   MySQLConnection* m_pConnection;
   MySQLConnectionPool* m_pConnectionPool;
   SessionID* m_pSessionID;
+  Writer* m_pWriter;
 };
 
 /// Creates a MySQL based implementation of Log.
@@ -90,6 +98,8 @@ public:
   static const std::string DEFAULT_PASSWORD;
   static const std::string DEFAULT_HOST;
   static const short DEFAULT_PORT;
+  static const int DEFAULT_BATCH_SIZE;
+  static const int DEFAULT_QUEUE_SIZE;
 
   MySQLLogFactory( const SessionSettings& settings )
 : m_settings( settings ), m_useSettings( true ) 
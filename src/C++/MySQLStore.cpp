@@ -37,12 +37,58 @@
 namespace FIX
 {
 
+static MySQLStatement& bindSessionID( MySQLStatement& statement, const SessionID& sessionID )
+{
+  return statement
+    .bind( sessionID.getBeginString().getValue() )
+    .bind( sessionID.getSenderCompID().getValue() )
+    .bind( sessionID.getTargetCompID().getValue() )
+    .bind( sessionID.getSessionQualifier() );
+}
+
 const std::string MySQLStoreFactory::DEFAULT_DATABASE = "quickfix";
 const std::string MySQLStoreFactory::DEFAULT_USER = "";
 const std::string MySQLStoreFactory::DEFAULT_PASSWORD = "";
 const std::string MySQLStoreFactory::DEFAULT_HOST = "localhost";
 const short MySQLStoreFactory::DEFAULT_PORT = 3306;
 
+/// Pages through the messages table in msgseqnum order, a bounded number of rows at a time
+class MySQLStoreCursor : public PagedMessageStoreCursor
+{
+public:
+  MySQLStoreCursor( const MySQLStore& store, int begin, int end )
+  : PagedMessageStoreCursor( begin, end, PAGE_SIZE ), m_store( store ) {}
+
+protected:
+  int fetch( int begin, int end, int limit,
+             std::vector < std::string > & page ) throw ( IOException )
+  {
+    page.clear();
+    // LIMIT takes only integer parameters, the page size is fixed so the
+    // text, and the prepared statement, stays the same for every fetch
+    MySQLStatement query( "SELECT msgseqnum, message FROM messages WHERE "
+      "beginstring=? and sendercompid=? and targetcompid=? and session_qualifier=? and "
+      "msgseqnum>=? and msgseqnum<=? ORDER BY msgseqnum LIMIT "
+      + IntConvertor::convert( limit ) );
+    bindSessionID( query, m_store.m_sessionID ).bind( begin ).bind( end );
+    if( !m_store.m_pConnection->execute( query ) )
+      query.throwException();
+
+    int rows = query.rows();
+    for( int row = 0; row < rows; row++ )
+      page.push_back( query.getValue( row, 1 ) );
+
+    if( rows < limit )
+      return end + 1;
+    return atoi( query.getValue( rows - 1, 0 ).c_str() ) + 1;
+  }
+
+private:
+  enum { PAGE_SIZE = 100 };
+
+  const MySQLStore& m_store;
+};
+
 MySQLStore::MySQLStore
 ( const SessionID& s, const DatabaseConnectionID& d, MySQLConnectionPool* p )
   : m_pConnectionPool( p ), m_sessionID( s )
@@ -169,35 +215,17 @@ void MySQLStoreFactory::destroy( MessageStore* pStore )
 bool MySQLStore::set( int msgSeqNum, const std::string& msg )
 throw ( IOException )
 {
-  char* msgCopy = new char[ (msg.size() * 2) + 1 ];
-  mysql_escape_string( msgCopy, msg.c_str(), msg.size() );
-
-  std::stringstream queryString;
-  queryString << "INSERT INTO messages "
-  << "(beginstring, sendercompid, targetcompid, session_qualifier, msgseqnum, message) "
-  << "VALUES ("
-  << "\"" << m_sessionID.getBeginString().getValue() << "\","
-  << "\"" << m_sessionID.getSenderCompID().getValue() << "\","
-  << "\"" << m_sessionID.getTargetCompID().getValue() << "\","
-  << "\"" << m_sessionID.getSessionQualifier() << "\","
-  << msgSeqNum << ","
-  << "\"" << msgCopy << "\")";
-
-  delete [] msgCopy;
-
-  MySQLQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
+  MySQLStatement insert( "INSERT INTO messages "
+    "(beginstring, sendercompid, targetcompid, session_qualifier, msgseqnum, message) "
+    "VALUES (?,?,?,?,?,?)" );
+  bindSessionID( insert, m_sessionID ).bind( msgSeqNum ).bind( msg );
+  if( !m_pConnection->execute( insert ) )
   {
-    std::stringstream queryString2;
-    queryString2 << "UPDATE messages SET message=\"" << msg << "\" WHERE "
-    << "beginstring=" << "\"" << m_sessionID.getBeginString().getValue() << "\" and "
-    << "sendercompid=" << "\"" << m_sessionID.getSenderCompID().getValue() << "\" and "
-    << "targetcompid=" << "\"" << m_sessionID.getTargetCompID().getValue() << "\" and "
-    << "session_qualifier=" << "\"" << m_sessionID.getSessionQualifier() << "\" and "
-    << "msgseqnum=" << msgSeqNum;
-    MySQLQuery query2( queryString2.str() );
-    if( !m_pConnection->execute(query2) )
-      query2.throwException();
+    MySQLStatement update( "UPDATE messages SET message=? WHERE "
+      "beginstring=? and sendercompid=? and targetcompid=? and session_qualifier=? and msgseqnum=?" );
+    bindSessionID( update.bind( msg ), m_sessionID ).bind( msgSeqNum );
+    if( !m_pConnection->execute( update ) )
+      update.throwException();
   }
   return true;
 }
@@ -207,17 +235,11 @@ void MySQLStore::get( int begin, int end,
 throw ( IOException )
 {
   result.clear();
-  std::stringstream queryString;
-  queryString << "SELECT message FROM messages WHERE "
-  << "beginstring=" << "\"" << m_sessionID.getBeginString().getValue() << "\" and "
-  << "sendercompid=" << "\"" << m_sessionID.getSenderCompID().getValue() << "\" and "
-  << "targetcompid=" << "\"" << m_sessionID.getTargetCompID().getValue() << "\" and "
-  << "session_qualifier=" << "\"" << m_sessionID.getSessionQualifier() << "\" and "
-  << "msgseqnum>=" << begin << " and " << "msgseqnum<=" << end << " "
-  << "ORDER BY msgseqnum";
-
-  MySQLQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
+  MySQLStatement query( "SELECT message FROM messages WHERE "
+    "beginstring=? and sendercompid=? and targetcompid=? and session_qualifier=? and "
+    "msgseqnum>=? and msgseqnum<=? ORDER BY msgseqnum" );
+  bindSessionID( query, m_sessionID ).bind( begin ).bind( end );
+  if( !m_pConnection->execute( query ) )
     query.throwException();
 
   int rows = query.rows();
@@ -225,6 +247,12 @@ throw ( IOException )
     result.push_back( query.getValue( row, 0 ) );
 }
 
+MessageStoreCursor* MySQLStore::cursor( int begin, int end ) const
+throw ( IOException )
+{
+  return new MySQLStoreCursor( *this, begin, end );
+}
+
 int MySQLStore::getNextSenderMsgSeqNum() const throw ( IOException )
 {
   return m_cache.getNextSenderMsgSeqNum();
@@ -237,31 +265,21 @@ int MySQLStore::getNextTargetMsgSeqNum() const throw ( IOException )
 
 void MySQLStore::setNextSenderMsgSeqNum( int value ) throw ( IOException )
 {
-  std::stringstream queryString;
-  queryString << "UPDATE sessions SET outgoing_seqnum=" << value << " WHERE "
-  << "beginstring=" << "\"" << m_sessionID.getBeginString().getValue() << "\" and "
-  << "sendercompid=" << "\"" << m_sessionID.getSenderCompID().getValue() << "\" and "
-  << "targetcompid=" << "\"" << m_sessionID.getTargetCompID().getValue() << "\" and "
-  << "session_qualifier=" << "\"" << m_sessionID.getSessionQualifier() << "\"";
-  MySQLQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
-    query.throwException();
+  MySQLStatement update( "UPDATE sessions SET outgoing_seqnum=? WHERE "
+    "beginstring=? and sendercompid=? and targetcompid=? and session_qualifier=?" );
+  bindSessionID( update.bind( value ), m_sessionID );
+  if( !m_pConnection->execute( update ) )
+    update.throwException();
   m_cache.setNextSenderMsgSeqNum( value );
 }
 
 void MySQLStore::setNextTargetMsgSeqNum( int value ) throw ( IOException )
 {
-  std::stringstream queryString;
-  queryString << "UPDATE sessions SET incoming_seqnum=" << value << " WHERE "
-  << "beginstring=" << "\"" << m_sessionID.getBeginString().getValue() << "\" and "
-  << "sendercompid=" << "\"" << m_sessionID.getSenderCompID().getValue() << "\" and "
-  << "targetcompid=" << "\"" << m_sessionID.getTargetCompID().getValue() << "\" and "
-  << "session_qualifier=" << "\"" << m_sessionID.getSessionQualifier() << "\"";
-
-  MySQLQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
-    query.throwException();
-
+  MySQLStatement update( "UPDATE sessions SET incoming_seqnum=? WHERE "
+    "beginstring=? and sendercompid=? and targetcompid=? and session_qualifier=?" );
+  bindSessionID( update.bind( value ), m_sessionID );
+  if( !m_pConnection->execute( update ) )
+    update.throwException();
   m_cache.setNextTargetMsgSeqNum( value );
 }
 
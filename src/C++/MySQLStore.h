@@ -115,6 +115,7 @@ public:
 
   bool set( int, const std::string& ) throw ( IOException );
   void get( int, int, std::vector < std::string > & ) const throw ( IOException );
+  MessageStoreCursor* cursor( int, int ) const throw ( IOException );
 
   int getNextSenderMsgSeqNum() const throw ( IOException );
   int getNextTargetMsgSeqNum() const throw ( IOException );
@@ -129,6 +130,7 @@ public:
   void refresh() throw ( IOException );
 
 private:
+  friend class MySQLStoreCursor;
   void populateCache();
 
   MemoryStore m_cache;
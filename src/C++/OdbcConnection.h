@@ -40,7 +40,10 @@
 #include "DatabaseConnectionID.h"
 #include "DatabaseConnectionPool.h"
 #include "Exceptions.h"
+#include "FieldConvertors.h"
 #include "Mutex.h"
+#include <map>
+#include <vector>
 
 namespace FIX
 {
@@ -147,6 +150,109 @@ private:
   std::string m_reason;
 };
 
+/**
+ * Parameterized statement executed through OdbcConnection.
+ *
+ * The connection prepares each distinct statement once and keeps the
+ * statement handle, so later executions only bind new values.
+ */
+class OdbcStatement
+{
+public:
+  OdbcStatement( const std::string& statement )
+  : m_result( SQL_SUCCESS ), m_statement( statement )
+  {}
+
+  const std::string& statement() const
+  {
+    return m_statement;
+  }
+
+  OdbcStatement& bind( const std::string& value )
+  {
+    m_values.push_back( value );
+    m_nulls.push_back( false );
+    return *this;
+  }
+
+  OdbcStatement& bind( int value )
+  {
+    return bind( IntConvertor::convert( value ) );
+  }
+
+  OdbcStatement& bindNull()
+  {
+    m_values.push_back( "" );
+    m_nulls.push_back( true );
+    return *this;
+  }
+
+  void clear()
+  {
+    m_values.clear();
+    m_nulls.clear();
+  }
+
+  bool execute( HSTMT statement )
+  {
+    m_lengths.resize( m_values.size() );
+    for( size_t i = 0; i < m_values.size(); ++i )
+    {
+      SQLULEN size = m_values[i].size() ? m_values[i].size() : 1;
+      m_lengths[i] = m_nulls[i] ? SQL_NULL_DATA : (SQLLEN)m_values[i].size();
+      m_result = SQLBindParameter
+        ( statement, (SQLUSMALLINT)(i + 1), SQL_PARAM_INPUT, SQL_C_CHAR,
+          SQL_VARCHAR, size, 0, (SQLPOINTER)m_values[i].c_str(),
+          (SQLLEN)m_values[i].size(), &m_lengths[i] );
+      if( !success() )
+      {
+        fail( odbcError( SQL_HANDLE_STMT, statement ) );
+        SQLFreeStmt( statement, SQL_RESET_PARAMS );
+        return false;
+      }
+    }
+
+    m_result = SQLExecute( statement );
+    if( m_result == SQL_NO_DATA )
+      m_result = SQL_SUCCESS;
+    if( !success() )
+      m_reason = odbcError( SQL_HANDLE_STMT, statement );
+    SQLFreeStmt( statement, SQL_CLOSE );
+    SQLFreeStmt( statement, SQL_RESET_PARAMS );
+    return success();
+  }
+
+  void fail( const std::string& reason )
+  {
+    m_result = SQL_ERROR;
+    m_reason = reason;
+  }
+
+  bool success()
+  {
+    return odbcSuccess( m_result );
+  }
+
+  const std::string& reason()
+  {
+    return m_reason;
+  }
+
+  void throwException() throw( IOException )
+  {
+    if( !success() )
+      throw IOException( "Statement failed [" + m_statement + "] " + reason() );
+  }
+
+private:
+  RETCODE m_result;
+  std::string m_statement;
+  std::string m_reason;
+  std::vector<std::string> m_values;
+  std::vector<bool> m_nulls;
+  std::vector<SQLLEN> m_lengths;
+};
+
 class OdbcConnection
 {
 public:
@@ -167,6 +273,7 @@ public:
 
   ~OdbcConnection()
   {
+    closeStatements();
     if( m_connection )
     {
       SQLDisconnect( m_connection );
@@ -189,6 +296,7 @@ public:
   bool reconnect()
   {
     Locker locker( m_mutex );
+    closeStatements();
     SQLDisconnect( m_connection );
     SQLFreeHandle( SQL_HANDLE_DBC, m_connection );
     m_connection = 0;
@@ -207,6 +315,44 @@ public:
     return true;
   }
 
+  bool execute( OdbcStatement& statement )
+  {
+    Locker locker( m_mutex );
+    HSTMT handle = prepare( statement );
+    if( handle && statement.execute( handle ) )
+      return true;
+    if( !dead() )
+      return false;
+
+    reconnect();
+    handle = prepare( statement );
+    return handle && statement.execute( handle );
+  }
+
+  /// Execute the statements in one transaction, rolling back if any fail
+  bool execute( std::vector<OdbcStatement>& statements, std::string& reason )
+  {
+    Locker locker( m_mutex );
+    if( dead() )
+      reconnect();
+
+    SQLSetConnectAttr( m_connection, SQL_ATTR_AUTOCOMMIT,
+                       (SQLPOINTER)SQL_AUTOCOMMIT_OFF, 0 );
+    bool success = true;
+    std::vector<OdbcStatement>::iterator i;
+    for( i = statements.begin(); success && i != statements.end(); ++i )
+    {
+      HSTMT handle = prepare( *i );
+      success = handle && i->execute( handle );
+      if( !success )
+        reason = i->reason();
+    }
+    SQLEndTran( SQL_HANDLE_DBC, m_connection, success ? SQL_COMMIT : SQL_ROLLBACK );
+    SQLSetConnectAttr( m_connection, SQL_ATTR_AUTOCOMMIT,
+                       (SQLPOINTER)SQL_AUTOCOMMIT_ON, 0 );
+    return success;
+  }
+
 private:
   void connect()
   {
@@ -254,6 +400,48 @@ private:
     m_connected = true;
   }
 
+  HSTMT prepare( OdbcStatement& statement )
+  {
+    const std::string& text = statement.statement();
+    Statements::iterator i = m_statements.find( text );
+    if( i != m_statements.end() )
+      return i->second;
+
+    HSTMT handle = 0;
+    if( !odbcSuccess( SQLAllocHandle( SQL_HANDLE_STMT, m_connection, &handle ) ) )
+    {
+      statement.fail( odbcError( SQL_HANDLE_DBC, m_connection ) );
+      return 0;
+    }
+    if( !odbcSuccess( SQLPrepare( handle, (SQLCHAR*)text.c_str(), text.size() ) ) )
+    {
+      statement.fail( odbcError( SQL_HANDLE_STMT, handle ) );
+      SQLFreeHandle( SQL_HANDLE_STMT, handle );
+      return 0;
+    }
+    m_statements[ text ] = handle;
+    return handle;
+  }
+
+  void closeStatements()
+  {
+    Statements::iterator i;
+    for( i = m_statements.begin(); i != m_statements.end(); ++i )
+      SQLFreeHandle( SQL_HANDLE_STMT, i->second );
+    m_statements.clear();
+  }
+
+  bool dead()
+  {
+    SQLUINTEGER dead = SQL_CD_FALSE;
+    RETCODE result = SQLGetConnectAttr
+      ( m_connection, SQL_ATTR_CONNECTION_DEAD, &dead, 0, 0 );
+    return odbcSuccess( result ) && dead == SQL_CD_TRUE;
+  }
+
+  typedef std::map<std::string, HSTMT> Statements;
+
+  Statements m_statements;
   HENV m_environment;
   HDBC m_connection;
   bool m_connected;
@@ -31,14 +31,43 @@
 #include "Utility.h"
 #include "strptime.h"
 #include <fstream>
+#include <map>
 
 namespace FIX
 {
 
+static OdbcStatement& bindSessionID( OdbcStatement& statement, const SessionID* pSessionID )
+{
+  if( !pSessionID )
+    return statement.bindNull().bindNull().bindNull().bindNull();
+
+  statement
+    .bind( pSessionID->getBeginString().getValue() )
+    .bind( pSessionID->getSenderCompID().getValue() )
+    .bind( pSessionID->getTargetCompID().getValue() );
+  if( pSessionID->getSessionQualifier().empty() )
+    return statement.bindNull();
+  return statement.bind( pSessionID->getSessionQualifier() );
+}
+
+static std::string sqlTime( const UtcTimeStamp& time )
+{
+  int year, month, day, hour, minute, second, millis;
+  time.getYMD( year, month, day );
+  time.getHMS( hour, minute, second, millis );
+
+  char sqlTime[ 24 ];
+  STRING_SPRINTF( sqlTime, "%d-%02d-%02d %02d:%02d:%02d.%03d",
+           year, month, day, hour, minute, second, millis );
+  return sqlTime;
+}
+
 const std::string OdbcLogFactory::DEFAULT_USER = "sa";
 const std::string OdbcLogFactory::DEFAULT_PASSWORD = "";
 const std::string OdbcLogFactory::DEFAULT_CONNECTION_STRING
   = "DATABASE=quickfix;DRIVER={SQL Server};SERVER=(local);";
+const int OdbcLogFactory::DEFAULT_BATCH_SIZE = 100;
+const int OdbcLogFactory::DEFAULT_QUEUE_SIZE = 10000;
 
 OdbcLog::OdbcLog
 ( const SessionID& s, const std::string& user, const std::string& password, 
@@ -63,14 +92,23 @@ void OdbcLog::init()
   setIncomingTable( "messages_log" );
   setOutgoingTable( "messages_log" );
   setEventTable( "event_log" );
+  m_pWriter = 0;
 }
 
 OdbcLog::~OdbcLog()
 {
+  // drain the queue while the connection is still open
+  delete m_pWriter;
   delete m_pSessionID;
   delete m_pConnection;
 }
 
+void OdbcLog::setBatching( int flushInterval, int batchSize, int queueSize )
+{
+  delete m_pWriter;
+  m_pWriter = new Writer( *this, flushInterval, batchSize, queueSize );
+}
+
 OdbcLogFactory::OdbcLogFactory( const std::string& user, const std::string& password, 
                                 const std::string& connectionString )
 : m_user( user ), m_password( password ), m_connectionString( connectionString ),
@@ -154,6 +192,22 @@ void OdbcLogFactory::initLog( const Dictionary& settings, OdbcLog& log )
 
   try { log.setEventTable( settings.getString( ODBC_LOG_EVENT_TABLE ) ); }
   catch( ConfigError& ) {}
+
+  int flushInterval = 0;
+  int batchSize = DEFAULT_BATCH_SIZE;
+  int queueSize = DEFAULT_QUEUE_SIZE;
+
+  try { flushInterval = settings.getInt( ODBC_LOG_FLUSH_INTERVAL ); }
+  catch( ConfigError& ) {}
+
+  try { batchSize = settings.getInt( ODBC_LOG_BATCH_SIZE ); }
+  catch( ConfigError& ) {}
+
+  try { queueSize = settings.getInt( ODBC_LOG_QUEUE_SIZE ); }
+  catch( ConfigError& ) {}
+
+  if( flushInterval > 0 )
+    log.setBatching( flushInterval, batchSize, queueSize );
 }
 
 void OdbcLogFactory::destroy( Log* pLog )
@@ -163,6 +217,9 @@ void OdbcLogFactory::destroy( Log* pLog )
 
 void OdbcLog::clear()
 {
+  if( m_pWriter )
+    m_pWriter->flush();
+
   std::stringstream whereClause;
 
   whereClause << "WHERE ";
@@ -207,44 +264,41 @@ void OdbcLog::backup()
 
 void OdbcLog::insert( const std::string& table, const std::string value )
 {
-  UtcTimeStamp time;
-  int year, month, day, hour, minute, second, millis;
-  time.getYMD( year, month, day );
-  time.getHMS( hour, minute, second, millis );
-
-  char sqlTime[ 24 ];
-  STRING_SPRINTF( sqlTime, "%d-%02d-%02d %02d:%02d:%02d.%003d",
-                  year, month, day, hour, minute, second, millis );
-
-  std::string valueCopy = value;
-  string_replace( "'", "''", valueCopy );
+  if( m_pWriter )
+    m_pWriter->push( DatabaseLogRecord( table, value ) );
+  else
+    insert( DatabaseLogRecord( table, value ) );
+}
 
-  std::stringstream queryString;
-  queryString << "INSERT INTO " << table << " "
-  << "(time, beginstring, sendercompid, targetcompid, session_qualifier, text) "
-  << "VALUES ("
-  << "{ts '" << sqlTime << "'},";
+static OdbcStatement statement( const DatabaseLogRecord& record, const SessionID* pSessionID )
+{
+  OdbcStatement statement( "INSERT INTO " + record.table + " "
+    "(time, beginstring, sendercompid, targetcompid, session_qualifier, text) "
+    "VALUES (?,?,?,?,?,?)" );
 
-  if( m_pSessionID )
-  {
-    queryString
-    << "'" << m_pSessionID->getBeginString().getValue() << "',"
-    << "'" << m_pSessionID->getSenderCompID().getValue() << "',"
-    << "'" << m_pSessionID->getTargetCompID().getValue() << "',";
-    if( m_pSessionID->getSessionQualifier() == "" )
-      queryString << "NULL" << ",";
-    else
-      queryString << "'" << m_pSessionID->getSessionQualifier() << "',";
-  }
-  else
-  {
-    queryString << "NULL, NULL, NULL, NULL, ";
-  }
+  statement.bind( sqlTime( record.time ) );
+  bindSessionID( statement, pSessionID ).bind( record.text );
+  return statement;
+}
 
-  queryString << "'" << valueCopy << "')";
+void OdbcLog::insert( const DatabaseLogRecord& record )
+{
+  OdbcStatement insert = statement( record, m_pSessionID );
+  m_pConnection->execute( insert );
+}
 
-  OdbcQuery query( queryString.str() );
-  m_pConnection->execute( query );
+void OdbcLog::write( const std::vector < DatabaseLogRecord > & records )
+{
+  // multi-row VALUES is not portable across ODBC drivers, so the batch
+  // reuses the prepared single row insert inside one transaction
+  std::vector < OdbcStatement > statements;
+  statements.reserve( records.size() );
+  std::vector < DatabaseLogRecord > ::const_iterator i;
+  for( i = records.begin(); i != records.end(); ++i )
+    statements.push_back( statement( *i, m_pSessionID ) );
+
+  std::string reason;
+  m_pConnection->execute( statements, reason );
 }
 
 }
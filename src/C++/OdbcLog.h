@@ -32,6 +32,7 @@
 #endif
 
 #include "OdbcConnection.h"
+#include "DatabaseBatchWriter.h"
 #include "Log.h"
 #include "SessionSettings.h"
 #include <fstream>
@@ -40,7 +41,7 @@
 namespace FIX
 {
 /// ODBC based implementation of Log.
-class OdbcLog : public Log
+class OdbcLog : public Log, private DatabaseBatchSink < DatabaseLogRecord >
 {
 public:
   OdbcLog( const SessionID& s, const std::string& user, const std::string& password, 
@@ -58,6 +59,8 @@ public:
   { m_outgoingTable = outgoingTable; }
   void setEventTable( const std::string& eventTable )
   { m_eventTable = eventTable; }
+  /// Write from a background thread, batchSize records at a time
+  void setBatching( int flushInterval, int batchSize, int queueSize );
 
   void onIncoming( const std::string& value )
   { insert( m_incomingTable, value ); }
@@ -67,14 +70,19 @@ public:
   { insert( m_eventTable, value ); }
 
 private:
+  typedef DatabaseBatchWriter < DatabaseLogRecord > Writer;
+
   void init();
   void insert( const std::string& table, const std::string value );
+  void insert( const DatabaseLogRecord& record );
+  void write( const std::vector < DatabaseLogRecord > & records );
 
   std::string m_incomingTable;
   std::string m_outgoingTable;
   std::string m_eventTable;
   OdbcConnection* m_pConnection;
   SessionID* m_pSessionID;
+  Writer* m_pWriter;
 };
 
 /// Creates a ODBC based implementation of Log.
@@ -84,6 +92,8 @@ public:
   static const std::string DEFAULT_USER;
   static const std::string DEFAULT_PASSWORD;
   static const std::string DEFAULT_CONNECTION_STRING;
+  static const int DEFAULT_BATCH_SIZE;
+  static const int DEFAULT_QUEUE_SIZE;
 
   OdbcLogFactory( const SessionSettings& settings )
   : m_settings( settings ), m_useSettings( true ) {}
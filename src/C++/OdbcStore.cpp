@@ -41,6 +41,15 @@
 namespace FIX
 {
 
+static OdbcStatement& bindSessionID( OdbcStatement& statement, const SessionID& sessionID )
+{
+  return statement
+    .bind( sessionID.getBeginString().getValue() )
+    .bind( sessionID.getSenderCompID().getValue() )
+    .bind( sessionID.getTargetCompID().getValue() )
+    .bind( sessionID.getSessionQualifier() );
+}
+
 const std::string OdbcStoreFactory::DEFAULT_USER = "sa";
 const std::string OdbcStoreFactory::DEFAULT_PASSWORD = "";
 const std::string OdbcStoreFactory::DEFAULT_CONNECTION_STRING 
@@ -164,34 +173,17 @@ MessageStore* OdbcStoreFactory::create( const SessionID& s, const Dictionary& se
 bool OdbcStore::set( int msgSeqNum, const std::string& msg )
 throw ( IOException )
 {
-  std::string msgCopy = msg;
-  string_replace( "'", "''", msgCopy );
-
-  std::stringstream queryString;
-  queryString << "INSERT INTO messages "
-  << "(beginstring, sendercompid, targetcompid, session_qualifier, msgseqnum, message) "
-  << "VALUES ("
-  << "'" << m_sessionID.getBeginString().getValue() << "',"
-  << "'" << m_sessionID.getSenderCompID().getValue() << "',"
-  << "'" << m_sessionID.getTargetCompID().getValue() << "',"
-  << "'" << m_sessionID.getSessionQualifier() << "',"
-  << msgSeqNum << ","
-  << "'" << msgCopy << "')";
-
-  OdbcQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
+  OdbcStatement insert( "INSERT INTO messages "
+    "(beginstring, sendercompid, targetcompid, session_qualifier, msgseqnum, message) "
+    "VALUES (?,?,?,?,?,?)" );
+  bindSessionID( insert, m_sessionID ).bind( msgSeqNum ).bind( msg );
+  if( !m_pConnection->execute( insert ) )
   {
-    query.close();
-    std::stringstream queryString2;
-    queryString2 << "UPDATE messages SET message='" << msgCopy << "' WHERE "
-    << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-    << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-    << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-    << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "' and "
-    << "msgseqnum=" << msgSeqNum;
-    OdbcQuery query2( queryString2.str() );
-    if( !m_pConnection->execute(query2) )
-      query2.throwException();
+    OdbcStatement update( "UPDATE messages SET message=? WHERE "
+      "beginstring=? and sendercompid=? and targetcompid=? and session_qualifier=? and msgseqnum=?" );
+    bindSessionID( update.bind( msg ), m_sessionID ).bind( msgSeqNum );
+    if( !m_pConnection->execute( update ) )
+      update.throwException();
   }
   return true;
 }
@@ -243,31 +235,21 @@ int OdbcStore::getNextTargetMsgSeqNum() const throw ( IOException )
 
 void OdbcStore::setNextSenderMsgSeqNum( int value ) throw ( IOException )
 {
-  std::stringstream queryString;
-  queryString << "UPDATE sessions SET outgoing_seqnum=" << value << " WHERE "
-  << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-  << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-  << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-  << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "'";
-  OdbcQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
-    query.throwException();
+  OdbcStatement update( "UPDATE sessions SET outgoing_seqnum=? WHERE "
+    "beginstring=? and sendercompid=? and targetcompid=? and session_qualifier=?" );
+  bindSessionID( update.bind( value ), m_sessionID );
+  if( !m_pConnection->execute( update ) )
+    update.throwException();
   m_cache.setNextSenderMsgSeqNum( value );
 }
 
 void OdbcStore::setNextTargetMsgSeqNum( int value ) throw ( IOException )
 {
-  std::stringstream queryString;
-  queryString << "UPDATE sessions SET incoming_seqnum=" << value << " WHERE "
-  << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-  << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-  << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-  << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "'";
-
-  OdbcQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
-    query.throwException();
-
+  OdbcStatement update( "UPDATE sessions SET incoming_seqnum=? WHERE "
+    "beginstring=? and sendercompid=? and targetcompid=? and session_qualifier=?" );
+  bindSessionID( update.bind( value ), m_sessionID );
+  if( !m_pConnection->execute( update ) )
+    update.throwException();
   m_cache.setNextTargetMsgSeqNum( value );
 }
 
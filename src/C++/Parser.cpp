@@ -31,12 +31,13 @@
 namespace FIX
 {
 bool Parser::extractLength( int& length, std::string::size_type& pos,
-                            const std::string& buffer )
+                            const std::string& buffer,
+                            std::string::size_type start )
 throw( MessageParseError )
 {
-  if( !buffer.size() ) return false;
+  if( buffer.size() <= start ) return false;
 
-  std::string::size_type startPos = buffer.find( "\0019=", 0 );
+  std::string::size_type startPos = buffer.find( "\0019=", start );
   if( startPos == std::string::npos ) return false;
   startPos += 3;
   std::string::size_type endPos = buffer.find( "\001", startPos );
@@ -61,16 +62,16 @@ throw( MessageParseError )
 {
   std::string::size_type pos = 0;
 
-  if( m_buffer.length() < 2 ) return false;
-  pos = m_buffer.find( "8=" );
+  if( m_buffer.length() < m_start + 2 ) return false;
+  pos = m_buffer.find( "8=", m_start );
   if( pos == std::string::npos ) return false;
-  m_buffer.erase( 0, pos );
+  m_start = pos;
 
   int length = 0;
 
   try
   {
-    if( extractLength(length, pos, m_buffer) )
+    if( extractLength(length, pos, m_buffer, m_start) )
     {
       pos += length;
       if( m_buffer.size() < pos )
@@ -83,17 +84,25 @@ throw( MessageParseError )
       if( pos == std::string::npos ) return false;
       pos += 1;
 
-      str.assign( m_buffer, 0, pos );
-      m_buffer.erase( 0, pos );
+      str.assign( m_buffer, m_start, pos - m_start );
+      m_start = pos;
+      if( m_start == m_buffer.size() )
+      {
+        m_buffer.clear();
+        m_start = 0;
+      }
       return true;
     }
   }
   catch( MessageParseError& e )
   {
-    if( length > 0 )
-      m_buffer.erase( 0, pos + length );
+    if( length > 0 && pos + length < m_buffer.size() )
+      m_start = pos + length;
     else
+    {
       m_buffer.erase();
+      m_start = 0;
+    }
 
     throw e;
   }
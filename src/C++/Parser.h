@@ -32,26 +32,41 @@
 
 namespace FIX
 {
-/// Parses %FIX messages off an input stream.
+/**
+ * Parses %FIX messages off an input stream.
+ *
+ * Messages read off the front of the stream only move a start offset,
+ * the consumed text is dropped once per addToStream.  A read holding
+ * many messages is then not shifted down once for every message.
+ */
 class Parser
 {
 public:
-  Parser() {}
+  Parser() : m_start( 0 ) {}
   ~Parser() {}
 
   bool extractLength( int& length, std::string::size_type& pos,
-                      const std::string& buffer )
+                      const std::string& buffer,
+                      std::string::size_type start = 0 )
   throw ( MessageParseError );
   bool readFixMessage( std::string& str )
   throw ( MessageParseError );
 
   void addToStream( const char* str, size_t len )
-  { m_buffer.append( str, len ); }
+  { compact(); m_buffer.append( str, len ); }
   void addToStream( const std::string& str )
-  { m_buffer.append( str ); }
+  { compact(); m_buffer.append( str ); }
 
 private:
+  void compact()
+  {
+    if( !m_start ) return;
+    m_buffer.erase( 0, m_start );
+    m_start = 0;
+  }
+
   std::string m_buffer;
+  std::string::size_type m_start;
 };
 }
 #endif //FIX_PARSER_H
@@ -35,7 +35,10 @@
 #include <libpq-fe.h>
 #include "DatabaseConnectionID.h"
 #include "DatabaseConnectionPool.h"
+#include "FieldConvertors.h"
 #include "Mutex.h"
+#include <map>
+#include <vector>
 
 namespace FIX
 {
@@ -101,6 +104,112 @@ private:
   std::string m_query; 
 };
 
+/**
+ * Parameterized statement executed through PostgreSQLConnection.
+ *
+ * The connection prepares each distinct statement once and reuses it,
+ * so only the bound values travel on later executions.
+ */
+class PostgreSQLStatement
+{
+public:
+  PostgreSQLStatement( const std::string& statement )
+  : m_result( 0 ), m_status( PGRES_COMMAND_OK ), m_statement( statement )
+  {}
+
+  ~PostgreSQLStatement()
+  {
+    if( m_result )
+      PQclear( m_result );
+  }
+
+  const std::string& statement() const
+  {
+    return m_statement;
+  }
+
+  PostgreSQLStatement& bind( const std::string& value )
+  {
+    m_values.push_back( value );
+    m_nulls.push_back( false );
+    return *this;
+  }
+
+  PostgreSQLStatement& bind( int value )
+  {
+    return bind( IntConvertor::convert( value ) );
+  }
+
+  PostgreSQLStatement& bindNull()
+  {
+    m_values.push_back( "" );
+    m_nulls.push_back( true );
+    return *this;
+  }
+
+  void clear()
+  {
+    m_values.clear();
+    m_nulls.clear();
+  }
+
+  bool execute( PGconn* pConnection, const std::string& name )
+  {
+    std::vector<const char*> values( m_values.size() );
+    for( size_t i = 0; i < m_values.size(); ++i )
+      values[i] = m_nulls[i] ? 0 : m_values[i].c_str();
+
+    if( m_result ) PQclear( m_result );
+    m_result = PQexecPrepared
+      ( pConnection, name.c_str(), (int)values.size(),
+        values.size() ? &values[0] : 0, 0, 0, 0 );
+    m_status = PQresultStatus( m_result );
+    m_reason = success() ? "" : PQresultErrorMessage( m_result );
+    return success();
+  }
+
+  int rows()
+  {
+    return m_result ? PQntuples( m_result ) : 0;
+  }
+
+  char* getValue( int row, int column )
+  {
+    return PQgetvalue( m_result, row, column );
+  }
+
+  void fail( const std::string& reason )
+  {
+    m_status = PGRES_FATAL_ERROR;
+    m_reason = reason;
+  }
+
+  bool success()
+  {
+    return m_status == PGRES_TUPLES_OK
+      || m_status == PGRES_COMMAND_OK;
+  }
+
+  const std::string& reason()
+  {
+    return m_reason;
+  }
+
+  void throwException() throw( IOException )
+  {
+    if( !success() )
+      throw IOException( "Statement failed [" + m_statement + "] " + reason() );
+  }
+
+private:
+  PGresult* m_result;
+  ExecStatusType m_status;
+  std::string m_statement;
+  std::string m_reason;
+  std::vector<std::string> m_values;
+  std::vector<bool> m_nulls;
+};
+
 class PostgreSQLConnection
 {
 public:
@@ -149,6 +258,53 @@ public:
     return pQuery.execute( m_pConnection );
   }
 
+  bool execute( PostgreSQLStatement& statement )
+  {
+    Locker locker( m_mutex );
+    int retry = 0;
+
+    do
+    {
+      const std::string* pName = prepare( statement );
+      if( pName && statement.execute( m_pConnection, *pName ) )
+        return true;
+      if( PQstatus( m_pConnection ) == CONNECTION_OK )
+        return false;
+      // prepared statements do not survive a reset
+      m_statements.clear();
+      PQreset( m_pConnection );
+      retry++;
+    } while( retry <= 1 );
+    return false;
+  }
+
+  /// Load each COPY ... FROM STDIN command with its data in one transaction
+  bool copy( const std::vector<std::string>& commands,
+             const std::vector<std::string>& data, std::string& reason )
+  {
+    Locker locker( m_mutex );
+    if( !command( "BEGIN", reason ) )
+    {
+      if( PQstatus( m_pConnection ) != CONNECTION_OK )
+      {
+        m_statements.clear();
+        PQreset( m_pConnection );
+      }
+      return false;
+    }
+
+    for( size_t i = 0; i < commands.size(); ++i )
+    {
+      if( !copy( commands[i], data[i], reason ) )
+      {
+        std::string ignored;
+        command( "ROLLBACK", ignored );
+        return false;
+      }
+    }
+    return command( "COMMIT", reason );
+  }
+
 private:
   void connect()
   {
@@ -161,8 +317,74 @@ private:
       throw ConfigError( "Unable to connect to database" );
   }
 
+  const std::string* prepare( PostgreSQLStatement& statement )
+  {
+    const std::string& text = statement.statement();
+    Statements::iterator i = m_statements.find( text );
+    if( i != m_statements.end() )
+      return &i->second;
+
+    std::string name = "quickfix_"
+      + IntConvertor::convert( (int)m_statements.size() + 1 );
+    PGresult* result = PQprepare( m_pConnection, name.c_str(), text.c_str(), 0, 0 );
+    bool prepared = PQresultStatus( result ) == PGRES_COMMAND_OK;
+    if( !prepared )
+      statement.fail( PQresultErrorMessage( result ) );
+    PQclear( result );
+    if( !prepared )
+      return 0;
+    return &( m_statements[ text ] = name );
+  }
+
+  bool command( const char* text, std::string& reason )
+  {
+    PGresult* result = PQexec( m_pConnection, text );
+    bool success = PQresultStatus( result ) == PGRES_COMMAND_OK;
+    if( !success )
+      reason = PQresultErrorMessage( result );
+    PQclear( result );
+    return success;
+  }
+
+  bool copy( const std::string& text, const std::string& data, std::string& reason )
+  {
+    PGresult* result = PQexec( m_pConnection, text.c_str() );
+    bool success = PQresultStatus( result ) == PGRES_COPY_IN;
+    if( !success )
+      reason = PQresultErrorMessage( result );
+    PQclear( result );
+    if( !success )
+      return false;
+
+    if( PQputCopyData( m_pConnection, data.data(), (int)data.size() ) != 1 )
+    {
+      reason = PQerrorMessage( m_pConnection );
+      PQputCopyEnd( m_pConnection, "unable to send data" );
+      success = false;
+    }
+    else if( PQputCopyEnd( m_pConnection, 0 ) != 1 )
+    {
+      reason = PQerrorMessage( m_pConnection );
+      success = false;
+    }
+
+    while( ( result = PQgetResult( m_pConnection ) ) )
+    {
+      if( success && PQresultStatus( result ) != PGRES_COMMAND_OK )
+      {
+        reason = PQresultErrorMessage( result );
+        success = false;
+      }
+      PQclear( result );
+    }
+    return success;
+  }
+
+  typedef std::map<std::string, std::string> Statements;
+
   PGconn* m_pConnection;
   DatabaseConnectionID m_connectionID;
+  Statements m_statements;
   Mutex m_mutex;
 };
 
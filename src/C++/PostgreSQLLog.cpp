@@ -31,15 +31,63 @@
 #include "Utility.h"
 #include "strptime.h"
 #include <fstream>
+#include <map>
 
 namespace FIX
 {
 
+static PostgreSQLStatement& bindSessionID( PostgreSQLStatement& statement, const SessionID* pSessionID )
+{
+  if( !pSessionID )
+    return statement.bindNull().bindNull().bindNull().bindNull();
+
+  statement
+    .bind( pSessionID->getBeginString().getValue() )
+    .bind( pSessionID->getSenderCompID().getValue() )
+    .bind( pSessionID->getTargetCompID().getValue() );
+  if( pSessionID->getSessionQualifier().empty() )
+    return statement.bindNull();
+  return statement.bind( pSessionID->getSessionQualifier() );
+}
+
+static std::string sqlTime( const UtcTimeStamp& time )
+{
+  int year, month, day, hour, minute, second, millis;
+  time.getYMD( year, month, day );
+  time.getHMS( hour, minute, second, millis );
+
+  char sqlTime[ 24 ];
+  STRING_SPRINTF( sqlTime, "%d-%02d-%02d %02d:%02d:%02d.%03d",
+           year, month, day, hour, minute, second, millis );
+  return sqlTime;
+}
+
+/// Escape a value for the text format of COPY ... FROM STDIN
+static std::string copyValue( const std::string& value )
+{
+  std::string result;
+  result.reserve( value.size() );
+  for( std::string::const_iterator i = value.begin(); i != value.end(); ++i )
+  {
+    switch( *i )
+    {
+    case '\\': result += "\\\\"; break;
+    case '\t': result += "\\t"; break;
+    case '\n': result += "\\n"; break;
+    case '\r': result += "\\r"; break;
+    default: result += *i;
+    }
+  }
+  return result;
+}
+
 const std::string PostgreSQLLogFactory::DEFAULT_DATABASE = "quickfix";
 const std::string PostgreSQLLogFactory::DEFAULT_USER = "postgres";
 const std::string PostgreSQLLogFactory::DEFAULT_PASSWORD = "";
 const std::string PostgreSQLLogFactory::DEFAULT_HOST = "localhost";
 const short PostgreSQLLogFactory::DEFAULT_PORT = 0;
+const int PostgreSQLLogFactory::DEFAULT_BATCH_SIZE = 100;
+const int PostgreSQLLogFactory::DEFAULT_QUEUE_SIZE = 10000;
 
 PostgreSQLLog::PostgreSQLLog
 ( const SessionID& s, const DatabaseConnectionID& d, PostgreSQLConnectionPool* p )
@@ -82,10 +130,13 @@ void PostgreSQLLog::init()
   setIncomingTable( "messages_log" );
   setOutgoingTable( "messages_log" );
   setEventTable( "event_log" );
+  m_pWriter = 0;
 }
 
 PostgreSQLLog::~PostgreSQLLog()
 {
+  // drain the queue while the connection is still open
+  delete m_pWriter;
   if( m_pConnectionPool )
     m_pConnectionPool->destroy( m_pConnection );
   else
@@ -93,6 +144,12 @@ PostgreSQLLog::~PostgreSQLLog()
   delete m_pSessionID;
 }
 
+void PostgreSQLLog::setBatching( int flushInterval, int batchSize, int queueSize )
+{
+  delete m_pWriter;
+  m_pWriter = new Writer( *this, flushInterval, batchSize, queueSize );
+}
+
 Log* PostgreSQLLogFactory::create()
 {
   std::string database;
@@ -177,6 +234,22 @@ void PostgreSQLLogFactory::initLog( const Dictionary& settings, PostgreSQLLog& l
 
   try { log.setEventTable( settings.getString( POSTGRESQL_LOG_EVENT_TABLE ) ); }
   catch( ConfigError& ) {}
+
+  int flushInterval = 0;
+  int batchSize = DEFAULT_BATCH_SIZE;
+  int queueSize = DEFAULT_QUEUE_SIZE;
+
+  try { flushInterval = settings.getInt( POSTGRESQL_LOG_FLUSH_INTERVAL ); }
+  catch( ConfigError& ) {}
+
+  try { batchSize = settings.getInt( POSTGRESQL_LOG_BATCH_SIZE ); }
+  catch( ConfigError& ) {}
+
+  try { queueSize = settings.getInt( POSTGRESQL_LOG_QUEUE_SIZE ); }
+  catch( ConfigError& ) {}
+
+  if( flushInterval > 0 )
+    log.setBatching( flushInterval, batchSize, queueSize );
 }
 
 void PostgreSQLLogFactory::destroy( Log* pLog )
@@ -186,6 +259,9 @@ void PostgreSQLLogFactory::destroy( Log* pLog )
 
 void PostgreSQLLog::clear()
 {
+  if( m_pWriter )
+    m_pWriter->flush();
+
   std::stringstream whereClause;
 
   whereClause << "WHERE ";
@@ -230,45 +306,61 @@ void PostgreSQLLog::backup()
 
 void PostgreSQLLog::insert( const std::string& table, const std::string value )
 {
-  UtcTimeStamp time;
-  int year, month, day, hour, minute, second, millis;
-  time.getYMD( year, month, day );
-  time.getHMS( hour, minute, second, millis );
+  if( m_pWriter )
+    m_pWriter->push( DatabaseLogRecord( table, value ) );
+  else
+    insert( DatabaseLogRecord( table, value ) );
+}
 
-  char sqlTime[ 24 ];
-  STRING_SPRINTF( sqlTime, "%d-%02d-%02d %02d:%02d:%02d.%003d",
-           year, month, day, hour, minute, second, millis );
-  
-  char* valueCopy = new char[ (value.size() * 2) + 1 ];
-  PQescapeString( valueCopy, value.c_str(), value.size() );
+void PostgreSQLLog::insert( const DatabaseLogRecord& record )
+{
+  PostgreSQLStatement statement( "INSERT INTO " + record.table + " "
+    "(time, beginstring, sendercompid, targetcompid, session_qualifier, text) "
+    "VALUES ($1,$2,$3,$4,$5,$6)" );
 
-  std::stringstream queryString;
-  queryString << "INSERT INTO " << table << " "
-  << "(time, beginstring, sendercompid, targetcompid, session_qualifier, text) "
-  << "VALUES ("
-  << "'" << sqlTime << "',";
+  statement.bind( sqlTime( record.time ) );
+  bindSessionID( statement, m_pSessionID ).bind( record.text );
+  m_pConnection->execute( statement );
+}
 
+void PostgreSQLLog::write( const std::vector < DatabaseLogRecord > & records )
+{
+  std::string session;
   if( m_pSessionID )
   {
-    queryString
-    << "'" << m_pSessionID->getBeginString().getValue() << "',"
-    << "'" << m_pSessionID->getSenderCompID().getValue() << "',"
-    << "'" << m_pSessionID->getTargetCompID().getValue() << "',";
-    if( m_pSessionID->getSessionQualifier() == "" )
-      queryString << "NULL" << ",";
-    else
-      queryString << "'" << m_pSessionID->getSessionQualifier() << "',";
+    session = copyValue( m_pSessionID->getBeginString().getValue() ) + "\t"
+      + copyValue( m_pSessionID->getSenderCompID().getValue() ) + "\t"
+      + copyValue( m_pSessionID->getTargetCompID().getValue() ) + "\t"
+      + ( m_pSessionID->getSessionQualifier() == ""
+          ? "\\N" : copyValue( m_pSessionID->getSessionQualifier() ) );
   }
   else
   {
-    queryString << "NULL, NULL, NULL, NULL, ";
+    session = "\\N\t\\N\t\\N\t\\N";
   }
 
-  queryString << "'" << valueCopy << "')";
-  delete [] valueCopy;
+  // one COPY per table, all committed together
+  std::map < std::string, std::string > copies;
+  std::vector < DatabaseLogRecord > ::const_iterator i;
+  for( i = records.begin(); i != records.end(); ++i )
+  {
+    copies[ i->table ] += sqlTime( i->time ) + "\t" + session + "\t"
+      + copyValue( i->text ) + "\n";
+  }
+
+  std::vector < std::string > commands;
+  std::vector < std::string > data;
+  std::map < std::string, std::string > ::const_iterator j;
+  for( j = copies.begin(); j != copies.end(); ++j )
+  {
+    commands.push_back( "COPY " + j->first + " "
+      "(time, beginstring, sendercompid, targetcompid, session_qualifier, text) "
+      "FROM STDIN" );
+    data.push_back( j->second );
+  }
 
-  PostgreSQLQuery query( queryString.str() );
-  m_pConnection->execute( query );
+  std::string reason;
+  m_pConnection->copy( commands, data, reason );
 }
 
 } // namespace FIX
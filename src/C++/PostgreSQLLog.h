@@ -34,13 +34,14 @@
 #include "Log.h"
 #include "SessionSettings.h"
 #include "PostgreSQLConnection.h"
+#include "DatabaseBatchWriter.h"
 #include <fstream>
 #include <string>
 
 namespace FIX
 {
 /// PostgreSQL based implementation of Log.
-class PostgreSQLLog : public Log
+class PostgreSQLLog : public Log, private DatabaseBatchSink < DatabaseLogRecord >
 {
 public:
   PostgreSQLLog( const SessionID& s, const DatabaseConnectionID& d, PostgreSQLConnectionPool* p );
@@ -60,6 +61,8 @@ public:
   { m_outgoingTable = outgoingTable; }
   void setEventTable( const std::string& eventTable )
   { m_eventTable = eventTable; }
+  /// Write from a background thread, batchSize records at a time
+  void setBatching( int flushInterval, int batchSize, int queueSize );
 
   void onIncoming( const std::string& value )
   { insert( m_incomingTable, value ); }
@@ -69,8 +72,12 @@ public:
   { insert( m_eventTable, value ); }
 
 private:
+  typedef DatabaseBatchWriter < DatabaseLogRecord > Writer;
+
   void init();
   void insert( const std::string& table, const std::string value );
+  void insert( const DatabaseLogRecord& record );
+  void write( const std::vector < DatabaseLogRecord > & records );
 
   std::string m_incomingTable;
   std::string m_outgoingTable;
@@ -78,6 +85,7 @@ private:
   PostgreSQLConnection* m_pConnection;
   PostgreSQLConnectionPool* m_pConnectionPool;
   SessionID* m_pSessionID;
+  Writer* m_pWriter;
 };
 
 /// Creates a MySQL based implementation of Log.
@@ -89,6 +97,8 @@ public:
   static const std::string DEFAULT_PASSWORD;
   static const std::string DEFAULT_HOST;
   static const short DEFAULT_PORT;
+  static const int DEFAULT_BATCH_SIZE;
+  static const int DEFAULT_QUEUE_SIZE;
 
   PostgreSQLLogFactory( const SessionSettings& settings )
 : m_settings( settings ), m_useSettings( true ) 
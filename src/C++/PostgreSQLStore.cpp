@@ -37,12 +37,55 @@
 namespace FIX
 {
 
+static PostgreSQLStatement& bindSessionID( PostgreSQLStatement& statement, const SessionID& sessionID )
+{
+  return statement
+    .bind( sessionID.getBeginString().getValue() )
+    .bind( sessionID.getSenderCompID().getValue() )
+    .bind( sessionID.getTargetCompID().getValue() )
+    .bind( sessionID.getSessionQualifier() );
+}
+
 const std::string PostgreSQLStoreFactory::DEFAULT_DATABASE = "quickfix";
 const std::string PostgreSQLStoreFactory::DEFAULT_USER = "postgres";
 const std::string PostgreSQLStoreFactory::DEFAULT_PASSWORD = "";
 const std::string PostgreSQLStoreFactory::DEFAULT_HOST = "localhost";
 const short PostgreSQLStoreFactory::DEFAULT_PORT = 0;
 
+/// Pages through the messages table in msgseqnum order, a bounded number of rows at a time
+class PostgreSQLStoreCursor : public PagedMessageStoreCursor
+{
+public:
+  PostgreSQLStoreCursor( const PostgreSQLStore& store, int begin, int end )
+  : PagedMessageStoreCursor( begin, end, PAGE_SIZE ), m_store( store ) {}
+
+protected:
+  int fetch( int begin, int end, int limit,
+             std::vector < std::string > & page ) throw ( IOException )
+  {
+    page.clear();
+    PostgreSQLStatement query( "SELECT msgseqnum, message FROM messages WHERE "
+      "beginstring=$1 and sendercompid=$2 and targetcompid=$3 and session_qualifier=$4 and "
+      "msgseqnum>=$5 and msgseqnum<=$6 ORDER BY msgseqnum LIMIT $7" );
+    bindSessionID( query, m_store.m_sessionID ).bind( begin ).bind( end ).bind( limit );
+    if( !m_store.m_pConnection->execute( query ) )
+      query.throwException();
+
+    int rows = query.rows();
+    for( int row = 0; row < rows; row++ )
+      page.push_back( query.getValue( row, 1 ) );
+
+    if( rows < limit )
+      return end + 1;
+    return atoi( query.getValue( rows - 1, 0 ) ) + 1;
+  }
+
+private:
+  enum { PAGE_SIZE = 100 };
+
+  const PostgreSQLStore& m_store;
+};
+
 PostgreSQLStore::PostgreSQLStore
 ( const SessionID& s, const DatabaseConnectionID& d, PostgreSQLConnectionPool* p )
 : m_pConnectionPool( p ), m_sessionID( s )
@@ -169,37 +212,18 @@ void PostgreSQLStoreFactory::destroy( MessageStore* pStore )
 bool PostgreSQLStore::set( int msgSeqNum, const std::string& msg )
 throw ( IOException )
 {
-  char* msgCopy = new char[ (msg.size() * 2) + 1 ];
-  PQescapeString( msgCopy, msg.c_str(), msg.size() );
-
-  std::stringstream queryString;
-  queryString << "INSERT INTO messages "
-  << "(beginstring, sendercompid, targetcompid, session_qualifier, msgseqnum, message) "
-  << "VALUES ("
-  << "'" << m_sessionID.getBeginString().getValue() << "',"
-  << "'" << m_sessionID.getSenderCompID().getValue() << "',"
-  << "'" << m_sessionID.getTargetCompID().getValue() << "',"
-  << "'" << m_sessionID.getSessionQualifier() << "',"
-  << msgSeqNum << ","
-  << "'" << msgCopy << "')";
-
-  delete [] msgCopy;
-
-  PostgreSQLQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
+  PostgreSQLStatement insert( "INSERT INTO messages "
+    "(beginstring, sendercompid, targetcompid, session_qualifier, msgseqnum, message) "
+    "VALUES ($1,$2,$3,$4,$5,$6)" );
+  bindSessionID( insert, m_sessionID ).bind( msgSeqNum ).bind( msg );
+  if( !m_pConnection->execute( insert ) )
   {
-    std::stringstream queryString2;
-    queryString2 << "UPDATE messages SET message='" << msg << "' WHERE "
-    << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-    << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-    << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-    << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "' and "
-    << "msgseqnum=" << msgSeqNum;
-    PostgreSQLQuery query2( queryString2.str() );
-    if( !m_pConnection->execute(query2) )
-      query2.throwException();
+    PostgreSQLStatement update( "UPDATE messages SET message=$1 WHERE "
+      "beginstring=$2 and sendercompid=$3 and targetcompid=$4 and session_qualifier=$5 and msgseqnum=$6" );
+    bindSessionID( update.bind( msg ), m_sessionID ).bind( msgSeqNum );
+    if( !m_pConnection->execute( update ) )
+      update.throwException();
   }
-
   return true;
 }
 
@@ -208,17 +232,11 @@ void PostgreSQLStore::get( int begin, int end,
 throw ( IOException )
 {
   result.clear();
-  std::stringstream queryString;
-  queryString << "SELECT message FROM messages WHERE "
-  << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-  << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-  << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-  << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "' and "
-  << "msgseqnum>=" << begin << " and " << "msgseqnum<=" << end << " "
-  << "ORDER BY msgseqnum";
-
-  PostgreSQLQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
+  PostgreSQLStatement query( "SELECT message FROM messages WHERE "
+    "beginstring=$1 and sendercompid=$2 and targetcompid=$3 and session_qualifier=$4 and "
+    "msgseqnum>=$5 and msgseqnum<=$6 ORDER BY msgseqnum" );
+  bindSessionID( query, m_sessionID ).bind( begin ).bind( end );
+  if( !m_pConnection->execute( query ) )
     query.throwException();
 
   int rows = query.rows();
@@ -226,6 +244,12 @@ throw ( IOException )
     result.push_back( query.getValue( row, 0 ) );
 }
 
+MessageStoreCursor* PostgreSQLStore::cursor( int begin, int end ) const
+throw ( IOException )
+{
+  return new PostgreSQLStoreCursor( *this, begin, end );
+}
+
 int PostgreSQLStore::getNextSenderMsgSeqNum() const throw ( IOException )
 {
   return m_cache.getNextSenderMsgSeqNum();
@@ -238,33 +262,21 @@ int PostgreSQLStore::getNextTargetMsgSeqNum() const throw ( IOException )
 
 void PostgreSQLStore::setNextSenderMsgSeqNum( int value ) throw ( IOException )
 {
-  std::stringstream queryString;
-  queryString << "UPDATE sessions SET outgoing_seqnum=" << value << " WHERE "
-  << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-  << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-  << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-  << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "'";
-
-  PostgreSQLQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
-    query.throwException();
-
+  PostgreSQLStatement update( "UPDATE sessions SET outgoing_seqnum=$1 WHERE "
+    "beginstring=$2 and sendercompid=$3 and targetcompid=$4 and session_qualifier=$5" );
+  bindSessionID( update.bind( value ), m_sessionID );
+  if( !m_pConnection->execute( update ) )
+    update.throwException();
   m_cache.setNextSenderMsgSeqNum( value );
 }
 
 void PostgreSQLStore::setNextTargetMsgSeqNum( int value ) throw ( IOException )
 {
-  std::stringstream queryString;
-  queryString << "UPDATE sessions SET incoming_seqnum=" << value << " WHERE "
-  << "beginstring=" << "'" << m_sessionID.getBeginString().getValue() << "' and "
-  << "sendercompid=" << "'" << m_sessionID.getSenderCompID().getValue() << "' and "
-  << "targetcompid=" << "'" << m_sessionID.getTargetCompID().getValue() << "' and "
-  << "session_qualifier=" << "'" << m_sessionID.getSessionQualifier() << "'";
-
-  PostgreSQLQuery query( queryString.str() );
-  if( !m_pConnection->execute(query) )
-    query.throwException();
-
+  PostgreSQLStatement update( "UPDATE sessions SET incoming_seqnum=$1 WHERE "
+    "beginstring=$2 and sendercompid=$3 and targetcompid=$4 and session_qualifier=$5" );
+  bindSessionID( update.bind( value ), m_sessionID );
+  if( !m_pConnection->execute( update ) )
+    update.throwException();
   m_cache.setNextTargetMsgSeqNum( value );
 }
 
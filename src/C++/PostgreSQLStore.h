@@ -114,6 +114,7 @@ public:
 
   bool set( int, const std::string& ) throw ( IOException );
   void get( int, int, std::vector < std::string > & ) const throw ( IOException );
+  MessageStoreCursor* cursor( int, int ) const throw ( IOException );
 
   int getNextSenderMsgSeqNum() const throw ( IOException );
   int getNextTargetMsgSeqNum() const throw ( IOException );
@@ -128,6 +129,7 @@ public:
   void refresh() throw ( IOException );
 
 private:
+  friend class PostgreSQLStoreCursor;
   void populateCache();
 
   MemoryStore m_cache;
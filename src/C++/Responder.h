@@ -37,6 +37,9 @@ namespace FIX
     virtual ~Responder() {}
     virtual bool send( const std::string& ) = 0;
     virtual void disconnect() = 0;
+    /// Sends until endBatch may be held back and written together.
+    virtual void beginBatch() {}
+    virtual void endBatch() {}
   };
 }
 
@@ -25,6 +25,7 @@
 
 #include "Session.h"
 #include "Values.h"
+#include "HeaderSniffer.h"
 #include <algorithm>
 #include <iostream>
 
@@ -59,12 +60,18 @@ Session::Session( Application& application,
   m_refreshOnLogon( false ),
   m_millisecondsInTimeStamp( true ),
   m_persistMessages( true ),
+  m_resendChunkSize( 1000 ),
   m_validationRules( ),
+  m_replayValidationRules( ),
+  m_eventLoop( -1 ),
   m_dataDictionaryProvider( dataDictionaryProvider ),
   m_messageStoreFactory( messageStoreFactory ),
   m_pLogFactory( pLogFactory ),
   m_pResponder( 0 )
 {
+  // messages replayed from our own store were validated when they were sent
+  m_replayValidationRules.setShouldValidate( false );
+
   m_state.heartBtInt( heartBtInt );
   m_state.initiate( heartBtInt != 0 );
   m_state.store( m_messageStoreFactory.create( m_sessionID ) );
@@ -139,27 +146,26 @@ void Session::eod()
   logout();
 }
 
-void Session::insertSendingTime( Header& header )
+bool Session::showMilliseconds() const
 {
-  UtcTimeStamp now;
   bool showMilliseconds = false;
   if( m_sessionID.getBeginString() == BeginString_FIXT11 )
     showMilliseconds = true;
   else
     showMilliseconds = m_sessionID.getBeginString() >= BeginString_FIX42;
 
-  header.setField( SendingTime(now, showMilliseconds && m_millisecondsInTimeStamp) );
+  return showMilliseconds && m_millisecondsInTimeStamp;
 }
 
-void Session::insertOrigSendingTime( Header& header, const UtcTimeStamp& when )
+void Session::insertSendingTime( Header& header )
 {
-  bool showMilliseconds = false;
-  if( m_sessionID.getBeginString() == BeginString_FIXT11 )
-    showMilliseconds = true;
-  else
-    showMilliseconds = m_sessionID.getBeginString() >= BeginString_FIX42;
+  UtcTimeStamp now;
+  header.setField( SendingTime(now, showMilliseconds()) );
+}
 
-  header.setField( OrigSendingTime(when, showMilliseconds && m_millisecondsInTimeStamp) );
+void Session::insertOrigSendingTime( Header& header, const UtcTimeStamp& when )
+{
+  header.setField( OrigSendingTime(when, showMilliseconds()) );
 }
 
 void Session::fill( Header& header )
@@ -384,6 +390,9 @@ void Session::nextResendRequest( const Message& resendRequest, const UtcTimeStam
 
   Locker l( m_mutex );
 
+  if ( m_pMetrics.get() )
+    m_pMetrics->increment( SessionMetrics::RESEND_REQUESTS );
+
   BeginSeqNo beginSeqNo;
   EndSeqNo endSeqNo;
   resendRequest.getField( beginSeqNo );
@@ -409,38 +418,56 @@ void Session::nextResendRequest( const Message& resendRequest, const UtcTimeStam
     return;
   }
 
-  std::vector < std::string > messages;
-  m_state.get( beginSeqNo, endSeqNo, messages );
+  const DataDictionary& sessionDD =
+    m_dataDictionaryProvider.getSessionDataDictionary(m_sessionID.getBeginString());
 
-  std::vector < std::string > ::iterator i;
   MsgSeqNum msgSeqNum(0);
   MsgType msgType;
   int begin = 0;
   int current = beginSeqNo;
+  int replayed = 0;
+  std::string stored;
   std::string messageString;
   Message msg;
 
-  for ( i = messages.begin(); i != messages.end(); ++i )
-  {
-    const DataDictionary& sessionDD = 
-      m_dataDictionaryProvider.getSessionDataDictionary(m_sessionID.getBeginString());
-
-    if( m_sessionID.isFIXT() )
+  // Stream the range from the store rather than reading it up front, and
+  // give other senders a turn every ResendChunkSize messages.  The lock is
+  // only given up when this is its only hold, a caller that already had
+  // it keeps it for the whole replay.  The replay is batched so the
+  // transport can write it out in large pieces.
+  SendBatch batch( *this );
+  Responder* pResponder = m_pResponder;
+  const UtcTimeStamp creationTime = m_state.getCreationTime();
+  std::unique_ptr<MessageStoreCursor> pCursor( m_state.cursor( beginSeqNo, endSeqNo ) );
+  while ( pCursor->next( stored ) )
+  {
+    if ( m_resendChunkSize > 0 && replayed && replayed % m_resendChunkSize == 0 )
     {
-      msg.setStringHeader(*i);
-      ApplVerID applVerID;
-      if( !msg.getHeader().getFieldIfSet(applVerID) )
-        applVerID = m_senderDefaultApplVerID;
+      endBatch();
+      if ( m_mutex.depth() == 1 )
+      {
+        int nextSender = m_state.getNextSenderMsgSeqNum();
+        {
+          ReverseLocker yield( m_mutex );
+          thread_yield();
+        }
 
-      const DataDictionary& applicationDD =
-        m_dataDictionaryProvider.getApplicationDataDictionary(applVerID);
-      msg = Message( OUTGOING_DIRECTION, *i, sessionDD, applicationDD, &m_validationRules );
-    }
-    else
-    {
-      msg = Message( OUTGOING_DIRECTION, *i, sessionDD, &m_validationRules );
+        // the rest of the range is only valid for the same connection
+        // and the same store
+        if ( !isLoggedOn() || m_pResponder != pResponder
+             || m_state.getNextSenderMsgSeqNum() < nextSender
+             || m_state.getCreationTime() != creationTime )
+        {
+          m_state.onEvent( "Resend aborted at: "
+                           + IntConvertor::convert( current ) );
+          return;
+        }
+      }
+      beginBatch();
     }
+    ++replayed;
 
+    replayMessage( stored, sessionDD, msg );
 
     msg.getHeader().getField( msgSeqNum );
     msg.getHeader().getField( msgType );
@@ -460,6 +487,8 @@ void Session::nextResendRequest( const Message& resendRequest, const UtcTimeStam
         send( msg.toString(messageString) );
         m_state.onEvent( "Resending Message: "
                          + IntConvertor::convert( msgSeqNum ) );
+        if ( m_pMetrics.get() )
+          m_pMetrics->increment( SessionMetrics::MESSAGES_RESENT );
         begin = 0;
       }
       else
@@ -490,6 +519,29 @@ void Session::nextResendRequest( const Message& resendRequest, const UtcTimeStam
     m_state.incrNextTargetMsgSeqNum();
 }
 
+void Session::replayMessage( const std::string& string,
+                             const DataDictionary& sessionDD, Message& msg )
+{
+  if( m_sessionID.isFIXT() )
+  {
+    HeaderSniffer header( string );
+    ApplVerID applVerID = m_senderDefaultApplVerID;
+    if( header.applVerID().found() )
+      applVerID = ApplVerID( header.applVerID().str() );
+
+    const DataDictionary& applicationDD =
+      m_dataDictionaryProvider.getApplicationDataDictionary(applVerID);
+    if( header.isAdmin() )
+      msg.setString( OUTGOING_DIRECTION, string, &m_replayValidationRules, &sessionDD, NULL );
+    else
+      msg.setString( OUTGOING_DIRECTION, string, &m_replayValidationRules, &sessionDD, &applicationDD );
+  }
+  else
+  {
+    msg.setString( OUTGOING_DIRECTION, string, &m_replayValidationRules, &sessionDD );
+  }
+}
+
 void Session::setSchedule( const std::string& scheduledescriptor )
 {
   m_pSchedule.reset(createSchedule(scheduledescriptor));
@@ -502,6 +554,73 @@ bool Session::send( Message& message )
   return sendRaw( message );
 }
 
+bool Session::send( MessageEncoder& encoder )
+{
+  Locker l( m_mutex );
+
+  try
+  {
+    // do not send application messages if they will just be cleared
+    if( !isLoggedOn() && shouldSendReset() )
+      return false;
+
+    // fill sets the same fields every time, so the header is reused as is
+    int msgSeqNum = getExpectedSenderNum();
+    m_encoderHeader.setField( MsgType( encoder.getMsgType() ) );
+    fill( m_encoderHeader );
+    encoder.setShowMilliseconds( showMilliseconds() );
+
+    try
+    {
+      if ( !m_application.toApp( encoder, m_sessionID ) )
+      {
+        // the application wants to see a Message, send it as one
+        encoder.toString( m_encoderHeader, m_encoderString );
+        Message message;
+        replayMessage( m_encoderString,
+          m_dataDictionaryProvider.getSessionDataDictionary( m_sessionID.getBeginString() ),
+          message );
+        return send( message );
+      }
+    }
+    catch ( DoNotSend& ) { return false; }
+
+    encoder.toString( m_encoderHeader, m_encoderString );
+    persist( msgSeqNum, m_encoderString );
+
+    if ( isLoggedOn() )
+      send( m_encoderString );
+    return true;
+  }
+  catch ( IOException& e )
+  {
+    m_state.onEvent( e.what() );
+    return false;
+  }
+}
+
+void Session::validateAll( const Message& message )
+throw( FIX::Exception )
+{
+  const DataDictionary& sessionDataDictionary =
+    m_dataDictionaryProvider.getSessionDataDictionary( m_sessionID.getBeginString() );
+
+  if( m_sessionID.isFIXT() && message.isApp() )
+  {
+    ApplVerID applVerID = m_targetDefaultApplVerID;
+    message.getHeader().getFieldIfSet( applVerID );
+    const DataDictionary& applicationDataDictionary =
+      m_dataDictionaryProvider.getApplicationDataDictionary( applVerID );
+    DataDictionary::validate( INCOMING_DIRECTION, message, &sessionDataDictionary, &applicationDataDictionary, 0 );
+  }
+  else
+  {
+    ValidationRules rules( m_validationRules );
+    rules.setValidateLazily( false );
+    sessionDataDictionary.validate( INCOMING_DIRECTION, message, &rules );
+  }
+}
+
 Message* Session::messageFromString( const std::string& string )
 throw( FIX::Exception )
 {
@@ -626,6 +745,15 @@ bool Session::send( const std::string& string )
 {
   if ( !m_pResponder ) return false;
   m_state.onOutgoing( string );
+
+  SessionMetrics* pMetrics = m_pMetrics.get();
+  if ( pMetrics )
+  {
+    pMetrics->increment( SessionMetrics::MESSAGES_OUT );
+    pMetrics->increment( SessionMetrics::BYTES_OUT, string.size() );
+  }
+
+  SessionMetrics::StageTimer timer( pMetrics, SessionMetrics::SEND );
   return m_pResponder->send( string );
 }
 
@@ -645,6 +773,9 @@ void Session::disconnect()
   {
     m_state.onEvent( "Disconnecting" );
 
+    // write anything held by a send batch, such as the Logout being
+    // answered, before the connection goes away
+    m_pResponder->endBatch();
     m_pResponder->disconnect();
     m_pResponder = 0;
   }
@@ -702,8 +833,17 @@ throw ( IOException )
 {
   MsgSeqNum msgSeqNum;
   message.getHeader().getField( msgSeqNum );
+  persist( msgSeqNum, messageString );
+}
+
+void Session::persist( int msgSeqNum,  const std::string& messageString )
+throw ( IOException )
+{
   if( m_persistMessages )
+  {
+    SessionMetrics::StageTimer timer( m_pMetrics.get(), SessionMetrics::STORE );
     m_state.set( msgSeqNum, messageString );
+  }
   m_state.incrNextSenderMsgSeqNum();
 }
 
@@ -958,7 +1098,11 @@ void Session::generateReject( int direction, const Header& header, const std::st
     throw std::runtime_error( "Tried to send a reject while not logged on" );
 
   if ( direction == INCOMING_DIRECTION )
+  {
     sendRaw( reject );
+    if ( m_pMetrics.get() )
+      m_pMetrics->increment( SessionMetrics::REJECTS );
+  }
 }
 
 void Session::generateReject( int direction, const Message& message, const std::string& str )
@@ -989,6 +1133,8 @@ void Session::generateReject( int direction, const Header& header, const std::st
 
   reject.setField( Text( str ) );
   sendRaw( reject );
+  if ( m_pMetrics.get() )
+    m_pMetrics->increment( SessionMetrics::REJECTS );
   m_state.onEvent( "Message " + msgSeqNum.getString()
                    + " Rejected: " + str );
 }
@@ -1229,6 +1375,8 @@ void Session::doTheStandardStateReset ()
   m_state.receivedReset( false );
   m_state.sentReset( false );
   m_state.clearQueue();
+  if ( m_pMetrics.get() )
+    m_pMetrics->set( SessionMetrics::QUEUED_MESSAGES, 0 );
   m_state.logoutReason();
   m_state.resendRange( 0, 0 );
   if ( m_state.receivedLogon() || m_state.sentLogon() )
@@ -1369,6 +1517,12 @@ void Session::doTargetTooHigh( const Message& msg )
 
   m_state.queue( msgSeqNum, msg );
 
+  if ( m_pMetrics.get() )
+  {
+    m_pMetrics->increment( SessionMetrics::SEQUENCE_GAPS );
+    m_pMetrics->set( SessionMetrics::QUEUED_MESSAGES, m_state.queueSize() );
+  }
+
   if( m_state.resendRequested() )
   {
     SessionState::ResendRange range = m_state.resendRange();
@@ -1398,6 +1552,8 @@ bool Session::nextQueued( int num, const UtcTimeStamp& timeStamp )
 
   if( m_state.retrieve( num, msg ) )
   {
+    if ( m_pMetrics.get() )
+      m_pMetrics->set( SessionMetrics::QUEUED_MESSAGES, m_state.queueSize() );
     m_state.onEvent( "Processing QUEUED message: "
                      + IntConvertor::convert( num ) );
     msg.getHeader().getField( msgType );
@@ -1422,18 +1578,35 @@ void Session::next( const std::string& msg, const UtcTimeStamp& timeStamp, bool
   try
   {
     m_state.onIncoming( msg );
-    const DataDictionary& sessionDD = 
-      m_dataDictionaryProvider.getSessionDataDictionary(m_sessionID.getBeginString());
-    if( m_sessionID.isFIXT() )
+
+    SessionMetrics* pMetrics = m_pMetrics.get();
+    if ( pMetrics )
     {
-      const DataDictionary& applicationDD =
-        m_dataDictionaryProvider.getApplicationDataDictionary(m_senderDefaultApplVerID);
-      next( Message( direction, msg, sessionDD, applicationDD, &m_validationRules ), timeStamp, queued );
+      pMetrics->increment( SessionMetrics::MESSAGES_IN );
+      pMetrics->increment( SessionMetrics::BYTES_IN, msg.size() );
     }
-    else
+
+    const DataDictionary& sessionDD = 
+      m_dataDictionaryProvider.getSessionDataDictionary(m_sessionID.getBeginString());
+
+    // parse outside of the constructors so the parse can be timed on its own
+    Message message;
     {
-      next( Message( direction, msg, sessionDD, &m_validationRules ), timeStamp, queued );
+      SessionMetrics::StageTimer timer( pMetrics, SessionMetrics::PARSE );
+      if( m_sessionID.isFIXT() )
+      {
+        const DataDictionary& applicationDD =
+          m_dataDictionaryProvider.getApplicationDataDictionary(m_senderDefaultApplVerID);
+        message.setStringHeader( msg );
+        message.setString( direction, msg, &m_validationRules, &sessionDD,
+                           message.isAdmin() ? NULL : &applicationDD );
+      }
+      else
+      {
+        message.setString( direction, msg, &m_validationRules, &sessionDD, &sessionDD );
+      }
     }
+    next( message, timeStamp, queued );
   }
   catch ( FieldNotFound & e ) 
   { LOGEX( generateReject( direction, Header(), msg, SessionRejectReason_REQUIRED_TAG_MISSING, e.field ) ); }
@@ -1540,17 +1713,21 @@ void Session::next( const Message& message, const UtcTimeStamp& timeStamp, bool
     const DataDictionary& sessionDataDictionary = 
         m_dataDictionaryProvider.getSessionDataDictionary(m_sessionID.getBeginString());
 
-    if( m_sessionID.isFIXT() && message.isApp() )
     {
-      ApplVerID applVerID = m_targetDefaultApplVerID;
-      header.getFieldIfSet(applVerID);
-      const DataDictionary& applicationDataDictionary = 
-        m_dataDictionaryProvider.getApplicationDataDictionary(applVerID);
-      DataDictionary::validate( INCOMING_DIRECTION, message, &sessionDataDictionary, &applicationDataDictionary, 0 );
-    }
-    else
-    {
-      sessionDataDictionary.validate( INCOMING_DIRECTION, message, &m_validationRules );
+      SessionMetrics::StageTimer timer( m_pMetrics.get(), SessionMetrics::VALIDATE );
+      if( m_sessionID.isFIXT() && message.isApp() )
+      {
+        ApplVerID applVerID = m_targetDefaultApplVerID;
+        header.getFieldIfSet(applVerID);
+        const DataDictionary& applicationDataDictionary = 
+          m_dataDictionaryProvider.getApplicationDataDictionary(applVerID);
+        DataDictionary::validate( INCOMING_DIRECTION, message, &sessionDataDictionary, &applicationDataDictionary, 0,
+                                  m_validationRules.shouldValidateLazily() );
+      }
+      else
+      {
+        sessionDataDictionary.validate( INCOMING_DIRECTION, message, &m_validationRules );
+      }
     }
 
     if ( msgType == MsgType_Logon )
@@ -1650,6 +1827,50 @@ void Session::next( const Message& message, const UtcTimeStamp& timeStamp, bool
     next();
 }
 
+void Session::nextBatch( const std::vector<std::string>& messages,
+                         const UtcTimeStamp& timeStamp )
+{
+  SendBatch batch( *this );
+  m_state.beginBatch();
+
+  try
+  {
+    std::vector<std::string>::const_iterator i;
+    for( i = messages.begin(); i != messages.end(); ++i )
+    {
+      try
+      {
+        next( *i, timeStamp );
+      }
+      catch( InvalidMessage& )
+      {
+        // the connection is dropped, what follows is never processed
+        if( !isLoggedOn() )
+          throw;
+      }
+    }
+  }
+  catch( ... )
+  {
+    endReceiveBatch();
+    throw;
+  }
+  endReceiveBatch();
+}
+
+void Session::endReceiveBatch()
+{
+  try
+  {
+    m_state.endBatch();
+  }
+  catch( IOException& e )
+  {
+    m_state.onEvent( e.what() );
+    disconnect();
+  }
+}
+
 bool Session::sendToTarget( Message& message, const std::string& qualifier )
 throw( SessionNotFound )
 {
@@ -1691,6 +1912,14 @@ throw( SessionNotFound )
                        TargetCompID( target ), qualifier );
 }
 
+bool Session::sendToTarget( MessageEncoder& encoder, const SessionID& sessionID )
+throw( SessionNotFound )
+{
+  Session* pSession = lookupSession( sessionID );
+  if ( !pSession ) throw SessionNotFound();
+  return pSession->send( encoder );
+}
+
 std::set<SessionID> Session::getSessions()
 {
   return s_sessionIDs;
@@ -1714,27 +1943,24 @@ Session* Session::lookupSession( const SessionID& sessionID )
 
 Session* Session::lookupSession( const std::string& string, bool reverse )
 {
-  Message message;
-  if ( !message.setStringHeader( string ) )
+  HeaderSniffer header( string );
+  if ( !header.valid()
+       || !header.senderCompID().found()
+       || !header.targetCompID().found() )
     return 0;
 
-  try
-  {
-    const Header& header = message.getHeader();
-    const BeginString& beginString = FIELD_GET_REF( header, BeginString );
-    const SenderCompID& senderCompID = FIELD_GET_REF( header, SenderCompID );
-    const TargetCompID& targetCompID = FIELD_GET_REF( header, TargetCompID );
+  BeginString beginString( header.beginString().str() );
+  SenderCompID senderCompID( header.senderCompID().str() );
+  TargetCompID targetCompID( header.targetCompID().str() );
 
-    if ( reverse )
-    {
-      return lookupSession( SessionID( beginString, SenderCompID( targetCompID ),
-                                     TargetCompID( senderCompID ) ) );
-    }
-
-    return lookupSession( SessionID( beginString, senderCompID,
-                          targetCompID ) );
+  if ( reverse )
+  {
+    return lookupSession( SessionID( beginString, SenderCompID( targetCompID ),
+                                   TargetCompID( senderCompID ) ) );
   }
-  catch ( FieldNotFound& ) { return 0; }
+
+  return lookupSession( SessionID( beginString, senderCompID,
+                        targetCompID ) );
 }
 
 bool Session::isSessionRegistered( const SessionID& sessionID )
@@ -37,6 +37,8 @@
 #include "Log.h"
 #include "ValidationRules.h"
 #include "ScheduleFactory.h"
+#include "SessionMetrics.h"
+#include "MessageEncoder.h"
 #include <utility>
 #include <map>
 #include <queue>
@@ -96,6 +98,8 @@ public:
                             const std::string& targetCompID,
                             const std::string& qualifier = "" )
   throw( SessionNotFound );
+  static bool sendToTarget( MessageEncoder& encoder, const SessionID& sessionID )
+  throw( SessionNotFound );
 
   static std::set<SessionID> getSessions();
   static bool doesSessionExist( const SessionID& );
@@ -109,6 +113,8 @@ public:
 
   bool isConnectTime(const UtcTimeStamp& time);
   void registerConnectionAttempt ();
+  int getReconnectInterval() const
+    { return m_pSchedule->reconnectInterval(); }
   bool isSessionTime(const UtcTimeStamp& time) const
     { return m_pSchedule->isInRange(time); }
   bool isLogonTime(const UtcTimeStamp& time) const
@@ -173,6 +179,24 @@ public:
   void setPersistMessages ( bool value )
     { m_persistMessages = value; }
 
+  int getResendChunkSize()
+    { return m_resendChunkSize; }
+  void setResendChunkSize ( int value )
+    { m_resendChunkSize = value; }
+
+  bool getCollectMetrics()
+    { return m_pMetrics.get() != 0; }
+  void setCollectMetrics ( bool value )
+    { if( value != getCollectMetrics() ) m_pMetrics.reset( value ? new SessionMetrics : 0 ); }
+  SessionMetrics* getMetrics() const
+    { return m_pMetrics.get(); }
+
+  /// Acceptor event loop serving the connection, -1 when not connected
+  int getEventLoop() const
+    { return m_eventLoop; }
+  void setEventLoop( int value )
+    { m_eventLoop = value; }
+
   bool getValidateLengthAndChecksum()
     { return m_validationRules.shouldValidateLength() && m_validationRules.shouldValidateChecksum(); }
   void setValidateLengthAndChecksum ( bool value )
@@ -187,6 +211,10 @@ public:
     { m_validationRules.setValidateUserDefinedFields( validateuserdefinedfields ); }
   void setValidateBounds ( bool validatebounds ) 
     { m_validationRules.setValidateBounds( validatebounds ) ; }
+  bool getLazyValidation()
+    { return m_validationRules.shouldValidateLazily(); }
+  void setLazyValidation ( bool value )
+    { m_validationRules.setValidateLazily( value ); }
   void setAllowedFields ( const std::string &allowedfieldstr ) 
     { m_validationRules.setAllowedFields (allowedfieldstr); }
   void setValidationRules ( const std::string &validationrules )
@@ -200,12 +228,21 @@ public:
   }
 
   bool send( Message& );
+  /// Send an application message written by a generated encoder.
+  /// A Message is built unless the application's encoder toApp returns true.
+  bool send( MessageEncoder& );
+  /// Apply every check lazy validation skipped to a received message.
+  void validateAll( const Message& ) throw( FIX::Exception );
   Message* messageFromString( const std::string& string )
   throw( FIX::Exception );
   void next();
   void next( const UtcTimeStamp& timeStamp );
   void next( const std::string&, const UtcTimeStamp& timeStamp,  bool queued = false );
   void next( const Message&, const UtcTimeStamp& timeStamp,  bool queued = false );
+  /// Process messages read together, each exactly as next() would.
+  /// The target sequence number is stored and the log flushed once, at
+  /// the end, and replies are sent as one batch.
+  void nextBatch( const std::vector<std::string>&, const UtcTimeStamp& timeStamp );
   void disconnect();
   void autoDisconnect();
   bool shouldConnectPrerequisites( const UtcTimeStamp& timeStamp );
@@ -223,12 +260,29 @@ private:
   static bool addSession( Session& );
   static void removeSession( Session& );
 
+  /// Keeps the responder batching sends while in scope.
+  class SendBatch
+  {
+  public:
+    SendBatch( Session& session ) : m_session( session )
+    { m_session.beginBatch(); }
+    ~SendBatch() { m_session.endBatch(); }
+  private:
+    Session& m_session;
+  };
+
   void doNextMessage( const Message&, const UtcTimeStamp& timeStamp, bool queued );
+  void endReceiveBatch();
   bool send( const std::string& );
+  void beginBatch() { if ( m_pResponder ) m_pResponder->beginBatch(); }
+  void endBatch() { if ( m_pResponder ) m_pResponder->endBatch(); }
   bool sendRaw( Message&, int msgSeqNum = 0 );
   bool resend( Message& message );
+  void replayMessage( const std::string&, const DataDictionary&, Message& );
   void persist( const Message&, const std::string& ) throw ( IOException );
+  void persist( int msgSeqNum, const std::string& ) throw ( IOException );
 
+  bool showMilliseconds() const;
   void insertSendingTime( Header& );
   void insertOrigSendingTime( Header&,
                               const UtcTimeStamp& when = UtcTimeStamp () );
@@ -320,13 +374,19 @@ private:
   bool m_refreshOnLogon;
   bool m_millisecondsInTimeStamp;
   bool m_persistMessages;
+  int m_resendChunkSize;
   ValidationRules m_validationRules;
+  ValidationRules m_replayValidationRules;
+  std::unique_ptr<SessionMetrics> m_pMetrics;
+  int m_eventLoop;
 
   SessionState m_state;
   DataDictionaryProvider m_dataDictionaryProvider;
   MessageStoreFactory& m_messageStoreFactory;
   LogFactory* m_pLogFactory;
   Responder* m_pResponder;
+  Header m_encoderHeader;
+  std::string m_encoderString;
   Mutex m_mutex;
 
   static Sessions s_sessions;
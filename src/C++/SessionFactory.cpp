@@ -121,6 +121,10 @@ Session* SessionFactory::create( const SessionID& sessionID,
     pSession->setMillisecondsInTimeStamp( settings.getBool( MILLISECONDS_IN_TIMESTAMP ) );
   if ( settings.has( PERSIST_MESSAGES ) )
     pSession->setPersistMessages( settings.getBool( PERSIST_MESSAGES ) );
+  if ( settings.has( RESEND_CHUNK_SIZE ) )
+    pSession->setResendChunkSize( settings.getInt( RESEND_CHUNK_SIZE ) );
+  if ( settings.has( COLLECT_METRICS ) )
+    pSession->setCollectMetrics( settings.getBool( COLLECT_METRICS ) );
   if ( settings.has( VALIDATE_LENGTH_AND_CHECKSUM ) )
     pSession->setValidateLengthAndChecksum( settings.getBool( VALIDATE_LENGTH_AND_CHECKSUM ) );
   if ( settings.has( VALIDATE ) )
@@ -133,6 +137,8 @@ Session* SessionFactory::create( const SessionID& sessionID,
     pSession->setValidateUserDefinedFields( settings.getBool( VALIDATE_USER_DEFINED_FIELDS ) );
   if ( settings.has( VALIDATE_BOUNDS ) )
     pSession->setValidateBounds( settings.getBool( VALIDATE_BOUNDS ) );
+  if ( settings.has( LAZY_VALIDATION ) )
+    pSession->setLazyValidation( settings.getBool( LAZY_VALIDATION ) );
   if ( settings.has( ALLOWED_FIELDS ) )
     pSession->setAllowedFields( settings.getString( ALLOWED_FIELDS ) );
   if ( settings.has( VALIDATION_RULES ) )
@@ -148,33 +154,27 @@ void SessionFactory::destroy( Session* pSession )
   delete pSession;
 }
 
-ptr::shared_ptr<DataDictionary> SessionFactory::createDataDictionary(const SessionID& sessionID, 
-                                                                     const Dictionary& settings, 
-                                                                     const std::string& settingsKey) throw(ConfigError)
+ptr::shared_ptr<const DataDictionary> SessionFactory::createDataDictionary(const SessionID& sessionID, 
+                                                                           const Dictionary& settings, 
+                                                                           const std::string& settingsKey) throw(ConfigError)
 {
-  ptr::shared_ptr<DataDictionary> pDD;
   std::string path = settings.getString( settingsKey );
   Dictionaries::iterator i = m_dictionaries.find( path );
   if ( i != m_dictionaries.end() )
-  {
-    pDD = i->second;
-  }
-  else
-  {
-    pDD = ptr::shared_ptr<DataDictionary>(new DataDictionary( path ));
-    m_dictionaries[ path ] = pDD;
-  }
-
-  ptr::shared_ptr<DataDictionary> pCopyOfDD = ptr::shared_ptr<DataDictionary>(new DataDictionary(*pDD));
+    return i->second;
 
-  return pCopyOfDD;
+  // dictionaries are never modified once loaded, so every session using
+  // the same file shares one instance; per session options live in ValidationRules
+  ptr::shared_ptr<const DataDictionary> pDD( new DataDictionary( path ) );
+  m_dictionaries[ path ] = pDD;
+  return pDD;
 }
 
 void SessionFactory::processFixtDataDictionaries(const SessionID& sessionID, 
                                                  const Dictionary& settings, 
                                                  DataDictionaryProvider& provider) throw(ConfigError)
 {
-  ptr::shared_ptr<DataDictionary> pDataDictionary = createDataDictionary(sessionID, settings, TRANSPORT_DATA_DICTIONARY);
+  ptr::shared_ptr<const DataDictionary> pDataDictionary = createDataDictionary(sessionID, settings, TRANSPORT_DATA_DICTIONARY);
   provider.addTransportDataDictionary(sessionID.getBeginString(), pDataDictionary);
   
   for(Dictionary::const_iterator data = settings.begin(); data != settings.end(); ++data)
@@ -205,7 +205,7 @@ void SessionFactory::processFixDataDictionary(const SessionID& sessionID,
                                               const Dictionary& settings, 
                                               DataDictionaryProvider& provider) throw(ConfigError)
 {
-  ptr::shared_ptr<DataDictionary> pDataDictionary = createDataDictionary(sessionID, settings, DATA_DICTIONARY);
+  ptr::shared_ptr<const DataDictionary> pDataDictionary = createDataDictionary(sessionID, settings, DATA_DICTIONARY);
   provider.addTransportDataDictionary(sessionID.getBeginString(), pDataDictionary);
   provider.addApplicationDataDictionary(Message::toApplVerID(sessionID.getBeginString()), pDataDictionary);
 }
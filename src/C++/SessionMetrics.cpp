@@ -0,0 +1,276 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "SessionMetrics.h"
+#include <iomanip>
+
+namespace FIX
+{
+namespace
+{
+struct MetricName
+{
+  const char* json;
+  const char* prometheus;
+  const char* help;
+};
+
+const MetricName counterNames[ SessionMetrics::COUNTERS ] =
+{
+  { "messagesIn", "quickfix_messages_in_total", "Messages received" },
+  { "messagesOut", "quickfix_messages_out_total", "Messages sent" },
+  { "bytesIn", "quickfix_bytes_in_total", "Bytes received" },
+  { "bytesOut", "quickfix_bytes_out_total", "Bytes sent" },
+  { "resendRequests", "quickfix_resend_requests_total", "ResendRequests received" },
+  { "messagesResent", "quickfix_messages_resent_total", "Messages resent in reply to a ResendRequest" },
+  { "sequenceGaps", "quickfix_sequence_gaps_total", "Messages received with MsgSeqNum too high" },
+  { "rejects", "quickfix_rejects_total", "Session level rejects sent" }
+};
+
+const MetricName gaugeNames[ SessionMetrics::GAUGES ] =
+{
+  { "queuedMessages", "quickfix_queued_messages", "Out of order messages waiting for a gap fill" },
+  { "sendQueueDepth", "quickfix_send_queue_depth", "Messages waiting to be written to the socket" }
+};
+
+const MetricName stageNames[ SessionMetrics::STAGES ] =
+{
+  { "parse", "quickfix_parse_seconds", "Time spent parsing incoming messages" },
+  { "validate", "quickfix_validate_seconds", "Time spent validating incoming messages" },
+  { "store", "quickfix_store_seconds", "Time spent persisting outgoing messages" },
+  { "send", "quickfix_send_seconds", "Time spent handing outgoing messages to the connection" },
+  { "wireIn", "quickfix_wire_in_seconds", "Time from the kernel receiving a message to the session processing it" },
+  { "wireOut", "quickfix_wire_out_seconds", "Time from writing a message to the kernel transmitting it" }
+};
+
+const double quantiles[] = { 0.5, 0.9, 0.99, 0.999 };
+const char* const quantileNames[] = { "p50", "p90", "p99", "p999" };
+const size_t QUANTILES = sizeof(quantiles) / sizeof(quantiles[0]);
+
+void writeEscaped( std::ostream& stream, const std::string& value )
+{
+  for( std::string::const_iterator i = value.begin(); i != value.end(); ++i )
+  {
+    switch( *i )
+    {
+    case '"': stream << "\\\""; break;
+    case '\\': stream << "\\\\"; break;
+    case '\n': stream << "\\n"; break;
+    default:
+      if( (unsigned char)*i < 0x20 )
+        stream << "\\u" << std::hex << std::setw( 4 ) << std::setfill( '0' )
+               << (int)*i << std::dec << std::setfill( ' ' );
+      else
+        stream << *i;
+    }
+  }
+}
+
+void writeLabel( std::ostream& stream, const SessionID& sessionID )
+{
+  stream << "{session=\"";
+  writeEscaped( stream, sessionID.toString() );
+  stream << "\"";
+}
+
+void writeHeader( std::ostream& stream, const MetricName& name, const char* type )
+{
+  stream << "# HELP " << name.prometheus << " " << name.help << "\n"
+         << "# TYPE " << name.prometheus << " " << type << "\n";
+}
+}
+
+LatencyHistogram::LatencyHistogram()
+: m_count( 0 ), m_sum( 0 ), m_max( 0 )
+{
+  for( int i = 0; i < BUCKETS; ++i )
+    m_buckets[ i ].store( 0, std::memory_order_relaxed );
+}
+
+int LatencyHistogram::bucketOf( unsigned long long value )
+{
+  if( value < SUB_BUCKETS )
+    return (int)value;
+
+  const unsigned long long limit = ( 1ULL << MAX_BITS ) - 1;
+  if( value > limit )
+    value = limit;
+
+  int exponent = 0;
+  unsigned long long bits = value;
+  if( bits >> 32 ) { bits >>= 32; exponent += 32; }
+  if( bits >> 16 ) { bits >>= 16; exponent += 16; }
+  if( bits >> 8 ) { bits >>= 8; exponent += 8; }
+  if( bits >> 4 ) { bits >>= 4; exponent += 4; }
+  if( bits >> 2 ) { bits >>= 2; exponent += 2; }
+  if( bits >> 1 ) { exponent += 1; }
+
+  int subBucket = (int)( value >> ( exponent - SUB_BUCKET_BITS ) ) & ( SUB_BUCKETS - 1 );
+  return ( exponent - SUB_BUCKET_BITS + 1 ) * SUB_BUCKETS + subBucket;
+}
+
+unsigned long long LatencyHistogram::highestValueOf( int bucket )
+{
+  if( bucket < SUB_BUCKETS )
+    return bucket;
+
+  int shift = bucket / SUB_BUCKETS - 1;
+  unsigned long long subBucket = SUB_BUCKETS + bucket % SUB_BUCKETS;
+  return ( ( subBucket + 1 ) << shift ) - 1;
+}
+
+void LatencyHistogram::record( unsigned long long nanos )
+{
+  m_buckets[ bucketOf( nanos ) ].fetch_add( 1, std::memory_order_relaxed );
+  m_count.fetch_add( 1, std::memory_order_relaxed );
+  m_sum.fetch_add( nanos, std::memory_order_relaxed );
+
+  unsigned long long current = m_max.load( std::memory_order_relaxed );
+  while( nanos > current
+         && !m_max.compare_exchange_weak( current, nanos, std::memory_order_relaxed ) ) {}
+}
+
+unsigned long long LatencyHistogram::percentile( double fraction ) const
+{
+  // sum the buckets rather than trusting m_count, a writer may be between the two
+  unsigned long long total = 0;
+  for( int i = 0; i < BUCKETS; ++i )
+    total += m_buckets[ i ].load( std::memory_order_relaxed );
+  if( !total )
+    return 0;
+
+  unsigned long long target = (unsigned long long)( fraction * total + 0.5 );
+  if( target < 1 ) target = 1;
+  if( target > total ) target = total;
+
+  unsigned long long seen = 0;
+  for( int i = 0; i < BUCKETS; ++i )
+  {
+    seen += m_buckets[ i ].load( std::memory_order_relaxed );
+    if( seen >= target )
+    {
+      unsigned long long value = highestValueOf( i );
+      return value < max() ? value : max();
+    }
+  }
+  return max();
+}
+
+SessionMetrics::SessionMetrics()
+{
+  for( int i = 0; i < COUNTERS; ++i )
+    m_counters[ i ].store( 0, std::memory_order_relaxed );
+  for( int i = 0; i < GAUGES; ++i )
+    m_gauges[ i ].store( 0, std::memory_order_relaxed );
+}
+
+void SessionMetrics::toJSON( std::ostream& stream, const Sessions& sessions )
+{
+  stream << "{\"sessions\":[";
+
+  for( Sessions::const_iterator i = sessions.begin(); i != sessions.end(); ++i )
+  {
+    const SessionMetrics& metrics = *i->second;
+    if( i != sessions.begin() ) stream << ",";
+    stream << "{\"sessionID\":\"";
+    writeEscaped( stream, i->first.toString() );
+    stream << "\"";
+
+    for( int c = 0; c < COUNTERS; ++c )
+      stream << ",\"" << counterNames[ c ].json << "\":" << metrics.get( (Counter)c );
+    for( int g = 0; g < GAUGES; ++g )
+      stream << ",\"" << gaugeNames[ g ].json << "\":" << metrics.get( (Gauge)g );
+
+    stream << ",\"latencyNanos\":{";
+    for( int s = 0; s < STAGES; ++s )
+    {
+      const LatencyHistogram& histogram = metrics.get( (Stage)s );
+      if( s ) stream << ",";
+      stream << "\"" << stageNames[ s ].json << "\":{"
+             << "\"count\":" << histogram.count()
+             << ",\"sum\":" << histogram.sum()
+             << ",\"max\":" << histogram.max();
+      for( size_t q = 0; q < QUANTILES; ++q )
+        stream << ",\"" << quantileNames[ q ] << "\":" << histogram.percentile( quantiles[ q ] );
+      stream << "}";
+    }
+    stream << "}}";
+  }
+
+  stream << "]}";
+}
+
+void SessionMetrics::toPrometheus( std::ostream& stream, const Sessions& sessions )
+{
+  Sessions::const_iterator i;
+
+  for( int c = 0; c < COUNTERS; ++c )
+  {
+    writeHeader( stream, counterNames[ c ], "counter" );
+    for( i = sessions.begin(); i != sessions.end(); ++i )
+    {
+      stream << counterNames[ c ].prometheus;
+      writeLabel( stream, i->first );
+      stream << "} " << i->second->get( (Counter)c ) << "\n";
+    }
+  }
+
+  for( int g = 0; g < GAUGES; ++g )
+  {
+    writeHeader( stream, gaugeNames[ g ], "gauge" );
+    for( i = sessions.begin(); i != sessions.end(); ++i )
+    {
+      stream << gaugeNames[ g ].prometheus;
+      writeLabel( stream, i->first );
+      stream << "} " << i->second->get( (Gauge)g ) << "\n";
+    }
+  }
+
+  std::streamsize precision = stream.precision( 9 );
+  for( int s = 0; s < STAGES; ++s )
+  {
+    const char* name = stageNames[ s ].prometheus;
+    writeHeader( stream, stageNames[ s ], "summary" );
+    for( i = sessions.begin(); i != sessions.end(); ++i )
+    {
+      const LatencyHistogram& histogram = i->second->get( (Stage)s );
+      for( size_t q = 0; q < QUANTILES; ++q )
+      {
+        stream << name;
+        writeLabel( stream, i->first );
+        stream << ",quantile=\"" << quantiles[ q ] << "\"} "
+               << histogram.percentile( quantiles[ q ] ) / 1e9 << "\n";
+      }
+      stream << name << "_sum";
+      writeLabel( stream, i->first );
+      stream << "} " << histogram.sum() / 1e9 << "\n";
+      stream << name << "_count";
+      writeLabel( stream, i->first );
+      stream << "} " << histogram.count() << "\n";
+    }
+  }
+  stream.precision( precision );
+}
+}
@@ -0,0 +1,162 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_SESSIONMETRICS_H
+#define FIX_SESSIONMETRICS_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "SessionID.h"
+#include "Utility.h"
+#include <atomic>
+#include <ostream>
+#include <vector>
+
+namespace FIX
+{
+/**
+ * Fixed size histogram of durations in nanoseconds.
+ *
+ * Values are kept in log-linear buckets with three significant bits,
+ * so any percentile is reported within 12.5% of the recorded value.
+ * Recording never allocates or locks and may run concurrently with
+ * readers.
+ */
+class LatencyHistogram
+{
+public:
+  LatencyHistogram();
+
+  void record( unsigned long long nanos );
+
+  unsigned long long count() const
+  { return m_count.load( std::memory_order_relaxed ); }
+  unsigned long long sum() const
+  { return m_sum.load( std::memory_order_relaxed ); }
+  unsigned long long max() const
+  { return m_max.load( std::memory_order_relaxed ); }
+  /// Smallest bucket bound below which the given fraction of values fall
+  unsigned long long percentile( double fraction ) const;
+
+private:
+  enum
+  {
+    SUB_BUCKET_BITS = 3,
+    SUB_BUCKETS = 1 << SUB_BUCKET_BITS,
+    MAX_BITS = 40,
+    BUCKETS = SUB_BUCKETS * ( MAX_BITS - SUB_BUCKET_BITS + 1 )
+  };
+
+  static int bucketOf( unsigned long long value );
+  static unsigned long long highestValueOf( int bucket );
+
+  std::atomic<unsigned long long> m_buckets[ BUCKETS ];
+  std::atomic<unsigned long long> m_count;
+  std::atomic<unsigned long long> m_sum;
+  std::atomic<unsigned long long> m_max;
+};
+
+/**
+ * Counters, gauges and latency histograms for a single session.
+ *
+ * A session only allocates metrics when CollectMetrics is enabled, and
+ * every instrumentation point checks for a null pointer before reading
+ * the clock, so disabled sessions pay a single branch.
+ */
+class SessionMetrics
+{
+public:
+  enum Counter
+  {
+    MESSAGES_IN, MESSAGES_OUT, BYTES_IN, BYTES_OUT,
+    RESEND_REQUESTS, MESSAGES_RESENT, SEQUENCE_GAPS, REJECTS,
+    COUNTERS
+  };
+
+  enum Gauge
+  {
+    QUEUED_MESSAGES, SEND_QUEUE_DEPTH,
+    GAUGES
+  };
+
+  /// WIRE_IN and WIRE_OUT come from kernel timestamps, so they are only
+  /// recorded for connections with SocketTimestamping turned on.
+  enum Stage
+  {
+    PARSE, VALIDATE, STORE, SEND, WIRE_IN, WIRE_OUT,
+    STAGES
+  };
+
+  /// Records the time spent in a stage for the lifetime of the object.
+  class StageTimer
+  {
+  public:
+    StageTimer( SessionMetrics* pMetrics, Stage stage )
+    : m_pMetrics( pMetrics ), m_stage( stage ),
+      m_start( pMetrics ? time_monotonic() : 0 ) {}
+    ~StageTimer()
+    {
+      if( m_pMetrics )
+        m_pMetrics->record( m_stage, time_monotonic() - m_start );
+    }
+
+  private:
+    SessionMetrics* m_pMetrics;
+    Stage m_stage;
+    unsigned long long m_start;
+  };
+
+  SessionMetrics();
+
+  void increment( Counter counter, unsigned long long value = 1 )
+  { m_counters[ counter ].fetch_add( value, std::memory_order_relaxed ); }
+  void set( Gauge gauge, long long value )
+  { m_gauges[ gauge ].store( value, std::memory_order_relaxed ); }
+  void record( Stage stage, unsigned long long nanos )
+  { m_stages[ stage ].record( nanos ); }
+
+  unsigned long long get( Counter counter ) const
+  { return m_counters[ counter ].load( std::memory_order_relaxed ); }
+  long long get( Gauge gauge ) const
+  { return m_gauges[ gauge ].load( std::memory_order_relaxed ); }
+  const LatencyHistogram& get( Stage stage ) const
+  { return m_stages[ stage ]; }
+
+  typedef std::vector< std::pair<SessionID, const SessionMetrics*> > Sessions;
+
+  /// Write metrics for the given sessions as a JSON document
+  static void toJSON( std::ostream&, const Sessions& );
+  /// Write metrics for the given sessions in Prometheus text format
+  static void toPrometheus( std::ostream&, const Sessions& );
+
+private:
+  SessionMetrics( const SessionMetrics& );
+  SessionMetrics& operator=( const SessionMetrics& );
+
+  std::atomic<unsigned long long> m_counters[ COUNTERS ];
+  std::atomic<long long> m_gauges[ GAUGES ];
+  LatencyHistogram m_stages[ STAGES ];
+};
+}
+
+#endif //FIX_SESSIONMETRICS_H
@@ -61,24 +61,49 @@ const char MAX_LATENCY[] = "MaxLatency";
 const char HEARTBTINT[] = "HeartBtInt";
 const char SOCKET_ACCEPT_PORT[] = "SocketAcceptPort";
 const char SOCKET_REUSE_ADDRESS[] = "SocketReuseAddress";
+const char SOCKET_ACCEPT_THREADS[] = "SocketAcceptThreads";
 const char SOCKET_CONNECT_HOST[] = "SocketConnectHost";
 const char SOCKET_CONNECT_PORT[] = "SocketConnectPort";
+const char SOCKET_CONNECT_HOST_LIMIT[] = "SocketConnectHostLimit";
 const char SOCKET_NODELAY[] = "SocketNodelay";
 const char SOCKET_SEND_BUFFER_SIZE[] = "SendBufferSize";
 const char SOCKET_RECEIVE_BUFFER_SIZE[] = "ReceiveBufferSize";
+const char SOCKET_ZERO_COPY_SIZE[] = "SocketZeroCopySize";
 const char RECONNECT_INTERVAL[] = "ReconnectInterval";
+const char RECONNECT_JITTER[] = "ReconnectJitter";
+const char RECONNECT_MAX_INTERVAL[] = "ReconnectMaxInterval";
+const char SOCKET_CONNECT_TIMEOUT[] = "SocketConnectTimeout";
+const char SOCKET_RESOLVE_TTL[] = "SocketResolveTTL";
+const char SOCKET_BUSY_POLL[] = "SocketBusyPoll";
+const char SOCKET_BUSY_POLL_TIME[] = "SocketBusyPollTime";
+const char SOCKET_SPIN_COUNT[] = "SocketSpinCount";
+const char SOCKET_PARK_TIMEOUT[] = "SocketParkTimeout";
+const char SOCKET_THREAD_CPU[] = "SocketThreadCPU";
+const char SOCKET_QUICK_ACK[] = "SocketQuickAck";
+const char SOCKET_USER_TIMEOUT[] = "SocketUserTimeout";
+const char SOCKET_PRIORITY[] = "SocketPriority";
+const char SOCKET_TOS[] = "SocketTOS";
+const char SOCKET_KEEP_ALIVE[] = "SocketKeepAlive";
+const char SOCKET_KEEP_ALIVE_IDLE[] = "SocketKeepAliveIdle";
+const char SOCKET_KEEP_ALIVE_INTERVAL[] = "SocketKeepAliveInterval";
+const char SOCKET_KEEP_ALIVE_COUNT[] = "SocketKeepAliveCount";
+const char SOCKET_TIMESTAMPING[] = "SocketTimestamping";
+const char SHARED_MEMORY_NAME[] = "SharedMemoryName";
+const char SHARED_MEMORY_SIZE[] = "SharedMemorySize";
 const char VALIDATE_LENGTH_AND_CHECKSUM[] = "ValidateLengthAndChecksum";
 const char VALIDATE[] = "Validate";
 const char VALIDATE_FIELDS_OUT_OF_ORDER[] = "ValidateFieldsOutOfOrder";
 const char VALIDATE_FIELDS_HAVE_VALUES[] = "ValidateFieldsHaveValues";
 const char VALIDATE_USER_DEFINED_FIELDS[] = "ValidateUserDefinedFields";
 const char VALIDATE_BOUNDS[] = "ValidateBounds";
+const char LAZY_VALIDATION[] = "LazyValidation";
 const char ALLOWED_FIELDS[] = "AllowedFields";
 const char VALIDATION_RULES[] = "ValidationRules";
 const char SCHEDULE[] = "Schedule";
 const char LOGON_TIMEOUT[] = "LogonTimeout";
 const char LOGOUT_TIMEOUT[] = "LogoutTimeout";
 const char FILE_STORE_PATH[] = "FileStorePath";
+const char FILE_IO_THREADS[] = "FileIOThreads";
 const char MYSQL_STORE_USECONNECTIONPOOL[] = "MySQLStoreUseConnectionPool";
 const char MYSQL_STORE_DATABASE[] = "MySQLStoreDatabase";
 const char MYSQL_STORE_USER[] = "MySQLStoreUser";
@@ -108,6 +133,9 @@ const char MYSQL_LOG_PORT[] = "MySQLLogPort";
 const char MYSQL_LOG_INCOMING_TABLE[] = "MySQLLogIncomingTable";
 const char MYSQL_LOG_OUTGOING_TABLE[] = "MySQLLogOutgoingTable";
 const char MYSQL_LOG_EVENT_TABLE[] = "MySQLLogEventTable";
+const char MYSQL_LOG_FLUSH_INTERVAL[] = "MySQLLogFlushInterval";
+const char MYSQL_LOG_BATCH_SIZE[] = "MySQLLogBatchSize";
+const char MYSQL_LOG_QUEUE_SIZE[] = "MySQLLogQueueSize";
 const char POSTGRESQL_LOG_USECONNECTIONPOOL[] = "PostgreSQLLogUseConnectionPool";
 const char POSTGRESQL_LOG_DATABASE[] = "PostgreSQLLogDatabase";
 const char POSTGRESQL_LOG_USER[] = "PostgreSQLLogUser";
@@ -117,12 +145,18 @@ const char POSTGRESQL_LOG_PORT[] = "PostgreSQLLogPort";
 const char POSTGRESQL_LOG_INCOMING_TABLE[] = "PostgreSQLLogIncomingTable";
 const char POSTGRESQL_LOG_OUTGOING_TABLE[] = "PostgreSQLLogOutgoingTable";
 const char POSTGRESQL_LOG_EVENT_TABLE[] = "PostgreSQLLogEventTable";
+const char POSTGRESQL_LOG_FLUSH_INTERVAL[] = "PostgreSQLLogFlushInterval";
+const char POSTGRESQL_LOG_BATCH_SIZE[] = "PostgreSQLLogBatchSize";
+const char POSTGRESQL_LOG_QUEUE_SIZE[] = "PostgreSQLLogQueueSize";
 const char ODBC_LOG_USER[] = "OdbcLogUser";
 const char ODBC_LOG_PASSWORD[] = "OdbcLogPassword";
 const char ODBC_LOG_CONNECTION_STRING[] = "OdbcLogConnectionString";
 const char ODBC_LOG_INCOMING_TABLE[] = "OdbcLogIncomingTable";
 const char ODBC_LOG_OUTGOING_TABLE[] = "OdbcLogOutgoingTable";
 const char ODBC_LOG_EVENT_TABLE[] = "OdbcLogEventTable";
+const char ODBC_LOG_FLUSH_INTERVAL[] = "OdbcLogFlushInterval";
+const char ODBC_LOG_BATCH_SIZE[] = "OdbcLogBatchSize";
+const char ODBC_LOG_QUEUE_SIZE[] = "OdbcLogQueueSize";
 const char RESET_ON_LOGON[] = "ResetOnLogon";
 const char RESET_ON_LOGOUT[] = "ResetOnLogout";
 const char RESET_ON_DISCONNECT[] = "ResetOnDisconnect";
@@ -131,6 +165,8 @@ const char REFRESH_ON_LOGON[] = "RefreshOnLogon";
 const char MILLISECONDS_IN_TIMESTAMP[] = "MillisecondsInTimeStamp";
 const char HTTP_ACCEPT_PORT[] = "HttpAcceptPort";
 const char PERSIST_MESSAGES[] = "PersistMessages";
+const char RESEND_CHUNK_SIZE[] = "ResendChunkSize";
+const char COLLECT_METRICS[] = "CollectMetrics";
 
 /// Container for setting dictionaries mapped to sessions.
 class SessionSettings
@@ -45,6 +45,7 @@ public:
   m_sentReset( false ), m_receivedReset( false ),
   m_initiate( false ), m_logonTimeout( 10 ), 
   m_logoutTimeout( 2 ), m_testRequest( 0 ),
+  m_batchDepth( 0 ), m_nextTargetMsgSeqNum( 0 ),
   m_pStore( 0 ), m_pLog( 0 )
   {
     m_lastConnectionAttempt += -10000000;
@@ -171,7 +172,7 @@ public:
     Messages::iterator i = m_queue.find( msgSeqNum );
     if ( i != m_queue.end() )
     {
-      message = i->second;
+      message = std::move( i->second );
       m_queue.erase( i );
       return true;
     }
@@ -179,32 +180,48 @@ public:
   }
   void clearQueue()
   { Locker l( m_mutex ); m_queue.clear(); }
+  size_t queueSize() const
+  { Locker l( m_mutex ); return m_queue.size(); }
 
   bool set( int s, const std::string& m ) throw ( IOException )
   { Locker l( m_mutex ); return m_pStore->set( s, m ); }
   void get( int b, int e, std::vector < std::string > &m ) const
   throw ( IOException )
   { Locker l( m_mutex ); m_pStore->get( b, e, m ); }
+  MessageStoreCursor* cursor( int b, int e ) const throw ( IOException )
+  { Locker l( m_mutex ); return new LockedCursor( m_pStore->cursor( b, e ), m_mutex ); }
   int getNextSenderMsgSeqNum() const throw ( IOException )
   { Locker l( m_mutex ); return m_pStore->getNextSenderMsgSeqNum(); }
   int getNextTargetMsgSeqNum() const throw ( IOException )
-  { Locker l( m_mutex ); return m_pStore->getNextTargetMsgSeqNum(); }
+  {
+    Locker l( m_mutex );
+    return m_nextTargetMsgSeqNum ?
+      m_nextTargetMsgSeqNum : m_pStore->getNextTargetMsgSeqNum();
+  }
   void setNextSenderMsgSeqNum( int n ) throw ( IOException )
   { Locker l( m_mutex ); m_pStore->setNextSenderMsgSeqNum( n ); }
   void setNextTargetMsgSeqNum( int n ) throw ( IOException )
-  { Locker l( m_mutex ); m_pStore->setNextTargetMsgSeqNum( n ); }
+  { Locker l( m_mutex ); m_nextTargetMsgSeqNum = 0; m_pStore->setNextTargetMsgSeqNum( n ); }
   void incrNextSenderMsgSeqNum() throw ( IOException )
   { Locker l( m_mutex ); m_pStore->incrNextSenderMsgSeqNum(); }
   void incrNextTargetMsgSeqNum() throw ( IOException )
-  { Locker l( m_mutex ); m_pStore->incrNextTargetMsgSeqNum(); }
+  {
+    Locker l( m_mutex );
+    if( !m_batchDepth )
+      m_pStore->incrNextTargetMsgSeqNum();
+    else if( m_nextTargetMsgSeqNum )
+      ++m_nextTargetMsgSeqNum;
+    else
+      m_nextTargetMsgSeqNum = m_pStore->getNextTargetMsgSeqNum() + 1;
+  }
   UtcTimeStamp getCreationTime() const throw ( IOException )
   { Locker l( m_mutex ); return m_pStore->getCreationTime(); }
   void reset() throw ( IOException )
-  { Locker l( m_mutex ); m_pStore->reset(); }
+  { Locker l( m_mutex ); m_nextTargetMsgSeqNum = 0; m_pStore->reset(); }
   void softReset() throw ( IOException )
   { Locker l( m_mutex ); m_pStore->softReset(); }
   void refresh() throw ( IOException )
-  { Locker l( m_mutex ); m_pStore->refresh(); }
+  { Locker l( m_mutex ); flushTargetMsgSeqNum(); m_pStore->refresh(); }
 
   void clear()
   { if ( !m_pLog ) return ; Locker l( m_mutex ); m_pLog->clear(); }
@@ -221,7 +238,48 @@ public:
   void onEvent( const std::string& string )
   { if ( !m_pLog ) return ; Locker l( m_mutex ); m_pLog->onEvent( string ); }
 
+  /// Hold target sequence number updates and log flushes until endBatch.
+  void beginBatch()
+  {
+    Locker l( m_mutex );
+    if ( m_batchDepth++ || !m_pLog ) return ;
+    m_pLog->beginBatch();
+  }
+  /// Store the target sequence number reached and flush the log.
+  void endBatch() throw ( IOException )
+  {
+    Locker l( m_mutex );
+    if ( --m_batchDepth ) return ;
+    if ( m_pLog ) m_pLog->endBatch();
+    flushTargetMsgSeqNum();
+  }
+
 private:
+  void flushTargetMsgSeqNum() throw ( IOException )
+  {
+    if ( !m_nextTargetMsgSeqNum ) return ;
+    const int next = m_nextTargetMsgSeqNum;
+    m_nextTargetMsgSeqNum = 0;
+    m_pStore->setNextTargetMsgSeqNum( next );
+  }
+
+  /// Serializes a store cursor with the other store operations
+  class LockedCursor : public MessageStoreCursor
+  {
+  public:
+    LockedCursor( MessageStoreCursor* pCursor, Mutex& mutex )
+    : m_pCursor( pCursor ), m_mutex( mutex ) {}
+    ~LockedCursor()
+    { Locker l( m_mutex ); delete m_pCursor; }
+
+    bool next( std::string& m ) throw ( IOException )
+    { Locker l( m_mutex ); return m_pCursor->next( m ); }
+
+  private:
+    MessageStoreCursor* m_pCursor;
+    Mutex& m_mutex;
+  };
+
   bool m_manualLoginRequested;
   bool m_manualLogoutRequested;
   bool m_receivedLogon;
@@ -233,6 +291,9 @@ private:
   int m_logonTimeout;
   int m_logoutTimeout;
   int m_testRequest;
+  /// open batches and the target sequence number they have not stored
+  int m_batchDepth;
+  int m_nextTargetMsgSeqNum;
   ResendRange m_resendRange;
   HeartBtInt m_heartBtInt;
   UtcTimeStamp m_lastSentTime;
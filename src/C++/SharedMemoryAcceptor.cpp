@@ -0,0 +1,191 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "SharedMemoryAcceptor.h"
+#include "Session.h"
+#include "Settings.h"
+#include "Utility.h"
+
+namespace FIX
+{
+const int SharedMemoryAcceptor::DEFAULT_SIZE = 1024 * 1024;
+
+SharedMemoryAcceptor::SharedMemoryAcceptor(
+  Application& application,
+  MessageStoreFactory& factory,
+  const SessionSettings& settings ) throw( ConfigError )
+: Acceptor( application, factory, settings ) {}
+
+SharedMemoryAcceptor::SharedMemoryAcceptor(
+  Application& application,
+  MessageStoreFactory& factory,
+  const SessionSettings& settings,
+  LogFactory& logFactory ) throw( ConfigError )
+: Acceptor( application, factory, settings, logFactory ) {}
+
+SharedMemoryAcceptor::~SharedMemoryAcceptor()
+{
+  SessionToConnection::iterator i;
+  for( i = m_connections.begin(); i != m_connections.end(); ++i )
+    delete i->second;
+}
+
+void SharedMemoryAcceptor::onConfigure( const SessionSettings& s )
+throw ( ConfigError )
+{
+  std::set<std::string> names;
+
+  std::set<SessionID> sessions = s.getSessions();
+  std::set<SessionID>::iterator i;
+  for( i = sessions.begin(); i != sessions.end(); ++i )
+  {
+    const Dictionary& settings = s.get( *i );
+    if( settings.getString( CONNECTION_TYPE ) != "acceptor" )
+      continue;
+
+    const std::string name = settings.getString( SHARED_MEMORY_NAME );
+    if( !names.insert( name ).second )
+      throw ConfigError( "Shared memory " + name + " is used by more than one session" );
+    if( getSize( settings ) <= 0 )
+      throw ConfigError( std::string( SHARED_MEMORY_SIZE ) + " must be positive" );
+  }
+}
+
+void SharedMemoryAcceptor::onInitialize( const SessionSettings& s )
+throw ( RuntimeError )
+{
+  // segments are offered before start returns, like a listening socket
+  const std::set<SessionID>& sessions = getSessions();
+  std::set<SessionID>::const_iterator i;
+  for( i = sessions.begin(); i != sessions.end(); ++i )
+  {
+    if( m_connections.find( *i ) != m_connections.end() )
+      continue;
+
+    const Dictionary& settings = s.get( *i );
+    m_connections[ *i ] = SharedMemoryConnection::create
+      ( settings.getString( SHARED_MEMORY_NAME ), getSize( settings ) );
+  }
+}
+
+void SharedMemoryAcceptor::onStart()
+{
+  Locker l( m_mutex );
+
+  SessionToConnection::iterator i;
+  for( i = m_connections.begin(); i != m_connections.end(); ++i )
+  {
+    const Dictionary* pSettings = getSessionSettings( i->first );
+    SessionThreadInfo* info = new SessionThreadInfo
+      ( this, i->first, i->second,
+        pSettings->getString( SHARED_MEMORY_NAME ), getSize( *pSettings ) );
+
+    thread_id thread;
+    if( thread_spawn( &sessionThread, info, thread ) )
+      m_threads[ i->first ] = thread;
+    else
+      delete info;
+  }
+  m_connections.clear();
+}
+
+bool SharedMemoryAcceptor::onPoll( double timeout )
+{
+  return false;
+}
+
+void SharedMemoryAcceptor::onStop()
+{
+  SessionToThread threads;
+  {
+    Locker l( m_mutex );
+    threads = m_threads;
+    m_threads.clear();
+  }
+
+  // each thread notices the stop within a second
+  SessionToThread::iterator i;
+  for( i = threads.begin(); i != threads.end(); ++i )
+    thread_join( i->second );
+}
+
+int SharedMemoryAcceptor::getSize( const Dictionary& settings ) const
+{
+  return settings.has( SHARED_MEMORY_SIZE ) ?
+    settings.getInt( SHARED_MEMORY_SIZE ) : DEFAULT_SIZE;
+}
+
+THREAD_PROC SharedMemoryAcceptor::sessionThread( void* p )
+{
+  SessionThreadInfo* info = reinterpret_cast < SessionThreadInfo* > ( p );
+
+  SharedMemoryAcceptor* pAcceptor = info->m_pAcceptor;
+  SessionID sessionID = info->m_sessionID;
+  SharedMemoryConnection* pConnection = info->m_pConnection;
+  std::string name = info->m_name;
+  int size = info->m_size;
+  delete info;
+
+  Session* pSession = pAcceptor->getSession( sessionID );
+  while( pSession && !pAcceptor->isStopped() )
+  {
+    // once a peer has gone a fresh segment is offered for the next one
+    if( !pConnection )
+    {
+      try
+      {
+        pConnection = SharedMemoryConnection::create( name, size );
+      }
+      catch( RuntimeError& e )
+      {
+        pSession->getLog()->onEvent( e.what() );
+        process_sleep( 1 );
+        continue;
+      }
+    }
+
+    while( !pAcceptor->isStopped() && !pConnection->isConnected() )
+      process_sleep( 0.01 );
+
+    if( pConnection->isConnected() && Session::registerSession( sessionID ) )
+    {
+      pSession->getLog()->onEvent( "Accepted shared memory connection on " + name );
+      pConnection->setSession( pSession );
+      pSession->setResponder( pConnection );
+
+      while( !pAcceptor->isStopped() && pConnection->read() ) {}
+
+      pSession->disconnect();
+      Session::unregisterSession( sessionID );
+    }
+
+    delete pConnection;
+    pConnection = 0;
+  }
+
+  delete pConnection;
+  return 0;
+}
+}
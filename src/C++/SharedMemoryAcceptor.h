@@ -0,0 +1,94 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_SHAREDMEMORYACCEPTOR_H
+#define FIX_SHAREDMEMORYACCEPTOR_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "Acceptor.h"
+#include "SharedMemoryConnection.h"
+#include "Mutex.h"
+#include <map>
+
+namespace FIX
+{
+/*! \addtogroup user
+ *  @{
+ */
+/**
+ * Shared memory implementation of Acceptor.
+ *
+ * Each session gets its own segment, named by SharedMemoryName, and a
+ * thread that offers the segment, serves the initiator that attaches and
+ * offers a fresh segment once that initiator goes away.
+ */
+class SharedMemoryAcceptor : public Acceptor
+{
+public:
+  SharedMemoryAcceptor( Application&, MessageStoreFactory&,
+                        const SessionSettings& ) throw( ConfigError );
+  SharedMemoryAcceptor( Application&, MessageStoreFactory&,
+                        const SessionSettings&,
+                        LogFactory& ) throw( ConfigError );
+
+  virtual ~SharedMemoryAcceptor();
+
+private:
+  struct SessionThreadInfo
+  {
+    SessionThreadInfo( SharedMemoryAcceptor* pAcceptor, const SessionID& sessionID,
+                       SharedMemoryConnection* pConnection, const std::string& name, int size )
+    : m_pAcceptor( pAcceptor ), m_sessionID( sessionID ),
+      m_pConnection( pConnection ), m_name( name ), m_size( size ) {}
+
+    SharedMemoryAcceptor* m_pAcceptor;
+    SessionID m_sessionID;
+    SharedMemoryConnection* m_pConnection;
+    std::string m_name;
+    int m_size;
+  };
+
+  typedef std::map < SessionID, SharedMemoryConnection* > SessionToConnection;
+  typedef std::map < SessionID, thread_id > SessionToThread;
+
+  void onConfigure( const SessionSettings& ) throw ( ConfigError );
+  void onInitialize( const SessionSettings& ) throw ( RuntimeError );
+
+  void onStart();
+  bool onPoll( double timeout );
+  void onStop();
+
+  int getSize( const Dictionary& ) const;
+  static THREAD_PROC sessionThread( void* p );
+
+  static const int DEFAULT_SIZE;
+
+  SessionToConnection m_connections;
+  SessionToThread m_threads;
+  Mutex m_mutex;
+};
+/*! @} */
+}
+
+#endif //FIX_SHAREDMEMORYACCEPTOR_H
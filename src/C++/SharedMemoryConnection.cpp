@@ -0,0 +1,389 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "SharedMemoryConnection.h"
+#include "Session.h"
+#include "Utility.h"
+#include <atomic>
+#include <new>
+#include <signal.h>
+#include <sys/mman.h>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+namespace FIX
+{
+/// One direction of a segment, written by one side and read by the other.
+struct SharedMemoryRing
+{
+  /// bytes ever written and read, the difference is what is waiting
+  std::atomic < unsigned long long > m_head;
+  char m_headPadding[ 56 ];
+  std::atomic < unsigned long long > m_tail;
+  char m_tailPadding[ 56 ];
+  /// bumped on every write, a sleeping reader waits for it to change
+  std::atomic < int > m_signal;
+  std::atomic < int > m_sleeping;
+  unsigned int m_capacity;
+  unsigned int m_offset;
+};
+
+struct SharedMemorySegment
+{
+  enum State { EMPTY, LISTENING, CONNECTED, CLOSED };
+  static const unsigned int MAGIC = 0x46495831;
+
+  unsigned int m_magic;
+  /// process that created the segment, to spot one it left behind
+  int m_creator;
+  std::atomic < int > m_state;
+  /// initiator to acceptor, then acceptor to initiator
+  SharedMemoryRing m_rings[ 2 ];
+};
+
+static void shm_wake( SharedMemoryRing& ring )
+{
+  ring.m_signal.fetch_add( 1 );
+  if( !ring.m_sleeping.load() )
+    return;
+#ifdef __linux__
+  syscall( SYS_futex, reinterpret_cast < int* > ( &ring.m_signal ),
+           FUTEX_WAKE, 1, 0, 0, 0 );
+#endif
+}
+
+static void shm_copyIn( char* data, unsigned int capacity,
+                        unsigned long long position, const char* source, size_t size )
+{
+  const size_t start = (size_t)( position & ( capacity - 1 ) );
+  const size_t first = std::min( size, capacity - start );
+  memcpy( data + start, source, first );
+  memcpy( data, source + first, size - first );
+}
+
+static void shm_copyOut( const char* data, unsigned int capacity,
+                         unsigned long long position, char* target, size_t size )
+{
+  const size_t start = (size_t)( position & ( capacity - 1 ) );
+  const size_t first = std::min( size, capacity - start );
+  memcpy( target, data + start, first );
+  memcpy( target + first, data, size - first );
+}
+
+static std::string shm_path( const std::string& name )
+{
+  return name.size() && name[ 0 ] == '/' ? name : "/" + name;
+}
+
+/// The ring lies within the mapping and wraps with a mask.
+static bool shm_validRing( const SharedMemoryRing& ring, size_t length )
+{
+  const unsigned int capacity = ring.m_capacity;
+  return capacity >= sizeof( unsigned int )
+    && ( capacity & ( capacity - 1 ) ) == 0
+    && ring.m_offset >= sizeof( SharedMemorySegment )
+    && (size_t)ring.m_offset + capacity <= length;
+}
+
+/// A FIX segment whose creator is no longer running.
+static bool shm_abandoned( const std::string& path )
+{
+  int fd = shm_open( path.c_str(), O_RDONLY, 0 );
+  if( fd < 0 )
+    return false;
+
+  struct stat status;
+  void* address = MAP_FAILED;
+  if( fstat( fd, &status ) == 0 && status.st_size >= (off_t)sizeof( SharedMemorySegment ) )
+    address = mmap( 0, sizeof( SharedMemorySegment ), PROT_READ, MAP_SHARED, fd, 0 );
+  ::close( fd );
+  if( address == MAP_FAILED )
+    return false;
+
+  const SharedMemorySegment* pSegment = static_cast < const SharedMemorySegment* > ( address );
+  const bool abandoned = pSegment->m_magic == SharedMemorySegment::MAGIC
+    && kill( pSegment->m_creator, 0 ) != 0 && errno == ESRCH;
+  munmap( address, sizeof( SharedMemorySegment ) );
+  return abandoned;
+}
+
+SharedMemoryConnection* SharedMemoryConnection::create
+( const std::string& name, int size ) throw( RuntimeError )
+{
+  const std::string path = shm_path( name );
+
+  unsigned int capacity = 4096;
+  while( capacity < (unsigned int)size && capacity < 0x40000000 )
+    capacity <<= 1;
+  const size_t offset = ( sizeof( SharedMemorySegment ) + 63 ) & ~(size_t)63;
+  const size_t length = offset + 2 * (size_t)capacity;
+
+  // a live segment is never replaced, only one whose creator has died
+  int fd = shm_open( path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600 );
+  if( fd < 0 && errno == EEXIST && shm_abandoned( path ) )
+  {
+    shm_unlink( path.c_str() );
+    fd = shm_open( path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600 );
+  }
+  if( fd < 0 )
+    throw RuntimeError( "Unable to create shared memory " + path
+                        + " (" + strerror( errno ) + ")" );
+
+  void* address = MAP_FAILED;
+  if( ftruncate( fd, length ) == 0 )
+    address = mmap( 0, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+  ::close( fd );
+  if( address == MAP_FAILED )
+  {
+    shm_unlink( path.c_str() );
+    throw RuntimeError( "Unable to map shared memory " + path
+                        + " (" + strerror( errno ) + ")" );
+  }
+
+  SharedMemorySegment* pSegment = new( address ) SharedMemorySegment();
+  pSegment->m_magic = SharedMemorySegment::MAGIC;
+  pSegment->m_creator = (int)getpid();
+  for( int i = 0; i < 2; ++i )
+  {
+    pSegment->m_rings[ i ].m_capacity = capacity;
+    pSegment->m_rings[ i ].m_offset = (unsigned int)( offset + i * capacity );
+  }
+  pSegment->m_state.store( SharedMemorySegment::LISTENING );
+
+  return new SharedMemoryConnection( path, true, pSegment, length );
+}
+
+SharedMemoryConnection* SharedMemoryConnection::open
+( const std::string& name ) throw( RuntimeError )
+{
+  const std::string path = shm_path( name );
+
+  int fd = shm_open( path.c_str(), O_RDWR, 0 );
+  if( fd < 0 )
+  {
+    if( errno == ENOENT )
+      return 0;
+    throw RuntimeError( "Unable to open shared memory " + path
+                        + " (" + strerror( errno ) + ")" );
+  }
+
+  struct stat status;
+  void* address = MAP_FAILED;
+  size_t length = 0;
+  if( fstat( fd, &status ) == 0 && status.st_size >= (off_t)sizeof( SharedMemorySegment ) )
+  {
+    length = (size_t)status.st_size;
+    address = mmap( 0, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+  }
+  ::close( fd );
+  if( address == MAP_FAILED )
+    return 0;
+
+  // the layout is complete once the creator has made it listening
+  SharedMemorySegment* pSegment = static_cast < SharedMemorySegment* > ( address );
+  if( pSegment->m_state.load() != SharedMemorySegment::LISTENING )
+  {
+    munmap( address, length );
+    return 0;
+  }
+
+  if( pSegment->m_magic != SharedMemorySegment::MAGIC
+      || pSegment->m_rings[ 0 ].m_capacity != pSegment->m_rings[ 1 ].m_capacity
+      || !shm_validRing( pSegment->m_rings[ 0 ], length )
+      || !shm_validRing( pSegment->m_rings[ 1 ], length ) )
+  {
+    munmap( address, length );
+    throw RuntimeError( "Shared memory " + path + " is not a FIX segment" );
+  }
+
+  // only a listening segment can be taken, and only by one initiator
+  int listening = SharedMemorySegment::LISTENING;
+  if( !pSegment->m_state.compare_exchange_strong( listening, SharedMemorySegment::CONNECTED ) )
+  {
+    munmap( address, length );
+    return 0;
+  }
+
+  shm_wake( pSegment->m_rings[ 0 ] );
+  return new SharedMemoryConnection( path, false, pSegment, length );
+}
+
+SharedMemoryConnection::SharedMemoryConnection
+( const std::string& name, bool owner, SharedMemorySegment* pSegment, size_t length )
+: m_name( name ), m_owner( owner ), m_pSegment( pSegment ), m_length( length ),
+  m_pInbound( &pSegment->m_rings[ owner ? 0 : 1 ] ),
+  m_pOutbound( &pSegment->m_rings[ owner ? 1 : 0 ] ),
+  m_capacity( m_pInbound->m_capacity ),
+  m_pInboundData( reinterpret_cast < char* > ( pSegment ) + m_pInbound->m_offset ),
+  m_pOutboundData( reinterpret_cast < char* > ( pSegment ) + m_pOutbound->m_offset ),
+  m_pSession( 0 ), m_disconnect( false ) {}
+
+SharedMemoryConnection::~SharedMemoryConnection()
+{
+  m_pSegment->m_state.store( SharedMemorySegment::CLOSED );
+  shm_wake( *m_pOutbound );
+  munmap( m_pSegment, m_length );
+  if( m_owner )
+    shm_unlink( m_name.c_str() );
+}
+
+bool SharedMemoryConnection::isConnected() const
+{
+  return m_pSegment->m_state.load() == SharedMemorySegment::CONNECTED;
+}
+
+bool SharedMemoryConnection::isClosed() const
+{
+  return m_pSegment->m_state.load() == SharedMemorySegment::CLOSED;
+}
+
+bool SharedMemoryConnection::send( const std::string& msg )
+{
+  SharedMemoryRing& ring = *m_pOutbound;
+  const unsigned int length = (unsigned int)msg.size();
+  const unsigned long long needed = sizeof( length ) + length;
+  if( needed > m_capacity || isClosed() )
+    return false;
+
+  // a full ring drains as the peer reads, unless the peer has gone
+  const unsigned long long head = ring.m_head.load( std::memory_order_relaxed );
+  while( head + needed - ring.m_tail.load( std::memory_order_acquire ) > m_capacity )
+  {
+    if( isClosed() )
+      return false;
+    process_sleep( 0.0001 );
+  }
+
+  shm_copyIn( m_pOutboundData, m_capacity, head, reinterpret_cast < const char* > ( &length ), sizeof( length ) );
+  shm_copyIn( m_pOutboundData, m_capacity, head + sizeof( length ), msg.data(), length );
+  ring.m_head.store( head + needed, std::memory_order_release );
+  shm_wake( ring );
+  return true;
+}
+
+void SharedMemoryConnection::disconnect()
+{
+  m_disconnect = true;
+  m_pSegment->m_state.store( SharedMemorySegment::CLOSED );
+  shm_wake( *m_pOutbound );
+  shm_wake( *m_pInbound );
+}
+
+bool SharedMemoryConnection::receive( std::string& msg )
+{
+  SharedMemoryRing& ring = *m_pInbound;
+  const unsigned long long tail = ring.m_tail.load( std::memory_order_relaxed );
+  const unsigned long long available = ring.m_head.load( std::memory_order_acquire ) - tail;
+  if( !available )
+    return false;
+
+  unsigned int length = 0;
+  if( available >= sizeof( length ) )
+    shm_copyOut( m_pInboundData, m_capacity, tail, reinterpret_cast < char* > ( &length ), sizeof( length ) );
+
+  // a frame the peer could not have written means the segment is corrupt
+  if( available > m_capacity || available < sizeof( length )
+      || length > available - sizeof( length ) )
+  {
+    m_pSegment->m_state.store( SharedMemorySegment::CLOSED );
+    shm_wake( *m_pOutbound );
+    return false;
+  }
+
+  msg.resize( length );
+  if( length )
+    shm_copyOut( m_pInboundData, m_capacity, tail + sizeof( length ), &msg[ 0 ], length );
+  ring.m_tail.store( tail + sizeof( length ) + length, std::memory_order_release );
+  return true;
+}
+
+bool SharedMemoryConnection::read()
+{
+  std::string msg;
+  bool received = false;
+  while( receive( msg ) )
+  {
+    received = true;
+    if( !m_pSession )
+      continue;
+    m_messages.push_back( std::string() );
+    m_messages.back().swap( msg );
+  }
+
+  // everything waiting in the ring is handed over as one batch
+  if( !m_messages.empty() )
+  {
+    try
+    {
+      m_pSession->nextBatch( m_messages, UtcTimeStamp() );
+    }
+    catch( InvalidMessage& )
+    {
+      m_messages.clear();
+      m_pSession->disconnect();
+      return false;
+    }
+    m_messages.clear();
+  }
+
+  if( isClosed() )
+  {
+    if( !m_disconnect && m_pSession )
+      m_pSession->disconnect();
+    return false;
+  }
+
+  if( !received && !wait( *m_pInbound, 1 ) && m_pSession )
+    m_pSession->next();
+  return true;
+}
+
+bool SharedMemoryConnection::wait( SharedMemoryRing& ring, double seconds )
+{
+  const int signal = ring.m_signal.load();
+  ring.m_sleeping.store( 1 );
+
+  bool ready = ring.m_head.load() != ring.m_tail.load() || isClosed();
+  if( !ready )
+  {
+#ifdef __linux__
+    timespec timeout;
+    timeout.tv_sec = (time_t)seconds;
+    timeout.tv_nsec = (long)( ( seconds - timeout.tv_sec ) * 1e9 );
+    syscall( SYS_futex, reinterpret_cast < int* > ( &ring.m_signal ),
+             FUTEX_WAIT, signal, &timeout, 0, 0 );
+#else
+    for( double waited = 0; waited < seconds && ring.m_signal.load() == signal; waited += 0.001 )
+      process_sleep( 0.001 );
+#endif
+    ready = ring.m_head.load() != ring.m_tail.load() || isClosed();
+  }
+
+  ring.m_sleeping.store( 0 );
+  return ready;
+}
+}
@@ -0,0 +1,105 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_SHAREDMEMORYCONNECTION_H
+#define FIX_SHAREDMEMORYCONNECTION_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "Responder.h"
+#include "Exceptions.h"
+#include <string>
+#include <vector>
+
+namespace FIX
+{
+class Session;
+struct SharedMemorySegment;
+struct SharedMemoryRing;
+
+/**
+ * A session's transport through a shared memory segment.
+ *
+ * The segment holds one single producer, single consumer ring for each
+ * direction.  Messages are stored with their length in front, so the
+ * reader hands them to the session without running them through a
+ * Parser.  A reader with nothing to do sleeps on a futex in the segment
+ * and the writer wakes it, so engines in different processes on the
+ * same host exchange messages without a socket.  Where futexes are not
+ * available the reader naps briefly between checks.
+ *
+ * The acceptor side creates the segment and the initiator side
+ * attaches to it.  Either side closing the segment disconnects both.
+ * A name in use by a running process is never taken over.
+ */
+class SharedMemoryConnection : public Responder
+{
+public:
+  /// Create a segment for an initiator to attach to.
+  static SharedMemoryConnection* create( const std::string& name, int size )
+  throw( RuntimeError );
+  /// Attach to a segment an acceptor created, 0 if none is listening.
+  static SharedMemoryConnection* open( const std::string& name )
+  throw( RuntimeError );
+
+  virtual ~SharedMemoryConnection();
+
+  void setSession( Session* pSession ) { m_pSession = pSession; }
+  Session* getSession() const { return m_pSession; }
+
+  /// Both sides are attached.
+  bool isConnected() const;
+  /// Either side has closed the segment.
+  bool isClosed() const;
+
+  bool send( const std::string& );
+  void disconnect();
+
+  /// Take the next message the peer sent, if there is one.
+  bool receive( std::string& );
+  /// Pass waiting messages to the session, waiting up to a second.
+  bool read();
+
+private:
+  SharedMemoryConnection( const std::string& name, bool owner,
+                          SharedMemorySegment* pSegment, size_t length );
+
+  bool wait( SharedMemoryRing& ring, double seconds );
+
+  std::string m_name;
+  bool m_owner;
+  SharedMemorySegment* m_pSegment;
+  size_t m_length;
+  SharedMemoryRing* m_pInbound;
+  SharedMemoryRing* m_pOutbound;
+  /// ring layout checked when attaching, not reread from the segment
+  unsigned int m_capacity;
+  char* m_pInboundData;
+  char* m_pOutboundData;
+  Session* m_pSession;
+  bool m_disconnect;
+  std::vector<std::string> m_messages;
+};
+}
+
+#endif //FIX_SHAREDMEMORYCONNECTION_H
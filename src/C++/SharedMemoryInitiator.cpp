@@ -0,0 +1,179 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "SharedMemoryInitiator.h"
+#include "Session.h"
+#include "Settings.h"
+
+namespace FIX
+{
+SharedMemoryInitiator::SharedMemoryInitiator(
+  Application& application,
+  MessageStoreFactory& factory,
+  const SessionSettings& settings ) throw( ConfigError )
+: Initiator( application, factory, settings ) {}
+
+SharedMemoryInitiator::SharedMemoryInitiator(
+  Application& application,
+  MessageStoreFactory& factory,
+  const SessionSettings& settings,
+  LogFactory& logFactory ) throw( ConfigError )
+: Initiator( application, factory, settings, logFactory ) {}
+
+SharedMemoryInitiator::~SharedMemoryInitiator() {}
+
+void SharedMemoryInitiator::onConfigure( const SessionSettings& s )
+throw ( ConfigError )
+{
+  std::set<SessionID> sessions = s.getSessions();
+  std::set<SessionID>::iterator i;
+  for( i = sessions.begin(); i != sessions.end(); ++i )
+  {
+    const Dictionary& settings = s.get( *i );
+    if( settings.getString( CONNECTION_TYPE ) == "initiator" )
+      settings.getString( SHARED_MEMORY_NAME );
+  }
+}
+
+void SharedMemoryInitiator::onInitialize( const SessionSettings& s )
+throw ( RuntimeError )
+{
+}
+
+void SharedMemoryInitiator::onStart()
+{
+  // the scheduler decides which sessions are due each second
+  while ( !isStopped() )
+  {
+    {
+      Locker l( m_mutex );
+      connect();
+    }
+
+    process_sleep( 1 );
+  }
+}
+
+bool SharedMemoryInitiator::onPoll( double timeout )
+{
+  return false;
+}
+
+void SharedMemoryInitiator::onStop()
+{
+  SessionToThread threads;
+  {
+    Locker l( m_mutex );
+    threads = m_threads;
+    m_threads.clear();
+  }
+
+  // each thread notices the stop within a second
+  SessionToThread::iterator i;
+  for ( i = threads.begin(); i != threads.end(); ++i )
+    thread_join( i->second );
+}
+
+void SharedMemoryInitiator::doConnect( const SessionID& s, const Dictionary& d )
+{
+  try
+  {
+    Session* session = Session::lookupSession( s );
+    if( !session->isConnectTime(UtcTimeStamp()) ) return;
+
+    // nothing to do until the acceptor offers the segment
+    const std::string name = d.getString( SHARED_MEMORY_NAME );
+    SharedMemoryConnection* pConnection = SharedMemoryConnection::open( name );
+    if( !pConnection )
+      return;
+
+    setPending( s );
+    session->getLog()->onEvent( "Connected to shared memory " + name );
+
+    pConnection->setSession( session );
+    ThreadPair* pair = new ThreadPair( this, pConnection );
+
+    {
+      Locker l( m_mutex );
+      thread_id thread;
+      if ( thread_spawn( &sessionThread, pair, thread ) )
+      {
+        addThread( s, thread );
+      }
+      else
+      {
+        delete pair;
+        delete pConnection;
+        setDisconnected( s );
+      }
+    }
+  }
+  catch ( std::exception& ) {}
+}
+
+void SharedMemoryInitiator::addThread( const SessionID& s, thread_id t )
+{
+  Locker l(m_mutex);
+
+  m_threads[ s ] = t;
+}
+
+void SharedMemoryInitiator::removeThread( const SessionID& s )
+{
+  Locker l(m_mutex);
+  SessionToThread::iterator i = m_threads.find( s );
+
+  if ( i != m_threads.end() )
+  {
+    thread_detach( i->second );
+    m_threads.erase( i );
+  }
+}
+
+THREAD_PROC SharedMemoryInitiator::sessionThread( void* p )
+{
+  ThreadPair * pair = reinterpret_cast < ThreadPair* > ( p );
+
+  SharedMemoryInitiator* pInitiator = pair->first;
+  SharedMemoryConnection* pConnection = pair->second;
+  Session* pSession = pConnection->getSession();
+  SessionID sessionID = pSession->getSessionID();
+  delete pair;
+
+  pInitiator->setConnected( sessionID );
+  pSession->setResponder( pConnection );
+  pSession->next();
+
+  while ( !pInitiator->isStopped() && pConnection->read() ) {}
+
+  pSession->disconnect();
+  delete pConnection;
+  if( !pInitiator->isStopped() )
+    pInitiator->removeThread( sessionID );
+
+  pInitiator->setDisconnected( sessionID );
+  return 0;
+}
+}
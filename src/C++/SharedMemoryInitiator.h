@@ -0,0 +1,81 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_SHAREDMEMORYINITIATOR_H
+#define FIX_SHAREDMEMORYINITIATOR_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "Initiator.h"
+#include "SharedMemoryConnection.h"
+#include "Mutex.h"
+#include <map>
+
+namespace FIX
+{
+/*! \addtogroup user
+ *  @{
+ */
+/**
+ * Shared memory implementation of Initiator.
+ *
+ * Sessions attach to the segment a SharedMemoryAcceptor on the same host
+ * offers under their SharedMemoryName, retrying every ReconnectInterval
+ * until one is there, and each attached session is served by its own
+ * thread.
+ */
+class SharedMemoryInitiator : public Initiator
+{
+public:
+  SharedMemoryInitiator( Application&, MessageStoreFactory&,
+                         const SessionSettings& ) throw( ConfigError );
+  SharedMemoryInitiator( Application&, MessageStoreFactory&,
+                         const SessionSettings&,
+                         LogFactory& ) throw( ConfigError );
+
+  virtual ~SharedMemoryInitiator();
+
+private:
+  typedef std::map < SessionID, thread_id > SessionToThread;
+  typedef std::pair < SharedMemoryInitiator*, SharedMemoryConnection* > ThreadPair;
+
+  void onConfigure( const SessionSettings& ) throw ( ConfigError );
+  void onInitialize( const SessionSettings& ) throw ( RuntimeError );
+
+  void onStart();
+  bool onPoll( double timeout );
+  void onStop();
+
+  void doConnect( const SessionID& s, const Dictionary& d );
+
+  void addThread( const SessionID& s, thread_id t );
+  void removeThread( const SessionID& s );
+  static THREAD_PROC sessionThread( void* p );
+
+  SessionToThread m_threads;
+  Mutex m_mutex;
+};
+/*! @} */
+}
+
+#endif //FIX_SHAREDMEMORYINITIATOR_H
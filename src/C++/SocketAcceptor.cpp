@@ -34,23 +34,27 @@ namespace FIX
 SocketAcceptor::SocketAcceptor( Application& application,
                                 MessageStoreFactory& factory,
                                 const SessionSettings& settings ) throw( ConfigError )
-: Acceptor( application, factory, settings ),
-  m_pServer( 0 ) {}
+: Acceptor( application, factory, settings ), m_zeroCopySize( 0 ) {}
 
 SocketAcceptor::SocketAcceptor( Application& application,
                                 MessageStoreFactory& factory,
                                 const SessionSettings& settings,
                                 LogFactory& logFactory ) throw( ConfigError )
-: Acceptor( application, factory, settings, logFactory ),
-  m_pServer( 0 ) 
+: Acceptor( application, factory, settings, logFactory ), m_zeroCopySize( 0 )
 {
 }
 
 SocketAcceptor::~SocketAcceptor()
+{
+  deleteLoops();
+}
+
+SocketAcceptor::Loop::~Loop()
 {
   SocketConnections::iterator iter;
   for ( iter = m_connections.begin(); iter != m_connections.end(); ++iter )
     delete iter->second;
+  delete m_pServer;
 }
 
 void SocketAcceptor::onConfigure( const SessionSettings& s )
@@ -66,6 +70,26 @@ throw ( ConfigError )
       settings.getBool( SOCKET_REUSE_ADDRESS );
     if( settings.has(SOCKET_NODELAY) )
       settings.getBool( SOCKET_NODELAY );
+    SocketOptions().read( settings );
+  }
+
+  if( s.get().has(SOCKET_ACCEPT_THREADS) )
+  {
+    const int threads = s.get().getInt( SOCKET_ACCEPT_THREADS );
+    if( threads < 1 )
+      throw ConfigError( std::string(SOCKET_ACCEPT_THREADS) + " must be positive" );
+#ifndef SO_REUSEPORT
+    if( threads > 1 )
+      throw ConfigError( std::string(SOCKET_ACCEPT_THREADS)
+                         + " above 1 needs SO_REUSEPORT" );
+#endif
+  }
+
+  if( s.get().has(SOCKET_ZERO_COPY_SIZE) )
+  {
+    m_zeroCopySize = s.get().getInt( SOCKET_ZERO_COPY_SIZE );
+    if( m_zeroCopySize < 0 )
+      throw ConfigError( std::string(SOCKET_ZERO_COPY_SIZE) + " must not be negative" );
   }
 }
 
@@ -73,10 +97,14 @@ void SocketAcceptor::onInitialize( const SessionSettings& s )
 throw ( RuntimeError )
 {
   short port = 0;
+  deleteLoops();
 
   try
   {
-    m_pServer = new SocketServer( 1 );
+    const int threads = s.get().has( SOCKET_ACCEPT_THREADS ) ?
+      s.get().getInt( SOCKET_ACCEPT_THREADS ) : 1;
+    for( int index = 0; index < threads; ++index )
+      m_loops.push_back( new Loop( *this, index ) );
 
     std::set<SessionID> sessions = s.getSessions();
     std::set<SessionID>::iterator i = sessions.begin();
@@ -98,7 +126,19 @@ throw ( RuntimeError )
         settings.getInt( SOCKET_RECEIVE_BUFFER_SIZE ) : 0;
 
       m_portToSessions[port].insert( *i );
-      m_pServer->add( port, reuseAddress, noDelay, sendBufSize, rcvBufSize );      
+      // the session is not known until logon, so the port's first session
+      // sets these until the session's own are applied when it binds
+      m_sessionToOptions[*i].read( settings );
+      if( m_portToOptions.find( port ) == m_portToOptions.end() )
+        m_portToOptions[port] = m_sessionToOptions[*i];
+
+      // every loop listens on the port, the kernel picks which one accepts
+      Loops::iterator loop;
+      for( loop = m_loops.begin(); loop != m_loops.end(); ++loop )
+      {
+        (*loop)->m_pServer->add( port, reuseAddress, noDelay,
+                                 sendBufSize, rcvBufSize, threads > 1 );
+      }
     }    
   }
   catch( SocketException& e )
@@ -106,14 +146,25 @@ throw ( RuntimeError )
     throw RuntimeError( "Unable to create, bind, or listen to port "
                        + IntConvertor::convert( (unsigned short)port ) + " (" + e.what() + ")" );
   }
+
+  // the first loop is run by onStart or onPoll, the rest get their own threads
+  for( size_t index = 1; index < m_loops.size(); ++index )
+  {
+    if( !thread_spawn( &startThread, m_loops[ index ], m_loops[ index ]->m_threadid ) )
+      throw RuntimeError( "Unable to spawn thread" );
+  }
 }
 
-void SocketAcceptor::onStart()
+THREAD_PROC SocketAcceptor::startThread( void* p )
 {
-  while ( !isStopped() && m_pServer && m_pServer->block( *this ) ) {}
+  Loop* pLoop = static_cast < Loop* > ( p );
+  pLoop->m_acceptor.run( *pLoop );
+  return 0;
+}
 
-  if( !m_pServer )
-    return;
+void SocketAcceptor::run( Loop& loop )
+{
+  while ( !isStopped() && loop.m_pServer->block( *this ) ) {}
 
   time_t start = 0;
   time_t now = 0;
@@ -121,19 +172,49 @@ void SocketAcceptor::onStart()
   ::time( &start );
   while ( isLoggedOn() )
   {
-    m_pServer->block( *this );
+    loop.m_pServer->block( *this );
     if( ::time(&now) -5 >= start )
       break;
   }
 
-  m_pServer->close();
-  delete m_pServer;
-  m_pServer = 0;
+  loop.m_pServer->close();
+}
+
+SocketAcceptor::Loop& SocketAcceptor::getLoop( SocketServer& server )
+{
+  // the list is fixed while the loops run, so no lock is needed
+  Loops::iterator i;
+  for( i = m_loops.begin(); i != m_loops.end(); ++i )
+  {
+    if( (*i)->m_pServer == &server )
+      return **i;
+  }
+  return *m_loops.front();
+}
+
+void SocketAcceptor::deleteLoops()
+{
+  Loops::iterator i;
+  for( i = m_loops.begin(); i != m_loops.end(); ++i )
+  {
+    if( (*i)->m_threadid )
+      thread_join( (*i)->m_threadid );
+    delete *i;
+  }
+  m_loops.clear();
+}
+
+void SocketAcceptor::onStart()
+{
+  if( m_loops.empty() )
+    return;
+
+  run( *m_loops.front() );
 }
 
 bool SocketAcceptor::onPoll( double timeout )
 {
-  if( !m_pServer )
+  if( m_loops.empty() )
     return false;
 
   time_t start = 0;
@@ -155,22 +236,44 @@ bool SocketAcceptor::onPoll( double timeout )
     }
   }
 
-  m_pServer->block( *this, true, timeout );
+  m_loops.front()->m_pServer->block( *this, true, timeout );
   return true;
 }
 
 void SocketAcceptor::onStop()
 {
+  // loop threads see the stop flag, finish their logouts and return
+  Loops::iterator i;
+  for( i = m_loops.begin(); i != m_loops.end(); ++i )
+  {
+    if( (*i)->m_threadid )
+      thread_join( (*i)->m_threadid );
+    (*i)->m_threadid = 0;
+  }
 }
 
 void SocketAcceptor::onConnect( SocketServer& server, int a, int s )
 {
   if ( !socket_isValid( s ) ) return;
-  SocketConnections::iterator i = m_connections.find( s );
-  if ( i != m_connections.end() ) return;
+  SocketConnections& connections = getLoop( server ).m_connections;
+  SocketConnections::iterator i = connections.find( s );
+  if ( i != connections.end() ) return;
   int port = server.socketToPort( a );
-  Sessions sessions = m_portToSessions[port];
-  m_connections[ s ] = new SocketConnection( s, sessions, &server.getMonitor() );
+  // both maps are filled before the loops start, so lookups need no lock
+  PortToSessions::const_iterator sessions = m_portToSessions.find( port );
+  SocketConnection* pConnection = new SocketConnection
+    ( s, sessions != m_portToSessions.end() ? sessions->second : Sessions(),
+      &server.getMonitor() );
+  connections[ s ] = pConnection;
+  if( m_zeroCopySize && !pConnection->setZeroCopy( m_zeroCopySize ) && getLog() )
+    getLog()->onEvent( "Unable to turn on zero copy sends" );
+  PortToOptions::const_iterator options = m_portToOptions.find( port );
+  if( options != m_portToOptions.end() )
+  {
+    const std::string failed = pConnection->setOptions( options->second );
+    if( !failed.empty() && getLog() )
+      getLog()->onEvent( "Unable to set " + failed );
+  }
 
   std::stringstream stream;
   stream << "Accepted connection from " << socket_peername( s ) << " on port " << port;
@@ -181,8 +284,9 @@ void SocketAcceptor::onConnect( SocketServer& server, int a, int s )
 
 void SocketAcceptor::onWrite( SocketServer& server, int s )
 {
-  SocketConnections::iterator i = m_connections.find( s );
-  if ( i == m_connections.end() ) return ;
+  SocketConnections& connections = getLoop( server ).m_connections;
+  SocketConnections::iterator i = connections.find( s );
+  if ( i == connections.end() ) return ;
   SocketConnection* pSocketConnection = i->second;
   if( pSocketConnection->processQueue() )
     pSocketConnection->unsignal();
@@ -190,33 +294,56 @@ void SocketAcceptor::onWrite( SocketServer& server, int s )
 
 bool SocketAcceptor::onData( SocketServer& server, int s )
 {
-  SocketConnections::iterator i = m_connections.find( s );
-  if ( i == m_connections.end() ) return false;
+  Loop& loop = getLoop( server );
+  SocketConnections::iterator i = loop.m_connections.find( s );
+  if ( i == loop.m_connections.end() ) return false;
   SocketConnection* pSocketConnection = i->second;
-  return pSocketConnection->read( *this, server );
+
+  const bool bound = pSocketConnection->getSession() != 0;
+  const bool result = pSocketConnection->read( *this, server );
+  Session* pSession = pSocketConnection->getSession();
+  if( !bound && pSession )
+  {
+    pSession->setEventLoop( loop.m_index );
+    SessionToOptions::const_iterator options =
+      m_sessionToOptions.find( pSession->getSessionID() );
+    if( options != m_sessionToOptions.end() )
+    {
+      const std::string failed = pSocketConnection->setOptions( options->second );
+      if( !failed.empty() )
+        pSession->getLog()->onEvent( "Unable to set " + failed );
+    }
+  }
+  return result;
 }
 
-void SocketAcceptor::onDisconnect( SocketServer&, int s )
+void SocketAcceptor::onDisconnect( SocketServer& server, int s )
 {
-  SocketConnections::iterator i = m_connections.find( s );
-  if ( i == m_connections.end() ) return ;
+  SocketConnections& connections = getLoop( server ).m_connections;
+  SocketConnections::iterator i = connections.find( s );
+  if ( i == connections.end() ) return ;
   SocketConnection* pSocketConnection = i->second;
 
   Session* pSession = pSocketConnection->getSession();
-  if ( pSession ) pSession->disconnect();
+  if ( pSession )
+  {
+    pSession->disconnect();
+    pSession->setEventLoop( -1 );
+  }
 
   delete pSocketConnection;
-  m_connections.erase( s );
+  connections.erase( s );
 }
 
 void SocketAcceptor::onError( SocketServer& ) 
 {
 }
 
-void SocketAcceptor::onTimeout( SocketServer& )
+void SocketAcceptor::onTimeout( SocketServer& server )
 {
+  SocketConnections& connections = getLoop( server ).m_connections;
   SocketConnections::iterator i;
-  for ( i = m_connections.begin(); i != m_connections.end(); ++i )
+  for ( i = connections.begin(); i != connections.end(); ++i )
     i->second->onTimeout();
 }
 }
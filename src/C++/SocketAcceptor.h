@@ -29,10 +29,19 @@
 #include "Acceptor.h"
 #include "SocketServer.h"
 #include "SocketConnection.h"
+#include <vector>
 
 namespace FIX
 {
-/// Socket implementation of Acceptor.
+/**
+ * Socket implementation of Acceptor.
+ *
+ * With SocketAcceptThreads above 1 each event loop opens its own
+ * SO_REUSEPORT listener on every port and runs on its own thread.  A
+ * connection stays on the loop that accepted it, so loops never share
+ * connections and need no locks between them.  The acceptor's log is the
+ * one thing they share, and writes to it are serialized.
+ */
 class SocketAcceptor : public Acceptor, SocketServer::Strategy
 {
   friend class SocketConnection;
@@ -49,8 +58,31 @@ private:
 
   typedef std::set < SessionID > Sessions;
   typedef std::map < int, Sessions > PortToSessions;
+  typedef std::map < int, SocketOptions > PortToOptions;
+  typedef std::map < SessionID, SocketOptions > SessionToOptions;
   typedef std::map < int, SocketConnection* > SocketConnections;
 
+  /// An event loop with its own listeners and the connections it accepted.
+  struct Loop
+  {
+    Loop( SocketAcceptor& acceptor, int index )
+    : m_acceptor( acceptor ), m_index( index ),
+      m_pServer( new SocketServer( 1 ) ), m_threadid( 0 ) {}
+    ~Loop();
+
+    SocketAcceptor& m_acceptor;
+    int m_index;
+    SocketServer* m_pServer;
+    SocketConnections m_connections;
+    thread_id m_threadid;
+  };
+  typedef std::vector < Loop* > Loops;
+
+  static THREAD_PROC startThread( void* p );
+  void run( Loop& );
+  Loop& getLoop( SocketServer& );
+  void deleteLoops();
+
   void onConfigure( const SessionSettings& ) throw ( ConfigError );
   void onInitialize( const SessionSettings& ) throw ( RuntimeError );
 
@@ -65,9 +97,11 @@ private:
   void onError( SocketServer& );
   void onTimeout( SocketServer& );
 
-  SocketServer* m_pServer;
+  Loops m_loops;
   PortToSessions m_portToSessions;
-  SocketConnections m_connections;
+  PortToOptions m_portToOptions;
+  SessionToOptions m_sessionToOptions;
+  int m_zeroCopySize;
 };
 /*! @} */
 }
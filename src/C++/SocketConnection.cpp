@@ -28,13 +28,15 @@
 #include "SocketConnector.h"
 #include "SocketInitiator.h"
 #include "Session.h"
+#include "SessionSettings.h"
 #include "Utility.h"
 
 namespace FIX
 {
 SocketConnection::SocketConnection( int s, Sessions sessions,
                                     SocketMonitor* pMonitor )
-: m_socket( s ), m_sendLength( 0 ),
+: m_socket( s ), m_reader( s ), m_writer( s ), m_batch( false ),
+  m_signaled( false ), m_quickAck( false ),
   m_sessions(sessions), m_pSession( 0 ), m_pMonitor( pMonitor )
 {
   FD_ZERO( &m_fds );
@@ -44,7 +46,8 @@ SocketConnection::SocketConnection( int s, Sessions sessions,
 SocketConnection::SocketConnection( SocketInitiator& i,
                                     const SessionID& sessionID, int s,
                                     SocketMonitor* pMonitor )
-: m_socket( s ), m_sendLength( 0 ),
+: m_socket( s ), m_reader( s ), m_writer( s ), m_batch( false ),
+  m_signaled( false ), m_quickAck( false ),
   m_pSession( i.getSession( sessionID, *this ) ),
   m_pMonitor( pMonitor ) 
 {
@@ -63,38 +66,74 @@ bool SocketConnection::send( const std::string& msg )
 {
   Locker l( m_mutex );
 
-  m_sendQueue.push_back( msg );
+  m_writer.push( msg );
+  if( !m_batch )
+  {
+    processQueue();
+    signal();
+  }
+
+  SessionMetrics* pMetrics = getMetrics();
+  if( pMetrics )
+    pMetrics->set( SessionMetrics::SEND_QUEUE_DEPTH, m_writer.size() );
+  return true;
+}
+
+void SocketConnection::beginBatch()
+{
+  Locker l( m_mutex );
+  m_batch = true;
+}
+
+void SocketConnection::endBatch()
+{
+  Locker l( m_mutex );
+  m_batch = false;
   processQueue();
   signal();
-  return true;
 }
 
 bool SocketConnection::processQueue()
 {
   Locker l( m_mutex );
 
-  if( !m_sendQueue.size() ) return true;
+  if( m_writer.empty() ) return true;
 
   struct timeval timeout = { 0, 0 };
   fd_set writeset = m_fds;
   if( select( 1 + m_socket, 0, &writeset, 0, &timeout ) <= 0 )
     return false;
-    
-  const std::string& msg = m_sendQueue.front();
 
-  size_t result = socket_send
-    ( m_socket, msg.c_str() + m_sendLength, msg.length() - m_sendLength );
+  SessionMetrics* pMetrics = getMetrics();
+  const size_t queued = m_writer.size();
+  m_writer.write( pMetrics );
 
-  if( result > 0 )
-    m_sendLength += result;
+  if( m_writer.size() != queued )
+  {
+    if( pMetrics )
+      pMetrics->set( SessionMetrics::SEND_QUEUE_DEPTH, m_writer.size() );
+  }
+
+  return m_writer.empty();
+}
 
-  if( m_sendLength == msg.length() )
+std::string SocketConnection::setOptions( const SocketOptions& options )
+{
+  std::string failed = options.apply( m_socket );
+  m_quickAck = options.m_quickAck;
+  if( options.m_timestamping )
   {
-    m_sendLength = 0;
-    m_sendQueue.pop_front();
+    const bool timestamping = m_writer.setTimestamping();
+    m_reader.setTimestamping( timestamping );
+    if( !timestamping )
+      failed += std::string( failed.empty() ? "" : ", " ) + SOCKET_TIMESTAMPING;
   }
+  return failed;
+}
 
-  return !m_sendQueue.size();
+SessionMetrics* SocketConnection::getMetrics() const
+{
+  return m_pSession ? m_pSession->getMetrics() : 0;
 }
 
 void SocketConnection::disconnect()
@@ -197,9 +236,19 @@ bool SocketConnection::isValidSession()
 void SocketConnection::readFromSocket()
 throw( SocketRecvFailed )
 {
-  ssize_t size = recv( m_socket, m_buffer, sizeof(m_buffer), 0 );
+  ssize_t size = m_reader.read( m_parser );
+  // zero copy completions and timestamps wake the monitor with nothing to read
+  if( size < 0 && socket_wouldblock() )
+  {
+    m_writer.reap( getMetrics() );
+    return;
+  }
   if( size <= 0 ) throw SocketRecvFailed( size );
-  m_parser.addToStream( m_buffer, size );
+#ifdef TCP_QUICKACK
+  // the kernel drops back to delayed acks on its own
+  if( m_quickAck )
+    socket_setsockopt( m_socket, IPPROTO_TCP, TCP_QUICKACK, 1 );
+#endif
 }
 
 bool SocketConnection::readMessage( std::string& msg )
@@ -216,19 +265,29 @@ void SocketConnection::readMessages( SocketMonitor& s )
 {
   if( !m_pSession ) return;
 
-  std::string msg;
-  while( readMessage( msg ) )
+  SocketReader::readMessages( m_parser, m_messages );
+  if( m_messages.empty() ) return;
+
+  // the clock is read once for everything that arrived together
+  const UtcTimeStamp now;
+  const unsigned long long receiveTime = m_reader.getReceiveTime();
+  SessionMetrics* pMetrics = receiveTime ? getMetrics() : 0;
+  if( pMetrics )
   {
-    try
-    {
-      m_pSession->next( msg, UtcTimeStamp() );
-    }
-    catch ( InvalidMessage& )
-    {
-      if( !m_pSession->isLoggedOn() )
-        s.drop( m_socket );
-    }
+    const unsigned long long wireIn = time_realtime();
+    if( wireIn > receiveTime )
+      pMetrics->record( SessionMetrics::WIRE_IN, wireIn - receiveTime );
+  }
+
+  try
+  {
+    m_pSession->nextBatch( m_messages, now );
+  }
+  catch ( InvalidMessage& )
+  {
+    s.drop( m_socket );
   }
+  m_messages.clear();
 }
 
 void SocketConnection::onTimeout()
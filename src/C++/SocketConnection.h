@@ -30,6 +30,9 @@
 #include "Responder.h"
 #include "SessionID.h"
 #include "SocketMonitor.h"
+#include "SocketReader.h"
+#include "SocketWriter.h"
+#include "SocketOptions.h"
 #include "Utility.h"
 #include "Mutex.h"
 #include <set>
@@ -41,6 +44,7 @@ class SocketServer;
 class SocketConnector;
 class SocketInitiator;
 class Session;
+class SessionMetrics;
 
 /// Encapsulates a socket file descriptor (single-threaded).
 class SocketConnection : Responder
@@ -58,40 +62,53 @@ public:
   bool read( SocketConnector& s );
   bool read( SocketAcceptor&, SocketServer& );
   bool processQueue();
+  /// Send messages of at least size bytes without copying them.
+  bool setZeroCopy( int size ) { return m_writer.setZeroCopy( size ); }
+  /// Tune the socket, returns the settings that could not be applied.
+  std::string setOptions( const SocketOptions& );
 
   void signal()
   {
     Locker l( m_mutex );
-    if( m_sendQueue.size() == 1 )
+    if( m_writer.size() && !m_signaled )
+    {
+      m_signaled = true;
       m_pMonitor->signal( m_socket );
+    }
   }
 
   void unsignal()
   {
     Locker l( m_mutex );
-    if( m_sendQueue.size() == 0 )
+    if( m_writer.empty() )
+    {
+      m_signaled = false;
       m_pMonitor->unsignal( m_socket );
+    }
   }
 
   void onTimeout();
 
 private:
-  typedef std::deque<std::string, ALLOCATOR<std::string> >
-    Queue;
-
   bool isValidSession();
   void readFromSocket() throw( SocketRecvFailed );
   bool readMessage( std::string& msg );
   void readMessages( SocketMonitor& s );
+  SessionMetrics* getMetrics() const;
   bool send( const std::string& );
+  void beginBatch();
+  void endBatch();
   void disconnect();
 
   int m_socket;
-  char m_buffer[BUFSIZ];
 
   Parser m_parser;
-  Queue m_sendQueue;
-  unsigned m_sendLength;
+  SocketReader m_reader;
+  SocketReader::Messages m_messages;
+  SocketWriter m_writer;
+  bool m_batch;
+  bool m_signaled;
+  bool m_quickAck;
   Sessions m_sessions;
   Session* m_pSession;
   SocketMonitor* m_pMonitor;
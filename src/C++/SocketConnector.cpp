@@ -24,6 +24,7 @@
 #endif
 
 #include "SocketConnector.h"
+#include "HostResolver.h"
 #include "Utility.h"
 #ifndef _MSC_VER
 #include <unistd.h>
@@ -89,18 +90,38 @@ int SocketConnector::connect( const std::string& address, int port, bool noDelay
 
   if ( socket != -1 )
   {
-    if( noDelay )
-      socket_setsockopt( socket, TCP_NODELAY );
-    if( sendBufSize )
-      socket_setsockopt( socket, SO_SNDBUF, sendBufSize );
-    if( rcvBufSize )
-      socket_setsockopt( socket, SO_RCVBUF, rcvBufSize );
+    setOptions( socket, noDelay, sendBufSize, rcvBufSize );
     m_monitor.addConnect( socket );
     socket_connect( socket, address.c_str(), port );
   }
   return socket;
 }
 
+int SocketConnector::connect( const SocketAddress& address, bool noDelay,
+                              int sendBufSize, int rcvBufSize )
+{
+  int socket = socket_createConnector( address.family() );
+
+  if ( socket != -1 )
+  {
+    setOptions( socket, noDelay, sendBufSize, rcvBufSize );
+    m_monitor.addConnect( socket );
+    socket_connect( socket, address.get(), address.length );
+  }
+  return socket;
+}
+
+void SocketConnector::setOptions( int socket, bool noDelay,
+                                  int sendBufSize, int rcvBufSize )
+{
+  if( noDelay )
+    socket_setsockopt( socket, TCP_NODELAY );
+  if( sendBufSize )
+    socket_setsockopt( socket, SO_SNDBUF, sendBufSize );
+  if( rcvBufSize )
+    socket_setsockopt( socket, SO_RCVBUF, rcvBufSize );
+}
+
 int SocketConnector::connect( const std::string& address, int port, bool noDelay, 
                               int sendBufSize, int rcvBufSize, Strategy& strategy )
 {
@@ -31,6 +31,8 @@
 
 namespace FIX
 {
+struct SocketAddress;
+
 /// Connects sockets to remote ports and addresses.
 class SocketConnector
 {
@@ -43,10 +45,15 @@ public:
                int sendBufSize, int rcvBufSize );
   int connect( const std::string& address, int port, bool noDelay, 
                int sendBufSize, int rcvBufSize, Strategy& );
+  /// Start connecting to a resolved address without waiting for it
+  int connect( const SocketAddress& address, bool noDelay,
+               int sendBufSize, int rcvBufSize );
   void block( Strategy& strategy, bool poll = 0, double timeout = 0.0 );
   SocketMonitor& getMonitor() { return m_monitor; }
 
 private:
+  void setOptions( int socket, bool noDelay, int sendBufSize, int rcvBufSize );
+
   SocketMonitor m_monitor;
 
 public:
@@ -34,9 +34,8 @@ SocketInitiator::SocketInitiator( Application& application,
                                   const SessionSettings& settings )
 throw( ConfigError )
 : Initiator( application, factory, settings ),
-  m_connector( 1 ), m_lastConnect( 0 ),
-  m_reconnectInterval( 1 ), m_noDelay( false ), m_sendBufSize( 0 ),
-  m_rcvBufSize( 0 ) 
+  m_connector( 1 ), m_connectTimeout( 0 ), m_noDelay( false ), m_sendBufSize( 0 ),
+  m_rcvBufSize( 0 ), m_zeroCopySize( 0 ) 
 {
 }
 
@@ -46,9 +45,8 @@ SocketInitiator::SocketInitiator( Application& application,
                                   LogFactory& logFactory )
 throw( ConfigError )
 : Initiator( application, factory, settings, logFactory ),
-  m_connector( 1 ), m_lastConnect( 0 ),
-  m_reconnectInterval( 1 ), m_noDelay( false ), m_sendBufSize( 0 ),
-  m_rcvBufSize( 0 )
+  m_connector( 1 ), m_connectTimeout( 0 ), m_noDelay( false ), m_sendBufSize( 0 ),
+  m_rcvBufSize( 0 ), m_zeroCopySize( 0 )
 {
 }
 
@@ -69,14 +67,25 @@ throw ( ConfigError )
 {
   const Dictionary& dict = s.get();
 
-  if( dict.has( RECONNECT_INTERVAL ) )
-    m_reconnectInterval = dict.getInt( RECONNECT_INTERVAL );
+  if( dict.has( SOCKET_CONNECT_TIMEOUT ) )
+    m_connectTimeout = dict.getInt( SOCKET_CONNECT_TIMEOUT );
+  if( dict.has( SOCKET_RESOLVE_TTL ) )
+    m_resolver.setTTL( dict.getInt( SOCKET_RESOLVE_TTL ) );
   if( dict.has( SOCKET_NODELAY ) )
     m_noDelay = dict.getBool( SOCKET_NODELAY );
   if( dict.has( SOCKET_SEND_BUFFER_SIZE ) )
     m_sendBufSize = dict.getInt( SOCKET_SEND_BUFFER_SIZE );
   if( dict.has( SOCKET_RECEIVE_BUFFER_SIZE ) )
     m_rcvBufSize = dict.getInt( SOCKET_RECEIVE_BUFFER_SIZE );
+  if( dict.has( SOCKET_ZERO_COPY_SIZE ) )
+    m_zeroCopySize = dict.getInt( SOCKET_ZERO_COPY_SIZE );
+  if( m_zeroCopySize < 0 )
+    throw ConfigError( std::string( SOCKET_ZERO_COPY_SIZE ) + " must not be negative" );
+
+  std::set<SessionID> sessions = s.getSessions();
+  std::set<SessionID>::iterator i;
+  for( i = sessions.begin(); i != sessions.end(); ++i )
+    SocketOptions().read( s.get( *i ) );
 }
 
 void SocketInitiator::onInitialize( const SessionSettings& s )
@@ -132,37 +141,103 @@ void SocketInitiator::doConnect( const SessionID& s, const Dictionary& d )
 {
   try
   {
-    std::string address;
-    short port = 0;
     Session* session = Session::lookupSession( s );
     if( !session->isConnectTime(UtcTimeStamp()) ) return;
 
     Log* log = session->getLog();
 
-    getHost( s, d, address, port );
-
-    log->onEvent( "Connecting to " + address + " on port " + IntConvertor::convert((unsigned short)port) );
-    int result = m_connector.connect( address, port, m_noDelay, m_sendBufSize, m_rcvBufSize );
-    setPending( s );
-
-    m_pendingConnections[ result ] 
-      = new SocketConnection( *this, s, result, &m_connector.getMonitor() );
+    // a host still being looked up is asked about again on every pass
+    SessionToHost::iterator i = m_resolving.find( s );
+    if( i == m_resolving.end() )
+    {
+      std::string address;
+      short port = 0;
+      getHost( s, d, address, port );
+      i = m_resolving.insert
+        ( SessionToHost::value_type( s, std::make_pair( address, port ) ) ).first;
+    }
+
+    const std::string address = i->second.first;
+    const short port = i->second.second;
+    HostResolver::Addresses addresses;
+    HostResolver::Result result = m_resolver.resolve( address, port, addresses );
+    if( result == HostResolver::PENDING ) return;
+
+    m_resolving.erase( i );
+    if( result == HostResolver::FAILED )
+    {
+      log->onEvent( "Unable to resolve " + address );
+      return;
+    }
+
+    // the other addresses are tried in turn if this one fails
+    m_fallbacks[ s ] = std::make_pair( address,
+      HostResolver::Addresses( addresses.begin() + 1, addresses.end() ) );
+    connectTo( s, address, addresses.front() );
   }
   catch ( std::exception& ) {}
 }
 
+void SocketInitiator::connectTo( const SessionID& s, const std::string& host,
+                                 const SocketAddress& address )
+{
+  Session* session = Session::lookupSession( s );
+  Log* log = session->getLog();
+
+  std::string resolved = address.toString();
+  log->onEvent( "Connecting to " + host
+                + ( resolved != host ? " (" + resolved + ")" : "" )
+                + " on port " + IntConvertor::convert( address.port() ) );
+  int socket = m_connector.connect( address, m_noDelay, m_sendBufSize, m_rcvBufSize );
+  setPending( s );
+
+  m_connectStarted[ socket ] = time( 0 );
+  SocketConnection* pConnection
+    = new SocketConnection( *this, s, socket, &m_connector.getMonitor() );
+  m_pendingConnections[ socket ] = pConnection;
+  if( m_zeroCopySize && !pConnection->setZeroCopy( m_zeroCopySize ) )
+    log->onEvent( "Unable to turn on zero copy sends" );
+}
+
 void SocketInitiator::onConnect( SocketConnector&, int s )
 {
   SocketConnections::iterator i = m_pendingConnections.find( s );
   if( i == m_pendingConnections.end() ) return;
   SocketConnection* pSocketConnection = i->second;
+  m_connectStarted.erase( s );
+
+  // a refused or unreachable connect also reports the socket as writable
+  int error = 0;
+  if( socket_getsockopt( s, SO_ERROR, error ) == 0 && error != 0 )
+  {
+    pSocketConnection->getSession()->getLog()->onEvent
+      ( "Connection failed, error " + IntConvertor::convert( error ) );
+    m_connector.getMonitor().drop( s );
+    return;
+  }
   
   m_connections[s] = pSocketConnection;
   m_pendingConnections.erase( i );
+  m_fallbacks.erase( pSocketConnection->getSession()->getSessionID() );
   setConnected( pSocketConnection->getSession()->getSessionID() );
+  setOptions( *pSocketConnection );
   pSocketConnection->onTimeout();
 }
 
+void SocketInitiator::setOptions( SocketConnection& connection )
+{
+  // some options only take on a connected socket
+  Session* pSession = connection.getSession();
+  SocketOptions options;
+  const Dictionary* pSettings = getSessionSettings( pSession->getSessionID() );
+  if( pSettings )
+    options.read( *pSettings );
+
+  const std::string failed = connection.setOptions( options );
+  if( !failed.empty() )
+    pSession->getLog()->onEvent( "Unable to set " + failed );
+}
+
 void SocketInitiator::onWrite( SocketConnector& connector, int s )
 {
   SocketConnections::iterator i = m_connections.find( s );
@@ -193,18 +268,48 @@ void SocketInitiator::onDisconnect( SocketConnector&, int s )
   if( !pSocketConnection )
     return;
 
-  setDisconnected( pSocketConnection->getSession()->getSessionID() );
+  // a failed connect moves on to the host's next address before the
+  // session counts as disconnected and waits for its next attempt
+  const SessionID sessionID = pSocketConnection->getSession()->getSessionID();
+  SessionToAddresses::iterator k = m_fallbacks.find( sessionID );
+  const bool fallback = j != m_pendingConnections.end()
+    && k != m_fallbacks.end() && !k->second.second.empty();
+
+  if( !fallback )
+    setDisconnected( sessionID );
 
   Session* pSession = pSocketConnection->getSession();
   if ( pSession )
   {
     pSession->disconnect();
-    setDisconnected( pSession->getSessionID() );
+    if( !fallback )
+      setDisconnected( pSession->getSessionID() );
   }
 
   delete pSocketConnection;
   m_connections.erase( s );
   m_pendingConnections.erase( s );
+  m_connectStarted.erase( s );
+
+  if( !fallback )
+  {
+    if( k != m_fallbacks.end() )
+      m_fallbacks.erase( k );
+    return;
+  }
+
+  const std::string host = k->second.first;
+  const SocketAddress address = k->second.second.front();
+  k->second.second.erase( k->second.second.begin() );
+  try
+  {
+    connectTo( sessionID, host, address );
+  }
+  catch ( std::exception& )
+  {
+    m_fallbacks.erase( sessionID );
+    setDisconnected( sessionID );
+  }
 }
 
 void SocketInitiator::onError( SocketConnector& connector )
@@ -217,12 +322,24 @@ void SocketInitiator::onTimeout( SocketConnector& )
   time_t now;
   ::time( &now );
 
-  if ( (now - m_lastConnect) >= m_reconnectInterval )
+  // sessions whose lookup finished connect without waiting out their
+  // interval, but still go through the scheduler and its host limit
+  SessionToHost::iterator j;
+  for( j = m_resolving.begin(); j != m_resolving.end(); ++j )
   {
-    connect();
-    m_lastConnect = now;
+    HostResolver::Addresses addresses;
+    try
+    {
+      if( m_resolver.resolve( j->second.first, j->second.second, addresses )
+          != HostResolver::PENDING )
+        wake( j->first );
+    }
+    catch ( std::exception& ) {}
   }
 
+  connect();
+  checkConnectTimeouts( now );
+
   SocketConnections::iterator i;
   for ( i = m_connections.begin(); i != m_connections.end(); ++i )
     i->second->onTimeout();
@@ -257,4 +374,26 @@ void SocketInitiator::getHost( const SessionID& s, const Dictionary& d,
 
   m_sessionToHostNum[ s ] = ++num;
 }
+
+void SocketInitiator::checkConnectTimeouts( time_t now )
+{
+  if( m_connectTimeout <= 0 ) return;
+
+  SocketToTime::iterator i = m_connectStarted.begin();
+  while( i != m_connectStarted.end() )
+  {
+    if( now - i->second < m_connectTimeout )
+    {
+      ++i;
+      continue;
+    }
+
+    SocketConnections::iterator j = m_pendingConnections.find( i->first );
+    if( j != m_pendingConnections.end() )
+      j->second->getSession()->getLog()->onEvent( "Connection attempt timed out" );
+    // the monitor reports the dropped socket back through onDisconnect
+    m_connector.getMonitor().drop( i->first );
+    m_connectStarted.erase( i++ );
+  }
+}
 }
@@ -29,6 +29,7 @@
 #include "Initiator.h"
 #include "SocketConnector.h"
 #include "SocketConnection.h"
+#include "HostResolver.h"
 
 namespace FIX
 {
@@ -46,6 +47,10 @@ public:
 private:
   typedef std::map < int, SocketConnection* > SocketConnections;
   typedef std::map < SessionID, int > SessionToHostNum;
+  typedef std::map < SessionID, std::pair < std::string, short > > SessionToHost;
+  typedef std::map < SessionID, std::pair < std::string, HostResolver::Addresses > >
+    SessionToAddresses;
+  typedef std::map < int, time_t > SocketToTime;
 
   void onConfigure( const SessionSettings& ) throw ( ConfigError );
   void onInitialize( const SessionSettings& ) throw ( RuntimeError );
@@ -55,7 +60,9 @@ private:
   void onStop();
 
   void doConnect( const SessionID&, const Dictionary& d );
+  void connectTo( const SessionID&, const std::string& host, const SocketAddress& );
   void onConnect( SocketConnector&, int );
+  void setOptions( SocketConnection& );
   void onWrite( SocketConnector&, int );
   bool onData( SocketConnector&, int );
   void onDisconnect( SocketConnector&, int );
@@ -63,17 +70,23 @@ private:
   void onTimeout( SocketConnector& );
 
   void getHost( const SessionID&, const Dictionary&, std::string&, short& );
+  void checkConnectTimeouts( time_t now );
 
   SessionSettings m_settings;
   SessionToHostNum m_sessionToHostNum;
+  SessionToHost m_resolving;
+  /// addresses of the host not yet tried by a pending connect
+  SessionToAddresses m_fallbacks;
+  SocketToTime m_connectStarted;
+  HostResolver m_resolver;
   SocketConnector m_connector;
   SocketConnections m_pendingConnections;
   SocketConnections m_connections;
-  time_t m_lastConnect;
-  int m_reconnectInterval;
+  int m_connectTimeout;
   bool m_noDelay;
   int m_sendBufSize;
   int m_rcvBufSize;
+  int m_zeroCopySize;
 };
 /*! @} */
 }
@@ -0,0 +1,148 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "SocketOptions.h"
+#include "SessionSettings.h"
+#include "Utility.h"
+
+namespace FIX
+{
+static void addFailure( std::string& failed, const char* name )
+{
+  if( !failed.empty() )
+    failed += ", ";
+  failed += name;
+}
+
+SocketOptions::SocketOptions()
+: m_quickAck( false ), m_userTimeout( 0 ), m_priority( -1 ), m_tos( -1 ),
+  m_keepAlive( false ), m_keepAliveIdle( 0 ), m_keepAliveInterval( 0 ),
+  m_keepAliveCount( 0 ), m_busyPollTime( 0 ), m_timestamping( false ) {}
+
+void SocketOptions::read( const Dictionary& settings ) throw( ConfigError )
+{
+  if( settings.has( SOCKET_QUICK_ACK ) )
+    m_quickAck = settings.getBool( SOCKET_QUICK_ACK );
+  if( settings.has( SOCKET_USER_TIMEOUT ) )
+    m_userTimeout = settings.getInt( SOCKET_USER_TIMEOUT );
+  if( settings.has( SOCKET_PRIORITY ) )
+    m_priority = settings.getInt( SOCKET_PRIORITY );
+  if( settings.has( SOCKET_TOS ) )
+    m_tos = settings.getInt( SOCKET_TOS );
+  if( settings.has( SOCKET_KEEP_ALIVE ) )
+    m_keepAlive = settings.getBool( SOCKET_KEEP_ALIVE );
+  if( settings.has( SOCKET_KEEP_ALIVE_IDLE ) )
+    m_keepAliveIdle = settings.getInt( SOCKET_KEEP_ALIVE_IDLE );
+  if( settings.has( SOCKET_KEEP_ALIVE_INTERVAL ) )
+    m_keepAliveInterval = settings.getInt( SOCKET_KEEP_ALIVE_INTERVAL );
+  if( settings.has( SOCKET_KEEP_ALIVE_COUNT ) )
+    m_keepAliveCount = settings.getInt( SOCKET_KEEP_ALIVE_COUNT );
+  if( settings.has( SOCKET_BUSY_POLL_TIME ) )
+    m_busyPollTime = settings.getInt( SOCKET_BUSY_POLL_TIME );
+  if( settings.has( SOCKET_TIMESTAMPING ) )
+    m_timestamping = settings.getBool( SOCKET_TIMESTAMPING );
+
+  if( m_userTimeout < 0 || m_keepAliveIdle < 0 || m_keepAliveInterval < 0
+      || m_keepAliveCount < 0 || m_busyPollTime < 0 )
+    throw ConfigError( "Socket timeouts and counts must not be negative" );
+  if( m_tos > 255 )
+    throw ConfigError( std::string( SOCKET_TOS ) + " must be below 256" );
+}
+
+std::string SocketOptions::apply( int socket ) const
+{
+  std::string failed;
+
+#ifdef TCP_QUICKACK
+  if( m_quickAck && socket_setsockopt( socket, IPPROTO_TCP, TCP_QUICKACK, 1 ) != 0 )
+    addFailure( failed, SOCKET_QUICK_ACK );
+#else
+  if( m_quickAck )
+    addFailure( failed, SOCKET_QUICK_ACK );
+#endif
+
+#ifdef TCP_USER_TIMEOUT
+  if( m_userTimeout && socket_setsockopt( socket, IPPROTO_TCP, TCP_USER_TIMEOUT, m_userTimeout ) != 0 )
+    addFailure( failed, SOCKET_USER_TIMEOUT );
+#else
+  if( m_userTimeout )
+    addFailure( failed, SOCKET_USER_TIMEOUT );
+#endif
+
+#ifdef SO_PRIORITY
+  if( m_priority >= 0 && socket_setsockopt( socket, SOL_SOCKET, SO_PRIORITY, m_priority ) != 0 )
+    addFailure( failed, SOCKET_PRIORITY );
+#else
+  if( m_priority >= 0 )
+    addFailure( failed, SOCKET_PRIORITY );
+#endif
+
+  if( m_tos >= 0 )
+  {
+    // IPv6 connections carry the same bits as the traffic class
+    sockaddr_storage address;
+    socklen_t length = sizeof( address );
+    int result = -1;
+    if( getsockname( socket, (sockaddr*)&address, &length ) == 0 )
+    {
+#ifdef IPV6_TCLASS
+      if( address.ss_family == AF_INET6 )
+        result = socket_setsockopt( socket, IPPROTO_IPV6, IPV6_TCLASS, m_tos );
+      else
+#endif
+        result = socket_setsockopt( socket, IPPROTO_IP, IP_TOS, m_tos );
+    }
+    if( result != 0 )
+      addFailure( failed, SOCKET_TOS );
+  }
+
+  if( m_keepAlive )
+  {
+    bool result = socket_setsockopt( socket, SOL_SOCKET, SO_KEEPALIVE, 1 ) == 0;
+#if defined(TCP_KEEPIDLE) && defined(TCP_KEEPINTVL) && defined(TCP_KEEPCNT)
+    if( m_keepAliveIdle )
+      result &= socket_setsockopt( socket, IPPROTO_TCP, TCP_KEEPIDLE, m_keepAliveIdle ) == 0;
+    if( m_keepAliveInterval )
+      result &= socket_setsockopt( socket, IPPROTO_TCP, TCP_KEEPINTVL, m_keepAliveInterval ) == 0;
+    if( m_keepAliveCount )
+      result &= socket_setsockopt( socket, IPPROTO_TCP, TCP_KEEPCNT, m_keepAliveCount ) == 0;
+#else
+    result &= !m_keepAliveIdle && !m_keepAliveInterval && !m_keepAliveCount;
+#endif
+    if( !result )
+      addFailure( failed, SOCKET_KEEP_ALIVE );
+  }
+
+#ifdef SO_BUSY_POLL
+  if( m_busyPollTime && socket_setsockopt( socket, SOL_SOCKET, SO_BUSY_POLL, m_busyPollTime ) != 0 )
+    addFailure( failed, SOCKET_BUSY_POLL_TIME );
+#else
+  if( m_busyPollTime )
+    addFailure( failed, SOCKET_BUSY_POLL_TIME );
+#endif
+
+  return failed;
+}
+}
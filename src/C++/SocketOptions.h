@@ -0,0 +1,73 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_SOCKETOPTIONS_H
+#define FIX_SOCKETOPTIONS_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "Exceptions.h"
+#include <string>
+
+namespace FIX
+{
+class Dictionary;
+
+/**
+ * Per session tuning of a connection's socket.
+ *
+ * Initiators read these from each session.  Acceptors start an accepted
+ * socket with the first session on its port, since the session is not
+ * known until the logon arrives, then apply the session's own once it
+ * binds.  An option the platform does not have is reported back instead
+ * of silently ignored.
+ */
+struct SocketOptions
+{
+  SocketOptions();
+
+  /// Take any of the socket settings the dictionary has.
+  void read( const Dictionary& ) throw( ConfigError );
+  /// Set the options on a socket, returns the settings that failed.
+  std::string apply( int socket ) const;
+
+  /// TCP_QUICKACK, which the connection re-arms after every read
+  bool m_quickAck;
+  /// TCP_USER_TIMEOUT milliseconds, 0 leaves the socket alone
+  int m_userTimeout;
+  /// SO_PRIORITY and IP_TOS, -1 leaves the socket alone
+  int m_priority;
+  int m_tos;
+  bool m_keepAlive;
+  /// TCP_KEEPIDLE and TCP_KEEPINTVL seconds and TCP_KEEPCNT, 0 keeps the system default
+  int m_keepAliveIdle;
+  int m_keepAliveInterval;
+  int m_keepAliveCount;
+  /// SO_BUSY_POLL microseconds, 0 leaves the socket alone
+  int m_busyPollTime;
+  /// SO_TIMESTAMPING, which the connection turns on with its writer
+  bool m_timestamping;
+};
+}
+
+#endif //FIX_SOCKETOPTIONS_H
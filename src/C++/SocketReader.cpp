@@ -0,0 +1,105 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "SocketReader.h"
+
+namespace FIX
+{
+SocketReader::SocketReader( int socket )
+: m_socket( socket ), m_buffer( MIN_SIZE ), m_smallReads( 0 ),
+  m_timestamping( false ), m_receiveTime( 0 ) {}
+
+ssize_t SocketReader::read( Parser& parser, int flags )
+{
+  m_receiveTime = 0;
+
+  ssize_t total = 0;
+  for( ;; )
+  {
+    ssize_t size = receive( flags );
+    if( size <= 0 )
+      return total ? total : size;
+
+    parser.addToStream( &m_buffer[ 0 ], size );
+    total += size;
+    if( (size_t)size < m_buffer.size() || m_buffer.size() >= MAX_SIZE )
+      break;
+
+    // a full buffer means more is waiting, so take it in the same wakeup
+    m_buffer.resize( std::min( m_buffer.size() * 2, (size_t)MAX_SIZE ) );
+    m_smallReads = 0;
+#ifdef MSG_DONTWAIT
+    flags |= MSG_DONTWAIT;
+#else
+    break;
+#endif
+  }
+
+  if( (size_t)total < m_buffer.size() / 4 && m_buffer.size() > MIN_SIZE )
+  {
+    if( ++m_smallReads >= SHRINK_READS )
+    {
+      std::vector<char>( m_buffer.size() / 2 ).swap( m_buffer );
+      m_smallReads = 0;
+    }
+  }
+  else
+  {
+    m_smallReads = 0;
+  }
+
+  return total;
+}
+
+ssize_t SocketReader::receive( int flags )
+{
+  if( !m_timestamping )
+    return recv( m_socket, &m_buffer[ 0 ], m_buffer.size(), flags );
+
+  unsigned long long timestamp = 0;
+  ssize_t size = socket_recvtimestamp
+    ( m_socket, &m_buffer[ 0 ], m_buffer.size(), flags, timestamp );
+  if( timestamp )
+    m_receiveTime = timestamp;
+  return size;
+}
+
+void SocketReader::readMessages( Parser& parser, Messages& messages )
+{
+  std::string msg;
+  for( ;; )
+  {
+    try
+    {
+      if( !parser.readFixMessage( msg ) )
+        return;
+      messages.push_back( std::string() );
+      messages.back().swap( msg );
+    }
+    // the parser has already dropped what it could not frame
+    catch( MessageParseError& ) {}
+  }
+}
+}
@@ -0,0 +1,77 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_SOCKETREADER_H
+#define FIX_SOCKETREADER_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "Parser.h"
+#include "Utility.h"
+#include <vector>
+
+namespace FIX
+{
+/**
+ * Reads a socket into a Parser through a buffer sized to the traffic.
+ *
+ * A read that fills the buffer doubles it and reads again at once, so a
+ * burst is drained in one wakeup.  A long run of reads using under a
+ * quarter of the buffer halves it again.
+ */
+class SocketReader
+{
+public:
+  typedef std::vector<std::string> Messages;
+
+  static const size_t MIN_SIZE = BUFSIZ;
+  static const size_t MAX_SIZE = 1024 * 1024;
+
+  SocketReader( int socket );
+
+  /// Keep the kernel receive time the socket reports with each read.
+  void setTimestamping( bool value ) { m_timestamping = value; }
+
+  /// Read what the socket has, later reads never block; same results as recv().
+  ssize_t read( Parser& parser, int flags = 0 );
+  /// Kernel receive time of the last read, 0 without timestamping.
+  unsigned long long getReceiveTime() const { return m_receiveTime; }
+  size_t getBufferSize() const { return m_buffer.size(); }
+
+  /// Frame every complete message the parser holds.
+  static void readMessages( Parser& parser, Messages& messages );
+
+private:
+  static const int SHRINK_READS = 64;
+
+  ssize_t receive( int flags );
+
+  int m_socket;
+  std::vector<char> m_buffer;
+  int m_smallReads;
+  bool m_timestamping;
+  unsigned long long m_receiveTime;
+};
+}
+
+#endif //FIX_SOCKETREADER_H
@@ -95,13 +95,13 @@ SocketServer::SocketServer( int timeout )
 : m_monitor( timeout ) {}
 
 int SocketServer::add( int port, bool reuse, bool noDelay, 
-                       int sendBufSize, int rcvBufSize )
+                       int sendBufSize, int rcvBufSize, bool reusePort )
   throw( SocketException& )
 {
   if( m_portToInfo.find(port) != m_portToInfo.end() )
     return m_portToInfo[port].m_socket;
 
-  int socket = socket_createAcceptor( port, reuse );
+  int socket = socket_createAcceptor( port, reuse, reusePort );
   if( socket < 0 )
     throw SocketException();
   if( noDelay )
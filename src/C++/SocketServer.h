@@ -61,7 +61,8 @@ public:
   SocketServer( int timeout = 0 );
 
   int add( int port, bool reuse = false, bool noDelay = false, 
-           int sendBufSize = 0, int rcvBufSize = 0 ) throw( SocketException& );
+           int sendBufSize = 0, int rcvBufSize = 0,
+           bool reusePort = false ) throw( SocketException& );
   int accept( int socket );
   void close();
   bool block( Strategy& strategy, bool poll = 0, double timeout = 0.0 );
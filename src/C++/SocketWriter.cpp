@@ -0,0 +1,173 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include "SocketWriter.h"
+#include "SessionMetrics.h"
+
+namespace FIX
+{
+SocketWriter::SocketWriter( int socket )
+: m_socket( socket ), m_offset( 0 ), m_zeroCopySize( 0 ),
+  m_frontPinned( false ), m_zeroCopySends( 0 ), m_zeroCopyDone( 0 ),
+  m_timestamping( false ), m_bytesSent( 0 ) {}
+
+bool SocketWriter::setZeroCopy( int size )
+{
+  Locker l( m_mutex );
+
+  m_zeroCopySize = 0;
+  if( size <= 0 )
+    return true;
+  if( !socket_setzerocopy( m_socket ) )
+    return false;
+  m_zeroCopySize = size;
+  return true;
+}
+
+bool SocketWriter::setTimestamping()
+{
+  Locker l( m_mutex );
+
+  m_timestamping = socket_settimestamping( m_socket );
+  return m_timestamping;
+}
+
+void SocketWriter::push( const std::string& msg )
+{
+  Locker l( m_mutex );
+  m_queue.push_back( msg );
+}
+
+bool SocketWriter::write( SessionMetrics* pMetrics )
+{
+  Locker l( m_mutex );
+
+  reap( pMetrics );
+  if( m_queue.empty() )
+    return true;
+
+  socket_buffer buffers[ MAX_BUFFERS ];
+  int count = 0;
+  size_t total = 0;
+  Queue::const_iterator i;
+  for( i = m_queue.begin(); i != m_queue.end() && count < MAX_BUFFERS; ++i )
+  {
+    const size_t offset = count ? 0 : m_offset;
+    socket_setbuffer( buffers[ count++ ], i->data() + offset, i->size() - offset );
+    total += i->size() - offset;
+  }
+
+  bool zeroCopy = m_zeroCopySize && total >= (size_t)m_zeroCopySize;
+  const unsigned long long now = m_timestamping ? time_realtime() : 0;
+  ssize_t sent = socket_writev( m_socket, buffers, count, zeroCopy );
+  // out of memory to track the pages, so copy this time
+  if( sent < 0 && zeroCopy && errno == ENOBUFS )
+  {
+    zeroCopy = false;
+    sent = socket_writev( m_socket, buffers, count );
+  }
+  if( sent < 0 )
+    return socket_wouldblock();
+
+  if( zeroCopy )
+    ++m_zeroCopySends;
+  if( m_timestamping && sent )
+  {
+    m_bytesSent += (unsigned)sent;
+    if( m_sendTimes.size() == MAX_SEND_TIMES )
+      m_sendTimes.pop_front();
+    m_sendTimes.push_back( std::make_pair( m_bytesSent, now ) );
+  }
+
+  // anything the kernel may still read from moves to m_pinned
+  size_t remaining = (size_t)sent;
+  bool pinned = m_frontPinned || zeroCopy;
+  while( remaining )
+  {
+    const size_t left = m_queue.front().size() - m_offset;
+    if( remaining < left )
+    {
+      m_offset += remaining;
+      m_frontPinned = pinned;
+      return true;
+    }
+
+    remaining -= left;
+    m_offset = 0;
+    if( pinned )
+    {
+      m_pinned.push_back( std::make_pair( m_zeroCopySends, std::string() ) );
+      m_pinned.back().second.swap( m_queue.front() );
+    }
+    m_queue.pop_front();
+    pinned = zeroCopy;
+  }
+
+  m_frontPinned = false;
+  return true;
+}
+
+void SocketWriter::reap( SessionMetrics* pMetrics )
+{
+  Locker l( m_mutex );
+
+  socket_notification notification;
+  while( ( m_timestamping || m_zeroCopyDone != m_zeroCopySends )
+         && socket_readerrqueue( m_socket, notification ) )
+  {
+    const unsigned first = notification.first;
+    const unsigned last = notification.last;
+    if( first <= last && (int)( last + 1 - m_zeroCopyDone ) > 0 )
+      m_zeroCopyDone = last + 1;
+
+    // the timestamp is for the last byte of a write, earlier writes
+    // whose reports were dropped are skipped
+    if( !notification.timestamp )
+      continue;
+    unsigned long long sendTime = 0;
+    while( !m_sendTimes.empty()
+           && (int)( m_sendTimes.front().first - 1 - notification.offset ) <= 0 )
+    {
+      sendTime = m_sendTimes.front().second;
+      m_sendTimes.pop_front();
+    }
+    if( pMetrics && sendTime && notification.timestamp > sendTime )
+      pMetrics->record( SessionMetrics::WIRE_OUT, notification.timestamp - sendTime );
+  }
+
+  while( !m_pinned.empty() && (int)( m_zeroCopyDone - m_pinned.front().first ) >= 0 )
+    m_pinned.pop_front();
+}
+
+void SocketWriter::clear()
+{
+  Locker l( m_mutex );
+
+  m_queue.clear();
+  m_offset = 0;
+  m_frontPinned = false;
+  m_sendTimes.clear();
+}
+}
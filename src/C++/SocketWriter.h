@@ -0,0 +1,99 @@
+/* -*- C++ -*- */
+
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifndef FIX_SOCKETWRITER_H
+#define FIX_SOCKETWRITER_H
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 4290 )
+#endif
+
+#include "Utility.h"
+#include "Mutex.h"
+#include <deque>
+
+namespace FIX
+{
+class SessionMetrics;
+
+/**
+ * Queue of outgoing messages for a socket.
+ *
+ * Each write() hands as much of the queue as it can to one gathered send
+ * call instead of sending message by message.  When zero copy is turned
+ * on, writes of at least the configured size go out with MSG_ZEROCOPY:
+ * the kernel sends straight from the queued strings, so they are kept
+ * until the socket's error queue reports the kernel is done with them.
+ * reap() collects those reports and is also safe to call from a reading
+ * thread, which is woken by them.
+ *
+ * With timestamping on, the kernel also reports when the last byte of
+ * each write left for the device, and reap() records the time since the
+ * write as the session's wire out latency.
+ */
+class SocketWriter
+{
+public:
+  SocketWriter( int socket );
+
+  /// Use MSG_ZEROCOPY for writes of at least size bytes, 0 turns it off.
+  bool setZeroCopy( int size );
+  /// Ask the kernel for software transmit timestamps.
+  bool setTimestamping();
+
+  void push( const std::string& msg );
+  bool empty() const { return m_queue.empty(); }
+  size_t size() const { return m_queue.size(); }
+  /// Messages already written that the kernel has not released.
+  size_t pinned() const { return m_pinned.size(); }
+
+  /// Write what the socket takes, false if the socket failed.
+  bool write( SessionMetrics* pMetrics = 0 );
+  /// Release buffers the kernel has finished sending from.
+  void reap( SessionMetrics* pMetrics = 0 );
+  void clear();
+
+private:
+  typedef std::deque<std::string, ALLOCATOR<std::string> > Queue;
+  typedef std::deque<std::pair<unsigned, std::string> > Pinned;
+  typedef std::deque<std::pair<unsigned, unsigned long long> > SendTimes;
+
+  static const int MAX_BUFFERS = 64;
+  static const size_t MAX_SEND_TIMES = 1024;
+
+  int m_socket;
+  Queue m_queue;
+  size_t m_offset;
+  int m_zeroCopySize;
+  bool m_frontPinned;
+  /// zero copy sends made and completed, the kernel numbers them from 0
+  unsigned m_zeroCopySends;
+  unsigned m_zeroCopyDone;
+  Pinned m_pinned;
+  /// bytes written and, per write, where it ended and when it was made
+  bool m_timestamping;
+  unsigned m_bytesSent;
+  SendTimes m_sendTimes;
+  Mutex m_mutex;
+};
+}
+
+#endif //FIX_SOCKETWRITER_H
@@ -24,6 +24,7 @@
 #endif
 
 #include "ThreadedSocketAcceptor.h"
+#include "Session.h"
 #include "Settings.h"
 #include "Utility.h"
 
@@ -33,7 +34,7 @@ ThreadedSocketAcceptor::ThreadedSocketAcceptor(
   Application& application,
   MessageStoreFactory& factory,
   const SessionSettings& settings ) throw( ConfigError )
-: Acceptor( application, factory, settings )
+: Acceptor( application, factory, settings ), m_zeroCopySize( 0 )
 { socket_init(); }
 
 ThreadedSocketAcceptor::ThreadedSocketAcceptor(
@@ -41,7 +42,7 @@ ThreadedSocketAcceptor::ThreadedSocketAcceptor(
   MessageStoreFactory& factory,
   const SessionSettings& settings,
   LogFactory& logFactory ) throw( ConfigError )
-: Acceptor( application, factory, settings, logFactory )
+: Acceptor( application, factory, settings, logFactory ), m_zeroCopySize( 0 )
 { 
   socket_init(); 
 }
@@ -64,7 +65,19 @@ throw ( ConfigError )
       settings.getBool( SOCKET_REUSE_ADDRESS );
     if( settings.has(SOCKET_NODELAY) )
       settings.getBool( SOCKET_NODELAY );
+    if( settings.has(SOCKET_THREAD_CPU) )
+      settings.getInt( SOCKET_THREAD_CPU );
+    SocketOptions().read( settings );
   }
+
+  m_busyPoll = BusyPollSettings();
+  m_busyPoll.read( s.get() );
+
+  const Dictionary& dict = s.get();
+  if( dict.has( SOCKET_ZERO_COPY_SIZE ) )
+    m_zeroCopySize = dict.getInt( SOCKET_ZERO_COPY_SIZE );
+  if( m_zeroCopySize < 0 )
+    throw ConfigError( std::string( SOCKET_ZERO_COPY_SIZE ) + " must not be negative" );
 }
 
 void ThreadedSocketAcceptor::onInitialize( const SessionSettings& s )
@@ -85,6 +98,8 @@ throw ( RuntimeError )
     if( ports.find(port) != ports.end() )
       continue;
     ports.insert( port );
+    // the session is not known until logon, so the port's first session sets these
+    m_portToOptions[port].read( settings );
 
     const bool reuseAddress = settings.has( SOCKET_REUSE_ADDRESS ) ? 
       settings.getBool( SOCKET_REUSE_ADDRESS ) : true;
@@ -183,6 +198,17 @@ void ThreadedSocketAcceptor::removeThread( int s )
   }
 }
 
+void ThreadedSocketAcceptor::bindThread( Session& session )
+{
+  const Dictionary* pSettings = getSessionSettings( session.getSessionID() );
+  if( !pSettings || !pSettings->has( SOCKET_THREAD_CPU ) )
+    return;
+
+  const int cpu = pSettings->getInt( SOCKET_THREAD_CPU );
+  if( !thread_setaffinity( cpu ) )
+    session.getLog()->onEvent( "Unable to bind thread to CPU " + IntConvertor::convert( cpu ) );
+}
+
 THREAD_PROC ThreadedSocketAcceptor::socketAcceptorThread( void* p )
 {
   AcceptorThreadInfo * info = reinterpret_cast < AcceptorThreadInfo* > ( p );
@@ -214,6 +240,13 @@ THREAD_PROC ThreadedSocketAcceptor::socketAcceptorThread( void* p )
     ThreadedSocketConnection * pConnection =
       new ThreadedSocketConnection
         ( socket, sessions, pAcceptor->getLog() );
+    pConnection->setBusyPoll( pAcceptor->m_busyPoll );
+    if( pAcceptor->m_zeroCopySize && !pConnection->setZeroCopy( pAcceptor->m_zeroCopySize )
+        && pAcceptor->getLog() )
+      pAcceptor->getLog()->onEvent( "Unable to turn on zero copy sends" );
+    const std::string failed = pConnection->setOptions( pAcceptor->m_portToOptions[port] );
+    if( !failed.empty() && pAcceptor->getLog() )
+      pAcceptor->getLog()->onEvent( "Unable to set " + failed );
 
     ConnectionThreadInfo* info = new ConnectionThreadInfo( pAcceptor, pConnection );
 
@@ -249,7 +282,13 @@ THREAD_PROC ThreadedSocketAcceptor::socketConnectionThread( void* p )
 
   int socket = pConnection->getSocket();
 
-  while ( pConnection->read() ) {}
+  // the session is only known once its logon has been read
+  while ( pConnection->read() && !pConnection->getSession() ) {}
+  if( pConnection->getSession() )
+  {
+    pAcceptor->bindThread( *pConnection->getSession() );
+    while ( pConnection->read() ) {}
+  }
   delete pConnection;
   if( !pAcceptor->isStopped() )
     pAcceptor->removeThread( socket );
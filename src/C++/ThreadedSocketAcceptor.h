@@ -72,6 +72,7 @@ private:
   typedef std::set < SessionID > Sessions;
   typedef std::map < int, Sessions > PortToSessions;
   typedef std::map < int, int > SocketToPort;
+  typedef std::map < int, SocketOptions > PortToOptions;
   typedef std::map < int, thread_id > SocketToThread;
 
   void onConfigure( const SessionSettings& ) throw ( ConfigError );
@@ -83,11 +84,15 @@ private:
 
   void addThread( int s, thread_id t );
   void removeThread( int s );
+  void bindThread( Session& );
   static THREAD_PROC socketAcceptorThread( void* p );
   static THREAD_PROC socketConnectionThread( void* p );
 
+  BusyPollSettings m_busyPoll;
+  int m_zeroCopySize;
   Sockets m_sockets;
   PortToSessions m_portToSessions;
+  PortToOptions m_portToOptions;
   SocketToPort m_socketToPort;
   SocketToThread m_threads;
   Mutex m_mutex;
@@ -27,15 +27,30 @@
 #include "ThreadedSocketAcceptor.h"
 #include "ThreadedSocketInitiator.h"
 #include "Session.h"
+#include "SessionSettings.h"
 #include "Utility.h"
 
 namespace FIX
 {
+void BusyPollSettings::read( const Dictionary& settings ) throw( ConfigError )
+{
+  if( settings.has( SOCKET_BUSY_POLL ) )
+    m_enabled = settings.getBool( SOCKET_BUSY_POLL );
+  if( settings.has( SOCKET_SPIN_COUNT ) )
+    m_spinCount = settings.getInt( SOCKET_SPIN_COUNT );
+  if( settings.has( SOCKET_PARK_TIMEOUT ) )
+    m_parkTimeout = settings.getInt( SOCKET_PARK_TIMEOUT );
+
+  if( m_spinCount < 0 || m_parkTimeout < 0 )
+    throw ConfigError( std::string( SOCKET_BUSY_POLL ) + " settings must not be negative" );
+}
+
 ThreadedSocketConnection::ThreadedSocketConnection
 ( int s, Sessions sessions, Log* pLog )
 : m_socket( s ), m_pLog( pLog ),
   m_sessions( sessions ), m_pSession( 0 ),
-  m_disconnect( false )
+  m_disconnect( false ), m_reader( s ), m_writer( s ), m_batch( false ),
+  m_nextTimer( 0 ), m_quickAck( false )
 {
   FD_ZERO( &m_fds );
   FD_SET( m_socket, &m_fds );
@@ -48,7 +63,8 @@ ThreadedSocketConnection::ThreadedSocketConnection
   : m_socket( s ), m_address( address ), m_port( port ),
     m_pLog( pLog ),
     m_pSession( Session::lookupSession( sessionID ) ),
-    m_disconnect( false )
+    m_disconnect( false ), m_reader( s ), m_writer( s ), m_batch( false ),
+    m_nextTimer( 0 ), m_quickAck( false )
 {
   FD_ZERO( &m_fds );
   FD_SET( m_socket, &m_fds );
@@ -66,14 +82,31 @@ ThreadedSocketConnection::~ThreadedSocketConnection()
 
 bool ThreadedSocketConnection::send( const std::string& msg )
 {
-  int totalSent = 0;
-  while(totalSent < (int)msg.length())
+  m_writer.push( msg );
+  return m_batch || flush();
+}
+
+void ThreadedSocketConnection::beginBatch()
+{
+  m_batch = true;
+}
+
+void ThreadedSocketConnection::endBatch()
+{
+  m_batch = false;
+  flush();
+}
+
+bool ThreadedSocketConnection::flush()
+{
+  while( !m_writer.empty() )
   {
-    ssize_t sent = socket_send( m_socket, msg.c_str() + totalSent, msg.length() );
-    if(sent < 0) return false;
-    totalSent += sent;
+    if( !m_writer.write( getMetrics() ) )
+    {
+      m_writer.clear();
+      return false;
+    }
   }
-
   return true;
 }
 
@@ -88,31 +121,38 @@ void ThreadedSocketConnection::disconnect()
   socket_close( m_socket );
 }
 
-bool ThreadedSocketConnection::read()
+void ThreadedSocketConnection::setBusyPoll( const BusyPollSettings& settings )
 {
-  struct timeval timeout = { 1, 0 };
-  fd_set readset = m_fds;
+  m_busyPoll = settings;
+}
 
-  try
+std::string ThreadedSocketConnection::setOptions( const SocketOptions& options )
+{
+  std::string failed = options.apply( m_socket );
+  m_quickAck = options.m_quickAck;
+  if( options.m_timestamping )
   {
-    // Wait for input (1 second timeout)
-    int result = select( 1 + m_socket, &readset, 0, 0, &timeout );
+    const bool timestamping = m_writer.setTimestamping();
+    m_reader.setTimestamping( timestamping );
+    if( !timestamping )
+      failed += std::string( failed.empty() ? "" : ", " ) + SOCKET_TIMESTAMPING;
+  }
+  return failed;
+}
 
-    if( result > 0 ) // Something to read
-    {
-      // We can read without blocking
-      ssize_t size = recv( m_socket, m_buffer, sizeof(m_buffer), 0 );
-      if ( size <= 0 ) { throw SocketRecvFailed( size ); }
-      m_parser.addToStream( m_buffer, size );
-    }
-    else if( result == 0 && m_pSession ) // Timeout
-    {
-      m_pSession->next();
-    }
-    else if( result < 0 ) // Error
-    {
-      throw SocketRecvFailed( result );
-    }
+SessionMetrics* ThreadedSocketConnection::getMetrics() const
+{
+  return m_pSession ? m_pSession->getMetrics() : 0;
+}
+
+bool ThreadedSocketConnection::read()
+{
+  try
+  {
+    if( m_busyPoll.m_enabled )
+      readSpinning();
+    else
+      readBlocking();
 
     processStream();
     return true;
@@ -136,42 +176,125 @@ bool ThreadedSocketConnection::read()
   }
 }
 
-bool ThreadedSocketConnection::readMessage( std::string& msg )
-throw( SocketRecvFailed )
+void ThreadedSocketConnection::readBlocking() throw( SocketRecvFailed )
 {
-  try
+  struct timeval timeout = { 1, 0 };
+  fd_set readset = m_fds;
+
+  // Wait for input (1 second timeout)
+  int result = select( 1 + m_socket, &readset, 0, 0, &timeout );
+
+  if( result > 0 ) // Something to read
   {
-    return m_parser.readFixMessage( msg );
+    // zero copy completions wake select with nothing to read
+    if( !receive() )
+      m_writer.reap( getMetrics() );
+  }
+  else if( result == 0 && m_pSession ) // Timeout
+  {
+    m_pSession->next();
+  }
+  else if( result < 0 ) // Error
+  {
+    throw SocketRecvFailed( result );
   }
-  catch ( MessageParseError& ) {}
-  return true;
 }
 
-void ThreadedSocketConnection::processStream()
+void ThreadedSocketConnection::readSpinning() throw( SocketRecvFailed )
 {
-  std::string msg;
-  while( readMessage(msg) )
+  for( int spins = 1; ; ++spins )
   {
-    if ( !m_pSession )
-    {
-      if ( !setSession( msg ) )
-      { disconnect(); continue; }
-    }
-    try
+    // no select() timeout wakes us, so the session timers run off the clock
+    const unsigned long long now = time_monotonic();
+    if( now >= m_nextTimer )
     {
-      m_pSession->next( msg, UtcTimeStamp() );
+      m_nextTimer = now + 1000000000ULL;
+      if( m_pSession )
+        m_pSession->next();
     }
-    catch( InvalidMessage& )
+
+    if( receive() )
+      return;
+
+    if( m_busyPoll.m_spinCount && spins >= m_busyPoll.m_spinCount )
     {
-      if( !m_pSession->isLoggedOn() )
-      {
-        disconnect();
-        return;
-      }
+      park();
+      spins = 0;
     }
   }
 }
 
+int ThreadedSocketConnection::receive() throw( SocketRecvFailed )
+{
+#ifdef MSG_DONTWAIT
+  ssize_t size = m_reader.read( m_parser, MSG_DONTWAIT );
+  if( size < 0 && ( errno == EAGAIN || errno == EWOULDBLOCK ) )
+    return 0;
+#else
+  struct timeval timeout = { 0, 0 };
+  fd_set readset = m_fds;
+  int result = select( 1 + m_socket, &readset, 0, 0, &timeout );
+  if( result < 0 )
+    throw SocketRecvFailed( result );
+  if( result == 0 )
+    return 0;
+  ssize_t size = m_reader.read( m_parser );
+#endif
+  if( size <= 0 )
+    throw SocketRecvFailed( size );
+#ifdef TCP_QUICKACK
+  // the kernel drops back to delayed acks on its own
+  if( m_quickAck )
+    socket_setsockopt( m_socket, IPPROTO_TCP, TCP_QUICKACK, 1 );
+#endif
+  return (int)size;
+}
+
+void ThreadedSocketConnection::park()
+{
+  struct timeval timeout;
+  timeout.tv_sec = m_busyPoll.m_parkTimeout / 1000000;
+  timeout.tv_usec = m_busyPoll.m_parkTimeout % 1000000;
+  fd_set readset = m_fds;
+  select( 1 + m_socket, &readset, 0, 0, &timeout );
+  m_writer.reap( getMetrics() );
+}
+
+void ThreadedSocketConnection::processStream()
+{
+  SocketReader::readMessages( m_parser, m_messages );
+  if( m_messages.empty() )
+    return;
+
+  // the clock is read once for everything that arrived together
+  const UtcTimeStamp now;
+  const unsigned long long receiveTime = m_reader.getReceiveTime();
+  SessionMetrics* pMetrics = receiveTime ? getMetrics() : 0;
+  if( pMetrics )
+  {
+    const unsigned long long wireIn = time_realtime();
+    if( wireIn > receiveTime )
+      pMetrics->record( SessionMetrics::WIRE_IN, wireIn - receiveTime );
+  }
+
+  if ( !m_pSession && !setSession( m_messages.front() ) )
+  {
+    disconnect();
+    m_messages.clear();
+    return;
+  }
+
+  try
+  {
+    m_pSession->nextBatch( m_messages, now );
+  }
+  catch( InvalidMessage& )
+  {
+    disconnect();
+  }
+  m_messages.clear();
+}
+
 bool ThreadedSocketConnection::setSession( const std::string& msg )
 {
   m_pSession = Session::lookupSession( msg, true );
@@ -29,16 +29,39 @@
 #include "Parser.h"
 #include "Responder.h"
 #include "SessionID.h"
+#include "Exceptions.h"
+#include "SocketReader.h"
+#include "SocketWriter.h"
+#include "SocketOptions.h"
 #include <set>
 #include <map>
+#include <atomic>
 
 namespace FIX
 {
 class ThreadedSocketAcceptor;
 class ThreadedSocketInitiator;
 class Session;
+class SessionMetrics;
 class Application;
 class Log;
+class Dictionary;
+
+/// How a connection waits for input when it busy polls.
+struct BusyPollSettings
+{
+  BusyPollSettings()
+  : m_enabled( false ), m_spinCount( 100000 ), m_parkTimeout( 1000 ) {}
+
+  /// Take any of the busy poll settings the dictionary has.
+  void read( const Dictionary& ) throw( ConfigError );
+
+  bool m_enabled;
+  /// empty reads before parking in select(), 0 never parks
+  int m_spinCount;
+  /// microseconds to park before spinning again
+  int m_parkTimeout;
+};
 
 /// Encapsulates a socket file descriptor (multi-threaded).
 class ThreadedSocketConnection : Responder
@@ -58,14 +81,27 @@ public:
   void disconnect();
   bool read();
 
+  /// Spin on non-blocking reads instead of blocking in select().
+  void setBusyPoll( const BusyPollSettings& );
+  /// Send messages of at least size bytes without copying them.
+  bool setZeroCopy( int size ) { return m_writer.setZeroCopy( size ); }
+  /// Tune the socket, returns the settings that could not be applied.
+  std::string setOptions( const SocketOptions& );
+
 private:
-  bool readMessage( std::string& msg ) throw( SocketRecvFailed );
+  void readBlocking() throw( SocketRecvFailed );
+  void readSpinning() throw( SocketRecvFailed );
+  int receive() throw( SocketRecvFailed );
+  void park();
   void processStream();
+  SessionMetrics* getMetrics() const;
   bool send( const std::string& );
+  void beginBatch();
+  void endBatch();
+  bool flush();
   bool setSession( const std::string& msg );
 
   int m_socket;
-  char m_buffer[BUFSIZ];
 
   std::string m_address;
   int m_port;
@@ -76,6 +112,14 @@ private:
   Session* m_pSession;
   bool m_disconnect;
   fd_set m_fds;
+  SocketReader m_reader;
+  SocketReader::Messages m_messages;
+  SocketWriter m_writer;
+  std::atomic<bool> m_batch;
+
+  BusyPollSettings m_busyPoll;
+  unsigned long long m_nextTimer;
+  bool m_quickAck;
 };
 }
 
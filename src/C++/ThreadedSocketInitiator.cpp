@@ -34,8 +34,8 @@ ThreadedSocketInitiator::ThreadedSocketInitiator(
   MessageStoreFactory& factory,
   const SessionSettings& settings ) throw( ConfigError )
 : Initiator( application, factory, settings ),
-  m_lastConnect( 0 ), m_reconnectInterval( 1 ), m_noDelay( false ), 
-  m_sendBufSize( 0 ), m_rcvBufSize( 0 ) 
+  m_noDelay( false ), 
+  m_sendBufSize( 0 ), m_rcvBufSize( 0 ), m_zeroCopySize( 0 )
 { 
   socket_init(); 
 }
@@ -46,8 +46,8 @@ ThreadedSocketInitiator::ThreadedSocketInitiator(
   const SessionSettings& settings,
   LogFactory& logFactory ) throw( ConfigError )
 : Initiator( application, factory, settings, logFactory ),
-  m_lastConnect( 0 ), m_reconnectInterval( 1 ), m_noDelay( false ), 
-  m_sendBufSize( 0 ), m_rcvBufSize( 0 ) 
+  m_noDelay( false ), 
+  m_sendBufSize( 0 ), m_rcvBufSize( 0 ), m_zeroCopySize( 0 )
 { 
   socket_init(); 
 }
@@ -62,14 +62,29 @@ throw ( ConfigError )
 {
   const Dictionary& dict = s.get();
 
-  if( dict.has( RECONNECT_INTERVAL ) )
-    m_reconnectInterval = dict.getInt( RECONNECT_INTERVAL );
   if( dict.has( SOCKET_NODELAY ) )
     m_noDelay = dict.getBool( SOCKET_NODELAY );
   if( dict.has( SOCKET_SEND_BUFFER_SIZE ) )
     m_sendBufSize = dict.getInt( SOCKET_SEND_BUFFER_SIZE );
   if( dict.has( SOCKET_RECEIVE_BUFFER_SIZE ) )
     m_rcvBufSize = dict.getInt( SOCKET_RECEIVE_BUFFER_SIZE );
+  if( dict.has( SOCKET_ZERO_COPY_SIZE ) )
+    m_zeroCopySize = dict.getInt( SOCKET_ZERO_COPY_SIZE );
+  if( m_zeroCopySize < 0 )
+    throw ConfigError( std::string( SOCKET_ZERO_COPY_SIZE ) + " must not be negative" );
+
+  m_busyPoll = BusyPollSettings();
+  m_busyPoll.read( dict );
+
+  std::set<SessionID> sessions = s.getSessions();
+  std::set<SessionID>::iterator i;
+  for( i = sessions.begin(); i != sessions.end(); ++i )
+  {
+    const Dictionary& settings = s.get( *i );
+    if( settings.has( SOCKET_THREAD_CPU ) )
+      settings.getInt( SOCKET_THREAD_CPU );
+    SocketOptions().read( settings );
+  }
 }
 
 void ThreadedSocketInitiator::onInitialize( const SessionSettings& s )
@@ -79,16 +94,12 @@ throw ( RuntimeError )
 
 void ThreadedSocketInitiator::onStart()
 {
+  // the scheduler decides which sessions are due each second
   while ( !isStopped() )
   {
-    time_t now;
-    ::time( &now );
-
-    if ( (now - m_lastConnect) >= m_reconnectInterval )
     {
       Locker l( m_mutex );
       connect();
-      m_lastConnect = now;
     }
 
     process_sleep( 1 );
@@ -156,6 +167,9 @@ void ThreadedSocketInitiator::doConnect( const SessionID& s, const Dictionary& d
 
     ThreadedSocketConnection* pConnection =
       new ThreadedSocketConnection( s, socket, address, port, getLog() );
+    pConnection->setBusyPoll( m_busyPoll );
+    if( m_zeroCopySize && !pConnection->setZeroCopy( m_zeroCopySize ) )
+      log->onEvent( "Unable to turn on zero copy sends" );
 
     ThreadPair* pair = new ThreadPair( this, pConnection );
 
@@ -197,6 +211,31 @@ void ThreadedSocketInitiator::removeThread( int s )
   }
 }
 
+void ThreadedSocketInitiator::bindThread( Session& session )
+{
+  const Dictionary* pSettings = getSessionSettings( session.getSessionID() );
+  if( !pSettings || !pSettings->has( SOCKET_THREAD_CPU ) )
+    return;
+
+  const int cpu = pSettings->getInt( SOCKET_THREAD_CPU );
+  if( !thread_setaffinity( cpu ) )
+    session.getLog()->onEvent( "Unable to bind thread to CPU " + IntConvertor::convert( cpu ) );
+}
+
+void ThreadedSocketInitiator::setOptions
+( ThreadedSocketConnection& connection, Session& session )
+{
+  // some options only take on a connected socket
+  SocketOptions options;
+  const Dictionary* pSettings = getSessionSettings( session.getSessionID() );
+  if( pSettings )
+    options.read( *pSettings );
+
+  const std::string failed = connection.setOptions( options );
+  if( !failed.empty() )
+    session.getLog()->onEvent( "Unable to set " + failed );
+}
+
 THREAD_PROC ThreadedSocketInitiator::socketThread( void* p )
 {
   ThreadPair * pair = reinterpret_cast < ThreadPair* > ( p );
@@ -222,6 +261,8 @@ THREAD_PROC ThreadedSocketInitiator::socketThread( void* p )
 
   pInitiator->setConnected( sessionID );
   pInitiator->getLog()->onEvent( "Connection succeeded" );
+  pInitiator->bindThread( *pSession );
+  pInitiator->setOptions( *pConnection, *pSession );
 
   pSession->next();
 
@@ -64,17 +64,19 @@ private:
   void addThread( int s, thread_id t );
   void removeThread( int s );
   void lock() { Locker l(m_mutex); }
+  void bindThread( Session& );
+  void setOptions( ThreadedSocketConnection&, Session& );
   static THREAD_PROC socketThread( void* p );
 
   void getHost( const SessionID&, const Dictionary&, std::string&, short& );
 
   SessionSettings m_settings;
   SessionToHostNum m_sessionToHostNum;
-  time_t m_lastConnect;
-  int m_reconnectInterval;
   bool m_noDelay;
   int m_sendBufSize;
   int m_rcvBufSize;
+  int m_zeroCopySize;
+  BusyPollSettings m_busyPoll;
   SocketToThread m_threads;
   Mutex m_mutex;
 };
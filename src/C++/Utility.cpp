@@ -30,6 +30,13 @@
 #include <stropts.h>
 #include <sys/conf.h>
 #endif
+#ifndef _MSC_VER
+#include <sched.h>
+#endif
+#ifdef __linux__
+#include <linux/errqueue.h>
+#include <linux/net_tstamp.h>
+#endif
 #include <string.h>
 #include <math.h>
 #include <stdio.h>
@@ -144,7 +151,7 @@ void socket_term()
 #endif
 }
 
-int socket_createAcceptor(int port, bool reuse)
+int socket_createAcceptor(int port, bool reuse, bool reusePort)
 {
   int socket = ::socket( PF_INET, SOCK_STREAM, 0 );
   if ( socket < 0 ) return -1;
@@ -158,6 +165,10 @@ int socket_createAcceptor(int port, bool reuse)
   socklen = sizeof( address );
   if( reuse )
     socket_setsockopt( socket, SO_REUSEADDR );
+#ifdef SO_REUSEPORT
+  if( reusePort )
+    socket_setsockopt( socket, SO_REUSEPORT );
+#endif
 
   int result = bind( socket, reinterpret_cast < sockaddr* > ( &address ),
                      socklen );
@@ -169,7 +180,12 @@ int socket_createAcceptor(int port, bool reuse)
 
 int socket_createConnector()
 {
-  return ::socket( PF_INET, SOCK_STREAM, IPPROTO_TCP );
+  return socket_createConnector( PF_INET );
+}
+
+int socket_createConnector( int family )
+{
+  return ::socket( family, SOCK_STREAM, IPPROTO_TCP );
 }
 
 int socket_connect( int socket, const char* address, int port )
@@ -188,6 +204,11 @@ int socket_connect( int socket, const char* address, int port )
   return result;
 }
 
+int socket_connect( int socket, const sockaddr* address, socklen_t length )
+{
+  return connect( socket, address, length );
+}
+
 int socket_accept( int s )
 {
   if ( !socket_isValid( s ) ) return -1;
@@ -199,6 +220,157 @@ ssize_t socket_send( int s, const char* msg, size_t length )
   return send( s, msg, length, 0 );
 }
 
+void socket_setbuffer( socket_buffer& buffer, const char* data, size_t length )
+{
+#ifdef _MSC_VER
+  buffer.buf = const_cast < char* > ( data );
+  buffer.len = (ULONG)length;
+#else
+  buffer.iov_base = const_cast < char* > ( data );
+  buffer.iov_len = length;
+#endif
+}
+
+ssize_t socket_writev( int s, socket_buffer* buffers, int count, bool zeroCopy )
+{
+#ifdef _MSC_VER
+  DWORD sent = 0;
+  if( WSASend( s, buffers, count, &sent, 0, 0, 0 ) != 0 )
+    return -1;
+  return (ssize_t)sent;
+#else
+  msghdr message;
+  memset( &message, 0, sizeof( message ) );
+  message.msg_iov = buffers;
+  message.msg_iovlen = count;
+
+  int flags = 0;
+#if defined(MSG_ZEROCOPY) && defined(SO_ZEROCOPY)
+  if( zeroCopy )
+    flags |= MSG_ZEROCOPY;
+#endif
+  return sendmsg( s, &message, flags );
+#endif
+}
+
+bool socket_setzerocopy( int s )
+{
+#if defined(MSG_ZEROCOPY) && defined(SO_ZEROCOPY)
+  return socket_setsockopt( s, SO_ZEROCOPY ) == 0;
+#else
+  return false;
+#endif
+}
+
+bool socket_readerrqueue( int s, socket_notification& notification )
+{
+  notification.first = 1;
+  notification.last = 0;
+  notification.timestamp = 0;
+  notification.offset = 0;
+#if defined(MSG_ERRQUEUE) && defined(__linux__)
+  char control[ 256 ];
+  msghdr message;
+  memset( &message, 0, sizeof( message ) );
+  message.msg_control = control;
+  message.msg_controllen = sizeof( control );
+  if( recvmsg( s, &message, MSG_ERRQUEUE ) < 0 )
+    return false;
+
+  // anything that is neither a completion nor a timestamp is skipped
+  unsigned long long timestamp = 0;
+  for( cmsghdr* header = CMSG_FIRSTHDR( &message ); header; header = CMSG_NXTHDR( &message, header ) )
+  {
+#ifdef SCM_TIMESTAMPING
+    if( header->cmsg_level == SOL_SOCKET && header->cmsg_type == SCM_TIMESTAMPING )
+    {
+      const timespec* times = reinterpret_cast < const timespec* > ( CMSG_DATA( header ) );
+      timestamp = (unsigned long long)times[ 0 ].tv_sec * 1000000000ULL + times[ 0 ].tv_nsec;
+      continue;
+    }
+#endif
+    if( !( header->cmsg_level == IPPROTO_IP && header->cmsg_type == IP_RECVERR )
+        && !( header->cmsg_level == IPPROTO_IPV6 && header->cmsg_type == IPV6_RECVERR ) )
+      continue;
+
+    const sock_extended_err* error =
+      reinterpret_cast < const sock_extended_err* > ( CMSG_DATA( header ) );
+#ifdef SO_EE_ORIGIN_ZEROCOPY
+    if( error->ee_errno == 0 && error->ee_origin == SO_EE_ORIGIN_ZEROCOPY )
+    {
+      notification.first = error->ee_info;
+      notification.last = error->ee_data;
+    }
+#endif
+#ifdef SO_EE_ORIGIN_TIMESTAMPING
+    if( error->ee_errno == ENOMSG && error->ee_origin == SO_EE_ORIGIN_TIMESTAMPING )
+      notification.offset = error->ee_data;
+#endif
+  }
+
+  if( notification.first > notification.last )
+    notification.timestamp = timestamp;
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool socket_settimestamping( int s )
+{
+#if defined(SO_TIMESTAMPING) && defined(__linux__)
+  const int flags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_TX_SOFTWARE
+                    | SOF_TIMESTAMPING_SOFTWARE | SOF_TIMESTAMPING_OPT_ID
+                    | SOF_TIMESTAMPING_OPT_TSONLY;
+  return socket_setsockopt( s, SOL_SOCKET, SO_TIMESTAMPING, flags ) == 0;
+#else
+  return false;
+#endif
+}
+
+ssize_t socket_recvtimestamp( int s, char* buffer, size_t length, int flags,
+                              unsigned long long& timestamp )
+{
+  timestamp = 0;
+#if defined(SO_TIMESTAMPING) && defined(__linux__)
+  char control[ 256 ];
+  iovec data;
+  data.iov_base = buffer;
+  data.iov_len = length;
+  msghdr message;
+  memset( &message, 0, sizeof( message ) );
+  message.msg_iov = &data;
+  message.msg_iovlen = 1;
+  message.msg_control = control;
+  message.msg_controllen = sizeof( control );
+
+  ssize_t size = recvmsg( s, &message, flags );
+  if( size <= 0 )
+    return size;
+
+  for( cmsghdr* header = CMSG_FIRSTHDR( &message ); header; header = CMSG_NXTHDR( &message, header ) )
+  {
+    if( header->cmsg_level == SOL_SOCKET && header->cmsg_type == SCM_TIMESTAMPING )
+    {
+      const timespec* times = reinterpret_cast < const timespec* > ( CMSG_DATA( header ) );
+      timestamp = (unsigned long long)times[ 0 ].tv_sec * 1000000000ULL + times[ 0 ].tv_nsec;
+    }
+  }
+  return size;
+#else
+  return recv( s, buffer, length, flags );
+#endif
+}
+
+bool socket_wouldblock()
+{
+#ifdef _MSC_VER
+  return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+  return errno == EAGAIN || errno == EWOULDBLOCK;
+#endif
+}
+
 void socket_close( int s )
 {
   shutdown( s, 2 );
@@ -243,6 +415,11 @@ int socket_setsockopt( int s, int opt, int optval )
   if( opt == TCP_NODELAY )
     level = IPPROTO_TCP;
 
+  return socket_setsockopt( s, level, opt, optval );
+}
+
+int socket_setsockopt( int s, int level, int opt, int optval )
+{
 #ifdef _MSC_VER
   return ::setsockopt( s, level, opt,
                        ( char* ) & optval, sizeof( optval ) );
@@ -435,6 +612,40 @@ tm time_localtime( const time_t* t)
 #endif
 }
 
+unsigned long long time_monotonic()
+{
+#ifdef _MSC_VER
+  static LARGE_INTEGER frequency = { 0 };
+  if( !frequency.QuadPart )
+    QueryPerformanceFrequency( &frequency );
+  LARGE_INTEGER counter;
+  QueryPerformanceCounter( &counter );
+  return (unsigned long long)
+    ( counter.QuadPart * ( 1e9 / (double)frequency.QuadPart ) );
+#else
+  timespec now;
+  clock_gettime( CLOCK_MONOTONIC, &now );
+  return (unsigned long long)now.tv_sec * 1000000000ULL + now.tv_nsec;
+#endif
+}
+
+unsigned long long time_realtime()
+{
+#ifdef _MSC_VER
+  // FILETIME counts 100ns intervals since 1601
+  FILETIME now;
+  GetSystemTimeAsFileTime( &now );
+  ULARGE_INTEGER ticks;
+  ticks.LowPart = now.dwLowDateTime;
+  ticks.HighPart = now.dwHighDateTime;
+  return ( ticks.QuadPart - 116444736000000000ULL ) * 100;
+#else
+  timespec now;
+  clock_gettime( CLOCK_REALTIME, &now );
+  return (unsigned long long)now.tv_sec * 1000000000ULL + now.tv_nsec;
+#endif
+}
+
 bool thread_spawn( THREAD_START_ROUTINE func, void* var, thread_id& thread )
 {
 #ifdef _MSC_VER
@@ -489,6 +700,31 @@ thread_id thread_self()
 #endif
 }
 
+bool thread_setaffinity( int cpu )
+{
+#if defined(_MSC_VER)
+  if( cpu < 0 || cpu >= (int)( sizeof( DWORD_PTR ) * 8 ) ) return false;
+  return SetThreadAffinityMask( GetCurrentThread(), (DWORD_PTR)1 << cpu ) != 0;
+#elif defined(__linux__)
+  if( cpu < 0 || cpu >= CPU_SETSIZE ) return false;
+  cpu_set_t set;
+  CPU_ZERO( &set );
+  CPU_SET( cpu, &set );
+  return pthread_setaffinity_np( pthread_self(), sizeof( set ), &set ) == 0;
+#else
+  return false;
+#endif
+}
+
+void thread_yield()
+{
+#ifdef _MSC_VER
+  SwitchToThread();
+#else
+  sched_yield();
+#endif
+}
+
 void process_sleep( double s )
 {
 #ifdef _MSC_VER
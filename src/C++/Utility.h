@@ -63,6 +63,7 @@
 #ifdef _MSC_VER
 /////////////////////////////////////////////
 #include <Winsock2.h>
+#include <Ws2tcpip.h>
 #include <process.h>
 #include <direct.h>
 #include <time.h>
@@ -83,6 +84,7 @@ typedef int ssize_t;
 #include <fcntl.h>
 #include <unistd.h>
 #include <pthread.h>
+#include <sys/uio.h>
 #include <signal.h>
 #include <errno.h>
 #include <time.h>
@@ -128,16 +130,43 @@ std::set<int> intSetFromSplit( const std::string& string, const std::string& del
 
 void socket_init();
 void socket_term();
-int socket_createAcceptor( int port, bool reuse = false );
+int socket_createAcceptor( int port, bool reuse = false, bool reusePort = false );
 int socket_createConnector();
+int socket_createConnector( int family );
 int socket_connect( int s, const char* address, int port );
+int socket_connect( int s, const sockaddr* address, socklen_t length );
 int socket_accept( int s );
 ssize_t socket_send( int s, const char* msg, size_t length );
+#ifdef _MSC_VER
+typedef WSABUF socket_buffer;
+#else
+typedef iovec socket_buffer;
+#endif
+void socket_setbuffer( socket_buffer& buffer, const char* data, size_t length );
+ssize_t socket_writev( int s, socket_buffer* buffers, int count, bool zeroCopy = false );
+bool socket_setzerocopy( int s );
+/// One report read from a socket's error queue.
+struct socket_notification
+{
+  /// zero copy sends the kernel is done with, none when first > last
+  unsigned first;
+  unsigned last;
+  /// software transmit time in nanoseconds since the epoch, 0 if none,
+  /// of the send ending at this byte offset
+  unsigned long long timestamp;
+  unsigned offset;
+};
+bool socket_readerrqueue( int s, socket_notification& notification );
+bool socket_settimestamping( int s );
+ssize_t socket_recvtimestamp( int s, char* buffer, size_t length, int flags,
+                              unsigned long long& timestamp );
+bool socket_wouldblock();
 void socket_close( int s );
 bool socket_fionread( int s, int& bytes );
 bool socket_disconnected( int s );
 int socket_setsockopt( int s, int opt );
 int socket_setsockopt( int s, int opt, int optval );
+int socket_setsockopt( int s, int level, int opt, int optval );
 int socket_getsockopt( int s, int opt, int& optval );
 #ifndef _MSC_VER
 int socket_fcntl( int s, int opt, int arg );
@@ -158,6 +187,8 @@ std::pair<int, int> socket_createpair();
 
 tm time_gmtime( const time_t* t );
 tm time_localtime( const time_t* t );
+unsigned long long time_monotonic();
+unsigned long long time_realtime();
 
 #ifdef _MSC_VER
 typedef unsigned int (_stdcall THREAD_START_ROUTINE)(void *);
@@ -178,6 +209,8 @@ bool thread_spawn( THREAD_START_ROUTINE func, void* var );
 void thread_join( thread_id thread );
 void thread_detach( thread_id thread );
 thread_id thread_self();
+bool thread_setaffinity( int cpu );
+void thread_yield();
 
 void process_sleep( double s );
 
@@ -205,6 +238,12 @@ std::string file_appendpath( const std::string& path, const std::string& file );
 #define STRING_SPRINTF sprintf
 #endif
 
+#if defined(_MSC_VER) && (_MSC_VER < 1900)
+#define NOEXCEPT throw()
+#else
+#define NOEXCEPT noexcept
+#endif
+
 #if (!defined(_MSC_VER) || (_MSC_VER >= 1300)) && !defined(HAVE_STLPORT)
 using std::abort;
 using std::sprintf;
@@ -21,6 +21,7 @@
 #include "Field.h"
 #include "Values.h"
 #include "Utility.h"
+#include <algorithm>
 
 
 
@@ -61,6 +62,13 @@ bool ValidationRules::shouldValidateUserDefinedFields( const ValidationRules* vr
   return vr->shouldValidateUserDefinedFields( );
 }
 
+bool ValidationRules::shouldValidateLazily( const ValidationRules* vr )
+{
+  if ( !vr )
+    return false;
+  return vr->shouldValidateLazily( );
+}
+
 bool ValidationRules::shouldTolerateBadFormatTag ( const ValidationRules* vr, int direction, const std::string& msgType, int tag )
 {
   if( !ValidationRules::shouldValidate( vr ) )
@@ -152,6 +160,7 @@ bool ValidationRules::shouldTolerateTagValue ( const ValidationRules* vr, int di
 ValidationRules::ValidationRules ()
 : m_validate(true),
 m_validateBounds(true),
+m_validateLazily(false),
 m_allowedFields(),
 m_badFormatFields(),
 m_outOfBoundsFields(),
@@ -160,8 +169,10 @@ m_repeatingGroupMismatches(),
 m_unknownFields(),
 m_emptyFields(),
 m_outOfOrderFields(),
-m_duplicateFields()
+m_duplicateFields(),
+m_hasRules(false)
 {
+  compile();
 }
 
 ValidationRules::~ValidationRules ()
@@ -181,11 +192,13 @@ void ValidationRules::setValidateBounds( bool validatebounds )
 void ValidationRules::setAllowedFields ( const std::string& allowedfieldstr ) 
 {
   split( allowedfieldstr, ";", std::bind( &ValidationRules::addAllowedFieldGroup, this, std::placeholders::_1 ) );
+  compile();
 }
 
 void ValidationRules::setValidationRules ( const std::string& validationrulesstr ) 
 {
   split( validationrulesstr, ",", std::bind( &ValidationRules::addValidationRule, this, std::placeholders::_1 ) );
+  compile();
 }
 
 void ValidationRules::setValidateLength ( bool validatelength)
@@ -213,6 +226,11 @@ void ValidationRules::setValidateUserDefinedFields ( bool validateuserdefinedfie
   m_validateUserDefinedFields = validateuserdefinedfields;
 }
 
+void ValidationRules::setValidateLazily ( bool validatelazily )
+{
+  m_validateLazily = validatelazily;
+}
+
 
 bool ValidationRules::shouldValidate ( ) const
 {
@@ -221,27 +239,27 @@ bool ValidationRules::shouldValidate ( ) const
 
 bool ValidationRules::shouldTolerateBadFormatTag ( int direction, const std::string& msgType, int tag ) const
 {
-  return standardAllowCheck( m_badFormatFields, direction, msgType, tag);
+  return standardAllowCheck( BAD_FORMAT, direction, msgType, tag);
 }
 
 bool ValidationRules::shouldTolerateMissingTag ( int direction, const std::string& msgType, int tag ) const
 {
-  return standardAllowCheck( m_missingFields, direction, msgType, tag);
+  return standardAllowCheck( MISSING, direction, msgType, tag);
 }
 
 bool ValidationRules::shouldTolerateMissingMessageType ( int direction ) const
 {
-  return standardAllowCheck( m_missingFields, direction, "?", 35 );
+  return standardAllowCheck( MISSING, direction, "?", 35 );
 }
 
 bool ValidationRules::shouldTolerateVersionMismatch ( int direction ) const
 {
-  return standardAllowCheck( m_versionMismatches, direction, "?", -1 );
+  return standardAllowCheck( VERSION_MISMATCH, direction, "?", -1 );
 }
 
 bool ValidationRules::shouldTolerateEmptyTag ( int direction, const std::string& msgType, int tag ) const
 {
-  return standardAllowCheck( m_emptyFields, direction, msgType, tag);
+  return standardAllowCheck( EMPTY, direction, msgType, tag);
 }
 
 bool ValidationRules::shouldTolerateOutOfOrderTag ( int direction, const std::string& msgType, int tag ) const
@@ -250,12 +268,12 @@ bool ValidationRules::shouldTolerateOutOfOrderTag ( int direction, const std::st
   {
     return true;
   }
-  return standardAllowCheck( m_outOfOrderFields, direction, msgType, tag);
+  return standardAllowCheck( OUT_OF_ORDER, direction, msgType, tag);
 }
 
 bool ValidationRules::shouldTolerateDuplicateTag ( int direction, const std::string& msgType, int tag ) const
 {
-  return standardAllowCheck( m_duplicateFields, direction, msgType, tag);
+  return standardAllowCheck( DUPLICATE, direction, msgType, tag);
 }
 
 bool ValidationRules::shouldTolerateUnknownTag ( int direction, const std::string& msgType, int tag ) const
@@ -263,7 +281,7 @@ bool ValidationRules::shouldTolerateUnknownTag ( int direction, const std::strin
   if (tag >= FIELD::UserMin) {
     return !m_validateUserDefinedFields;
   }
-  return standardAllowCheck( m_unknownFields, direction, msgType, tag );
+  return standardAllowCheck( UNKNOWN, direction, msgType, tag );
 }
 
 bool ValidationRules::shouldTolerateTagValue ( int direction, const std::string& msgType, int tag ) const
@@ -271,12 +289,12 @@ bool ValidationRules::shouldTolerateTagValue ( int direction, const std::string&
   if (!m_validateBounds) {
     return true;
   }
-  return standardAllowCheck( m_outOfBoundsFields, direction, msgType, tag );
+  return standardAllowCheck( OUT_OF_BOUNDS, direction, msgType, tag );
 }
 
 bool ValidationRules::shouldTolerateRepeatingGroupCountMismatch ( int direction, const std::string& msgType, int tag ) const
 {
-  return standardAllowCheck( m_repeatingGroupMismatches, direction, msgType, tag );
+  return standardAllowCheck( REPEATING_GROUP_MISMATCH, direction, msgType, tag );
 }
 
 bool ValidationRules::shouldValidateLength ( ) const 
@@ -299,6 +317,11 @@ bool ValidationRules::shouldValidateUserDefinedFields ( ) const
   return m_validateUserDefinedFields;
 }
 
+bool ValidationRules::shouldValidateLazily ( ) const
+{
+  return m_validateLazily;
+}
+
 void ValidationRules::addAllowedFieldGroup ( const std::string& afgstring )
 {
   AllowedFieldGroup(afgstring, this);
@@ -309,11 +332,132 @@ void ValidationRules::addValidationRule ( const std::string& validationrulesstr
   ValidationRule( validationrulesstr, this );
 }
 
-bool ValidationRules::standardAllowCheck( const ValidationRules::DirectionAwareMsgTypeMap& dmtm, int direction, const std::string& msgType, int tag ) const
+bool ValidationRules::standardAllowCheck( Tolerance tolerance, int direction, const std::string& msgType, int tag ) const
 {
-  if( mapHasValue( m_allowedFields, msgType, tag ) )
-    return true;
-  return dmtm.shouldAllowTag( direction, msgType, tag );
+  if( !m_hasRules )
+    return false;
+
+  // rules only differ for message types they name, the rest share AnyMsgType
+  size_t index = m_compiledRules.size() > 1 ? compiledIndex( msgType ) : 0;
+
+  if( direction != INCOMING_DIRECTION && direction != OUTGOING_DIRECTION )
+    direction = 0;
+  return m_compiledRules[ index ].tolerated[ tolerance ][ direction ].contains( tag );
+}
+
+size_t ValidationRules::compiledIndex( const std::string& msgType ) const
+{
+  unsigned long long key = 0;
+  if( !packMsgType( msgType, key ) )
+  {
+    std::map<std::string, size_t>::const_iterator i = m_compiledMsgTypes.find( msgType );
+    return i != m_compiledMsgTypes.end() ? i->second : 0;
+  }
+
+  PackedMsgTypes::const_iterator i = std::lower_bound
+    ( m_packedMsgTypes.begin(), m_packedMsgTypes.end(), std::make_pair( key, (size_t)0 ) );
+  return i != m_packedMsgTypes.end() && i->first == key ? i->second : 0;
+}
+
+bool ValidationRules::packMsgType( const std::string& msgType, unsigned long long& key )
+{
+  // the length takes the low byte, the characters the seven above it
+  if( msgType.size() > 7 )
+    return false;
+  key = msgType.size();
+  for( size_t i = 0; i < msgType.size(); ++i )
+    key |= (unsigned long long)(unsigned char)msgType[ i ] << ( 8 * ( i + 1 ) );
+  return true;
+}
+
+void ValidationRules::compile()
+{
+  const DirectionAwareMsgTypeMap* rules[ TOLERANCES ] =
+  {
+    &m_badFormatFields, &m_outOfBoundsFields, &m_missingFields,
+    &m_repeatingGroupMismatches, &m_unknownFields, &m_emptyFields,
+    &m_outOfOrderFields, &m_duplicateFields, &m_versionMismatches
+  };
+  const int directions[] = { 0, INCOMING_DIRECTION, OUTGOING_DIRECTION };
+
+  std::set<std::string> msgTypes;
+  MsgTypeMap::const_iterator i;
+  for( i = m_allowedFields.begin(); i != m_allowedFields.end(); ++i )
+    msgTypes.insert( i->first );
+  for( int t = 0; t < TOLERANCES; ++t )
+  {
+    for( int d = 1; d < 3; ++d )
+    {
+      const MsgTypeMap& fields = rules[ t ]->fields( directions[ d ] );
+      for( i = fields.begin(); i != fields.end(); ++i )
+        msgTypes.insert( i->first );
+    }
+  }
+  m_hasRules = !msgTypes.empty();
+  msgTypes.erase( AnyMsgType );
+
+  m_compiledMsgTypes.clear();
+  m_compiledMsgTypes[ AnyMsgType ] = 0;
+  std::set<std::string>::const_iterator j;
+  for( j = msgTypes.begin(); j != msgTypes.end(); ++j )
+    m_compiledMsgTypes.insert( std::make_pair( *j, m_compiledMsgTypes.size() ) );
+
+  m_packedMsgTypes.clear();
+  std::map<std::string, size_t>::const_iterator k;
+  for( k = m_compiledMsgTypes.begin(); k != m_compiledMsgTypes.end(); ++k )
+  {
+    unsigned long long key = 0;
+    if( packMsgType( k->first, key ) )
+      m_packedMsgTypes.push_back( std::make_pair( key, k->second ) );
+  }
+  std::sort( m_packedMsgTypes.begin(), m_packedMsgTypes.end() );
+
+  // resolve each message type the same way the maps are searched, falling
+  // back to AnyMsgType only when a map has no entry for the type at all
+  m_compiledRules.assign( m_compiledMsgTypes.size(), CompiledRules() );
+  for( k = m_compiledMsgTypes.begin(); k != m_compiledMsgTypes.end(); ++k )
+  {
+    CompiledRules& compiled = m_compiledRules[ k->second ];
+    const MsgTypeValues* allowed = resolveMsgTypeValues( m_allowedFields, k->first );
+
+    for( int t = 0; t < TOLERANCES; ++t )
+    {
+      for( int d = 0; d < 3; ++d )
+      {
+        compiled.tolerated[ t ][ directions[ d ] ].insert( allowed );
+        if( directions[ d ] )
+        {
+          compiled.tolerated[ t ][ directions[ d ] ].insert
+            ( resolveMsgTypeValues( rules[ t ]->fields( directions[ d ] ), k->first ) );
+        }
+      }
+    }
+  }
+}
+
+void ValidationRules::TagSet::insert( int tag )
+{
+  static const int MAX_INDEXED_TAG = 20000;
+
+  if( tag < -1 || tag > MAX_INDEXED_TAG )
+  {
+    m_overflow.insert( tag );
+    return;
+  }
+
+  size_t index = (size_t)( tag + 1 );
+  if( index >= m_bits.size() )
+    m_bits.resize( index + 1, false );
+  m_bits[ index ] = true;
+}
+
+void ValidationRules::TagSet::insert( const MsgTypeValues* tags )
+{
+  if( !tags )
+    return;
+  MsgTypeValues::const_iterator i;
+  for( i = tags->begin(); i != tags->end(); ++i )
+    insert( *i );
 }
 
 void ValidationRules::DirectionAwareMsgTypeMap::safeAddMsgTypeValue( int inbound, const std::string& msgType, int tag )
@@ -324,13 +468,9 @@ void ValidationRules::DirectionAwareMsgTypeMap::safeAddMsgTypeValue( int inbound
     ValidationRules::safeAddMsgTypeValue( m_inboundFields, msgType, tag );
 }
 
-bool ValidationRules::DirectionAwareMsgTypeMap::shouldAllowTag( int direction, const std::string& msgType, int tag ) const
+const ValidationRules::MsgTypeMap& ValidationRules::DirectionAwareMsgTypeMap::fields( int direction ) const
 {
-  if( direction == INCOMING_DIRECTION )
-    return ValidationRules::mapHasValue( m_inboundFields, msgType, tag );
-  if( direction == OUTGOING_DIRECTION )
-    return ValidationRules::mapHasValue( m_outboundFields, msgType, tag );
-  return false;
+  return direction == INCOMING_DIRECTION ? m_inboundFields : m_outboundFields;
 }
 
 ValidationRules::AllowedFieldGroup::AllowedFieldGroup( const std::string& descriptor, ValidationRules* vrptr )
@@ -23,6 +23,7 @@
 #include <string>
 #include <map>
 #include <set>
+#include <vector>
 #include <stdexcept>
 
 namespace FIX
@@ -34,6 +35,7 @@ class ValidationRules
     static bool shouldValidateLength( const ValidationRules* vr );
     static bool shouldValidateChecksum( const ValidationRules* vr );
     static bool shouldValidateUserDefinedFields( const ValidationRules* vr );
+    static bool shouldValidateLazily( const ValidationRules* vr );
     static bool shouldTolerateBadFormatTag ( const ValidationRules* vr, int direction, const std::string& msgType, int tag );
     static bool shouldTolerateMissingTag ( const ValidationRules* vr, int direction, const std::string& msgType, int tag );
     static bool shouldTolerateMissingMessageType ( const ValidationRules* vr, int direction );
@@ -57,6 +59,9 @@ class ValidationRules
     void setValidateFieldsOutOfOrder ( bool validatefieldsoutoforder );
     void setValidateFieldsHaveValues ( bool validatefieldshavevalues );
     void setValidateUserDefinedFields ( bool validateuserdefinedfields );
+    /// Skip body field format and enumeration checks on receipt.  Both
+    /// are checked instead when a field is first read from the message.
+    void setValidateLazily ( bool validatelazily );
 
     bool shouldValidate ( ) const;
     bool shouldTolerateBadFormatTag ( int direction, const std::string& msgType, int tag ) const;
@@ -74,6 +79,7 @@ class ValidationRules
     bool shouldValidateChecksum ( ) const;
     bool shouldValidateFieldsHaveValues ( ) const;
     bool shouldValidateUserDefinedFields ( ) const;
+    bool shouldValidateLazily ( ) const;
 
   private:
     static const std::string AnyMsgType;
@@ -85,8 +91,40 @@ class ValidationRules
         MsgTypeMap m_outboundFields;
       public: 
         void safeAddMsgTypeValue( int inbound, const std::string& msgType, int tag );
-        bool shouldAllowTag( int direction, const std::string& msgType, int tag ) const;
+        const MsgTypeMap& fields( int direction ) const;
     };
+
+    enum Tolerance
+    {
+      BAD_FORMAT, OUT_OF_BOUNDS, MISSING, REPEATING_GROUP_MISMATCH, UNKNOWN,
+      EMPTY, OUT_OF_ORDER, DUPLICATE, VERSION_MISMATCH, TOLERANCES
+    };
+
+    /// Tags held as bits, with a set for the rare tag too large to index.
+    class TagSet
+    {
+      public:
+        void insert( int tag );
+        void insert( const MsgTypeValues* tags );
+        bool contains( int tag ) const
+        {
+          // offset by one so the -1 used by version mismatch rules has a bit
+          size_t index = (size_t)( tag + 1 );
+          if( index < m_bits.size() )
+            return m_bits[ index ];
+          return !m_overflow.empty() && m_overflow.find( tag ) != m_overflow.end();
+        }
+      private:
+        std::vector<bool> m_bits;
+        MsgTypeValues m_overflow;
+    };
+
+    /// Tolerated tags for one message type, indexed by tolerance and direction.
+    struct CompiledRules
+    {
+      TagSet tolerated[ TOLERANCES ][ 3 ];
+    };
+
     bool m_validate;
     bool m_validateBounds;
     bool m_validateLength;
@@ -94,6 +132,7 @@ class ValidationRules
     bool m_validateFieldsOutOfOrder;
     bool m_validateFieldsHaveValues;
     bool m_validateUserDefinedFields;
+    bool m_validateLazily;
     MsgTypeMap m_allowedFields;
     DirectionAwareMsgTypeMap m_badFormatFields;
     DirectionAwareMsgTypeMap m_outOfBoundsFields;
@@ -104,10 +143,20 @@ class ValidationRules
     DirectionAwareMsgTypeMap m_outOfOrderFields;
     DirectionAwareMsgTypeMap m_duplicateFields;
     DirectionAwareMsgTypeMap m_versionMismatches;
+    bool m_hasRules;
+    std::vector<CompiledRules> m_compiledRules;
+    std::map<std::string, size_t> m_compiledMsgTypes;
+    /// Short message types packed into an integer and sorted, so the
+    /// lookup on every check is a binary search rather than string compares.
+    typedef std::vector< std::pair<unsigned long long, size_t> > PackedMsgTypes;
+    PackedMsgTypes m_packedMsgTypes;
     void addAllowedFieldGroup ( const std::string& afgstring );
     void addValidationRule ( const std::string& validationrulestr );
+    void compile();
 
-    bool standardAllowCheck( const DirectionAwareMsgTypeMap& dmtm, int direction, const std::string& msgType, int tag ) const ;
+    bool standardAllowCheck( Tolerance tolerance, int direction, const std::string& msgType, int tag ) const;
+    size_t compiledIndex( const std::string& msgType ) const;
+    static bool packMsgType( const std::string& msgType, unsigned long long& key );
 
     static MsgTypeMap::const_iterator findMsgTypeValues( const MsgTypeMap& map, const std::string& msgtype ) 
     throw( std::out_of_range )
@@ -163,20 +212,17 @@ class ValidationRules
       }
     }
 
-    static bool mapHasValue ( const MsgTypeMap& map, const std::string& msgtype, int value )
+    static const MsgTypeValues* resolveMsgTypeValues ( const MsgTypeMap& map, const std::string& msgtype )
     {
-      MsgTypeMap::const_iterator mi;
       try 
       {
-        mi = findMsgTypeValues( map, msgtype );
+        return &findMsgTypeValues( map, msgtype )->second;
       }
       catch ( std::out_of_range& e ) 
       {
         (void) e;
-        return false;
+        return 0;
       }
-      MsgTypeValues::const_iterator si = mi->second.find( value );
-      return si != mi->second.end();
     }
 
     static void safeAddMsgTypeValue ( MsgTypeMap& map, const std::string& msgtype, int value ) 
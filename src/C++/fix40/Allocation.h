@@ -61,7 +61,8 @@ namespace FIX40
     class NoOrders: public FIX::Group
     {
     public:
-    NoOrders() : FIX::Group(73,11,FIX::message_order(11,37,66,105,0)) {}
+    NoOrders() : FIX::Group(73,11,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(11,37,66,105,0); return instance; }
       FIELD_SET(*this, FIX::ClOrdID);
       FIELD_SET(*this, FIX::OrderID);
       FIELD_SET(*this, FIX::ListID);
@@ -71,7 +72,8 @@ namespace FIX40
     class NoExecs: public FIX::Group
     {
     public:
-    NoExecs() : FIX::Group(124,17,FIX::message_order(17,32,31,30,0)) {}
+    NoExecs() : FIX::Group(124,17,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(17,32,31,30,0); return instance; }
       FIELD_SET(*this, FIX::ExecID);
       FIELD_SET(*this, FIX::LastShares);
       FIELD_SET(*this, FIX::LastPx);
@@ -81,7 +83,8 @@ namespace FIX40
     class NoMiscFees: public FIX::Group
     {
     public:
-    NoMiscFees() : FIX::Group(136,137,FIX::message_order(137,138,139,0)) {}
+    NoMiscFees() : FIX::Group(136,137,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(137,138,139,0); return instance; }
       FIELD_SET(*this, FIX::MiscFeeAmt);
       FIELD_SET(*this, FIX::MiscFeeCurr);
       FIELD_SET(*this, FIX::MiscFeeType);
@@ -90,7 +93,8 @@ namespace FIX40
     class NoAllocs: public FIX::Group
     {
     public:
-    NoAllocs() : FIX::Group(78,79,FIX::message_order(79,80,81,76,109,12,13,85,92,86,0)) {}
+    NoAllocs() : FIX::Group(78,79,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(79,80,81,76,109,12,13,85,92,86,0); return instance; }
       FIELD_SET(*this, FIX::AllocAccount);
       FIELD_SET(*this, FIX::AllocShares);
       FIELD_SET(*this, FIX::ProcessCode);
@@ -90,7 +90,8 @@ namespace FIX40
     class NoMiscFees: public FIX::Group
     {
     public:
-    NoMiscFees() : FIX::Group(136,137,FIX::message_order(137,138,139,0)) {}
+    NoMiscFees() : FIX::Group(136,137,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(137,138,139,0); return instance; }
       FIELD_SET(*this, FIX::MiscFeeAmt);
       FIELD_SET(*this, FIX::MiscFeeCurr);
       FIELD_SET(*this, FIX::MiscFeeType);
@@ -34,7 +34,8 @@ namespace FIX40
     class NoOrders: public FIX::Group
     {
     public:
-    NoOrders() : FIX::Group(73,11,FIX::message_order(11,14,84,6,0)) {}
+    NoOrders() : FIX::Group(73,11,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(11,14,84,6,0); return instance; }
       FIELD_SET(*this, FIX::ClOrdID);
       FIELD_SET(*this, FIX::CumQty);
       FIELD_SET(*this, FIX::CxlQty);
@@ -61,7 +61,8 @@ namespace FIX41
     class NoIOIQualifiers: public FIX::Group
     {
     public:
-    NoIOIQualifiers() : FIX::Group(199,104,FIX::message_order(104,0)) {}
+    NoIOIQualifiers() : FIX::Group(199,104,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(104,0); return instance; }
       FIELD_SET(*this, FIX::IOIQualifier);
     };
   };
@@ -32,7 +32,8 @@ namespace FIX41
     class NoRelatedSym: public FIX::Group
     {
     public:
-    NoRelatedSym() : FIX::Group(146,46,FIX::message_order(46,65,48,22,167,200,205,201,202,206,207,106,107,0)) {}
+    NoRelatedSym() : FIX::Group(146,46,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(46,65,48,22,167,200,205,201,202,206,207,106,107,0); return instance; }
       FIELD_SET(*this, FIX::RelatdSym);
       FIELD_SET(*this, FIX::SymbolSfx);
       FIELD_SET(*this, FIX::SecurityID);
@@ -51,7 +52,8 @@ namespace FIX41
     class LinesOfText: public FIX::Group
     {
     public:
-    LinesOfText() : FIX::Group(33,58,FIX::message_order(58,0)) {}
+    LinesOfText() : FIX::Group(33,58,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(58,0); return instance; }
       FIELD_SET(*this, FIX::Text);
     };
   };
@@ -135,7 +135,8 @@ namespace FIX42
     class NoContraBrokers: public FIX::Group
     {
     public:
-    NoContraBrokers() : FIX::Group(382,375,FIX::message_order(375,337,437,438,0)) {}
+    NoContraBrokers() : FIX::Group(382,375,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(375,337,437,438,0); return instance; }
       FIELD_SET(*this, FIX::ContraBroker);
       FIELD_SET(*this, FIX::ContraTrader);
       FIELD_SET(*this, FIX::ContraTradeQty);
@@ -70,14 +70,16 @@ namespace FIX42
     class NoIOIQualifiers: public FIX::Group
     {
     public:
-    NoIOIQualifiers() : FIX::Group(199,104,FIX::message_order(104,0)) {}
+    NoIOIQualifiers() : FIX::Group(199,104,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(104,0); return instance; }
       FIELD_SET(*this, FIX::IOIQualifier);
     };
     FIELD_SET(*this, FIX::NoRoutingIDs);
     class NoRoutingIDs: public FIX::Group
     {
     public:
-    NoRoutingIDs() : FIX::Group(215,216,FIX::message_order(216,217,0)) {}
+    NoRoutingIDs() : FIX::Group(215,216,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(216,217,0); return instance; }
       FIELD_SET(*this, FIX::RoutingType);
       FIELD_SET(*this, FIX::RoutingID);
     };
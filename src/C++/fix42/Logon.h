@@ -34,7 +34,8 @@ namespace FIX42
     class NoMsgTypes: public FIX::Group
     {
     public:
-    NoMsgTypes() : FIX::Group(384,372,FIX::message_order(372,385,0)) {}
+    NoMsgTypes() : FIX::Group(384,372,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(372,385,0); return instance; }
       FIELD_SET(*this, FIX::RefMsgType);
       FIELD_SET(*this, FIX::MsgDirection);
     };
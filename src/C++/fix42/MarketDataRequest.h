@@ -35,14 +35,16 @@ namespace FIX42
     class NoMDEntryTypes: public FIX::Group
     {
     public:
-    NoMDEntryTypes() : FIX::Group(267,269,FIX::message_order(269,0)) {}
+    NoMDEntryTypes() : FIX::Group(267,269,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(269,0); return instance; }
       FIELD_SET(*this, FIX::MDEntryType);
     };
     FIELD_SET(*this, FIX::NoRelatedSym);
     class NoRelatedSym: public FIX::Group
     {
     public:
-    NoRelatedSym() : FIX::Group(146,55,FIX::message_order(55,65,48,22,167,200,205,201,202,206,231,223,207,106,348,349,107,350,351,336,0)) {}
+    NoRelatedSym() : FIX::Group(146,55,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(55,65,48,22,167,200,205,201,202,206,231,223,207,106,348,349,107,350,351,336,0); return instance; }
       FIELD_SET(*this, FIX::Symbol);
       FIELD_SET(*this, FIX::SymbolSfx);
       FIELD_SET(*this, FIX::SecurityID);
@@ -49,7 +49,8 @@ namespace FIX42
     class NoMDEntries: public FIX::Group
     {
     public:
-    NoMDEntries() : FIX::Group(268,269,FIX::message_order(269,270,15,271,272,273,274,275,336,276,277,282,283,284,286,59,432,126,110,18,287,37,299,288,289,346,290,58,354,355,0)) {}
+    NoMDEntries() : FIX::Group(268,269,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(269,270,15,271,272,273,274,275,336,276,277,282,283,284,286,59,432,126,110,18,287,37,299,288,289,346,290,58,354,355,0); return instance; }
       FIELD_SET(*this, FIX::MDEntryType);
       FIELD_SET(*this, FIX::MDEntryPx);
       FIELD_SET(*this, FIX::Currency);
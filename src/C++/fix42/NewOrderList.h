@@ -41,7 +41,8 @@ namespace FIX42
     class NoOrders: public FIX::Group
     {
     public:
-    NoOrders() : FIX::Group(73,11,FIX::message_order(11,67,160,109,76,1,78,63,64,21,18,110,111,100,386,81,55,65,48,22,167,200,205,201,202,206,231,223,207,106,348,349,107,350,351,140,54,401,114,60,38,152,40,44,99,15,376,377,23,117,59,168,432,126,427,12,13,47,121,120,58,354,355,193,192,77,203,204,210,211,388,389,439,440,0)) {}
+    NoOrders() : FIX::Group(73,11,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(11,67,160,109,76,1,78,63,64,21,18,110,111,100,386,81,55,65,48,22,167,200,205,201,202,206,231,223,207,106,348,349,107,350,351,140,54,401,114,60,38,152,40,44,99,15,376,377,23,117,59,168,432,126,427,12,13,47,121,120,58,354,355,193,192,77,203,204,210,211,388,389,439,440,0); return instance; }
       FIELD_SET(*this, FIX::ClOrdID);
       FIELD_SET(*this, FIX::ListSeqNo);
       FIELD_SET(*this, FIX::SettlInstMode);
@@ -118,7 +119,8 @@ namespace FIX42
       class NoAllocs: public FIX::Group
       {
       public:
-      NoAllocs() : FIX::Group(78,79,FIX::message_order(79,80,0)) {}
+      NoAllocs() : FIX::Group(78,79,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(79,80,0); return instance; }
         FIELD_SET(*this, FIX::AllocAccount);
         FIELD_SET(*this, FIX::AllocShares);
       };
@@ -126,7 +128,8 @@ namespace FIX42
       class NoTradingSessions: public FIX::Group
       {
       public:
-      NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,0)) {}
+      NoTradingSessions() : FIX::Group(386,336,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(336,0); return instance; }
         FIELD_SET(*this, FIX::TradingSessionID);
       };
     };
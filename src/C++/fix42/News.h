@@ -34,7 +34,8 @@ namespace FIX42
     class NoRoutingIDs: public FIX::Group
     {
     public:
-    NoRoutingIDs() : FIX::Group(215,216,FIX::message_order(216,217,0)) {}
+    NoRoutingIDs() : FIX::Group(215,216,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(216,217,0); return instance; }
       FIELD_SET(*this, FIX::RoutingType);
       FIELD_SET(*this, FIX::RoutingID);
     };
@@ -42,7 +43,8 @@ namespace FIX42
     class NoRelatedSym: public FIX::Group
     {
     public:
-    NoRelatedSym() : FIX::Group(146,46,FIX::message_order(46,65,48,22,167,200,205,201,202,206,231,223,207,106,348,349,107,350,351,0)) {}
+    NoRelatedSym() : FIX::Group(146,46,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(46,65,48,22,167,200,205,201,202,206,231,223,207,106,348,349,107,350,351,0); return instance; }
       FIELD_SET(*this, FIX::RelatdSym);
       FIELD_SET(*this, FIX::SymbolSfx);
       FIELD_SET(*this, FIX::SecurityID);
@@ -67,7 +69,8 @@ namespace FIX42
     class LinesOfText: public FIX::Group
     {
     public:
-    LinesOfText() : FIX::Group(33,58,FIX::message_order(58,354,355,0)) {}
+    LinesOfText() : FIX::Group(33,58,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(58,354,355,0); return instance; }
       FIELD_SET(*this, FIX::Text);
       FIELD_SET(*this, FIX::EncodedTextLen);
       FIELD_SET(*this, FIX::EncodedText);
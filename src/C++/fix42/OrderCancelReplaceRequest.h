@@ -106,7 +106,8 @@ namespace FIX42
     class NoAllocs: public FIX::Group
     {
     public:
-    NoAllocs() : FIX::Group(78,79,FIX::message_order(79,80,0)) {}
+    NoAllocs() : FIX::Group(78,79,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(79,80,0); return instance; }
       FIELD_SET(*this, FIX::AllocAccount);
       FIELD_SET(*this, FIX::AllocShares);
     };
@@ -114,7 +115,8 @@ namespace FIX42
     class NoTradingSessions: public FIX::Group
     {
     public:
-    NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,0)) {}
+    NoTradingSessions() : FIX::Group(386,336,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(336,0); return instance; }
       FIELD_SET(*this, FIX::TradingSessionID);
     };
   };
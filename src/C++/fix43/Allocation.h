@@ -78,7 +78,8 @@ namespace FIX43
     class NoSecurityAltID: public FIX::Group
     {
     public:
-    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+    NoSecurityAltID() : FIX::Group(454,455,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(455,456,0); return instance; }
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
     };
@@ -95,7 +96,8 @@ namespace FIX43
     class NoPartyIDs: public FIX::Group
     {
     public:
-    NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,523,0)) {}
+    NoPartyIDs() : FIX::Group(453,448,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(448,447,452,523,0); return instance; }
       FIELD_SET(*this, FIX::PartyID);
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
@@ -121,7 +123,8 @@ namespace FIX43
     class NoOrders: public FIX::Group
     {
     public:
-    NoOrders() : FIX::Group(73,11,FIX::message_order(11,37,198,526,66,0)) {}
+    NoOrders() : FIX::Group(73,11,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(11,37,198,526,66,0); return instance; }
       FIELD_SET(*this, FIX::ClOrdID);
       FIELD_SET(*this, FIX::OrderID);
       FIELD_SET(*this, FIX::SecondaryOrderID);
@@ -132,7 +135,8 @@ namespace FIX43
     class NoExecs: public FIX::Group
     {
     public:
-    NoExecs() : FIX::Group(124,32,FIX::message_order(32,17,527,31,29,0)) {}
+    NoExecs() : FIX::Group(124,32,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(32,17,527,31,29,0); return instance; }
       FIELD_SET(*this, FIX::LastQty);
       FIELD_SET(*this, FIX::ExecID);
       FIELD_SET(*this, FIX::SecondaryExecID);
@@ -143,7 +147,8 @@ namespace FIX43
     class NoAllocs: public FIX::Group
     {
     public:
-    NoAllocs() : FIX::Group(78,79,FIX::message_order(79,366,80,467,81,539,208,209,161,360,361,12,13,479,497,153,154,119,120,155,156,159,160,136,0)) {}
+    NoAllocs() : FIX::Group(78,79,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(79,366,80,467,81,539,208,209,161,360,361,12,13,479,497,153,154,119,120,155,156,159,160,136,0); return instance; }
       FIELD_SET(*this, FIX::AllocAccount);
       FIELD_SET(*this, FIX::AllocPrice);
       FIELD_SET(*this, FIX::AllocQty);
@@ -153,7 +158,8 @@ namespace FIX43
       class NoNestedPartyIDs: public FIX::Group
       {
       public:
-      NoNestedPartyIDs() : FIX::Group(539,524,FIX::message_order(524,525,538,545,0)) {}
+      NoNestedPartyIDs() : FIX::Group(539,524,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(524,525,538,545,0); return instance; }
         FIELD_SET(*this, FIX::NestedPartyID);
         FIELD_SET(*this, FIX::NestedPartyIDSource);
         FIELD_SET(*this, FIX::NestedPartyRole);
@@ -180,7 +186,8 @@ namespace FIX43
       class NoMiscFees: public FIX::Group
       {
       public:
-      NoMiscFees() : FIX::Group(136,137,FIX::message_order(137,138,139,0)) {}
+      NoMiscFees() : FIX::Group(136,137,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(137,138,139,0); return instance; }
         FIELD_SET(*this, FIX::MiscFeeAmt);
         FIELD_SET(*this, FIX::MiscFeeCurr);
         FIELD_SET(*this, FIX::MiscFeeType);
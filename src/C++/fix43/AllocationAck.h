@@ -30,7 +30,8 @@ namespace FIX43
     class NoPartyIDs: public FIX::Group
     {
     public:
-    NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,523,0)) {}
+    NoPartyIDs() : FIX::Group(453,448,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(448,447,452,523,0); return instance; }
       FIELD_SET(*this, FIX::PartyID);
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
@@ -71,7 +71,8 @@ namespace FIX43
     class NoSecurityAltID: public FIX::Group
     {
     public:
-    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+    NoSecurityAltID() : FIX::Group(454,455,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(455,456,0); return instance; }
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
     };
@@ -80,7 +81,8 @@ namespace FIX43
     class NoSides: public FIX::Group
     {
     public:
-    NoSides() : FIX::Group(552,54,FIX::message_order(54,41,11,526,583,586,453,229,38,152,516,468,469,376,58,354,355,0)) {}
+    NoSides() : FIX::Group(552,54,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(54,41,11,526,583,586,453,229,38,152,516,468,469,376,58,354,355,0); return instance; }
       FIELD_SET(*this, FIX::Side);
       FIELD_SET(*this, FIX::OrigClOrdID);
       FIELD_SET(*this, FIX::ClOrdID);
@@ -91,7 +93,8 @@ namespace FIX43
       class NoPartyIDs: public FIX::Group
       {
       public:
-      NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,523,0)) {}
+      NoPartyIDs() : FIX::Group(453,448,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(448,447,452,523,0); return instance; }
         FIELD_SET(*this, FIX::PartyID);
         FIELD_SET(*this, FIX::PartyIDSource);
         FIELD_SET(*this, FIX::PartyRole);
@@ -63,7 +63,8 @@ namespace FIX43
     class NoUnderlyingSecurityAltID: public FIX::Group
     {
     public:
-    NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
+    NoUnderlyingSecurityAltID() : FIX::Group(457,458,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(458,459,0); return instance; }
       FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
       FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
     };
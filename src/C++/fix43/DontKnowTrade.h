@@ -67,7 +67,8 @@ namespace FIX43
     class NoSecurityAltID: public FIX::Group
     {
     public:
-    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+    NoSecurityAltID() : FIX::Group(454,455,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(455,456,0); return instance; }
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
     };
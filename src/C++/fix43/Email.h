@@ -40,7 +40,8 @@ namespace FIX43
     class NoRoutingIDs: public FIX::Group
     {
     public:
-    NoRoutingIDs() : FIX::Group(215,216,FIX::message_order(216,217,0)) {}
+    NoRoutingIDs() : FIX::Group(215,216,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(216,217,0); return instance; }
       FIELD_SET(*this, FIX::RoutingType);
       FIELD_SET(*this, FIX::RoutingID);
     };
@@ -48,7 +49,8 @@ namespace FIX43
     class NoRelatedSym: public FIX::Group
     {
     public:
-    NoRelatedSym() : FIX::Group(146,55,FIX::message_order(55,65,48,22,454,460,461,167,200,541,224,225,239,226,227,228,255,543,470,471,472,240,202,206,231,223,207,106,348,349,107,350,351,0)) {}
+    NoRelatedSym() : FIX::Group(146,55,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(55,65,48,22,454,460,461,167,200,541,224,225,239,226,227,228,255,543,470,471,472,240,202,206,231,223,207,106,348,349,107,350,351,0); return instance; }
       FIELD_SET(*this, FIX::Symbol);
       FIELD_SET(*this, FIX::SymbolSfx);
       FIELD_SET(*this, FIX::SecurityID);
@@ -85,7 +87,8 @@ namespace FIX43
       class NoSecurityAltID: public FIX::Group
       {
       public:
-      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+      NoSecurityAltID() : FIX::Group(454,455,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(455,456,0); return instance; }
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
       };
@@ -94,7 +97,8 @@ namespace FIX43
     class LinesOfText: public FIX::Group
     {
     public:
-    LinesOfText() : FIX::Group(33,58,FIX::message_order(58,354,355,0)) {}
+    LinesOfText() : FIX::Group(33,58,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(58,354,355,0); return instance; }
       FIELD_SET(*this, FIX::Text);
       FIELD_SET(*this, FIX::EncodedTextLen);
       FIELD_SET(*this, FIX::EncodedText);
@@ -30,7 +30,8 @@ namespace FIX43
     class NoStrikes: public FIX::Group
     {
     public:
-    NoStrikes() : FIX::Group(428,55,FIX::message_order(55,65,48,22,454,460,461,167,200,541,224,225,239,226,227,228,255,543,470,471,472,240,202,206,231,223,207,106,348,349,107,350,351,140,11,526,54,44,15,58,354,355,0)) {}
+    NoStrikes() : FIX::Group(428,55,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(55,65,48,22,454,460,461,167,200,541,224,225,239,226,227,228,255,543,470,471,472,240,202,206,231,223,207,106,348,349,107,350,351,140,11,526,54,44,15,58,354,355,0); return instance; }
       FIELD_SET(*this, FIX::Symbol);
       FIELD_SET(*this, FIX::SymbolSfx);
       FIELD_SET(*this, FIX::SecurityID);
@@ -67,7 +68,8 @@ namespace FIX43
       class NoSecurityAltID: public FIX::Group
       {
       public:
-      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+      NoSecurityAltID() : FIX::Group(454,455,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(455,456,0); return instance; }
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
       };
@@ -38,14 +38,16 @@ namespace FIX43
     class NoMDEntryTypes: public FIX::Group
     {
     public:
-    NoMDEntryTypes() : FIX::Group(267,269,FIX::message_order(269,0)) {}
+    NoMDEntryTypes() : FIX::Group(267,269,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(269,0); return instance; }
       FIELD_SET(*this, FIX::MDEntryType);
     };
     FIELD_SET(*this, FIX::NoRelatedSym);
     class NoRelatedSym: public FIX::Group
     {
     public:
-    NoRelatedSym() : FIX::Group(146,55,FIX::message_order(55,65,48,22,454,460,461,167,200,541,224,225,239,226,227,228,255,543,470,471,472,240,202,206,231,223,207,106,348,349,107,350,351,0)) {}
+    NoRelatedSym() : FIX::Group(146,55,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(55,65,48,22,454,460,461,167,200,541,224,225,239,226,227,228,255,543,470,471,472,240,202,206,231,223,207,106,348,349,107,350,351,0); return instance; }
       FIELD_SET(*this, FIX::Symbol);
       FIELD_SET(*this, FIX::SymbolSfx);
       FIELD_SET(*this, FIX::SecurityID);
@@ -82,7 +84,8 @@ namespace FIX43
       class NoSecurityAltID: public FIX::Group
       {
       public:
-      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+      NoSecurityAltID() : FIX::Group(454,455,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(455,456,0); return instance; }
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
       };
@@ -91,7 +94,8 @@ namespace FIX43
     class NoTradingSessions: public FIX::Group
     {
     public:
-    NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,625,0)) {}
+    NoTradingSessions() : FIX::Group(386,336,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(336,625,0); return instance; }
       FIELD_SET(*this, FIX::TradingSessionID);
       FIELD_SET(*this, FIX::TradingSessionSubID);
     };
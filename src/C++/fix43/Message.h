@@ -40,7 +40,8 @@ namespace FIX43
     class NoHops: public FIX::Group
     {
     public:
-    NoHops() : FIX::Group(627,628,FIX::message_order(628,629,630,0)) {}
+    NoHops() : FIX::Group(627,628,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(628,629,630,0); return instance; }
       FIELD_SET(*this, FIX::HopCompID);
       FIELD_SET(*this, FIX::HopSendingTime);
       FIELD_SET(*this, FIX::HopRefID);
@@ -71,7 +71,8 @@ namespace FIX43
     class NoSecurityAltID: public FIX::Group
     {
     public:
-    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+    NoSecurityAltID() : FIX::Group(454,455,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(455,456,0); return instance; }
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
     };
@@ -90,7 +91,8 @@ namespace FIX43
     class NoStipulations: public FIX::Group
     {
     public:
-    NoStipulations() : FIX::Group(232,233,FIX::message_order(233,234,0)) {}
+    NoStipulations() : FIX::Group(232,233,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(233,234,0); return instance; }
       FIELD_SET(*this, FIX::StipulationType);
       FIELD_SET(*this, FIX::StipulationValue);
     };
@@ -128,7 +130,8 @@ namespace FIX43
     class NoSides: public FIX::Group
     {
     public:
-    NoSides() : FIX::Group(552,54,FIX::message_order(54,11,526,583,453,229,1,581,589,590,591,78,465,38,152,516,468,469,12,13,479,497,528,529,582,121,120,58,354,355,77,203,544,635,377,659,0)) {}
+    NoSides() : FIX::Group(552,54,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(54,11,526,583,453,229,1,581,589,590,591,78,465,38,152,516,468,469,12,13,479,497,528,529,582,121,120,58,354,355,77,203,544,635,377,659,0); return instance; }
       FIELD_SET(*this, FIX::Side);
       FIELD_SET(*this, FIX::ClOrdID);
       FIELD_SET(*this, FIX::SecondaryClOrdID);
@@ -137,7 +140,8 @@ namespace FIX43
       class NoPartyIDs: public FIX::Group
       {
       public:
-      NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,523,0)) {}
+      NoPartyIDs() : FIX::Group(453,448,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(448,447,452,523,0); return instance; }
         FIELD_SET(*this, FIX::PartyID);
         FIELD_SET(*this, FIX::PartyIDSource);
         FIELD_SET(*this, FIX::PartyRole);
@@ -177,14 +181,16 @@ namespace FIX43
       class NoAllocs: public FIX::Group
       {
       public:
-      NoAllocs() : FIX::Group(78,79,FIX::message_order(79,467,539,80,0)) {}
+      NoAllocs() : FIX::Group(78,79,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(79,467,539,80,0); return instance; }
         FIELD_SET(*this, FIX::AllocAccount);
         FIELD_SET(*this, FIX::IndividualAllocID);
         FIELD_SET(*this, FIX::NoNestedPartyIDs);
         class NoNestedPartyIDs: public FIX::Group
         {
         public:
-        NoNestedPartyIDs() : FIX::Group(539,524,FIX::message_order(524,525,538,545,0)) {}
+        NoNestedPartyIDs() : FIX::Group(539,524,order()) {}
+        static const FIX::message_order& order() { static const FIX::message_order instance(524,525,538,545,0); return instance; }
           FIELD_SET(*this, FIX::NestedPartyID);
           FIELD_SET(*this, FIX::NestedPartyIDSource);
           FIELD_SET(*this, FIX::NestedPartyRole);
@@ -197,7 +203,8 @@ namespace FIX43
     class NoTradingSessions: public FIX::Group
     {
     public:
-    NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,625,0)) {}
+    NoTradingSessions() : FIX::Group(386,336,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(336,625,0); return instance; }
       FIELD_SET(*this, FIX::TradingSessionID);
       FIELD_SET(*this, FIX::TradingSessionSubID);
     };
@@ -44,7 +44,8 @@ namespace FIX43
     class NoOrders: public FIX::Group
     {
     public:
-    NoOrders() : FIX::Group(73,11,FIX::message_order(11,526,67,583,160,453,229,1,581,589,590,591,78,63,64,544,635,21,18,110,111,100,386,81,55,65,48,22,454,460,461,167,200,541,224,225,239,226,227,228,255,543,470,471,472,240,202,206,231,223,207,106,348,349,107,350,351,140,54,401,114,60,232,465,38,152,516,468,469,40,423,44,99,218,220,221,222,235,236,15,376,377,23,117,59,168,432,126,427,12,13,479,497,528,529,582,47,121,120,58,354,355,193,192,640,77,203,210,211,388,389,494,158,159,118,0)) {}
+    NoOrders() : FIX::Group(73,11,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(11,526,67,583,160,453,229,1,581,589,590,591,78,63,64,544,635,21,18,110,111,100,386,81,55,65,48,22,454,460,461,167,200,541,224,225,239,226,227,228,255,543,470,471,472,240,202,206,231,223,207,106,348,349,107,350,351,140,54,401,114,60,232,465,38,152,516,468,469,40,423,44,99,218,220,221,222,235,236,15,376,377,23,117,59,168,432,126,427,12,13,479,497,528,529,582,47,121,120,58,354,355,193,192,640,77,203,210,211,388,389,494,158,159,118,0); return instance; }
       FIELD_SET(*this, FIX::ClOrdID);
       FIELD_SET(*this, FIX::SecondaryClOrdID);
       FIELD_SET(*this, FIX::ListSeqNo);
@@ -54,7 +55,8 @@ namespace FIX43
       class NoPartyIDs: public FIX::Group
       {
       public:
-      NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,523,0)) {}
+      NoPartyIDs() : FIX::Group(453,448,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(448,447,452,523,0); return instance; }
         FIELD_SET(*this, FIX::PartyID);
         FIELD_SET(*this, FIX::PartyIDSource);
         FIELD_SET(*this, FIX::PartyRole);
@@ -112,7 +114,8 @@ namespace FIX43
       class NoSecurityAltID: public FIX::Group
       {
       public:
-      NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+      NoSecurityAltID() : FIX::Group(454,455,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(455,456,0); return instance; }
         FIELD_SET(*this, FIX::SecurityAltID);
         FIELD_SET(*this, FIX::SecurityAltIDSource);
       };
@@ -125,7 +128,8 @@ namespace FIX43
       class NoStipulations: public FIX::Group
       {
       public:
-      NoStipulations() : FIX::Group(232,233,FIX::message_order(233,234,0)) {}
+      NoStipulations() : FIX::Group(232,233,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(233,234,0); return instance; }
         FIELD_SET(*this, FIX::StipulationType);
         FIELD_SET(*this, FIX::StipulationValue);
       };
@@ -185,14 +189,16 @@ namespace FIX43
       class NoAllocs: public FIX::Group
       {
       public:
-      NoAllocs() : FIX::Group(78,79,FIX::message_order(79,467,539,80,0)) {}
+      NoAllocs() : FIX::Group(78,79,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(79,467,539,80,0); return instance; }
         FIELD_SET(*this, FIX::AllocAccount);
         FIELD_SET(*this, FIX::IndividualAllocID);
         FIELD_SET(*this, FIX::NoNestedPartyIDs);
         class NoNestedPartyIDs: public FIX::Group
         {
         public:
-        NoNestedPartyIDs() : FIX::Group(539,524,FIX::message_order(524,525,538,545,0)) {}
+        NoNestedPartyIDs() : FIX::Group(539,524,order()) {}
+        static const FIX::message_order& order() { static const FIX::message_order instance(524,525,538,545,0); return instance; }
           FIELD_SET(*this, FIX::NestedPartyID);
           FIELD_SET(*this, FIX::NestedPartyIDSource);
           FIELD_SET(*this, FIX::NestedPartyRole);
@@ -204,7 +210,8 @@ namespace FIX43
       class NoTradingSessions: public FIX::Group
       {
       public:
-      NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,625,0)) {}
+      NoTradingSessions() : FIX::Group(386,336,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(336,625,0); return instance; }
         FIELD_SET(*this, FIX::TradingSessionID);
         FIELD_SET(*this, FIX::TradingSessionSubID);
       };
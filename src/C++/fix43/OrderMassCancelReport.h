@@ -72,7 +72,8 @@ namespace FIX43
     class NoSecurityAltID: public FIX::Group
     {
     public:
-    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+    NoSecurityAltID() : FIX::Group(454,455,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(455,456,0); return instance; }
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
     };
@@ -113,7 +114,8 @@ namespace FIX43
     class NoUnderlyingSecurityAltID: public FIX::Group
     {
     public:
-    NoUnderlyingSecurityAltID() : FIX::Group(457,458,FIX::message_order(458,459,0)) {}
+    NoUnderlyingSecurityAltID() : FIX::Group(457,458,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(458,459,0); return instance; }
       FIELD_SET(*this, FIX::UnderlyingSecurityAltID);
       FIELD_SET(*this, FIX::UnderlyingSecurityAltIDSource);
     };
@@ -126,7 +128,8 @@ namespace FIX43
     class NoAffectedOrders: public FIX::Group
     {
     public:
-    NoAffectedOrders() : FIX::Group(534,41,FIX::message_order(41,535,536,0)) {}
+    NoAffectedOrders() : FIX::Group(534,41,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(41,535,536,0); return instance; }
       FIELD_SET(*this, FIX::OrigClOrdID);
       FIELD_SET(*this, FIX::AffectedOrderID);
       FIELD_SET(*this, FIX::AffectedSecondaryOrderID);
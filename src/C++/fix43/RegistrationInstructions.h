@@ -34,7 +34,8 @@ namespace FIX43
     class NoPartyIDs: public FIX::Group
     {
     public:
-    NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,523,0)) {}
+    NoPartyIDs() : FIX::Group(453,448,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(448,447,452,523,0); return instance; }
       FIELD_SET(*this, FIX::PartyID);
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
@@ -48,7 +49,8 @@ namespace FIX43
     class NoRegistDtls: public FIX::Group
     {
     public:
-    NoRegistDtls() : FIX::Group(473,509,FIX::message_order(509,511,474,482,539,522,486,475,0)) {}
+    NoRegistDtls() : FIX::Group(473,509,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(509,511,474,482,539,522,486,475,0); return instance; }
       FIELD_SET(*this, FIX::RegistDetls);
       FIELD_SET(*this, FIX::RegistEmail);
       FIELD_SET(*this, FIX::MailingDtls);
@@ -57,7 +59,8 @@ namespace FIX43
       class NoNestedPartyIDs: public FIX::Group
       {
       public:
-      NoNestedPartyIDs() : FIX::Group(539,524,FIX::message_order(524,525,538,545,0)) {}
+      NoNestedPartyIDs() : FIX::Group(539,524,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(524,525,538,545,0); return instance; }
         FIELD_SET(*this, FIX::NestedPartyID);
         FIELD_SET(*this, FIX::NestedPartyIDSource);
         FIELD_SET(*this, FIX::NestedPartyRole);
@@ -71,7 +74,8 @@ namespace FIX43
     class NoDistribInsts: public FIX::Group
     {
     public:
-    NoDistribInsts() : FIX::Group(510,477,FIX::message_order(477,512,478,498,499,500,501,0)) {}
+    NoDistribInsts() : FIX::Group(510,477,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(477,512,478,498,499,500,501,0); return instance; }
       FIELD_SET(*this, FIX::DistribPaymentMethod);
       FIELD_SET(*this, FIX::DistribPercentage);
       FIELD_SET(*this, FIX::CashDistribCurr);
@@ -79,7 +79,8 @@ namespace FIX43
     class NoSecurityAltID: public FIX::Group
     {
     public:
-    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+    NoSecurityAltID() : FIX::Group(454,455,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(455,456,0); return instance; }
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
     };
@@ -103,7 +104,8 @@ namespace FIX43
     class NoSides: public FIX::Group
     {
     public:
-    NoSides() : FIX::Group(552,54,FIX::message_order(54,37,198,11,453,1,581,81,575,576,635,578,579,15,376,377,528,529,582,483,336,625,12,13,479,497,381,157,230,158,159,238,237,118,119,120,155,156,77,58,354,355,442,518,136,0)) {}
+    NoSides() : FIX::Group(552,54,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(54,37,198,11,453,1,581,81,575,576,635,578,579,15,376,377,528,529,582,483,336,625,12,13,479,497,381,157,230,158,159,238,237,118,119,120,155,156,77,58,354,355,442,518,136,0); return instance; }
       FIELD_SET(*this, FIX::Side);
       FIELD_SET(*this, FIX::OrderID);
       FIELD_SET(*this, FIX::SecondaryOrderID);
@@ -112,7 +114,8 @@ namespace FIX43
       class NoPartyIDs: public FIX::Group
       {
       public:
-      NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,523,0)) {}
+      NoPartyIDs() : FIX::Group(453,448,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(448,447,452,523,0); return instance; }
         FIELD_SET(*this, FIX::PartyID);
         FIELD_SET(*this, FIX::PartyIDSource);
         FIELD_SET(*this, FIX::PartyRole);
@@ -159,14 +162,16 @@ namespace FIX43
       class NoClearingInstructions: public FIX::Group
       {
       public:
-      NoClearingInstructions() : FIX::Group(576,577,FIX::message_order(577,0)) {}
+      NoClearingInstructions() : FIX::Group(576,577,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(577,0); return instance; }
         FIELD_SET(*this, FIX::ClearingInstruction);
       };
       FIELD_SET(*this, FIX::NoContAmts);
       class NoContAmts: public FIX::Group
       {
       public:
-      NoContAmts() : FIX::Group(518,519,FIX::message_order(519,520,521,0)) {}
+      NoContAmts() : FIX::Group(518,519,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(519,520,521,0); return instance; }
         FIELD_SET(*this, FIX::ContAmtType);
         FIELD_SET(*this, FIX::ContAmtValue);
         FIELD_SET(*this, FIX::ContAmtCurr);
@@ -175,7 +180,8 @@ namespace FIX43
       class NoMiscFees: public FIX::Group
       {
       public:
-      NoMiscFees() : FIX::Group(136,137,FIX::message_order(137,138,139,0)) {}
+      NoMiscFees() : FIX::Group(136,137,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(137,138,139,0); return instance; }
         FIELD_SET(*this, FIX::MiscFeeAmt);
         FIELD_SET(*this, FIX::MiscFeeCurr);
         FIELD_SET(*this, FIX::MiscFeeType);
@@ -35,7 +35,8 @@ namespace FIX43
     class NoPartyIDs: public FIX::Group
     {
     public:
-    NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,523,0)) {}
+    NoPartyIDs() : FIX::Group(453,448,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(448,447,452,523,0); return instance; }
       FIELD_SET(*this, FIX::PartyID);
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
@@ -77,7 +78,8 @@ namespace FIX43
     class NoSecurityAltID: public FIX::Group
     {
     public:
-    NoSecurityAltID() : FIX::Group(454,455,FIX::message_order(455,456,0)) {}
+    NoSecurityAltID() : FIX::Group(454,455,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(455,456,0); return instance; }
       FIELD_SET(*this, FIX::SecurityAltID);
       FIELD_SET(*this, FIX::SecurityAltIDSource);
     };
@@ -91,7 +93,8 @@ namespace FIX43
     class NoDates: public FIX::Group
     {
     public:
-    NoDates() : FIX::Group(580,75,FIX::message_order(75,60,0)) {}
+    NoDates() : FIX::Group(580,75,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(75,60,0); return instance; }
       FIELD_SET(*this, FIX::TradeDate);
       FIELD_SET(*this, FIX::TransactTime);
     };
@@ -51,7 +51,8 @@ namespace FIX44
     class NoOrders: public FIX::Group
     {
     public:
-    NoOrders() : FIX::Group(73,11,FIX::message_order(11,37,198,526,66,756,38,799,800,0)) {}
+    NoOrders() : FIX::Group(73,11,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(11,37,198,526,66,756,38,799,800,0); return instance; }
       FIELD_SET(*this, FIX::ClOrdID);
       FIELD_SET(*this, FIX::OrderID);
       FIELD_SET(*this, FIX::SecondaryOrderID);
@@ -61,7 +62,8 @@ namespace FIX44
       class NoNested2PartyIDs: public FIX::Group
       {
       public:
-      NoNested2PartyIDs() : FIX::Group(756,757,FIX::message_order(757,758,759,806,0)) {}
+      NoNested2PartyIDs() : FIX::Group(756,757,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(757,758,759,806,0); return instance; }
         FIELD_SET(*this, FIX::Nested2PartyID);
         FIELD_SET(*this, FIX::Nested2PartyIDSource);
         FIELD_SET(*this, FIX::Nested2PartyRole);
@@ -69,7 +71,8 @@ namespace FIX44
         class NoNested2PartySubIDs: public FIX::Group
         {
         public:
-        NoNested2PartySubIDs() : FIX::Group(806,760,FIX::message_order(760,807,0)) {}
+        NoNested2PartySubIDs() : FIX::Group(806,760,order()) {}
+        static const FIX::message_order& order() { static const FIX::message_order instance(760,807,0); return instance; }
           FIELD_SET(*this, FIX::Nested2PartySubID);
           FIELD_SET(*this, FIX::Nested2PartySubIDType);
         };
@@ -82,7 +85,8 @@ namespace FIX44
     class NoExecs: public FIX::Group
     {
     public:
-    NoExecs() : FIX::Group(124,32,FIX::message_order(32,17,527,31,669,29,0)) {}
+    NoExecs() : FIX::Group(124,32,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(32,17,527,31,669,29,0); return instance; }
       FIELD_SET(*this, FIX::LastQty);
       FIELD_SET(*this, FIX::ExecID);
       FIELD_SET(*this, FIX::SecondaryExecID);
@@ -150,7 +154,8 @@ namespace FIX44
     class NoUnderlyings: public FIX::Group
     {
     public:
-    NoUnderlyings() : FIX::Group(711,311,FIX::message_order(311,312,309,305,462,463,310,763,313,542,315,241,242,243,244,245,246,256,595,592,593,594,247,316,941,317,436,435,308,306,362,363,307,364,365,877,878,318,879,810,882,883,884,885,886,0)) {}
+    NoUnderlyings() : FIX::Group(711,311,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(311,312,309,305,462,463,310,763,313,542,315,241,242,243,244,245,246,256,595,592,593,594,247,316,941,317,436,435,308,306,362,363,307,364,365,877,878,318,879,810,882,883,884,885,886,0); return instance; }
       FIELD_SET(*this, FIX::UnderlyingSymbol);
       FIELD_SET(*this, FIX::UnderlyingSymbolSfx);
       FIELD_SET(*this, FIX::UnderlyingSecurityID);
@@ -201,7 +206,8 @@ namespace FIX44
     class NoLegs: public FIX::Group
     {
     public:
-    NoLegs() : FIX::Group(555,600,FIX::message_order(600,601,602,603,607,608,609,764,610,611,248,249,250,251,252,253,257,599,596,597,598,254,612,942,613,614,615,616,617,618,619,620,621,622,623,624,556,740,739,955,956,0)) {}
+    NoLegs() : FIX::Group(555,600,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(600,601,602,603,607,608,609,764,610,611,248,249,250,251,252,253,257,599,596,597,598,254,612,942,613,614,615,616,617,618,619,620,621,622,623,624,556,740,739,955,956,0); return instance; }
       FIELD_SET(*this, FIX::LegSymbol);
       FIELD_SET(*this, FIX::LegSymbolSfx);
       FIELD_SET(*this, FIX::LegSecurityID);
@@ -267,7 +273,8 @@ namespace FIX44
     class NoPartyIDs: public FIX::Group
     {
     public:
-    NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,802,0)) {}
+    NoPartyIDs() : FIX::Group(453,448,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(448,447,452,802,0); return instance; }
       FIELD_SET(*this, FIX::PartyID);
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
@@ -275,7 +282,8 @@ namespace FIX44
       class NoPartySubIDs: public FIX::Group
       {
       public:
-      NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
+      NoPartySubIDs() : FIX::Group(802,523,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(523,803,0); return instance; }
         FIELD_SET(*this, FIX::PartySubID);
         FIELD_SET(*this, FIX::PartySubIDType);
       };
@@ -307,7 +315,8 @@ namespace FIX44
     class NoStipulations: public FIX::Group
     {
     public:
-    NoStipulations() : FIX::Group(232,233,FIX::message_order(233,234,0)) {}
+    NoStipulations() : FIX::Group(232,233,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(233,234,0); return instance; }
       FIELD_SET(*this, FIX::StipulationType);
       FIELD_SET(*this, FIX::StipulationValue);
     };
@@ -323,7 +332,8 @@ namespace FIX44
     class NoAllocs: public FIX::Group
     {
     public:
-    NoAllocs() : FIX::Group(78,79,FIX::message_order(79,661,573,366,80,467,81,539,208,209,161,360,361,12,13,479,497,153,154,119,737,120,736,155,156,742,741,136,576,780,172,169,170,171,0)) {}
+    NoAllocs() : FIX::Group(78,79,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(79,661,573,366,80,467,81,539,208,209,161,360,361,12,13,479,497,153,154,119,737,120,736,155,156,742,741,136,576,780,172,169,170,171,0); return instance; }
       FIELD_SET(*this, FIX::AllocAccount);
       FIELD_SET(*this, FIX::AllocAcctIDSource);
       FIELD_SET(*this, FIX::MatchStatus);
@@ -335,7 +345,8 @@ namespace FIX44
       class NoNestedPartyIDs: public FIX::Group
       {
       public:
-      NoNestedPartyIDs() : FIX::Group(539,524,FIX::message_order(524,525,538,804,0)) {}
+      NoNestedPartyIDs() : FIX::Group(539,524,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(524,525,538,804,0); return instance; }
         FIELD_SET(*this, FIX::NestedPartyID);
         FIELD_SET(*this, FIX::NestedPartyIDSource);
         FIELD_SET(*this, FIX::NestedPartyRole);
@@ -343,7 +354,8 @@ namespace FIX44
         class NoNestedPartySubIDs: public FIX::Group
         {
         public:
-        NoNestedPartySubIDs() : FIX::Group(804,545,FIX::message_order(545,805,0)) {}
+        NoNestedPartySubIDs() : FIX::Group(804,545,order()) {}
+        static const FIX::message_order& order() { static const FIX::message_order instance(545,805,0); return instance; }
           FIELD_SET(*this, FIX::NestedPartySubID);
           FIELD_SET(*this, FIX::NestedPartySubIDType);
         };
@@ -371,7 +383,8 @@ namespace FIX44
       class NoMiscFees: public FIX::Group
       {
       public:
-      NoMiscFees() : FIX::Group(136,137,FIX::message_order(137,138,139,891,0)) {}
+      NoMiscFees() : FIX::Group(136,137,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(137,138,139,891,0); return instance; }
         FIELD_SET(*this, FIX::MiscFeeAmt);
         FIELD_SET(*this, FIX::MiscFeeCurr);
         FIELD_SET(*this, FIX::MiscFeeType);
@@ -381,7 +394,8 @@ namespace FIX44
       class NoClearingInstructions: public FIX::Group
       {
       public:
-      NoClearingInstructions() : FIX::Group(576,577,FIX::message_order(577,0)) {}
+      NoClearingInstructions() : FIX::Group(576,577,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(577,0); return instance; }
         FIELD_SET(*this, FIX::ClearingInstruction);
       };
       FIELD_SET(*this, FIX::AllocSettlInstType);
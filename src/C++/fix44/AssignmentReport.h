@@ -49,7 +49,8 @@ namespace FIX44
     class NoPartyIDs: public FIX::Group
     {
     public:
-    NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,802,0)) {}
+    NoPartyIDs() : FIX::Group(453,448,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(448,447,452,802,0); return instance; }
       FIELD_SET(*this, FIX::PartyID);
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
@@ -57,7 +58,8 @@ namespace FIX44
       class NoPartySubIDs: public FIX::Group
       {
       public:
-      NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
+      NoPartySubIDs() : FIX::Group(802,523,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(523,803,0); return instance; }
         FIELD_SET(*this, FIX::PartySubID);
         FIELD_SET(*this, FIX::PartySubIDType);
       };
@@ -110,7 +112,8 @@ namespace FIX44
     class NoLegs: public FIX::Group
     {
     public:
-    NoLegs() : FIX::Group(555,600,FIX::message_order(600,601,602,603,607,608,609,764,610,611,248,249,250,251,252,253,257,599,596,597,598,254,612,942,613,614,615,616,617,618,619,620,621,622,623,624,556,740,739,955,956,0)) {}
+    NoLegs() : FIX::Group(555,600,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(600,601,602,603,607,608,609,764,610,611,248,249,250,251,252,253,257,599,596,597,598,254,612,942,613,614,615,616,617,618,619,620,621,622,623,624,556,740,739,955,956,0); return instance; }
       FIELD_SET(*this, FIX::LegSymbol);
       FIELD_SET(*this, FIX::LegSymbolSfx);
       FIELD_SET(*this, FIX::LegSecurityID);
@@ -157,7 +160,8 @@ namespace FIX44
     class NoUnderlyings: public FIX::Group
     {
     public:
-    NoUnderlyings() : FIX::Group(711,311,FIX::message_order(311,312,309,305,462,463,310,763,313,542,315,241,242,243,244,245,246,256,595,592,593,594,247,316,941,317,436,435,308,306,362,363,307,364,365,877,878,318,879,810,882,883,884,885,886,0)) {}
+    NoUnderlyings() : FIX::Group(711,311,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(311,312,309,305,462,463,310,763,313,542,315,241,242,243,244,245,246,256,595,592,593,594,247,316,941,317,436,435,308,306,362,363,307,364,365,877,878,318,879,810,882,883,884,885,886,0); return instance; }
       FIELD_SET(*this, FIX::UnderlyingSymbol);
       FIELD_SET(*this, FIX::UnderlyingSymbolSfx);
       FIELD_SET(*this, FIX::UnderlyingSecurityID);
@@ -208,7 +212,8 @@ namespace FIX44
     class NoPositions: public FIX::Group
     {
     public:
-    NoPositions() : FIX::Group(702,703,FIX::message_order(703,704,705,706,539,0)) {}
+    NoPositions() : FIX::Group(702,703,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(703,704,705,706,539,0); return instance; }
       FIELD_SET(*this, FIX::PosType);
       FIELD_SET(*this, FIX::LongQty);
       FIELD_SET(*this, FIX::ShortQty);
@@ -217,7 +222,8 @@ namespace FIX44
       class NoNestedPartyIDs: public FIX::Group
       {
       public:
-      NoNestedPartyIDs() : FIX::Group(539,524,FIX::message_order(524,525,538,804,0)) {}
+      NoNestedPartyIDs() : FIX::Group(539,524,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(524,525,538,804,0); return instance; }
         FIELD_SET(*this, FIX::NestedPartyID);
         FIELD_SET(*this, FIX::NestedPartyIDSource);
         FIELD_SET(*this, FIX::NestedPartyRole);
@@ -225,7 +231,8 @@ namespace FIX44
         class NoNestedPartySubIDs: public FIX::Group
         {
         public:
-        NoNestedPartySubIDs() : FIX::Group(804,545,FIX::message_order(545,805,0)) {}
+        NoNestedPartySubIDs() : FIX::Group(804,545,order()) {}
+        static const FIX::message_order& order() { static const FIX::message_order instance(545,805,0); return instance; }
           FIELD_SET(*this, FIX::NestedPartySubID);
           FIELD_SET(*this, FIX::NestedPartySubIDType);
         };
@@ -235,7 +242,8 @@ namespace FIX44
     class NoPosAmt: public FIX::Group
     {
     public:
-    NoPosAmt() : FIX::Group(753,707,FIX::message_order(707,708,0)) {}
+    NoPosAmt() : FIX::Group(753,707,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(707,708,0); return instance; }
       FIELD_SET(*this, FIX::PosAmtType);
       FIELD_SET(*this, FIX::PosAmt);
     };
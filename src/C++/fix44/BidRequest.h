@@ -46,7 +46,8 @@ namespace FIX44
     class NoBidDescriptors: public FIX::Group
     {
     public:
-    NoBidDescriptors() : FIX::Group(398,399,FIX::message_order(399,400,401,404,441,402,403,405,406,407,408,0)) {}
+    NoBidDescriptors() : FIX::Group(398,399,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(399,400,401,404,441,402,403,405,406,407,408,0); return instance; }
       FIELD_SET(*this, FIX::BidDescriptorType);
       FIELD_SET(*this, FIX::BidDescriptor);
       FIELD_SET(*this, FIX::SideValueInd);
@@ -63,7 +64,8 @@ namespace FIX44
     class NoBidComponents: public FIX::Group
     {
     public:
-    NoBidComponents() : FIX::Group(420,66,FIX::message_order(66,54,336,625,430,63,64,1,660,0)) {}
+    NoBidComponents() : FIX::Group(420,66,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(66,54,336,625,430,63,64,1,660,0); return instance; }
       FIELD_SET(*this, FIX::ListID);
       FIELD_SET(*this, FIX::Side);
       FIELD_SET(*this, FIX::TradingSessionID);
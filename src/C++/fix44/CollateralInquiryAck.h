@@ -31,7 +31,8 @@ namespace FIX44
     class NoCollInquiryQualifier: public FIX::Group
     {
     public:
-    NoCollInquiryQualifier() : FIX::Group(938,896,FIX::message_order(896,0)) {}
+    NoCollInquiryQualifier() : FIX::Group(938,896,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(896,0); return instance; }
       FIELD_SET(*this, FIX::CollInquiryQualifier);
     };
     FIELD_SET(*this, FIX::TotNumReports);
@@ -39,7 +40,8 @@ namespace FIX44
     class NoPartyIDs: public FIX::Group
     {
     public:
-    NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,802,0)) {}
+    NoPartyIDs() : FIX::Group(453,448,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(448,447,452,802,0); return instance; }
       FIELD_SET(*this, FIX::PartyID);
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
@@ -47,7 +49,8 @@ namespace FIX44
       class NoPartySubIDs: public FIX::Group
       {
       public:
-      NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
+      NoPartySubIDs() : FIX::Group(802,523,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(523,803,0); return instance; }
         FIELD_SET(*this, FIX::PartySubID);
         FIELD_SET(*this, FIX::PartySubIDType);
       };
@@ -62,14 +65,16 @@ namespace FIX44
     class NoExecs: public FIX::Group
     {
     public:
-    NoExecs() : FIX::Group(124,17,FIX::message_order(17,0)) {}
+    NoExecs() : FIX::Group(124,17,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(17,0); return instance; }
       FIELD_SET(*this, FIX::ExecID);
     };
     FIELD_SET(*this, FIX::NoTrades);
     class NoTrades: public FIX::Group
     {
     public:
-    NoTrades() : FIX::Group(897,571,FIX::message_order(571,818,0)) {}
+    NoTrades() : FIX::Group(897,571,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(571,818,0); return instance; }
       FIELD_SET(*this, FIX::TradeReportID);
       FIELD_SET(*this, FIX::SecondaryTradeReportID);
     };
@@ -131,7 +136,8 @@ namespace FIX44
     class NoLegs: public FIX::Group
     {
     public:
-    NoLegs() : FIX::Group(555,600,FIX::message_order(600,601,602,603,607,608,609,764,610,611,248,249,250,251,252,253,257,599,596,597,598,254,612,942,613,614,615,616,617,618,619,620,621,622,623,624,556,740,739,955,956,0)) {}
+    NoLegs() : FIX::Group(555,600,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(600,601,602,603,607,608,609,764,610,611,248,249,250,251,252,253,257,599,596,597,598,254,612,942,613,614,615,616,617,618,619,620,621,622,623,624,556,740,739,955,956,0); return instance; }
       FIELD_SET(*this, FIX::LegSymbol);
       FIELD_SET(*this, FIX::LegSymbolSfx);
       FIELD_SET(*this, FIX::LegSecurityID);
@@ -178,7 +184,8 @@ namespace FIX44
     class NoUnderlyings: public FIX::Group
     {
     public:
-    NoUnderlyings() : FIX::Group(711,311,FIX::message_order(311,312,309,305,462,463,310,763,313,542,315,241,242,243,244,245,246,256,595,592,593,594,247,316,941,317,436,435,308,306,362,363,307,364,365,877,878,318,879,810,882,883,884,885,886,0)) {}
+    NoUnderlyings() : FIX::Group(711,311,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(311,312,309,305,462,463,310,763,313,542,315,241,242,243,244,245,246,256,595,592,593,594,247,316,941,317,436,435,308,306,362,363,307,364,365,877,878,318,879,810,882,883,884,885,886,0); return instance; }
       FIELD_SET(*this, FIX::UnderlyingSymbol);
       FIELD_SET(*this, FIX::UnderlyingSymbolSfx);
       FIELD_SET(*this, FIX::UnderlyingSecurityID);
@@ -0,0 +1,3323 @@
+#ifndef FIX44_EXECUTIONREPORTDECODER_H
+#define FIX44_EXECUTIONREPORTDECODER_H
+
+#include "../FlyweightDecoder.h"
+#include "Message.h"
+
+namespace FIX44
+{
+
+  /// Decodes a raw ExecutionReport in a single pass without building a FIX::Message.
+  /// Values point into the decoded buffer, which must outlive the decoder.
+  class ExecutionReportDecoder
+  {
+  public:
+    class NoPartyIDs
+    {
+    public:
+      class NoPartySubIDs
+      {
+      public:
+        void decode( FIX::FieldCursor& cursor )
+        {
+          do
+          {
+            switch( cursor.tag() )
+            {
+            case 523:
+              m_present.set( 0 );
+              m_PartySubID = cursor.value();
+              break;
+            case 803:
+              m_present.set( 1 );
+              m_PartySubIDType = cursor.getInt();
+              break;
+            default:
+              return;
+            }
+            cursor.next();
+          }
+          while( cursor.valid() && cursor.tag() != 523 );
+        }
+
+        void clear()
+        {
+          m_present.reset();
+        }
+        bool isSetPartySubID() const { return m_present[ 0 ]; }
+        const FIX::FieldView& getPartySubID() const
+        { if( !m_present[ 0 ] ) throw FIX::FieldNotFound( FIX::FIELD::PartySubID ); return m_PartySubID; }
+        bool isSetPartySubIDType() const { return m_present[ 1 ]; }
+        int getPartySubIDType() const
+        { if( !m_present[ 1 ] ) throw FIX::FieldNotFound( FIX::FIELD::PartySubIDType ); return m_PartySubIDType; }
+
+      private:
+        std::bitset< 2 > m_present;
+        FIX::FieldView m_PartySubID;
+        int m_PartySubIDType;
+      };
+      typedef FIX::InlineVector< NoPartySubIDs, 2 > NoPartySubIDsEntries;
+
+      void decode( FIX::FieldCursor& cursor )
+      {
+        do
+        {
+          switch( cursor.tag() )
+          {
+          case 448:
+            m_present.set( 0 );
+            m_PartyID = cursor.value();
+            break;
+          case 447:
+            m_present.set( 1 );
+            m_PartyIDSource = cursor.getChar();
+            break;
+          case 452:
+            m_present.set( 2 );
+            m_PartyRole = cursor.getInt();
+            break;
+          case 802:
+            m_present.set( 3 );
+            FIX::decodeGroups( cursor, m_NoPartySubIDs, 802, 523 );
+            continue;
+          default:
+            return;
+          }
+          cursor.next();
+        }
+        while( cursor.valid() && cursor.tag() != 448 );
+      }
+
+      void clear()
+      {
+        m_present.reset();
+        m_NoPartySubIDs.clear();
+      }
+      bool isSetPartyID() const { return m_present[ 0 ]; }
+      const FIX::FieldView& getPartyID() const
+      { if( !m_present[ 0 ] ) throw FIX::FieldNotFound( FIX::FIELD::PartyID ); return m_PartyID; }
+      bool isSetPartyIDSource() const { return m_present[ 1 ]; }
+      char getPartyIDSource() const
+      { if( !m_present[ 1 ] ) throw FIX::FieldNotFound( FIX::FIELD::PartyIDSource ); return m_PartyIDSource; }
+      bool isSetPartyRole() const { return m_present[ 2 ]; }
+      int getPartyRole() const
+      { if( !m_present[ 2 ] ) throw FIX::FieldNotFound( FIX::FIELD::PartyRole ); return m_PartyRole; }
+      bool isSetNoPartySubIDs() const { return m_present[ 3 ]; }
+      const NoPartySubIDsEntries& getNoPartySubIDs() const { return m_NoPartySubIDs; }
+
+    private:
+      std::bitset< 4 > m_present;
+      FIX::FieldView m_PartyID;
+      char m_PartyIDSource;
+      int m_PartyRole;
+      NoPartySubIDsEntries m_NoPartySubIDs;
+    };
+    typedef FIX::InlineVector< NoPartyIDs, 8 > NoPartyIDsEntries;
+
+    class NoContraBrokers
+    {
+    public:
+      void decode( FIX::FieldCursor& cursor )
+      {
+        do
+        {
+          switch( cursor.tag() )
+          {
+          case 375:
+            m_present.set( 0 );
+            m_ContraBroker = cursor.value();
+            break;
+          case 337:
+            m_present.set( 1 );
+            m_ContraTrader = cursor.value();
+            break;
+          case 437:
+            m_present.set( 2 );
+            m_ContraTradeQty = cursor.getDouble();
+            break;
+          case 438:
+            m_present.set( 3 );
+            m_ContraTradeTime = cursor.value();
+            break;
+          case 655:
+            m_present.set( 4 );
+            m_ContraLegRefID = cursor.value();
+            break;
+          default:
+            return;
+          }
+          cursor.next();
+        }
+        while( cursor.valid() && cursor.tag() != 375 );
+      }
+
+      void clear()
+      {
+        m_present.reset();
+      }
+      bool isSetContraBroker() const { return m_present[ 0 ]; }
+      const FIX::FieldView& getContraBroker() const
+      { if( !m_present[ 0 ] ) throw FIX::FieldNotFound( FIX::FIELD::ContraBroker ); return m_ContraBroker; }
+      bool isSetContraTrader() const { return m_present[ 1 ]; }
+      const FIX::FieldView& getContraTrader() const
+      { if( !m_present[ 1 ] ) throw FIX::FieldNotFound( FIX::FIELD::ContraTrader ); return m_ContraTrader; }
+      bool isSetContraTradeQty() const { return m_present[ 2 ]; }
+      double getContraTradeQty() const
+      { if( !m_present[ 2 ] ) throw FIX::FieldNotFound( FIX::FIELD::ContraTradeQty ); return m_ContraTradeQty; }
+      bool isSetContraTradeTime() const { return m_present[ 3 ]; }
+      const FIX::FieldView& getContraTradeTime() const
+      { if( !m_present[ 3 ] ) throw FIX::FieldNotFound( FIX::FIELD::ContraTradeTime ); return m_ContraTradeTime; }
+      bool isSetContraLegRefID() const { return m_present[ 4 ]; }
+      const FIX::FieldView& getContraLegRefID() const
+      { if( !m_present[ 4 ] ) throw FIX::FieldNotFound( FIX::FIELD::ContraLegRefID ); return m_ContraLegRefID; }
+
+    private:
+      std::bitset< 5 > m_present;
+      FIX::FieldView m_ContraBroker;
+      FIX::FieldView m_ContraTrader;
+      double m_ContraTradeQty;
+      FIX::FieldView m_ContraTradeTime;
+      FIX::FieldView m_ContraLegRefID;
+    };
+    typedef FIX::InlineVector< NoContraBrokers, 8 > NoContraBrokersEntries;
+
+    class NoUnderlyings
+    {
+    public:
+      void decode( FIX::FieldCursor& cursor )
+      {
+        do
+        {
+          switch( cursor.tag() )
+          {
+          case 311:
+            m_present.set( 0 );
+            m_UnderlyingSymbol = cursor.value();
+            break;
+          case 312:
+            m_present.set( 1 );
+            m_UnderlyingSymbolSfx = cursor.value();
+            break;
+          case 309:
+            m_present.set( 2 );
+            m_UnderlyingSecurityID = cursor.value();
+            break;
+          case 305:
+            m_present.set( 3 );
+            m_UnderlyingSecurityIDSource = cursor.value();
+            break;
+          case 462:
+            m_present.set( 4 );
+            m_UnderlyingProduct = cursor.getInt();
+            break;
+          case 463:
+            m_present.set( 5 );
+            m_UnderlyingCFICode = cursor.value();
+            break;
+          case 310:
+            m_present.set( 6 );
+            m_UnderlyingSecurityType = cursor.value();
+            break;
+          case 763:
+            m_present.set( 7 );
+            m_UnderlyingSecuritySubType = cursor.value();
+            break;
+          case 313:
+            m_present.set( 8 );
+            m_UnderlyingMaturityMonthYear = cursor.value();
+            break;
+          case 542:
+            m_present.set( 9 );
+            m_UnderlyingMaturityDate = cursor.value();
+            break;
+          case 315:
+            m_present.set( 10 );
+            m_UnderlyingPutOrCall = cursor.getInt();
+            break;
+          case 241:
+            m_present.set( 11 );
+            m_UnderlyingCouponPaymentDate = cursor.value();
+            break;
+          case 242:
+            m_present.set( 12 );
+            m_UnderlyingIssueDate = cursor.value();
+            break;
+          case 243:
+            m_present.set( 13 );
+            m_UnderlyingRepoCollateralSecurityType = cursor.value();
+            break;
+          case 244:
+            m_present.set( 14 );
+            m_UnderlyingRepurchaseTerm = cursor.getInt();
+            break;
+          case 245:
+            m_present.set( 15 );
+            m_UnderlyingRepurchaseRate = cursor.getDouble();
+            break;
+          case 246:
+            m_present.set( 16 );
+            m_UnderlyingFactor = cursor.getDouble();
+            break;
+          case 256:
+            m_present.set( 17 );
+            m_UnderlyingCreditRating = cursor.value();
+            break;
+          case 595:
+            m_present.set( 18 );
+            m_UnderlyingInstrRegistry = cursor.value();
+            break;
+          case 592:
+            m_present.set( 19 );
+            m_UnderlyingCountryOfIssue = cursor.value();
+            break;
+          case 593:
+            m_present.set( 20 );
+            m_UnderlyingStateOrProvinceOfIssue = cursor.value();
+            break;
+          case 594:
+            m_present.set( 21 );
+            m_UnderlyingLocaleOfIssue = cursor.value();
+            break;
+          case 247:
+            m_present.set( 22 );
+            m_UnderlyingRedemptionDate = cursor.value();
+            break;
+          case 316:
+            m_present.set( 23 );
+            m_UnderlyingStrikePrice = cursor.getDouble();
+            break;
+          case 941:
+            m_present.set( 24 );
+            m_UnderlyingStrikeCurrency = cursor.value();
+            break;
+          case 317:
+            m_present.set( 25 );
+            m_UnderlyingOptAttribute = cursor.getChar();
+            break;
+          case 436:
+            m_present.set( 26 );
+            m_UnderlyingContractMultiplier = cursor.getDouble();
+            break;
+          case 435:
+            m_present.set( 27 );
+            m_UnderlyingCouponRate = cursor.getDouble();
+            break;
+          case 308:
+            m_present.set( 28 );
+            m_UnderlyingSecurityExchange = cursor.value();
+            break;
+          case 306:
+            m_present.set( 29 );
+            m_UnderlyingIssuer = cursor.value();
+            break;
+          case 362:
+            m_present.set( 30 );
+            m_EncodedUnderlyingIssuerLen = cursor.getInt();
+            cursor.setDataLength( 363, m_EncodedUnderlyingIssuerLen );
+            break;
+          case 363:
+            m_present.set( 31 );
+            m_EncodedUnderlyingIssuer = cursor.value();
+            break;
+          case 307:
+            m_present.set( 32 );
+            m_UnderlyingSecurityDesc = cursor.value();
+            break;
+          case 364:
+            m_present.set( 33 );
+            m_EncodedUnderlyingSecurityDescLen = cursor.getInt();
+            cursor.setDataLength( 365, m_EncodedUnderlyingSecurityDescLen );
+            break;
+          case 365:
+            m_present.set( 34 );
+            m_EncodedUnderlyingSecurityDesc = cursor.value();
+            break;
+          case 877:
+            m_present.set( 35 );
+            m_UnderlyingCPProgram = cursor.value();
+            break;
+          case 878:
+            m_present.set( 36 );
+            m_UnderlyingCPRegType = cursor.value();
+            break;
+          case 318:
+            m_present.set( 37 );
+            m_UnderlyingCurrency = cursor.value();
+            break;
+          case 879:
+            m_present.set( 38 );
+            m_UnderlyingQty = cursor.getDouble();
+            break;
+          case 810:
+            m_present.set( 39 );
+            m_UnderlyingPx = cursor.getDouble();
+            break;
+          case 882:
+            m_present.set( 40 );
+            m_UnderlyingDirtyPrice = cursor.getDouble();
+            break;
+          case 883:
+            m_present.set( 41 );
+            m_UnderlyingEndPrice = cursor.getDouble();
+            break;
+          case 884:
+            m_present.set( 42 );
+            m_UnderlyingStartValue = cursor.getDouble();
+            break;
+          case 885:
+            m_present.set( 43 );
+            m_UnderlyingCurrentValue = cursor.getDouble();
+            break;
+          case 886:
+            m_present.set( 44 );
+            m_UnderlyingEndValue = cursor.getDouble();
+            break;
+          default:
+            return;
+          }
+          cursor.next();
+        }
+        while( cursor.valid() && cursor.tag() != 311 );
+      }
+
+      void clear()
+      {
+        m_present.reset();
+      }
+      bool isSetUnderlyingSymbol() const { return m_present[ 0 ]; }
+      const FIX::FieldView& getUnderlyingSymbol() const
+      { if( !m_present[ 0 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingSymbol ); return m_UnderlyingSymbol; }
+      bool isSetUnderlyingSymbolSfx() const { return m_present[ 1 ]; }
+      const FIX::FieldView& getUnderlyingSymbolSfx() const
+      { if( !m_present[ 1 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingSymbolSfx ); return m_UnderlyingSymbolSfx; }
+      bool isSetUnderlyingSecurityID() const { return m_present[ 2 ]; }
+      const FIX::FieldView& getUnderlyingSecurityID() const
+      { if( !m_present[ 2 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingSecurityID ); return m_UnderlyingSecurityID; }
+      bool isSetUnderlyingSecurityIDSource() const { return m_present[ 3 ]; }
+      const FIX::FieldView& getUnderlyingSecurityIDSource() const
+      { if( !m_present[ 3 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingSecurityIDSource ); return m_UnderlyingSecurityIDSource; }
+      bool isSetUnderlyingProduct() const { return m_present[ 4 ]; }
+      int getUnderlyingProduct() const
+      { if( !m_present[ 4 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingProduct ); return m_UnderlyingProduct; }
+      bool isSetUnderlyingCFICode() const { return m_present[ 5 ]; }
+      const FIX::FieldView& getUnderlyingCFICode() const
+      { if( !m_present[ 5 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingCFICode ); return m_UnderlyingCFICode; }
+      bool isSetUnderlyingSecurityType() const { return m_present[ 6 ]; }
+      const FIX::FieldView& getUnderlyingSecurityType() const
+      { if( !m_present[ 6 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingSecurityType ); return m_UnderlyingSecurityType; }
+      bool isSetUnderlyingSecuritySubType() const { return m_present[ 7 ]; }
+      const FIX::FieldView& getUnderlyingSecuritySubType() const
+      { if( !m_present[ 7 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingSecuritySubType ); return m_UnderlyingSecuritySubType; }
+      bool isSetUnderlyingMaturityMonthYear() const { return m_present[ 8 ]; }
+      const FIX::FieldView& getUnderlyingMaturityMonthYear() const
+      { if( !m_present[ 8 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingMaturityMonthYear ); return m_UnderlyingMaturityMonthYear; }
+      bool isSetUnderlyingMaturityDate() const { return m_present[ 9 ]; }
+      const FIX::FieldView& getUnderlyingMaturityDate() const
+      { if( !m_present[ 9 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingMaturityDate ); return m_UnderlyingMaturityDate; }
+      bool isSetUnderlyingPutOrCall() const { return m_present[ 10 ]; }
+      int getUnderlyingPutOrCall() const
+      { if( !m_present[ 10 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingPutOrCall ); return m_UnderlyingPutOrCall; }
+      bool isSetUnderlyingCouponPaymentDate() const { return m_present[ 11 ]; }
+      const FIX::FieldView& getUnderlyingCouponPaymentDate() const
+      { if( !m_present[ 11 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingCouponPaymentDate ); return m_UnderlyingCouponPaymentDate; }
+      bool isSetUnderlyingIssueDate() const { return m_present[ 12 ]; }
+      const FIX::FieldView& getUnderlyingIssueDate() const
+      { if( !m_present[ 12 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingIssueDate ); return m_UnderlyingIssueDate; }
+      bool isSetUnderlyingRepoCollateralSecurityType() const { return m_present[ 13 ]; }
+      const FIX::FieldView& getUnderlyingRepoCollateralSecurityType() const
+      { if( !m_present[ 13 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingRepoCollateralSecurityType ); return m_UnderlyingRepoCollateralSecurityType; }
+      bool isSetUnderlyingRepurchaseTerm() const { return m_present[ 14 ]; }
+      int getUnderlyingRepurchaseTerm() const
+      { if( !m_present[ 14 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingRepurchaseTerm ); return m_UnderlyingRepurchaseTerm; }
+      bool isSetUnderlyingRepurchaseRate() const { return m_present[ 15 ]; }
+      double getUnderlyingRepurchaseRate() const
+      { if( !m_present[ 15 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingRepurchaseRate ); return m_UnderlyingRepurchaseRate; }
+      bool isSetUnderlyingFactor() const { return m_present[ 16 ]; }
+      double getUnderlyingFactor() const
+      { if( !m_present[ 16 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingFactor ); return m_UnderlyingFactor; }
+      bool isSetUnderlyingCreditRating() const { return m_present[ 17 ]; }
+      const FIX::FieldView& getUnderlyingCreditRating() const
+      { if( !m_present[ 17 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingCreditRating ); return m_UnderlyingCreditRating; }
+      bool isSetUnderlyingInstrRegistry() const { return m_present[ 18 ]; }
+      const FIX::FieldView& getUnderlyingInstrRegistry() const
+      { if( !m_present[ 18 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingInstrRegistry ); return m_UnderlyingInstrRegistry; }
+      bool isSetUnderlyingCountryOfIssue() const { return m_present[ 19 ]; }
+      const FIX::FieldView& getUnderlyingCountryOfIssue() const
+      { if( !m_present[ 19 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingCountryOfIssue ); return m_UnderlyingCountryOfIssue; }
+      bool isSetUnderlyingStateOrProvinceOfIssue() const { return m_present[ 20 ]; }
+      const FIX::FieldView& getUnderlyingStateOrProvinceOfIssue() const
+      { if( !m_present[ 20 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingStateOrProvinceOfIssue ); return m_UnderlyingStateOrProvinceOfIssue; }
+      bool isSetUnderlyingLocaleOfIssue() const { return m_present[ 21 ]; }
+      const FIX::FieldView& getUnderlyingLocaleOfIssue() const
+      { if( !m_present[ 21 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingLocaleOfIssue ); return m_UnderlyingLocaleOfIssue; }
+      bool isSetUnderlyingRedemptionDate() const { return m_present[ 22 ]; }
+      const FIX::FieldView& getUnderlyingRedemptionDate() const
+      { if( !m_present[ 22 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingRedemptionDate ); return m_UnderlyingRedemptionDate; }
+      bool isSetUnderlyingStrikePrice() const { return m_present[ 23 ]; }
+      double getUnderlyingStrikePrice() const
+      { if( !m_present[ 23 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingStrikePrice ); return m_UnderlyingStrikePrice; }
+      bool isSetUnderlyingStrikeCurrency() const { return m_present[ 24 ]; }
+      const FIX::FieldView& getUnderlyingStrikeCurrency() const
+      { if( !m_present[ 24 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingStrikeCurrency ); return m_UnderlyingStrikeCurrency; }
+      bool isSetUnderlyingOptAttribute() const { return m_present[ 25 ]; }
+      char getUnderlyingOptAttribute() const
+      { if( !m_present[ 25 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingOptAttribute ); return m_UnderlyingOptAttribute; }
+      bool isSetUnderlyingContractMultiplier() const { return m_present[ 26 ]; }
+      double getUnderlyingContractMultiplier() const
+      { if( !m_present[ 26 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingContractMultiplier ); return m_UnderlyingContractMultiplier; }
+      bool isSetUnderlyingCouponRate() const { return m_present[ 27 ]; }
+      double getUnderlyingCouponRate() const
+      { if( !m_present[ 27 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingCouponRate ); return m_UnderlyingCouponRate; }
+      bool isSetUnderlyingSecurityExchange() const { return m_present[ 28 ]; }
+      const FIX::FieldView& getUnderlyingSecurityExchange() const
+      { if( !m_present[ 28 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingSecurityExchange ); return m_UnderlyingSecurityExchange; }
+      bool isSetUnderlyingIssuer() const { return m_present[ 29 ]; }
+      const FIX::FieldView& getUnderlyingIssuer() const
+      { if( !m_present[ 29 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingIssuer ); return m_UnderlyingIssuer; }
+      bool isSetEncodedUnderlyingIssuerLen() const { return m_present[ 30 ]; }
+      int getEncodedUnderlyingIssuerLen() const
+      { if( !m_present[ 30 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedUnderlyingIssuerLen ); return m_EncodedUnderlyingIssuerLen; }
+      bool isSetEncodedUnderlyingIssuer() const { return m_present[ 31 ]; }
+      const FIX::FieldView& getEncodedUnderlyingIssuer() const
+      { if( !m_present[ 31 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedUnderlyingIssuer ); return m_EncodedUnderlyingIssuer; }
+      bool isSetUnderlyingSecurityDesc() const { return m_present[ 32 ]; }
+      const FIX::FieldView& getUnderlyingSecurityDesc() const
+      { if( !m_present[ 32 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingSecurityDesc ); return m_UnderlyingSecurityDesc; }
+      bool isSetEncodedUnderlyingSecurityDescLen() const { return m_present[ 33 ]; }
+      int getEncodedUnderlyingSecurityDescLen() const
+      { if( !m_present[ 33 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedUnderlyingSecurityDescLen ); return m_EncodedUnderlyingSecurityDescLen; }
+      bool isSetEncodedUnderlyingSecurityDesc() const { return m_present[ 34 ]; }
+      const FIX::FieldView& getEncodedUnderlyingSecurityDesc() const
+      { if( !m_present[ 34 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedUnderlyingSecurityDesc ); return m_EncodedUnderlyingSecurityDesc; }
+      bool isSetUnderlyingCPProgram() const { return m_present[ 35 ]; }
+      const FIX::FieldView& getUnderlyingCPProgram() const
+      { if( !m_present[ 35 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingCPProgram ); return m_UnderlyingCPProgram; }
+      bool isSetUnderlyingCPRegType() const { return m_present[ 36 ]; }
+      const FIX::FieldView& getUnderlyingCPRegType() const
+      { if( !m_present[ 36 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingCPRegType ); return m_UnderlyingCPRegType; }
+      bool isSetUnderlyingCurrency() const { return m_present[ 37 ]; }
+      const FIX::FieldView& getUnderlyingCurrency() const
+      { if( !m_present[ 37 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingCurrency ); return m_UnderlyingCurrency; }
+      bool isSetUnderlyingQty() const { return m_present[ 38 ]; }
+      double getUnderlyingQty() const
+      { if( !m_present[ 38 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingQty ); return m_UnderlyingQty; }
+      bool isSetUnderlyingPx() const { return m_present[ 39 ]; }
+      double getUnderlyingPx() const
+      { if( !m_present[ 39 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingPx ); return m_UnderlyingPx; }
+      bool isSetUnderlyingDirtyPrice() const { return m_present[ 40 ]; }
+      double getUnderlyingDirtyPrice() const
+      { if( !m_present[ 40 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingDirtyPrice ); return m_UnderlyingDirtyPrice; }
+      bool isSetUnderlyingEndPrice() const { return m_present[ 41 ]; }
+      double getUnderlyingEndPrice() const
+      { if( !m_present[ 41 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingEndPrice ); return m_UnderlyingEndPrice; }
+      bool isSetUnderlyingStartValue() const { return m_present[ 42 ]; }
+      double getUnderlyingStartValue() const
+      { if( !m_present[ 42 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingStartValue ); return m_UnderlyingStartValue; }
+      bool isSetUnderlyingCurrentValue() const { return m_present[ 43 ]; }
+      double getUnderlyingCurrentValue() const
+      { if( !m_present[ 43 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingCurrentValue ); return m_UnderlyingCurrentValue; }
+      bool isSetUnderlyingEndValue() const { return m_present[ 44 ]; }
+      double getUnderlyingEndValue() const
+      { if( !m_present[ 44 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingEndValue ); return m_UnderlyingEndValue; }
+
+    private:
+      std::bitset< 45 > m_present;
+      FIX::FieldView m_UnderlyingSymbol;
+      FIX::FieldView m_UnderlyingSymbolSfx;
+      FIX::FieldView m_UnderlyingSecurityID;
+      FIX::FieldView m_UnderlyingSecurityIDSource;
+      int m_UnderlyingProduct;
+      FIX::FieldView m_UnderlyingCFICode;
+      FIX::FieldView m_UnderlyingSecurityType;
+      FIX::FieldView m_UnderlyingSecuritySubType;
+      FIX::FieldView m_UnderlyingMaturityMonthYear;
+      FIX::FieldView m_UnderlyingMaturityDate;
+      int m_UnderlyingPutOrCall;
+      FIX::FieldView m_UnderlyingCouponPaymentDate;
+      FIX::FieldView m_UnderlyingIssueDate;
+      FIX::FieldView m_UnderlyingRepoCollateralSecurityType;
+      int m_UnderlyingRepurchaseTerm;
+      double m_UnderlyingRepurchaseRate;
+      double m_UnderlyingFactor;
+      FIX::FieldView m_UnderlyingCreditRating;
+      FIX::FieldView m_UnderlyingInstrRegistry;
+      FIX::FieldView m_UnderlyingCountryOfIssue;
+      FIX::FieldView m_UnderlyingStateOrProvinceOfIssue;
+      FIX::FieldView m_UnderlyingLocaleOfIssue;
+      FIX::FieldView m_UnderlyingRedemptionDate;
+      double m_UnderlyingStrikePrice;
+      FIX::FieldView m_UnderlyingStrikeCurrency;
+      char m_UnderlyingOptAttribute;
+      double m_UnderlyingContractMultiplier;
+      double m_UnderlyingCouponRate;
+      FIX::FieldView m_UnderlyingSecurityExchange;
+      FIX::FieldView m_UnderlyingIssuer;
+      int m_EncodedUnderlyingIssuerLen;
+      FIX::FieldView m_EncodedUnderlyingIssuer;
+      FIX::FieldView m_UnderlyingSecurityDesc;
+      int m_EncodedUnderlyingSecurityDescLen;
+      FIX::FieldView m_EncodedUnderlyingSecurityDesc;
+      FIX::FieldView m_UnderlyingCPProgram;
+      FIX::FieldView m_UnderlyingCPRegType;
+      FIX::FieldView m_UnderlyingCurrency;
+      double m_UnderlyingQty;
+      double m_UnderlyingPx;
+      double m_UnderlyingDirtyPrice;
+      double m_UnderlyingEndPrice;
+      double m_UnderlyingStartValue;
+      double m_UnderlyingCurrentValue;
+      double m_UnderlyingEndValue;
+    };
+    typedef FIX::InlineVector< NoUnderlyings, 8 > NoUnderlyingsEntries;
+
+    class NoStipulations
+    {
+    public:
+      void decode( FIX::FieldCursor& cursor )
+      {
+        do
+        {
+          switch( cursor.tag() )
+          {
+          case 233:
+            m_present.set( 0 );
+            m_StipulationType = cursor.value();
+            break;
+          case 234:
+            m_present.set( 1 );
+            m_StipulationValue = cursor.value();
+            break;
+          default:
+            return;
+          }
+          cursor.next();
+        }
+        while( cursor.valid() && cursor.tag() != 233 );
+      }
+
+      void clear()
+      {
+        m_present.reset();
+      }
+      bool isSetStipulationType() const { return m_present[ 0 ]; }
+      const FIX::FieldView& getStipulationType() const
+      { if( !m_present[ 0 ] ) throw FIX::FieldNotFound( FIX::FIELD::StipulationType ); return m_StipulationType; }
+      bool isSetStipulationValue() const { return m_present[ 1 ]; }
+      const FIX::FieldView& getStipulationValue() const
+      { if( !m_present[ 1 ] ) throw FIX::FieldNotFound( FIX::FIELD::StipulationValue ); return m_StipulationValue; }
+
+    private:
+      std::bitset< 2 > m_present;
+      FIX::FieldView m_StipulationType;
+      FIX::FieldView m_StipulationValue;
+    };
+    typedef FIX::InlineVector< NoStipulations, 8 > NoStipulationsEntries;
+
+    class NoContAmts
+    {
+    public:
+      void decode( FIX::FieldCursor& cursor )
+      {
+        do
+        {
+          switch( cursor.tag() )
+          {
+          case 519:
+            m_present.set( 0 );
+            m_ContAmtType = cursor.getInt();
+            break;
+          case 520:
+            m_present.set( 1 );
+            m_ContAmtValue = cursor.getDouble();
+            break;
+          case 521:
+            m_present.set( 2 );
+            m_ContAmtCurr = cursor.value();
+            break;
+          default:
+            return;
+          }
+          cursor.next();
+        }
+        while( cursor.valid() && cursor.tag() != 519 );
+      }
+
+      void clear()
+      {
+        m_present.reset();
+      }
+      bool isSetContAmtType() const { return m_present[ 0 ]; }
+      int getContAmtType() const
+      { if( !m_present[ 0 ] ) throw FIX::FieldNotFound( FIX::FIELD::ContAmtType ); return m_ContAmtType; }
+      bool isSetContAmtValue() const { return m_present[ 1 ]; }
+      double getContAmtValue() const
+      { if( !m_present[ 1 ] ) throw FIX::FieldNotFound( FIX::FIELD::ContAmtValue ); return m_ContAmtValue; }
+      bool isSetContAmtCurr() const { return m_present[ 2 ]; }
+      const FIX::FieldView& getContAmtCurr() const
+      { if( !m_present[ 2 ] ) throw FIX::FieldNotFound( FIX::FIELD::ContAmtCurr ); return m_ContAmtCurr; }
+
+    private:
+      std::bitset< 3 > m_present;
+      int m_ContAmtType;
+      double m_ContAmtValue;
+      FIX::FieldView m_ContAmtCurr;
+    };
+    typedef FIX::InlineVector< NoContAmts, 8 > NoContAmtsEntries;
+
+    class NoLegs
+    {
+    public:
+      class NoLegStipulations
+      {
+      public:
+        void decode( FIX::FieldCursor& cursor )
+        {
+          do
+          {
+            switch( cursor.tag() )
+            {
+            case 688:
+              m_present.set( 0 );
+              m_LegStipulationType = cursor.value();
+              break;
+            case 689:
+              m_present.set( 1 );
+              m_LegStipulationValue = cursor.value();
+              break;
+            default:
+              return;
+            }
+            cursor.next();
+          }
+          while( cursor.valid() && cursor.tag() != 688 );
+        }
+
+        void clear()
+        {
+          m_present.reset();
+        }
+        bool isSetLegStipulationType() const { return m_present[ 0 ]; }
+        const FIX::FieldView& getLegStipulationType() const
+        { if( !m_present[ 0 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegStipulationType ); return m_LegStipulationType; }
+        bool isSetLegStipulationValue() const { return m_present[ 1 ]; }
+        const FIX::FieldView& getLegStipulationValue() const
+        { if( !m_present[ 1 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegStipulationValue ); return m_LegStipulationValue; }
+
+      private:
+        std::bitset< 2 > m_present;
+        FIX::FieldView m_LegStipulationType;
+        FIX::FieldView m_LegStipulationValue;
+      };
+      typedef FIX::InlineVector< NoLegStipulations, 2 > NoLegStipulationsEntries;
+
+      class NoNestedPartyIDs
+      {
+      public:
+        class NoNestedPartySubIDs
+        {
+        public:
+          void decode( FIX::FieldCursor& cursor )
+          {
+            do
+            {
+              switch( cursor.tag() )
+              {
+              case 545:
+                m_present.set( 0 );
+                m_NestedPartySubID = cursor.value();
+                break;
+              case 805:
+                m_present.set( 1 );
+                m_NestedPartySubIDType = cursor.getInt();
+                break;
+              default:
+                return;
+              }
+              cursor.next();
+            }
+            while( cursor.valid() && cursor.tag() != 545 );
+          }
+
+          void clear()
+          {
+            m_present.reset();
+          }
+          bool isSetNestedPartySubID() const { return m_present[ 0 ]; }
+          const FIX::FieldView& getNestedPartySubID() const
+          { if( !m_present[ 0 ] ) throw FIX::FieldNotFound( FIX::FIELD::NestedPartySubID ); return m_NestedPartySubID; }
+          bool isSetNestedPartySubIDType() const { return m_present[ 1 ]; }
+          int getNestedPartySubIDType() const
+          { if( !m_present[ 1 ] ) throw FIX::FieldNotFound( FIX::FIELD::NestedPartySubIDType ); return m_NestedPartySubIDType; }
+
+        private:
+          std::bitset< 2 > m_present;
+          FIX::FieldView m_NestedPartySubID;
+          int m_NestedPartySubIDType;
+        };
+        typedef FIX::InlineVector< NoNestedPartySubIDs, 2 > NoNestedPartySubIDsEntries;
+
+        void decode( FIX::FieldCursor& cursor )
+        {
+          do
+          {
+            switch( cursor.tag() )
+            {
+            case 524:
+              m_present.set( 0 );
+              m_NestedPartyID = cursor.value();
+              break;
+            case 525:
+              m_present.set( 1 );
+              m_NestedPartyIDSource = cursor.getChar();
+              break;
+            case 538:
+              m_present.set( 2 );
+              m_NestedPartyRole = cursor.getInt();
+              break;
+            case 804:
+              m_present.set( 3 );
+              FIX::decodeGroups( cursor, m_NoNestedPartySubIDs, 804, 545 );
+              continue;
+            default:
+              return;
+            }
+            cursor.next();
+          }
+          while( cursor.valid() && cursor.tag() != 524 );
+        }
+
+        void clear()
+        {
+          m_present.reset();
+          m_NoNestedPartySubIDs.clear();
+        }
+        bool isSetNestedPartyID() const { return m_present[ 0 ]; }
+        const FIX::FieldView& getNestedPartyID() const
+        { if( !m_present[ 0 ] ) throw FIX::FieldNotFound( FIX::FIELD::NestedPartyID ); return m_NestedPartyID; }
+        bool isSetNestedPartyIDSource() const { return m_present[ 1 ]; }
+        char getNestedPartyIDSource() const
+        { if( !m_present[ 1 ] ) throw FIX::FieldNotFound( FIX::FIELD::NestedPartyIDSource ); return m_NestedPartyIDSource; }
+        bool isSetNestedPartyRole() const { return m_present[ 2 ]; }
+        int getNestedPartyRole() const
+        { if( !m_present[ 2 ] ) throw FIX::FieldNotFound( FIX::FIELD::NestedPartyRole ); return m_NestedPartyRole; }
+        bool isSetNoNestedPartySubIDs() const { return m_present[ 3 ]; }
+        const NoNestedPartySubIDsEntries& getNoNestedPartySubIDs() const { return m_NoNestedPartySubIDs; }
+
+      private:
+        std::bitset< 4 > m_present;
+        FIX::FieldView m_NestedPartyID;
+        char m_NestedPartyIDSource;
+        int m_NestedPartyRole;
+        NoNestedPartySubIDsEntries m_NoNestedPartySubIDs;
+      };
+      typedef FIX::InlineVector< NoNestedPartyIDs, 2 > NoNestedPartyIDsEntries;
+
+      void decode( FIX::FieldCursor& cursor )
+      {
+        do
+        {
+          switch( cursor.tag() )
+          {
+          case 600:
+            m_present.set( 0 );
+            m_LegSymbol = cursor.value();
+            break;
+          case 601:
+            m_present.set( 1 );
+            m_LegSymbolSfx = cursor.value();
+            break;
+          case 602:
+            m_present.set( 2 );
+            m_LegSecurityID = cursor.value();
+            break;
+          case 603:
+            m_present.set( 3 );
+            m_LegSecurityIDSource = cursor.value();
+            break;
+          case 607:
+            m_present.set( 4 );
+            m_LegProduct = cursor.getInt();
+            break;
+          case 608:
+            m_present.set( 5 );
+            m_LegCFICode = cursor.value();
+            break;
+          case 609:
+            m_present.set( 6 );
+            m_LegSecurityType = cursor.value();
+            break;
+          case 764:
+            m_present.set( 7 );
+            m_LegSecuritySubType = cursor.value();
+            break;
+          case 610:
+            m_present.set( 8 );
+            m_LegMaturityMonthYear = cursor.value();
+            break;
+          case 611:
+            m_present.set( 9 );
+            m_LegMaturityDate = cursor.value();
+            break;
+          case 248:
+            m_present.set( 10 );
+            m_LegCouponPaymentDate = cursor.value();
+            break;
+          case 249:
+            m_present.set( 11 );
+            m_LegIssueDate = cursor.value();
+            break;
+          case 250:
+            m_present.set( 12 );
+            m_LegRepoCollateralSecurityType = cursor.value();
+            break;
+          case 251:
+            m_present.set( 13 );
+            m_LegRepurchaseTerm = cursor.getInt();
+            break;
+          case 252:
+            m_present.set( 14 );
+            m_LegRepurchaseRate = cursor.getDouble();
+            break;
+          case 253:
+            m_present.set( 15 );
+            m_LegFactor = cursor.getDouble();
+            break;
+          case 257:
+            m_present.set( 16 );
+            m_LegCreditRating = cursor.value();
+            break;
+          case 599:
+            m_present.set( 17 );
+            m_LegInstrRegistry = cursor.value();
+            break;
+          case 596:
+            m_present.set( 18 );
+            m_LegCountryOfIssue = cursor.value();
+            break;
+          case 597:
+            m_present.set( 19 );
+            m_LegStateOrProvinceOfIssue = cursor.value();
+            break;
+          case 598:
+            m_present.set( 20 );
+            m_LegLocaleOfIssue = cursor.value();
+            break;
+          case 254:
+            m_present.set( 21 );
+            m_LegRedemptionDate = cursor.value();
+            break;
+          case 612:
+            m_present.set( 22 );
+            m_LegStrikePrice = cursor.getDouble();
+            break;
+          case 942:
+            m_present.set( 23 );
+            m_LegStrikeCurrency = cursor.value();
+            break;
+          case 613:
+            m_present.set( 24 );
+            m_LegOptAttribute = cursor.getChar();
+            break;
+          case 614:
+            m_present.set( 25 );
+            m_LegContractMultiplier = cursor.getDouble();
+            break;
+          case 615:
+            m_present.set( 26 );
+            m_LegCouponRate = cursor.getDouble();
+            break;
+          case 616:
+            m_present.set( 27 );
+            m_LegSecurityExchange = cursor.value();
+            break;
+          case 617:
+            m_present.set( 28 );
+            m_LegIssuer = cursor.value();
+            break;
+          case 618:
+            m_present.set( 29 );
+            m_EncodedLegIssuerLen = cursor.getInt();
+            cursor.setDataLength( 619, m_EncodedLegIssuerLen );
+            break;
+          case 619:
+            m_present.set( 30 );
+            m_EncodedLegIssuer = cursor.value();
+            break;
+          case 620:
+            m_present.set( 31 );
+            m_LegSecurityDesc = cursor.value();
+            break;
+          case 621:
+            m_present.set( 32 );
+            m_EncodedLegSecurityDescLen = cursor.getInt();
+            cursor.setDataLength( 622, m_EncodedLegSecurityDescLen );
+            break;
+          case 622:
+            m_present.set( 33 );
+            m_EncodedLegSecurityDesc = cursor.value();
+            break;
+          case 623:
+            m_present.set( 34 );
+            m_LegRatioQty = cursor.getDouble();
+            break;
+          case 624:
+            m_present.set( 35 );
+            m_LegSide = cursor.getChar();
+            break;
+          case 556:
+            m_present.set( 36 );
+            m_LegCurrency = cursor.value();
+            break;
+          case 740:
+            m_present.set( 37 );
+            m_LegPool = cursor.value();
+            break;
+          case 739:
+            m_present.set( 38 );
+            m_LegDatedDate = cursor.value();
+            break;
+          case 955:
+            m_present.set( 39 );
+            m_LegContractSettlMonth = cursor.value();
+            break;
+          case 956:
+            m_present.set( 40 );
+            m_LegInterestAccrualDate = cursor.value();
+            break;
+          case 687:
+            m_present.set( 41 );
+            m_LegQty = cursor.getDouble();
+            break;
+          case 690:
+            m_present.set( 42 );
+            m_LegSwapType = cursor.getInt();
+            break;
+          case 683:
+            m_present.set( 43 );
+            FIX::decodeGroups( cursor, m_NoLegStipulations, 683, 688 );
+            continue;
+          case 564:
+            m_present.set( 44 );
+            m_LegPositionEffect = cursor.getChar();
+            break;
+          case 565:
+            m_present.set( 45 );
+            m_LegCoveredOrUncovered = cursor.getInt();
+            break;
+          case 539:
+            m_present.set( 46 );
+            FIX::decodeGroups( cursor, m_NoNestedPartyIDs, 539, 524 );
+            continue;
+          case 654:
+            m_present.set( 47 );
+            m_LegRefID = cursor.value();
+            break;
+          case 566:
+            m_present.set( 48 );
+            m_LegPrice = cursor.getDouble();
+            break;
+          case 587:
+            m_present.set( 49 );
+            m_LegSettlType = cursor.getChar();
+            break;
+          case 588:
+            m_present.set( 50 );
+            m_LegSettlDate = cursor.value();
+            break;
+          case 637:
+            m_present.set( 51 );
+            m_LegLastPx = cursor.getDouble();
+            break;
+          default:
+            return;
+          }
+          cursor.next();
+        }
+        while( cursor.valid() && cursor.tag() != 600 );
+      }
+
+      void clear()
+      {
+        m_present.reset();
+        m_NoLegStipulations.clear();
+        m_NoNestedPartyIDs.clear();
+      }
+      bool isSetLegSymbol() const { return m_present[ 0 ]; }
+      const FIX::FieldView& getLegSymbol() const
+      { if( !m_present[ 0 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSymbol ); return m_LegSymbol; }
+      bool isSetLegSymbolSfx() const { return m_present[ 1 ]; }
+      const FIX::FieldView& getLegSymbolSfx() const
+      { if( !m_present[ 1 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSymbolSfx ); return m_LegSymbolSfx; }
+      bool isSetLegSecurityID() const { return m_present[ 2 ]; }
+      const FIX::FieldView& getLegSecurityID() const
+      { if( !m_present[ 2 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSecurityID ); return m_LegSecurityID; }
+      bool isSetLegSecurityIDSource() const { return m_present[ 3 ]; }
+      const FIX::FieldView& getLegSecurityIDSource() const
+      { if( !m_present[ 3 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSecurityIDSource ); return m_LegSecurityIDSource; }
+      bool isSetLegProduct() const { return m_present[ 4 ]; }
+      int getLegProduct() const
+      { if( !m_present[ 4 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegProduct ); return m_LegProduct; }
+      bool isSetLegCFICode() const { return m_present[ 5 ]; }
+      const FIX::FieldView& getLegCFICode() const
+      { if( !m_present[ 5 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegCFICode ); return m_LegCFICode; }
+      bool isSetLegSecurityType() const { return m_present[ 6 ]; }
+      const FIX::FieldView& getLegSecurityType() const
+      { if( !m_present[ 6 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSecurityType ); return m_LegSecurityType; }
+      bool isSetLegSecuritySubType() const { return m_present[ 7 ]; }
+      const FIX::FieldView& getLegSecuritySubType() const
+      { if( !m_present[ 7 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSecuritySubType ); return m_LegSecuritySubType; }
+      bool isSetLegMaturityMonthYear() const { return m_present[ 8 ]; }
+      const FIX::FieldView& getLegMaturityMonthYear() const
+      { if( !m_present[ 8 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegMaturityMonthYear ); return m_LegMaturityMonthYear; }
+      bool isSetLegMaturityDate() const { return m_present[ 9 ]; }
+      const FIX::FieldView& getLegMaturityDate() const
+      { if( !m_present[ 9 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegMaturityDate ); return m_LegMaturityDate; }
+      bool isSetLegCouponPaymentDate() const { return m_present[ 10 ]; }
+      const FIX::FieldView& getLegCouponPaymentDate() const
+      { if( !m_present[ 10 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegCouponPaymentDate ); return m_LegCouponPaymentDate; }
+      bool isSetLegIssueDate() const { return m_present[ 11 ]; }
+      const FIX::FieldView& getLegIssueDate() const
+      { if( !m_present[ 11 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegIssueDate ); return m_LegIssueDate; }
+      bool isSetLegRepoCollateralSecurityType() const { return m_present[ 12 ]; }
+      const FIX::FieldView& getLegRepoCollateralSecurityType() const
+      { if( !m_present[ 12 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegRepoCollateralSecurityType ); return m_LegRepoCollateralSecurityType; }
+      bool isSetLegRepurchaseTerm() const { return m_present[ 13 ]; }
+      int getLegRepurchaseTerm() const
+      { if( !m_present[ 13 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegRepurchaseTerm ); return m_LegRepurchaseTerm; }
+      bool isSetLegRepurchaseRate() const { return m_present[ 14 ]; }
+      double getLegRepurchaseRate() const
+      { if( !m_present[ 14 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegRepurchaseRate ); return m_LegRepurchaseRate; }
+      bool isSetLegFactor() const { return m_present[ 15 ]; }
+      double getLegFactor() const
+      { if( !m_present[ 15 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegFactor ); return m_LegFactor; }
+      bool isSetLegCreditRating() const { return m_present[ 16 ]; }
+      const FIX::FieldView& getLegCreditRating() const
+      { if( !m_present[ 16 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegCreditRating ); return m_LegCreditRating; }
+      bool isSetLegInstrRegistry() const { return m_present[ 17 ]; }
+      const FIX::FieldView& getLegInstrRegistry() const
+      { if( !m_present[ 17 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegInstrRegistry ); return m_LegInstrRegistry; }
+      bool isSetLegCountryOfIssue() const { return m_present[ 18 ]; }
+      const FIX::FieldView& getLegCountryOfIssue() const
+      { if( !m_present[ 18 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegCountryOfIssue ); return m_LegCountryOfIssue; }
+      bool isSetLegStateOrProvinceOfIssue() const { return m_present[ 19 ]; }
+      const FIX::FieldView& getLegStateOrProvinceOfIssue() const
+      { if( !m_present[ 19 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegStateOrProvinceOfIssue ); return m_LegStateOrProvinceOfIssue; }
+      bool isSetLegLocaleOfIssue() const { return m_present[ 20 ]; }
+      const FIX::FieldView& getLegLocaleOfIssue() const
+      { if( !m_present[ 20 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegLocaleOfIssue ); return m_LegLocaleOfIssue; }
+      bool isSetLegRedemptionDate() const { return m_present[ 21 ]; }
+      const FIX::FieldView& getLegRedemptionDate() const
+      { if( !m_present[ 21 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegRedemptionDate ); return m_LegRedemptionDate; }
+      bool isSetLegStrikePrice() const { return m_present[ 22 ]; }
+      double getLegStrikePrice() const
+      { if( !m_present[ 22 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegStrikePrice ); return m_LegStrikePrice; }
+      bool isSetLegStrikeCurrency() const { return m_present[ 23 ]; }
+      const FIX::FieldView& getLegStrikeCurrency() const
+      { if( !m_present[ 23 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegStrikeCurrency ); return m_LegStrikeCurrency; }
+      bool isSetLegOptAttribute() const { return m_present[ 24 ]; }
+      char getLegOptAttribute() const
+      { if( !m_present[ 24 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegOptAttribute ); return m_LegOptAttribute; }
+      bool isSetLegContractMultiplier() const { return m_present[ 25 ]; }
+      double getLegContractMultiplier() const
+      { if( !m_present[ 25 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegContractMultiplier ); return m_LegContractMultiplier; }
+      bool isSetLegCouponRate() const { return m_present[ 26 ]; }
+      double getLegCouponRate() const
+      { if( !m_present[ 26 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegCouponRate ); return m_LegCouponRate; }
+      bool isSetLegSecurityExchange() const { return m_present[ 27 ]; }
+      const FIX::FieldView& getLegSecurityExchange() const
+      { if( !m_present[ 27 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSecurityExchange ); return m_LegSecurityExchange; }
+      bool isSetLegIssuer() const { return m_present[ 28 ]; }
+      const FIX::FieldView& getLegIssuer() const
+      { if( !m_present[ 28 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegIssuer ); return m_LegIssuer; }
+      bool isSetEncodedLegIssuerLen() const { return m_present[ 29 ]; }
+      int getEncodedLegIssuerLen() const
+      { if( !m_present[ 29 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedLegIssuerLen ); return m_EncodedLegIssuerLen; }
+      bool isSetEncodedLegIssuer() const { return m_present[ 30 ]; }
+      const FIX::FieldView& getEncodedLegIssuer() const
+      { if( !m_present[ 30 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedLegIssuer ); return m_EncodedLegIssuer; }
+      bool isSetLegSecurityDesc() const { return m_present[ 31 ]; }
+      const FIX::FieldView& getLegSecurityDesc() const
+      { if( !m_present[ 31 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSecurityDesc ); return m_LegSecurityDesc; }
+      bool isSetEncodedLegSecurityDescLen() const { return m_present[ 32 ]; }
+      int getEncodedLegSecurityDescLen() const
+      { if( !m_present[ 32 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedLegSecurityDescLen ); return m_EncodedLegSecurityDescLen; }
+      bool isSetEncodedLegSecurityDesc() const { return m_present[ 33 ]; }
+      const FIX::FieldView& getEncodedLegSecurityDesc() const
+      { if( !m_present[ 33 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedLegSecurityDesc ); return m_EncodedLegSecurityDesc; }
+      bool isSetLegRatioQty() const { return m_present[ 34 ]; }
+      double getLegRatioQty() const
+      { if( !m_present[ 34 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegRatioQty ); return m_LegRatioQty; }
+      bool isSetLegSide() const { return m_present[ 35 ]; }
+      char getLegSide() const
+      { if( !m_present[ 35 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSide ); return m_LegSide; }
+      bool isSetLegCurrency() const { return m_present[ 36 ]; }
+      const FIX::FieldView& getLegCurrency() const
+      { if( !m_present[ 36 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegCurrency ); return m_LegCurrency; }
+      bool isSetLegPool() const { return m_present[ 37 ]; }
+      const FIX::FieldView& getLegPool() const
+      { if( !m_present[ 37 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegPool ); return m_LegPool; }
+      bool isSetLegDatedDate() const { return m_present[ 38 ]; }
+      const FIX::FieldView& getLegDatedDate() const
+      { if( !m_present[ 38 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegDatedDate ); return m_LegDatedDate; }
+      bool isSetLegContractSettlMonth() const { return m_present[ 39 ]; }
+      const FIX::FieldView& getLegContractSettlMonth() const
+      { if( !m_present[ 39 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegContractSettlMonth ); return m_LegContractSettlMonth; }
+      bool isSetLegInterestAccrualDate() const { return m_present[ 40 ]; }
+      const FIX::FieldView& getLegInterestAccrualDate() const
+      { if( !m_present[ 40 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegInterestAccrualDate ); return m_LegInterestAccrualDate; }
+      bool isSetLegQty() const { return m_present[ 41 ]; }
+      double getLegQty() const
+      { if( !m_present[ 41 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegQty ); return m_LegQty; }
+      bool isSetLegSwapType() const { return m_present[ 42 ]; }
+      int getLegSwapType() const
+      { if( !m_present[ 42 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSwapType ); return m_LegSwapType; }
+      bool isSetNoLegStipulations() const { return m_present[ 43 ]; }
+      const NoLegStipulationsEntries& getNoLegStipulations() const { return m_NoLegStipulations; }
+      bool isSetLegPositionEffect() const { return m_present[ 44 ]; }
+      char getLegPositionEffect() const
+      { if( !m_present[ 44 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegPositionEffect ); return m_LegPositionEffect; }
+      bool isSetLegCoveredOrUncovered() const { return m_present[ 45 ]; }
+      int getLegCoveredOrUncovered() const
+      { if( !m_present[ 45 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegCoveredOrUncovered ); return m_LegCoveredOrUncovered; }
+      bool isSetNoNestedPartyIDs() const { return m_present[ 46 ]; }
+      const NoNestedPartyIDsEntries& getNoNestedPartyIDs() const { return m_NoNestedPartyIDs; }
+      bool isSetLegRefID() const { return m_present[ 47 ]; }
+      const FIX::FieldView& getLegRefID() const
+      { if( !m_present[ 47 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegRefID ); return m_LegRefID; }
+      bool isSetLegPrice() const { return m_present[ 48 ]; }
+      double getLegPrice() const
+      { if( !m_present[ 48 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegPrice ); return m_LegPrice; }
+      bool isSetLegSettlType() const { return m_present[ 49 ]; }
+      char getLegSettlType() const
+      { if( !m_present[ 49 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSettlType ); return m_LegSettlType; }
+      bool isSetLegSettlDate() const { return m_present[ 50 ]; }
+      const FIX::FieldView& getLegSettlDate() const
+      { if( !m_present[ 50 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSettlDate ); return m_LegSettlDate; }
+      bool isSetLegLastPx() const { return m_present[ 51 ]; }
+      double getLegLastPx() const
+      { if( !m_present[ 51 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegLastPx ); return m_LegLastPx; }
+
+    private:
+      std::bitset< 52 > m_present;
+      FIX::FieldView m_LegSymbol;
+      FIX::FieldView m_LegSymbolSfx;
+      FIX::FieldView m_LegSecurityID;
+      FIX::FieldView m_LegSecurityIDSource;
+      int m_LegProduct;
+      FIX::FieldView m_LegCFICode;
+      FIX::FieldView m_LegSecurityType;
+      FIX::FieldView m_LegSecuritySubType;
+      FIX::FieldView m_LegMaturityMonthYear;
+      FIX::FieldView m_LegMaturityDate;
+      FIX::FieldView m_LegCouponPaymentDate;
+      FIX::FieldView m_LegIssueDate;
+      FIX::FieldView m_LegRepoCollateralSecurityType;
+      int m_LegRepurchaseTerm;
+      double m_LegRepurchaseRate;
+      double m_LegFactor;
+      FIX::FieldView m_LegCreditRating;
+      FIX::FieldView m_LegInstrRegistry;
+      FIX::FieldView m_LegCountryOfIssue;
+      FIX::FieldView m_LegStateOrProvinceOfIssue;
+      FIX::FieldView m_LegLocaleOfIssue;
+      FIX::FieldView m_LegRedemptionDate;
+      double m_LegStrikePrice;
+      FIX::FieldView m_LegStrikeCurrency;
+      char m_LegOptAttribute;
+      double m_LegContractMultiplier;
+      double m_LegCouponRate;
+      FIX::FieldView m_LegSecurityExchange;
+      FIX::FieldView m_LegIssuer;
+      int m_EncodedLegIssuerLen;
+      FIX::FieldView m_EncodedLegIssuer;
+      FIX::FieldView m_LegSecurityDesc;
+      int m_EncodedLegSecurityDescLen;
+      FIX::FieldView m_EncodedLegSecurityDesc;
+      double m_LegRatioQty;
+      char m_LegSide;
+      FIX::FieldView m_LegCurrency;
+      FIX::FieldView m_LegPool;
+      FIX::FieldView m_LegDatedDate;
+      FIX::FieldView m_LegContractSettlMonth;
+      FIX::FieldView m_LegInterestAccrualDate;
+      double m_LegQty;
+      int m_LegSwapType;
+      NoLegStipulationsEntries m_NoLegStipulations;
+      char m_LegPositionEffect;
+      int m_LegCoveredOrUncovered;
+      NoNestedPartyIDsEntries m_NoNestedPartyIDs;
+      FIX::FieldView m_LegRefID;
+      double m_LegPrice;
+      char m_LegSettlType;
+      FIX::FieldView m_LegSettlDate;
+      double m_LegLastPx;
+    };
+    typedef FIX::InlineVector< NoLegs, 8 > NoLegsEntries;
+
+    class NoMiscFees
+    {
+    public:
+      void decode( FIX::FieldCursor& cursor )
+      {
+        do
+        {
+          switch( cursor.tag() )
+          {
+          case 137:
+            m_present.set( 0 );
+            m_MiscFeeAmt = cursor.getDouble();
+            break;
+          case 138:
+            m_present.set( 1 );
+            m_MiscFeeCurr = cursor.value();
+            break;
+          case 139:
+            m_present.set( 2 );
+            m_MiscFeeType = cursor.value();
+            break;
+          case 891:
+            m_present.set( 3 );
+            m_MiscFeeBasis = cursor.getInt();
+            break;
+          default:
+            return;
+          }
+          cursor.next();
+        }
+        while( cursor.valid() && cursor.tag() != 137 );
+      }
+
+      void clear()
+      {
+        m_present.reset();
+      }
+      bool isSetMiscFeeAmt() const { return m_present[ 0 ]; }
+      double getMiscFeeAmt() const
+      { if( !m_present[ 0 ] ) throw FIX::FieldNotFound( FIX::FIELD::MiscFeeAmt ); return m_MiscFeeAmt; }
+      bool isSetMiscFeeCurr() const { return m_present[ 1 ]; }
+      const FIX::FieldView& getMiscFeeCurr() const
+      { if( !m_present[ 1 ] ) throw FIX::FieldNotFound( FIX::FIELD::MiscFeeCurr ); return m_MiscFeeCurr; }
+      bool isSetMiscFeeType() const { return m_present[ 2 ]; }
+      const FIX::FieldView& getMiscFeeType() const
+      { if( !m_present[ 2 ] ) throw FIX::FieldNotFound( FIX::FIELD::MiscFeeType ); return m_MiscFeeType; }
+      bool isSetMiscFeeBasis() const { return m_present[ 3 ]; }
+      int getMiscFeeBasis() const
+      { if( !m_present[ 3 ] ) throw FIX::FieldNotFound( FIX::FIELD::MiscFeeBasis ); return m_MiscFeeBasis; }
+
+    private:
+      std::bitset< 4 > m_present;
+      double m_MiscFeeAmt;
+      FIX::FieldView m_MiscFeeCurr;
+      FIX::FieldView m_MiscFeeType;
+      int m_MiscFeeBasis;
+    };
+    typedef FIX::InlineVector< NoMiscFees, 8 > NoMiscFeesEntries;
+
+    ExecutionReportDecoder() : m_data( 0 ), m_size( 0 ) {}
+
+    void decode( const std::string& message )
+    { decode( message.data(), message.size() ); }
+    void decode( const char* data, size_t size )
+    {
+      m_data = data;
+      m_size = size;
+      clear();
+      FIX::FieldCursor cursor( data, data + size );
+      while( cursor.valid() )
+      {
+        switch( cursor.tag() )
+        {
+        case 8:
+          m_present.set( 0 );
+          m_BeginString = cursor.value();
+          break;
+        case 9:
+          m_present.set( 1 );
+          m_BodyLength = cursor.getInt();
+          break;
+        case 35:
+          m_present.set( 2 );
+          m_MsgType = cursor.value();
+          if( m_MsgType != "8" )
+            throw FIX::InvalidMessageType( m_MsgType.str() );
+          break;
+        case 49:
+          m_present.set( 3 );
+          m_SenderCompID = cursor.value();
+          break;
+        case 56:
+          m_present.set( 4 );
+          m_TargetCompID = cursor.value();
+          break;
+        case 115:
+          m_present.set( 5 );
+          m_OnBehalfOfCompID = cursor.value();
+          break;
+        case 128:
+          m_present.set( 6 );
+          m_DeliverToCompID = cursor.value();
+          break;
+        case 90:
+          m_present.set( 7 );
+          m_SecureDataLen = cursor.getInt();
+          cursor.setDataLength( 91, m_SecureDataLen );
+          break;
+        case 91:
+          m_present.set( 8 );
+          m_SecureData = cursor.value();
+          break;
+        case 34:
+          m_present.set( 9 );
+          m_MsgSeqNum = cursor.getInt();
+          break;
+        case 50:
+          m_present.set( 10 );
+          m_SenderSubID = cursor.value();
+          break;
+        case 142:
+          m_present.set( 11 );
+          m_SenderLocationID = cursor.value();
+          break;
+        case 57:
+          m_present.set( 12 );
+          m_TargetSubID = cursor.value();
+          break;
+        case 143:
+          m_present.set( 13 );
+          m_TargetLocationID = cursor.value();
+          break;
+        case 116:
+          m_present.set( 14 );
+          m_OnBehalfOfSubID = cursor.value();
+          break;
+        case 144:
+          m_present.set( 15 );
+          m_OnBehalfOfLocationID = cursor.value();
+          break;
+        case 129:
+          m_present.set( 16 );
+          m_DeliverToSubID = cursor.value();
+          break;
+        case 145:
+          m_present.set( 17 );
+          m_DeliverToLocationID = cursor.value();
+          break;
+        case 43:
+          m_present.set( 18 );
+          m_PossDupFlag = cursor.getBool();
+          break;
+        case 97:
+          m_present.set( 19 );
+          m_PossResend = cursor.getBool();
+          break;
+        case 52:
+          m_present.set( 20 );
+          m_SendingTime = cursor.value();
+          break;
+        case 122:
+          m_present.set( 21 );
+          m_OrigSendingTime = cursor.value();
+          break;
+        case 212:
+          m_present.set( 22 );
+          m_XmlDataLen = cursor.getInt();
+          cursor.setDataLength( 213, m_XmlDataLen );
+          break;
+        case 213:
+          m_present.set( 23 );
+          m_XmlData = cursor.value();
+          break;
+        case 347:
+          m_present.set( 24 );
+          m_MessageEncoding = cursor.value();
+          break;
+        case 369:
+          m_present.set( 25 );
+          m_LastMsgSeqNumProcessed = cursor.getInt();
+          break;
+        case 37:
+          m_present.set( 26 );
+          m_OrderID = cursor.value();
+          break;
+        case 198:
+          m_present.set( 27 );
+          m_SecondaryOrderID = cursor.value();
+          break;
+        case 526:
+          m_present.set( 28 );
+          m_SecondaryClOrdID = cursor.value();
+          break;
+        case 527:
+          m_present.set( 29 );
+          m_SecondaryExecID = cursor.value();
+          break;
+        case 11:
+          m_present.set( 30 );
+          m_ClOrdID = cursor.value();
+          break;
+        case 41:
+          m_present.set( 31 );
+          m_OrigClOrdID = cursor.value();
+          break;
+        case 583:
+          m_present.set( 32 );
+          m_ClOrdLinkID = cursor.value();
+          break;
+        case 693:
+          m_present.set( 33 );
+          m_QuoteRespID = cursor.value();
+          break;
+        case 790:
+          m_present.set( 34 );
+          m_OrdStatusReqID = cursor.value();
+          break;
+        case 584:
+          m_present.set( 35 );
+          m_MassStatusReqID = cursor.value();
+          break;
+        case 911:
+          m_present.set( 36 );
+          m_TotNumReports = cursor.getInt();
+          break;
+        case 912:
+          m_present.set( 37 );
+          m_LastRptRequested = cursor.getBool();
+          break;
+        case 453:
+          m_present.set( 38 );
+          FIX::decodeGroups( cursor, m_NoPartyIDs, 453, 448 );
+          continue;
+        case 229:
+          m_present.set( 39 );
+          m_TradeOriginationDate = cursor.value();
+          break;
+        case 382:
+          m_present.set( 40 );
+          FIX::decodeGroups( cursor, m_NoContraBrokers, 382, 375 );
+          continue;
+        case 66:
+          m_present.set( 41 );
+          m_ListID = cursor.value();
+          break;
+        case 548:
+          m_present.set( 42 );
+          m_CrossID = cursor.value();
+          break;
+        case 551:
+          m_present.set( 43 );
+          m_OrigCrossID = cursor.value();
+          break;
+        case 549:
+          m_present.set( 44 );
+          m_CrossType = cursor.getInt();
+          break;
+        case 17:
+          m_present.set( 45 );
+          m_ExecID = cursor.value();
+          break;
+        case 19:
+          m_present.set( 46 );
+          m_ExecRefID = cursor.value();
+          break;
+        case 150:
+          m_present.set( 47 );
+          m_ExecType = cursor.getChar();
+          break;
+        case 39:
+          m_present.set( 48 );
+          m_OrdStatus = cursor.getChar();
+          break;
+        case 636:
+          m_present.set( 49 );
+          m_WorkingIndicator = cursor.getBool();
+          break;
+        case 103:
+          m_present.set( 50 );
+          m_OrdRejReason = cursor.getInt();
+          break;
+        case 378:
+          m_present.set( 51 );
+          m_ExecRestatementReason = cursor.getInt();
+          break;
+        case 1:
+          m_present.set( 52 );
+          m_Account = cursor.value();
+          break;
+        case 660:
+          m_present.set( 53 );
+          m_AcctIDSource = cursor.getInt();
+          break;
+        case 581:
+          m_present.set( 54 );
+          m_AccountType = cursor.getInt();
+          break;
+        case 589:
+          m_present.set( 55 );
+          m_DayBookingInst = cursor.getChar();
+          break;
+        case 590:
+          m_present.set( 56 );
+          m_BookingUnit = cursor.getChar();
+          break;
+        case 591:
+          m_present.set( 57 );
+          m_PreallocMethod = cursor.getChar();
+          break;
+        case 63:
+          m_present.set( 58 );
+          m_SettlType = cursor.value();
+          break;
+        case 64:
+          m_present.set( 59 );
+          m_SettlDate = cursor.value();
+          break;
+        case 544:
+          m_present.set( 60 );
+          m_CashMargin = cursor.getChar();
+          break;
+        case 635:
+          m_present.set( 61 );
+          m_ClearingFeeIndicator = cursor.value();
+          break;
+        case 55:
+          m_present.set( 62 );
+          m_Symbol = cursor.value();
+          break;
+        case 65:
+          m_present.set( 63 );
+          m_SymbolSfx = cursor.value();
+          break;
+        case 48:
+          m_present.set( 64 );
+          m_SecurityID = cursor.value();
+          break;
+        case 22:
+          m_present.set( 65 );
+          m_SecurityIDSource = cursor.value();
+          break;
+        case 460:
+          m_present.set( 66 );
+          m_Product = cursor.getInt();
+          break;
+        case 461:
+          m_present.set( 67 );
+          m_CFICode = cursor.value();
+          break;
+        case 167:
+          m_present.set( 68 );
+          m_SecurityType = cursor.value();
+          break;
+        case 762:
+          m_present.set( 69 );
+          m_SecuritySubType = cursor.value();
+          break;
+        case 200:
+          m_present.set( 70 );
+          m_MaturityMonthYear = cursor.value();
+          break;
+        case 541:
+          m_present.set( 71 );
+          m_MaturityDate = cursor.value();
+          break;
+        case 201:
+          m_present.set( 72 );
+          m_PutOrCall = cursor.getInt();
+          break;
+        case 224:
+          m_present.set( 73 );
+          m_CouponPaymentDate = cursor.value();
+          break;
+        case 225:
+          m_present.set( 74 );
+          m_IssueDate = cursor.value();
+          break;
+        case 239:
+          m_present.set( 75 );
+          m_RepoCollateralSecurityType = cursor.value();
+          break;
+        case 226:
+          m_present.set( 76 );
+          m_RepurchaseTerm = cursor.getInt();
+          break;
+        case 227:
+          m_present.set( 77 );
+          m_RepurchaseRate = cursor.getDouble();
+          break;
+        case 228:
+          m_present.set( 78 );
+          m_Factor = cursor.getDouble();
+          break;
+        case 255:
+          m_present.set( 79 );
+          m_CreditRating = cursor.value();
+          break;
+        case 543:
+          m_present.set( 80 );
+          m_InstrRegistry = cursor.value();
+          break;
+        case 470:
+          m_present.set( 81 );
+          m_CountryOfIssue = cursor.value();
+          break;
+        case 471:
+          m_present.set( 82 );
+          m_StateOrProvinceOfIssue = cursor.value();
+          break;
+        case 472:
+          m_present.set( 83 );
+          m_LocaleOfIssue = cursor.value();
+          break;
+        case 240:
+          m_present.set( 84 );
+          m_RedemptionDate = cursor.value();
+          break;
+        case 202:
+          m_present.set( 85 );
+          m_StrikePrice = cursor.getDouble();
+          break;
+        case 947:
+          m_present.set( 86 );
+          m_StrikeCurrency = cursor.value();
+          break;
+        case 206:
+          m_present.set( 87 );
+          m_OptAttribute = cursor.getChar();
+          break;
+        case 231:
+          m_present.set( 88 );
+          m_ContractMultiplier = cursor.getDouble();
+          break;
+        case 223:
+          m_present.set( 89 );
+          m_CouponRate = cursor.getDouble();
+          break;
+        case 207:
+          m_present.set( 90 );
+          m_SecurityExchange = cursor.value();
+          break;
+        case 106:
+          m_present.set( 91 );
+          m_Issuer = cursor.value();
+          break;
+        case 348:
+          m_present.set( 92 );
+          m_EncodedIssuerLen = cursor.getInt();
+          cursor.setDataLength( 349, m_EncodedIssuerLen );
+          break;
+        case 349:
+          m_present.set( 93 );
+          m_EncodedIssuer = cursor.value();
+          break;
+        case 107:
+          m_present.set( 94 );
+          m_SecurityDesc = cursor.value();
+          break;
+        case 350:
+          m_present.set( 95 );
+          m_EncodedSecurityDescLen = cursor.getInt();
+          cursor.setDataLength( 351, m_EncodedSecurityDescLen );
+          break;
+        case 351:
+          m_present.set( 96 );
+          m_EncodedSecurityDesc = cursor.value();
+          break;
+        case 691:
+          m_present.set( 97 );
+          m_Pool = cursor.value();
+          break;
+        case 667:
+          m_present.set( 98 );
+          m_ContractSettlMonth = cursor.value();
+          break;
+        case 875:
+          m_present.set( 99 );
+          m_CPProgram = cursor.getInt();
+          break;
+        case 876:
+          m_present.set( 100 );
+          m_CPRegType = cursor.value();
+          break;
+        case 873:
+          m_present.set( 101 );
+          m_DatedDate = cursor.value();
+          break;
+        case 874:
+          m_present.set( 102 );
+          m_InterestAccrualDate = cursor.value();
+          break;
+        case 913:
+          m_present.set( 103 );
+          m_AgreementDesc = cursor.value();
+          break;
+        case 914:
+          m_present.set( 104 );
+          m_AgreementID = cursor.value();
+          break;
+        case 915:
+          m_present.set( 105 );
+          m_AgreementDate = cursor.value();
+          break;
+        case 918:
+          m_present.set( 106 );
+          m_AgreementCurrency = cursor.value();
+          break;
+        case 788:
+          m_present.set( 107 );
+          m_TerminationType = cursor.getInt();
+          break;
+        case 916:
+          m_present.set( 108 );
+          m_StartDate = cursor.value();
+          break;
+        case 917:
+          m_present.set( 109 );
+          m_EndDate = cursor.value();
+          break;
+        case 919:
+          m_present.set( 110 );
+          m_DeliveryType = cursor.getInt();
+          break;
+        case 898:
+          m_present.set( 111 );
+          m_MarginRatio = cursor.getDouble();
+          break;
+        case 711:
+          m_present.set( 112 );
+          FIX::decodeGroups( cursor, m_NoUnderlyings, 711, 311 );
+          continue;
+        case 54:
+          m_present.set( 113 );
+          m_Side = cursor.getChar();
+          break;
+        case 232:
+          m_present.set( 114 );
+          FIX::decodeGroups( cursor, m_NoStipulations, 232, 233 );
+          continue;
+        case 854:
+          m_present.set( 115 );
+          m_QtyType = cursor.getInt();
+          break;
+        case 38:
+          m_present.set( 116 );
+          m_OrderQty = cursor.getDouble();
+          break;
+        case 152:
+          m_present.set( 117 );
+          m_CashOrderQty = cursor.getDouble();
+          break;
+        case 516:
+          m_present.set( 118 );
+          m_OrderPercent = cursor.getDouble();
+          break;
+        case 468:
+          m_present.set( 119 );
+          m_RoundingDirection = cursor.getChar();
+          break;
+        case 469:
+          m_present.set( 120 );
+          m_RoundingModulus = cursor.getDouble();
+          break;
+        case 40:
+          m_present.set( 121 );
+          m_OrdType = cursor.getChar();
+          break;
+        case 423:
+          m_present.set( 122 );
+          m_PriceType = cursor.getInt();
+          break;
+        case 44:
+          m_present.set( 123 );
+          m_Price = cursor.getDouble();
+          break;
+        case 99:
+          m_present.set( 124 );
+          m_StopPx = cursor.getDouble();
+          break;
+        case 211:
+          m_present.set( 125 );
+          m_PegOffsetValue = cursor.getDouble();
+          break;
+        case 835:
+          m_present.set( 126 );
+          m_PegMoveType = cursor.getInt();
+          break;
+        case 836:
+          m_present.set( 127 );
+          m_PegOffsetType = cursor.getInt();
+          break;
+        case 837:
+          m_present.set( 128 );
+          m_PegLimitType = cursor.getInt();
+          break;
+        case 838:
+          m_present.set( 129 );
+          m_PegRoundDirection = cursor.getInt();
+          break;
+        case 840:
+          m_present.set( 130 );
+          m_PegScope = cursor.getInt();
+          break;
+        case 388:
+          m_present.set( 131 );
+          m_DiscretionInst = cursor.getChar();
+          break;
+        case 389:
+          m_present.set( 132 );
+          m_DiscretionOffsetValue = cursor.getDouble();
+          break;
+        case 841:
+          m_present.set( 133 );
+          m_DiscretionMoveType = cursor.getInt();
+          break;
+        case 842:
+          m_present.set( 134 );
+          m_DiscretionOffsetType = cursor.getInt();
+          break;
+        case 843:
+          m_present.set( 135 );
+          m_DiscretionLimitType = cursor.getInt();
+          break;
+        case 844:
+          m_present.set( 136 );
+          m_DiscretionRoundDirection = cursor.getInt();
+          break;
+        case 846:
+          m_present.set( 137 );
+          m_DiscretionScope = cursor.getInt();
+          break;
+        case 839:
+          m_present.set( 138 );
+          m_PeggedPrice = cursor.getDouble();
+          break;
+        case 845:
+          m_present.set( 139 );
+          m_DiscretionPrice = cursor.getDouble();
+          break;
+        case 847:
+          m_present.set( 140 );
+          m_TargetStrategy = cursor.getInt();
+          break;
+        case 848:
+          m_present.set( 141 );
+          m_TargetStrategyParameters = cursor.value();
+          break;
+        case 849:
+          m_present.set( 142 );
+          m_ParticipationRate = cursor.getDouble();
+          break;
+        case 850:
+          m_present.set( 143 );
+          m_TargetStrategyPerformance = cursor.getDouble();
+          break;
+        case 15:
+          m_present.set( 144 );
+          m_Currency = cursor.value();
+          break;
+        case 376:
+          m_present.set( 145 );
+          m_ComplianceID = cursor.value();
+          break;
+        case 377:
+          m_present.set( 146 );
+          m_SolicitedFlag = cursor.getBool();
+          break;
+        case 59:
+          m_present.set( 147 );
+          m_TimeInForce = cursor.getChar();
+          break;
+        case 168:
+          m_present.set( 148 );
+          m_EffectiveTime = cursor.value();
+          break;
+        case 432:
+          m_present.set( 149 );
+          m_ExpireDate = cursor.value();
+          break;
+        case 126:
+          m_present.set( 150 );
+          m_ExpireTime = cursor.value();
+          break;
+        case 18:
+          m_present.set( 151 );
+          m_ExecInst = cursor.value();
+          break;
+        case 528:
+          m_present.set( 152 );
+          m_OrderCapacity = cursor.getChar();
+          break;
+        case 529:
+          m_present.set( 153 );
+          m_OrderRestrictions = cursor.value();
+          break;
+        case 582:
+          m_present.set( 154 );
+          m_CustOrderCapacity = cursor.getInt();
+          break;
+        case 32:
+          m_present.set( 155 );
+          m_LastQty = cursor.getDouble();
+          break;
+        case 652:
+          m_present.set( 156 );
+          m_UnderlyingLastQty = cursor.getDouble();
+          break;
+        case 31:
+          m_present.set( 157 );
+          m_LastPx = cursor.getDouble();
+          break;
+        case 651:
+          m_present.set( 158 );
+          m_UnderlyingLastPx = cursor.getDouble();
+          break;
+        case 669:
+          m_present.set( 159 );
+          m_LastParPx = cursor.getDouble();
+          break;
+        case 194:
+          m_present.set( 160 );
+          m_LastSpotRate = cursor.getDouble();
+          break;
+        case 195:
+          m_present.set( 161 );
+          m_LastForwardPoints = cursor.getDouble();
+          break;
+        case 30:
+          m_present.set( 162 );
+          m_LastMkt = cursor.value();
+          break;
+        case 336:
+          m_present.set( 163 );
+          m_TradingSessionID = cursor.value();
+          break;
+        case 625:
+          m_present.set( 164 );
+          m_TradingSessionSubID = cursor.value();
+          break;
+        case 943:
+          m_present.set( 165 );
+          m_TimeBracket = cursor.value();
+          break;
+        case 29:
+          m_present.set( 166 );
+          m_LastCapacity = cursor.getChar();
+          break;
+        case 151:
+          m_present.set( 167 );
+          m_LeavesQty = cursor.getDouble();
+          break;
+        case 14:
+          m_present.set( 168 );
+          m_CumQty = cursor.getDouble();
+          break;
+        case 6:
+          m_present.set( 169 );
+          m_AvgPx = cursor.getDouble();
+          break;
+        case 424:
+          m_present.set( 170 );
+          m_DayOrderQty = cursor.getDouble();
+          break;
+        case 425:
+          m_present.set( 171 );
+          m_DayCumQty = cursor.getDouble();
+          break;
+        case 426:
+          m_present.set( 172 );
+          m_DayAvgPx = cursor.getDouble();
+          break;
+        case 427:
+          m_present.set( 173 );
+          m_GTBookingInst = cursor.getInt();
+          break;
+        case 75:
+          m_present.set( 174 );
+          m_TradeDate = cursor.value();
+          break;
+        case 60:
+          m_present.set( 175 );
+          m_TransactTime = cursor.value();
+          break;
+        case 113:
+          m_present.set( 176 );
+          m_ReportToExch = cursor.getBool();
+          break;
+        case 12:
+          m_present.set( 177 );
+          m_Commission = cursor.getDouble();
+          break;
+        case 13:
+          m_present.set( 178 );
+          m_CommType = cursor.getChar();
+          break;
+        case 479:
+          m_present.set( 179 );
+          m_CommCurrency = cursor.value();
+          break;
+        case 497:
+          m_present.set( 180 );
+          m_FundRenewWaiv = cursor.getChar();
+          break;
+        case 218:
+          m_present.set( 181 );
+          m_Spread = cursor.getDouble();
+          break;
+        case 220:
+          m_present.set( 182 );
+          m_BenchmarkCurveCurrency = cursor.value();
+          break;
+        case 221:
+          m_present.set( 183 );
+          m_BenchmarkCurveName = cursor.value();
+          break;
+        case 222:
+          m_present.set( 184 );
+          m_BenchmarkCurvePoint = cursor.value();
+          break;
+        case 662:
+          m_present.set( 185 );
+          m_BenchmarkPrice = cursor.getDouble();
+          break;
+        case 663:
+          m_present.set( 186 );
+          m_BenchmarkPriceType = cursor.getInt();
+          break;
+        case 699:
+          m_present.set( 187 );
+          m_BenchmarkSecurityID = cursor.value();
+          break;
+        case 761:
+          m_present.set( 188 );
+          m_BenchmarkSecurityIDSource = cursor.value();
+          break;
+        case 235:
+          m_present.set( 189 );
+          m_YieldType = cursor.value();
+          break;
+        case 236:
+          m_present.set( 190 );
+          m_Yield = cursor.getDouble();
+          break;
+        case 701:
+          m_present.set( 191 );
+          m_YieldCalcDate = cursor.value();
+          break;
+        case 696:
+          m_present.set( 192 );
+          m_YieldRedemptionDate = cursor.value();
+          break;
+        case 697:
+          m_present.set( 193 );
+          m_YieldRedemptionPrice = cursor.getDouble();
+          break;
+        case 698:
+          m_present.set( 194 );
+          m_YieldRedemptionPriceType = cursor.getInt();
+          break;
+        case 381:
+          m_present.set( 195 );
+          m_GrossTradeAmt = cursor.getDouble();
+          break;
+        case 157:
+          m_present.set( 196 );
+          m_NumDaysInterest = cursor.getInt();
+          break;
+        case 230:
+          m_present.set( 197 );
+          m_ExDate = cursor.value();
+          break;
+        case 158:
+          m_present.set( 198 );
+          m_AccruedInterestRate = cursor.getDouble();
+          break;
+        case 159:
+          m_present.set( 199 );
+          m_AccruedInterestAmt = cursor.getDouble();
+          break;
+        case 738:
+          m_present.set( 200 );
+          m_InterestAtMaturity = cursor.getDouble();
+          break;
+        case 920:
+          m_present.set( 201 );
+          m_EndAccruedInterestAmt = cursor.getDouble();
+          break;
+        case 921:
+          m_present.set( 202 );
+          m_StartCash = cursor.getDouble();
+          break;
+        case 922:
+          m_present.set( 203 );
+          m_EndCash = cursor.getDouble();
+          break;
+        case 258:
+          m_present.set( 204 );
+          m_TradedFlatSwitch = cursor.getBool();
+          break;
+        case 259:
+          m_present.set( 205 );
+          m_BasisFeatureDate = cursor.value();
+          break;
+        case 260:
+          m_present.set( 206 );
+          m_BasisFeaturePrice = cursor.getDouble();
+          break;
+        case 238:
+          m_present.set( 207 );
+          m_Concession = cursor.getDouble();
+          break;
+        case 237:
+          m_present.set( 208 );
+          m_TotalTakedown = cursor.getDouble();
+          break;
+        case 118:
+          m_present.set( 209 );
+          m_NetMoney = cursor.getDouble();
+          break;
+        case 119:
+          m_present.set( 210 );
+          m_SettlCurrAmt = cursor.getDouble();
+          break;
+        case 120:
+          m_present.set( 211 );
+          m_SettlCurrency = cursor.value();
+          break;
+        case 155:
+          m_present.set( 212 );
+          m_SettlCurrFxRate = cursor.getDouble();
+          break;
+        case 156:
+          m_present.set( 213 );
+          m_SettlCurrFxRateCalc = cursor.getChar();
+          break;
+        case 21:
+          m_present.set( 214 );
+          m_HandlInst = cursor.getChar();
+          break;
+        case 110:
+          m_present.set( 215 );
+          m_MinQty = cursor.getDouble();
+          break;
+        case 111:
+          m_present.set( 216 );
+          m_MaxFloor = cursor.getDouble();
+          break;
+        case 77:
+          m_present.set( 217 );
+          m_PositionEffect = cursor.getChar();
+          break;
+        case 210:
+          m_present.set( 218 );
+          m_MaxShow = cursor.getDouble();
+          break;
+        case 775:
+          m_present.set( 219 );
+          m_BookingType = cursor.getInt();
+          break;
+        case 58:
+          m_present.set( 220 );
+          m_Text = cursor.value();
+          break;
+        case 354:
+          m_present.set( 221 );
+          m_EncodedTextLen = cursor.getInt();
+          cursor.setDataLength( 355, m_EncodedTextLen );
+          break;
+        case 355:
+          m_present.set( 222 );
+          m_EncodedText = cursor.value();
+          break;
+        case 193:
+          m_present.set( 223 );
+          m_SettlDate2 = cursor.value();
+          break;
+        case 192:
+          m_present.set( 224 );
+          m_OrderQty2 = cursor.getDouble();
+          break;
+        case 641:
+          m_present.set( 225 );
+          m_LastForwardPoints2 = cursor.getDouble();
+          break;
+        case 442:
+          m_present.set( 226 );
+          m_MultiLegReportingType = cursor.getChar();
+          break;
+        case 480:
+          m_present.set( 227 );
+          m_CancellationRights = cursor.getChar();
+          break;
+        case 481:
+          m_present.set( 228 );
+          m_MoneyLaunderingStatus = cursor.getChar();
+          break;
+        case 513:
+          m_present.set( 229 );
+          m_RegistID = cursor.value();
+          break;
+        case 494:
+          m_present.set( 230 );
+          m_Designation = cursor.value();
+          break;
+        case 483:
+          m_present.set( 231 );
+          m_TransBkdTime = cursor.value();
+          break;
+        case 515:
+          m_present.set( 232 );
+          m_ExecValuationPoint = cursor.value();
+          break;
+        case 484:
+          m_present.set( 233 );
+          m_ExecPriceType = cursor.getChar();
+          break;
+        case 485:
+          m_present.set( 234 );
+          m_ExecPriceAdjustment = cursor.getDouble();
+          break;
+        case 638:
+          m_present.set( 235 );
+          m_PriorityIndicator = cursor.getInt();
+          break;
+        case 639:
+          m_present.set( 236 );
+          m_PriceImprovement = cursor.getDouble();
+          break;
+        case 851:
+          m_present.set( 237 );
+          m_LastLiquidityInd = cursor.getInt();
+          break;
+        case 518:
+          m_present.set( 238 );
+          FIX::decodeGroups( cursor, m_NoContAmts, 518, 519 );
+          continue;
+        case 555:
+          m_present.set( 239 );
+          FIX::decodeGroups( cursor, m_NoLegs, 555, 600 );
+          continue;
+        case 797:
+          m_present.set( 240 );
+          m_CopyMsgIndicator = cursor.getBool();
+          break;
+        case 136:
+          m_present.set( 241 );
+          FIX::decodeGroups( cursor, m_NoMiscFees, 136, 137 );
+          continue;
+        case 93:
+          m_present.set( 242 );
+          m_SignatureLength = cursor.getInt();
+          cursor.setDataLength( 89, m_SignatureLength );
+          break;
+        case 89:
+          m_present.set( 243 );
+          m_Signature = cursor.value();
+          break;
+        case 10:
+          m_present.set( 244 );
+          m_CheckSum = cursor.value();
+          break;
+        default:
+          break;
+        }
+        cursor.next();
+      }
+    }
+
+    /// Parse the decoded buffer into a full message.
+    void toMessage( FIX::Message& message, const FIX::DataDictionary* pDataDictionary = 0 ) const
+    { message.setString( FIX::INCOMING_DIRECTION, std::string( m_data, m_size ), 0, pDataDictionary ); }
+
+    bool isSetBeginString() const { return m_present[ 0 ]; }
+    const FIX::FieldView& getBeginString() const
+    { if( !m_present[ 0 ] ) throw FIX::FieldNotFound( FIX::FIELD::BeginString ); return m_BeginString; }
+    bool isSetBodyLength() const { return m_present[ 1 ]; }
+    int getBodyLength() const
+    { if( !m_present[ 1 ] ) throw FIX::FieldNotFound( FIX::FIELD::BodyLength ); return m_BodyLength; }
+    bool isSetMsgType() const { return m_present[ 2 ]; }
+    const FIX::FieldView& getMsgType() const
+    { if( !m_present[ 2 ] ) throw FIX::FieldNotFound( FIX::FIELD::MsgType ); return m_MsgType; }
+    bool isSetSenderCompID() const { return m_present[ 3 ]; }
+    const FIX::FieldView& getSenderCompID() const
+    { if( !m_present[ 3 ] ) throw FIX::FieldNotFound( FIX::FIELD::SenderCompID ); return m_SenderCompID; }
+    bool isSetTargetCompID() const { return m_present[ 4 ]; }
+    const FIX::FieldView& getTargetCompID() const
+    { if( !m_present[ 4 ] ) throw FIX::FieldNotFound( FIX::FIELD::TargetCompID ); return m_TargetCompID; }
+    bool isSetOnBehalfOfCompID() const { return m_present[ 5 ]; }
+    const FIX::FieldView& getOnBehalfOfCompID() const
+    { if( !m_present[ 5 ] ) throw FIX::FieldNotFound( FIX::FIELD::OnBehalfOfCompID ); return m_OnBehalfOfCompID; }
+    bool isSetDeliverToCompID() const { return m_present[ 6 ]; }
+    const FIX::FieldView& getDeliverToCompID() const
+    { if( !m_present[ 6 ] ) throw FIX::FieldNotFound( FIX::FIELD::DeliverToCompID ); return m_DeliverToCompID; }
+    bool isSetSecureDataLen() const { return m_present[ 7 ]; }
+    int getSecureDataLen() const
+    { if( !m_present[ 7 ] ) throw FIX::FieldNotFound( FIX::FIELD::SecureDataLen ); return m_SecureDataLen; }
+    bool isSetSecureData() const { return m_present[ 8 ]; }
+    const FIX::FieldView& getSecureData() const
+    { if( !m_present[ 8 ] ) throw FIX::FieldNotFound( FIX::FIELD::SecureData ); return m_SecureData; }
+    bool isSetMsgSeqNum() const { return m_present[ 9 ]; }
+    int getMsgSeqNum() const
+    { if( !m_present[ 9 ] ) throw FIX::FieldNotFound( FIX::FIELD::MsgSeqNum ); return m_MsgSeqNum; }
+    bool isSetSenderSubID() const { return m_present[ 10 ]; }
+    const FIX::FieldView& getSenderSubID() const
+    { if( !m_present[ 10 ] ) throw FIX::FieldNotFound( FIX::FIELD::SenderSubID ); return m_SenderSubID; }
+    bool isSetSenderLocationID() const { return m_present[ 11 ]; }
+    const FIX::FieldView& getSenderLocationID() const
+    { if( !m_present[ 11 ] ) throw FIX::FieldNotFound( FIX::FIELD::SenderLocationID ); return m_SenderLocationID; }
+    bool isSetTargetSubID() const { return m_present[ 12 ]; }
+    const FIX::FieldView& getTargetSubID() const
+    { if( !m_present[ 12 ] ) throw FIX::FieldNotFound( FIX::FIELD::TargetSubID ); return m_TargetSubID; }
+    bool isSetTargetLocationID() const { return m_present[ 13 ]; }
+    const FIX::FieldView& getTargetLocationID() const
+    { if( !m_present[ 13 ] ) throw FIX::FieldNotFound( FIX::FIELD::TargetLocationID ); return m_TargetLocationID; }
+    bool isSetOnBehalfOfSubID() const { return m_present[ 14 ]; }
+    const FIX::FieldView& getOnBehalfOfSubID() const
+    { if( !m_present[ 14 ] ) throw FIX::FieldNotFound( FIX::FIELD::OnBehalfOfSubID ); return m_OnBehalfOfSubID; }
+    bool isSetOnBehalfOfLocationID() const { return m_present[ 15 ]; }
+    const FIX::FieldView& getOnBehalfOfLocationID() const
+    { if( !m_present[ 15 ] ) throw FIX::FieldNotFound( FIX::FIELD::OnBehalfOfLocationID ); return m_OnBehalfOfLocationID; }
+    bool isSetDeliverToSubID() const { return m_present[ 16 ]; }
+    const FIX::FieldView& getDeliverToSubID() const
+    { if( !m_present[ 16 ] ) throw FIX::FieldNotFound( FIX::FIELD::DeliverToSubID ); return m_DeliverToSubID; }
+    bool isSetDeliverToLocationID() const { return m_present[ 17 ]; }
+    const FIX::FieldView& getDeliverToLocationID() const
+    { if( !m_present[ 17 ] ) throw FIX::FieldNotFound( FIX::FIELD::DeliverToLocationID ); return m_DeliverToLocationID; }
+    bool isSetPossDupFlag() const { return m_present[ 18 ]; }
+    bool getPossDupFlag() const
+    { if( !m_present[ 18 ] ) throw FIX::FieldNotFound( FIX::FIELD::PossDupFlag ); return m_PossDupFlag; }
+    bool isSetPossResend() const { return m_present[ 19 ]; }
+    bool getPossResend() const
+    { if( !m_present[ 19 ] ) throw FIX::FieldNotFound( FIX::FIELD::PossResend ); return m_PossResend; }
+    bool isSetSendingTime() const { return m_present[ 20 ]; }
+    const FIX::FieldView& getSendingTime() const
+    { if( !m_present[ 20 ] ) throw FIX::FieldNotFound( FIX::FIELD::SendingTime ); return m_SendingTime; }
+    bool isSetOrigSendingTime() const { return m_present[ 21 ]; }
+    const FIX::FieldView& getOrigSendingTime() const
+    { if( !m_present[ 21 ] ) throw FIX::FieldNotFound( FIX::FIELD::OrigSendingTime ); return m_OrigSendingTime; }
+    bool isSetXmlDataLen() const { return m_present[ 22 ]; }
+    int getXmlDataLen() const
+    { if( !m_present[ 22 ] ) throw FIX::FieldNotFound( FIX::FIELD::XmlDataLen ); return m_XmlDataLen; }
+    bool isSetXmlData() const { return m_present[ 23 ]; }
+    const FIX::FieldView& getXmlData() const
+    { if( !m_present[ 23 ] ) throw FIX::FieldNotFound( FIX::FIELD::XmlData ); return m_XmlData; }
+    bool isSetMessageEncoding() const { return m_present[ 24 ]; }
+    const FIX::FieldView& getMessageEncoding() const
+    { if( !m_present[ 24 ] ) throw FIX::FieldNotFound( FIX::FIELD::MessageEncoding ); return m_MessageEncoding; }
+    bool isSetLastMsgSeqNumProcessed() const { return m_present[ 25 ]; }
+    int getLastMsgSeqNumProcessed() const
+    { if( !m_present[ 25 ] ) throw FIX::FieldNotFound( FIX::FIELD::LastMsgSeqNumProcessed ); return m_LastMsgSeqNumProcessed; }
+    bool isSetOrderID() const { return m_present[ 26 ]; }
+    const FIX::FieldView& getOrderID() const
+    { if( !m_present[ 26 ] ) throw FIX::FieldNotFound( FIX::FIELD::OrderID ); return m_OrderID; }
+    bool isSetSecondaryOrderID() const { return m_present[ 27 ]; }
+    const FIX::FieldView& getSecondaryOrderID() const
+    { if( !m_present[ 27 ] ) throw FIX::FieldNotFound( FIX::FIELD::SecondaryOrderID ); return m_SecondaryOrderID; }
+    bool isSetSecondaryClOrdID() const { return m_present[ 28 ]; }
+    const FIX::FieldView& getSecondaryClOrdID() const
+    { if( !m_present[ 28 ] ) throw FIX::FieldNotFound( FIX::FIELD::SecondaryClOrdID ); return m_SecondaryClOrdID; }
+    bool isSetSecondaryExecID() const { return m_present[ 29 ]; }
+    const FIX::FieldView& getSecondaryExecID() const
+    { if( !m_present[ 29 ] ) throw FIX::FieldNotFound( FIX::FIELD::SecondaryExecID ); return m_SecondaryExecID; }
+    bool isSetClOrdID() const { return m_present[ 30 ]; }
+    const FIX::FieldView& getClOrdID() const
+    { if( !m_present[ 30 ] ) throw FIX::FieldNotFound( FIX::FIELD::ClOrdID ); return m_ClOrdID; }
+    bool isSetOrigClOrdID() const { return m_present[ 31 ]; }
+    const FIX::FieldView& getOrigClOrdID() const
+    { if( !m_present[ 31 ] ) throw FIX::FieldNotFound( FIX::FIELD::OrigClOrdID ); return m_OrigClOrdID; }
+    bool isSetClOrdLinkID() const { return m_present[ 32 ]; }
+    const FIX::FieldView& getClOrdLinkID() const
+    { if( !m_present[ 32 ] ) throw FIX::FieldNotFound( FIX::FIELD::ClOrdLinkID ); return m_ClOrdLinkID; }
+    bool isSetQuoteRespID() const { return m_present[ 33 ]; }
+    const FIX::FieldView& getQuoteRespID() const
+    { if( !m_present[ 33 ] ) throw FIX::FieldNotFound( FIX::FIELD::QuoteRespID ); return m_QuoteRespID; }
+    bool isSetOrdStatusReqID() const { return m_present[ 34 ]; }
+    const FIX::FieldView& getOrdStatusReqID() const
+    { if( !m_present[ 34 ] ) throw FIX::FieldNotFound( FIX::FIELD::OrdStatusReqID ); return m_OrdStatusReqID; }
+    bool isSetMassStatusReqID() const { return m_present[ 35 ]; }
+    const FIX::FieldView& getMassStatusReqID() const
+    { if( !m_present[ 35 ] ) throw FIX::FieldNotFound( FIX::FIELD::MassStatusReqID ); return m_MassStatusReqID; }
+    bool isSetTotNumReports() const { return m_present[ 36 ]; }
+    int getTotNumReports() const
+    { if( !m_present[ 36 ] ) throw FIX::FieldNotFound( FIX::FIELD::TotNumReports ); return m_TotNumReports; }
+    bool isSetLastRptRequested() const { return m_present[ 37 ]; }
+    bool getLastRptRequested() const
+    { if( !m_present[ 37 ] ) throw FIX::FieldNotFound( FIX::FIELD::LastRptRequested ); return m_LastRptRequested; }
+    bool isSetNoPartyIDs() const { return m_present[ 38 ]; }
+    const NoPartyIDsEntries& getNoPartyIDs() const { return m_NoPartyIDs; }
+    bool isSetTradeOriginationDate() const { return m_present[ 39 ]; }
+    const FIX::FieldView& getTradeOriginationDate() const
+    { if( !m_present[ 39 ] ) throw FIX::FieldNotFound( FIX::FIELD::TradeOriginationDate ); return m_TradeOriginationDate; }
+    bool isSetNoContraBrokers() const { return m_present[ 40 ]; }
+    const NoContraBrokersEntries& getNoContraBrokers() const { return m_NoContraBrokers; }
+    bool isSetListID() const { return m_present[ 41 ]; }
+    const FIX::FieldView& getListID() const
+    { if( !m_present[ 41 ] ) throw FIX::FieldNotFound( FIX::FIELD::ListID ); return m_ListID; }
+    bool isSetCrossID() const { return m_present[ 42 ]; }
+    const FIX::FieldView& getCrossID() const
+    { if( !m_present[ 42 ] ) throw FIX::FieldNotFound( FIX::FIELD::CrossID ); return m_CrossID; }
+    bool isSetOrigCrossID() const { return m_present[ 43 ]; }
+    const FIX::FieldView& getOrigCrossID() const
+    { if( !m_present[ 43 ] ) throw FIX::FieldNotFound( FIX::FIELD::OrigCrossID ); return m_OrigCrossID; }
+    bool isSetCrossType() const { return m_present[ 44 ]; }
+    int getCrossType() const
+    { if( !m_present[ 44 ] ) throw FIX::FieldNotFound( FIX::FIELD::CrossType ); return m_CrossType; }
+    bool isSetExecID() const { return m_present[ 45 ]; }
+    const FIX::FieldView& getExecID() const
+    { if( !m_present[ 45 ] ) throw FIX::FieldNotFound( FIX::FIELD::ExecID ); return m_ExecID; }
+    bool isSetExecRefID() const { return m_present[ 46 ]; }
+    const FIX::FieldView& getExecRefID() const
+    { if( !m_present[ 46 ] ) throw FIX::FieldNotFound( FIX::FIELD::ExecRefID ); return m_ExecRefID; }
+    bool isSetExecType() const { return m_present[ 47 ]; }
+    char getExecType() const
+    { if( !m_present[ 47 ] ) throw FIX::FieldNotFound( FIX::FIELD::ExecType ); return m_ExecType; }
+    bool isSetOrdStatus() const { return m_present[ 48 ]; }
+    char getOrdStatus() const
+    { if( !m_present[ 48 ] ) throw FIX::FieldNotFound( FIX::FIELD::OrdStatus ); return m_OrdStatus; }
+    bool isSetWorkingIndicator() const { return m_present[ 49 ]; }
+    bool getWorkingIndicator() const
+    { if( !m_present[ 49 ] ) throw FIX::FieldNotFound( FIX::FIELD::WorkingIndicator ); return m_WorkingIndicator; }
+    bool isSetOrdRejReason() const { return m_present[ 50 ]; }
+    int getOrdRejReason() const
+    { if( !m_present[ 50 ] ) throw FIX::FieldNotFound( FIX::FIELD::OrdRejReason ); return m_OrdRejReason; }
+    bool isSetExecRestatementReason() const { return m_present[ 51 ]; }
+    int getExecRestatementReason() const
+    { if( !m_present[ 51 ] ) throw FIX::FieldNotFound( FIX::FIELD::ExecRestatementReason ); return m_ExecRestatementReason; }
+    bool isSetAccount() const { return m_present[ 52 ]; }
+    const FIX::FieldView& getAccount() const
+    { if( !m_present[ 52 ] ) throw FIX::FieldNotFound( FIX::FIELD::Account ); return m_Account; }
+    bool isSetAcctIDSource() const { return m_present[ 53 ]; }
+    int getAcctIDSource() const
+    { if( !m_present[ 53 ] ) throw FIX::FieldNotFound( FIX::FIELD::AcctIDSource ); return m_AcctIDSource; }
+    bool isSetAccountType() const { return m_present[ 54 ]; }
+    int getAccountType() const
+    { if( !m_present[ 54 ] ) throw FIX::FieldNotFound( FIX::FIELD::AccountType ); return m_AccountType; }
+    bool isSetDayBookingInst() const { return m_present[ 55 ]; }
+    char getDayBookingInst() const
+    { if( !m_present[ 55 ] ) throw FIX::FieldNotFound( FIX::FIELD::DayBookingInst ); return m_DayBookingInst; }
+    bool isSetBookingUnit() const { return m_present[ 56 ]; }
+    char getBookingUnit() const
+    { if( !m_present[ 56 ] ) throw FIX::FieldNotFound( FIX::FIELD::BookingUnit ); return m_BookingUnit; }
+    bool isSetPreallocMethod() const { return m_present[ 57 ]; }
+    char getPreallocMethod() const
+    { if( !m_present[ 57 ] ) throw FIX::FieldNotFound( FIX::FIELD::PreallocMethod ); return m_PreallocMethod; }
+    bool isSetSettlType() const { return m_present[ 58 ]; }
+    const FIX::FieldView& getSettlType() const
+    { if( !m_present[ 58 ] ) throw FIX::FieldNotFound( FIX::FIELD::SettlType ); return m_SettlType; }
+    bool isSetSettlDate() const { return m_present[ 59 ]; }
+    const FIX::FieldView& getSettlDate() const
+    { if( !m_present[ 59 ] ) throw FIX::FieldNotFound( FIX::FIELD::SettlDate ); return m_SettlDate; }
+    bool isSetCashMargin() const { return m_present[ 60 ]; }
+    char getCashMargin() const
+    { if( !m_present[ 60 ] ) throw FIX::FieldNotFound( FIX::FIELD::CashMargin ); return m_CashMargin; }
+    bool isSetClearingFeeIndicator() const { return m_present[ 61 ]; }
+    const FIX::FieldView& getClearingFeeIndicator() const
+    { if( !m_present[ 61 ] ) throw FIX::FieldNotFound( FIX::FIELD::ClearingFeeIndicator ); return m_ClearingFeeIndicator; }
+    bool isSetSymbol() const { return m_present[ 62 ]; }
+    const FIX::FieldView& getSymbol() const
+    { if( !m_present[ 62 ] ) throw FIX::FieldNotFound( FIX::FIELD::Symbol ); return m_Symbol; }
+    bool isSetSymbolSfx() const { return m_present[ 63 ]; }
+    const FIX::FieldView& getSymbolSfx() const
+    { if( !m_present[ 63 ] ) throw FIX::FieldNotFound( FIX::FIELD::SymbolSfx ); return m_SymbolSfx; }
+    bool isSetSecurityID() const { return m_present[ 64 ]; }
+    const FIX::FieldView& getSecurityID() const
+    { if( !m_present[ 64 ] ) throw FIX::FieldNotFound( FIX::FIELD::SecurityID ); return m_SecurityID; }
+    bool isSetSecurityIDSource() const { return m_present[ 65 ]; }
+    const FIX::FieldView& getSecurityIDSource() const
+    { if( !m_present[ 65 ] ) throw FIX::FieldNotFound( FIX::FIELD::SecurityIDSource ); return m_SecurityIDSource; }
+    bool isSetProduct() const { return m_present[ 66 ]; }
+    int getProduct() const
+    { if( !m_present[ 66 ] ) throw FIX::FieldNotFound( FIX::FIELD::Product ); return m_Product; }
+    bool isSetCFICode() const { return m_present[ 67 ]; }
+    const FIX::FieldView& getCFICode() const
+    { if( !m_present[ 67 ] ) throw FIX::FieldNotFound( FIX::FIELD::CFICode ); return m_CFICode; }
+    bool isSetSecurityType() const { return m_present[ 68 ]; }
+    const FIX::FieldView& getSecurityType() const
+    { if( !m_present[ 68 ] ) throw FIX::FieldNotFound( FIX::FIELD::SecurityType ); return m_SecurityType; }
+    bool isSetSecuritySubType() const { return m_present[ 69 ]; }
+    const FIX::FieldView& getSecuritySubType() const
+    { if( !m_present[ 69 ] ) throw FIX::FieldNotFound( FIX::FIELD::SecuritySubType ); return m_SecuritySubType; }
+    bool isSetMaturityMonthYear() const { return m_present[ 70 ]; }
+    const FIX::FieldView& getMaturityMonthYear() const
+    { if( !m_present[ 70 ] ) throw FIX::FieldNotFound( FIX::FIELD::MaturityMonthYear ); return m_MaturityMonthYear; }
+    bool isSetMaturityDate() const { return m_present[ 71 ]; }
+    const FIX::FieldView& getMaturityDate() const
+    { if( !m_present[ 71 ] ) throw FIX::FieldNotFound( FIX::FIELD::MaturityDate ); return m_MaturityDate; }
+    bool isSetPutOrCall() const { return m_present[ 72 ]; }
+    int getPutOrCall() const
+    { if( !m_present[ 72 ] ) throw FIX::FieldNotFound( FIX::FIELD::PutOrCall ); return m_PutOrCall; }
+    bool isSetCouponPaymentDate() const { return m_present[ 73 ]; }
+    const FIX::FieldView& getCouponPaymentDate() const
+    { if( !m_present[ 73 ] ) throw FIX::FieldNotFound( FIX::FIELD::CouponPaymentDate ); return m_CouponPaymentDate; }
+    bool isSetIssueDate() const { return m_present[ 74 ]; }
+    const FIX::FieldView& getIssueDate() const
+    { if( !m_present[ 74 ] ) throw FIX::FieldNotFound( FIX::FIELD::IssueDate ); return m_IssueDate; }
+    bool isSetRepoCollateralSecurityType() const { return m_present[ 75 ]; }
+    const FIX::FieldView& getRepoCollateralSecurityType() const
+    { if( !m_present[ 75 ] ) throw FIX::FieldNotFound( FIX::FIELD::RepoCollateralSecurityType ); return m_RepoCollateralSecurityType; }
+    bool isSetRepurchaseTerm() const { return m_present[ 76 ]; }
+    int getRepurchaseTerm() const
+    { if( !m_present[ 76 ] ) throw FIX::FieldNotFound( FIX::FIELD::RepurchaseTerm ); return m_RepurchaseTerm; }
+    bool isSetRepurchaseRate() const { return m_present[ 77 ]; }
+    double getRepurchaseRate() const
+    { if( !m_present[ 77 ] ) throw FIX::FieldNotFound( FIX::FIELD::RepurchaseRate ); return m_RepurchaseRate; }
+    bool isSetFactor() const { return m_present[ 78 ]; }
+    double getFactor() const
+    { if( !m_present[ 78 ] ) throw FIX::FieldNotFound( FIX::FIELD::Factor ); return m_Factor; }
+    bool isSetCreditRating() const { return m_present[ 79 ]; }
+    const FIX::FieldView& getCreditRating() const
+    { if( !m_present[ 79 ] ) throw FIX::FieldNotFound( FIX::FIELD::CreditRating ); return m_CreditRating; }
+    bool isSetInstrRegistry() const { return m_present[ 80 ]; }
+    const FIX::FieldView& getInstrRegistry() const
+    { if( !m_present[ 80 ] ) throw FIX::FieldNotFound( FIX::FIELD::InstrRegistry ); return m_InstrRegistry; }
+    bool isSetCountryOfIssue() const { return m_present[ 81 ]; }
+    const FIX::FieldView& getCountryOfIssue() const
+    { if( !m_present[ 81 ] ) throw FIX::FieldNotFound( FIX::FIELD::CountryOfIssue ); return m_CountryOfIssue; }
+    bool isSetStateOrProvinceOfIssue() const { return m_present[ 82 ]; }
+    const FIX::FieldView& getStateOrProvinceOfIssue() const
+    { if( !m_present[ 82 ] ) throw FIX::FieldNotFound( FIX::FIELD::StateOrProvinceOfIssue ); return m_StateOrProvinceOfIssue; }
+    bool isSetLocaleOfIssue() const { return m_present[ 83 ]; }
+    const FIX::FieldView& getLocaleOfIssue() const
+    { if( !m_present[ 83 ] ) throw FIX::FieldNotFound( FIX::FIELD::LocaleOfIssue ); return m_LocaleOfIssue; }
+    bool isSetRedemptionDate() const { return m_present[ 84 ]; }
+    const FIX::FieldView& getRedemptionDate() const
+    { if( !m_present[ 84 ] ) throw FIX::FieldNotFound( FIX::FIELD::RedemptionDate ); return m_RedemptionDate; }
+    bool isSetStrikePrice() const { return m_present[ 85 ]; }
+    double getStrikePrice() const
+    { if( !m_present[ 85 ] ) throw FIX::FieldNotFound( FIX::FIELD::StrikePrice ); return m_StrikePrice; }
+    bool isSetStrikeCurrency() const { return m_present[ 86 ]; }
+    const FIX::FieldView& getStrikeCurrency() const
+    { if( !m_present[ 86 ] ) throw FIX::FieldNotFound( FIX::FIELD::StrikeCurrency ); return m_StrikeCurrency; }
+    bool isSetOptAttribute() const { return m_present[ 87 ]; }
+    char getOptAttribute() const
+    { if( !m_present[ 87 ] ) throw FIX::FieldNotFound( FIX::FIELD::OptAttribute ); return m_OptAttribute; }
+    bool isSetContractMultiplier() const { return m_present[ 88 ]; }
+    double getContractMultiplier() const
+    { if( !m_present[ 88 ] ) throw FIX::FieldNotFound( FIX::FIELD::ContractMultiplier ); return m_ContractMultiplier; }
+    bool isSetCouponRate() const { return m_present[ 89 ]; }
+    double getCouponRate() const
+    { if( !m_present[ 89 ] ) throw FIX::FieldNotFound( FIX::FIELD::CouponRate ); return m_CouponRate; }
+    bool isSetSecurityExchange() const { return m_present[ 90 ]; }
+    const FIX::FieldView& getSecurityExchange() const
+    { if( !m_present[ 90 ] ) throw FIX::FieldNotFound( FIX::FIELD::SecurityExchange ); return m_SecurityExchange; }
+    bool isSetIssuer() const { return m_present[ 91 ]; }
+    const FIX::FieldView& getIssuer() const
+    { if( !m_present[ 91 ] ) throw FIX::FieldNotFound( FIX::FIELD::Issuer ); return m_Issuer; }
+    bool isSetEncodedIssuerLen() const { return m_present[ 92 ]; }
+    int getEncodedIssuerLen() const
+    { if( !m_present[ 92 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedIssuerLen ); return m_EncodedIssuerLen; }
+    bool isSetEncodedIssuer() const { return m_present[ 93 ]; }
+    const FIX::FieldView& getEncodedIssuer() const
+    { if( !m_present[ 93 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedIssuer ); return m_EncodedIssuer; }
+    bool isSetSecurityDesc() const { return m_present[ 94 ]; }
+    const FIX::FieldView& getSecurityDesc() const
+    { if( !m_present[ 94 ] ) throw FIX::FieldNotFound( FIX::FIELD::SecurityDesc ); return m_SecurityDesc; }
+    bool isSetEncodedSecurityDescLen() const { return m_present[ 95 ]; }
+    int getEncodedSecurityDescLen() const
+    { if( !m_present[ 95 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedSecurityDescLen ); return m_EncodedSecurityDescLen; }
+    bool isSetEncodedSecurityDesc() const { return m_present[ 96 ]; }
+    const FIX::FieldView& getEncodedSecurityDesc() const
+    { if( !m_present[ 96 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedSecurityDesc ); return m_EncodedSecurityDesc; }
+    bool isSetPool() const { return m_present[ 97 ]; }
+    const FIX::FieldView& getPool() const
+    { if( !m_present[ 97 ] ) throw FIX::FieldNotFound( FIX::FIELD::Pool ); return m_Pool; }
+    bool isSetContractSettlMonth() const { return m_present[ 98 ]; }
+    const FIX::FieldView& getContractSettlMonth() const
+    { if( !m_present[ 98 ] ) throw FIX::FieldNotFound( FIX::FIELD::ContractSettlMonth ); return m_ContractSettlMonth; }
+    bool isSetCPProgram() const { return m_present[ 99 ]; }
+    int getCPProgram() const
+    { if( !m_present[ 99 ] ) throw FIX::FieldNotFound( FIX::FIELD::CPProgram ); return m_CPProgram; }
+    bool isSetCPRegType() const { return m_present[ 100 ]; }
+    const FIX::FieldView& getCPRegType() const
+    { if( !m_present[ 100 ] ) throw FIX::FieldNotFound( FIX::FIELD::CPRegType ); return m_CPRegType; }
+    bool isSetDatedDate() const { return m_present[ 101 ]; }
+    const FIX::FieldView& getDatedDate() const
+    { if( !m_present[ 101 ] ) throw FIX::FieldNotFound( FIX::FIELD::DatedDate ); return m_DatedDate; }
+    bool isSetInterestAccrualDate() const { return m_present[ 102 ]; }
+    const FIX::FieldView& getInterestAccrualDate() const
+    { if( !m_present[ 102 ] ) throw FIX::FieldNotFound( FIX::FIELD::InterestAccrualDate ); return m_InterestAccrualDate; }
+    bool isSetAgreementDesc() const { return m_present[ 103 ]; }
+    const FIX::FieldView& getAgreementDesc() const
+    { if( !m_present[ 103 ] ) throw FIX::FieldNotFound( FIX::FIELD::AgreementDesc ); return m_AgreementDesc; }
+    bool isSetAgreementID() const { return m_present[ 104 ]; }
+    const FIX::FieldView& getAgreementID() const
+    { if( !m_present[ 104 ] ) throw FIX::FieldNotFound( FIX::FIELD::AgreementID ); return m_AgreementID; }
+    bool isSetAgreementDate() const { return m_present[ 105 ]; }
+    const FIX::FieldView& getAgreementDate() const
+    { if( !m_present[ 105 ] ) throw FIX::FieldNotFound( FIX::FIELD::AgreementDate ); return m_AgreementDate; }
+    bool isSetAgreementCurrency() const { return m_present[ 106 ]; }
+    const FIX::FieldView& getAgreementCurrency() const
+    { if( !m_present[ 106 ] ) throw FIX::FieldNotFound( FIX::FIELD::AgreementCurrency ); return m_AgreementCurrency; }
+    bool isSetTerminationType() const { return m_present[ 107 ]; }
+    int getTerminationType() const
+    { if( !m_present[ 107 ] ) throw FIX::FieldNotFound( FIX::FIELD::TerminationType ); return m_TerminationType; }
+    bool isSetStartDate() const { return m_present[ 108 ]; }
+    const FIX::FieldView& getStartDate() const
+    { if( !m_present[ 108 ] ) throw FIX::FieldNotFound( FIX::FIELD::StartDate ); return m_StartDate; }
+    bool isSetEndDate() const { return m_present[ 109 ]; }
+    const FIX::FieldView& getEndDate() const
+    { if( !m_present[ 109 ] ) throw FIX::FieldNotFound( FIX::FIELD::EndDate ); return m_EndDate; }
+    bool isSetDeliveryType() const { return m_present[ 110 ]; }
+    int getDeliveryType() const
+    { if( !m_present[ 110 ] ) throw FIX::FieldNotFound( FIX::FIELD::DeliveryType ); return m_DeliveryType; }
+    bool isSetMarginRatio() const { return m_present[ 111 ]; }
+    double getMarginRatio() const
+    { if( !m_present[ 111 ] ) throw FIX::FieldNotFound( FIX::FIELD::MarginRatio ); return m_MarginRatio; }
+    bool isSetNoUnderlyings() const { return m_present[ 112 ]; }
+    const NoUnderlyingsEntries& getNoUnderlyings() const { return m_NoUnderlyings; }
+    bool isSetSide() const { return m_present[ 113 ]; }
+    char getSide() const
+    { if( !m_present[ 113 ] ) throw FIX::FieldNotFound( FIX::FIELD::Side ); return m_Side; }
+    bool isSetNoStipulations() const { return m_present[ 114 ]; }
+    const NoStipulationsEntries& getNoStipulations() const { return m_NoStipulations; }
+    bool isSetQtyType() const { return m_present[ 115 ]; }
+    int getQtyType() const
+    { if( !m_present[ 115 ] ) throw FIX::FieldNotFound( FIX::FIELD::QtyType ); return m_QtyType; }
+    bool isSetOrderQty() const { return m_present[ 116 ]; }
+    double getOrderQty() const
+    { if( !m_present[ 116 ] ) throw FIX::FieldNotFound( FIX::FIELD::OrderQty ); return m_OrderQty; }
+    bool isSetCashOrderQty() const { return m_present[ 117 ]; }
+    double getCashOrderQty() const
+    { if( !m_present[ 117 ] ) throw FIX::FieldNotFound( FIX::FIELD::CashOrderQty ); return m_CashOrderQty; }
+    bool isSetOrderPercent() const { return m_present[ 118 ]; }
+    double getOrderPercent() const
+    { if( !m_present[ 118 ] ) throw FIX::FieldNotFound( FIX::FIELD::OrderPercent ); return m_OrderPercent; }
+    bool isSetRoundingDirection() const { return m_present[ 119 ]; }
+    char getRoundingDirection() const
+    { if( !m_present[ 119 ] ) throw FIX::FieldNotFound( FIX::FIELD::RoundingDirection ); return m_RoundingDirection; }
+    bool isSetRoundingModulus() const { return m_present[ 120 ]; }
+    double getRoundingModulus() const
+    { if( !m_present[ 120 ] ) throw FIX::FieldNotFound( FIX::FIELD::RoundingModulus ); return m_RoundingModulus; }
+    bool isSetOrdType() const { return m_present[ 121 ]; }
+    char getOrdType() const
+    { if( !m_present[ 121 ] ) throw FIX::FieldNotFound( FIX::FIELD::OrdType ); return m_OrdType; }
+    bool isSetPriceType() const { return m_present[ 122 ]; }
+    int getPriceType() const
+    { if( !m_present[ 122 ] ) throw FIX::FieldNotFound( FIX::FIELD::PriceType ); return m_PriceType; }
+    bool isSetPrice() const { return m_present[ 123 ]; }
+    double getPrice() const
+    { if( !m_present[ 123 ] ) throw FIX::FieldNotFound( FIX::FIELD::Price ); return m_Price; }
+    bool isSetStopPx() const { return m_present[ 124 ]; }
+    double getStopPx() const
+    { if( !m_present[ 124 ] ) throw FIX::FieldNotFound( FIX::FIELD::StopPx ); return m_StopPx; }
+    bool isSetPegOffsetValue() const { return m_present[ 125 ]; }
+    double getPegOffsetValue() const
+    { if( !m_present[ 125 ] ) throw FIX::FieldNotFound( FIX::FIELD::PegOffsetValue ); return m_PegOffsetValue; }
+    bool isSetPegMoveType() const { return m_present[ 126 ]; }
+    int getPegMoveType() const
+    { if( !m_present[ 126 ] ) throw FIX::FieldNotFound( FIX::FIELD::PegMoveType ); return m_PegMoveType; }
+    bool isSetPegOffsetType() const { return m_present[ 127 ]; }
+    int getPegOffsetType() const
+    { if( !m_present[ 127 ] ) throw FIX::FieldNotFound( FIX::FIELD::PegOffsetType ); return m_PegOffsetType; }
+    bool isSetPegLimitType() const { return m_present[ 128 ]; }
+    int getPegLimitType() const
+    { if( !m_present[ 128 ] ) throw FIX::FieldNotFound( FIX::FIELD::PegLimitType ); return m_PegLimitType; }
+    bool isSetPegRoundDirection() const { return m_present[ 129 ]; }
+    int getPegRoundDirection() const
+    { if( !m_present[ 129 ] ) throw FIX::FieldNotFound( FIX::FIELD::PegRoundDirection ); return m_PegRoundDirection; }
+    bool isSetPegScope() const { return m_present[ 130 ]; }
+    int getPegScope() const
+    { if( !m_present[ 130 ] ) throw FIX::FieldNotFound( FIX::FIELD::PegScope ); return m_PegScope; }
+    bool isSetDiscretionInst() const { return m_present[ 131 ]; }
+    char getDiscretionInst() const
+    { if( !m_present[ 131 ] ) throw FIX::FieldNotFound( FIX::FIELD::DiscretionInst ); return m_DiscretionInst; }
+    bool isSetDiscretionOffsetValue() const { return m_present[ 132 ]; }
+    double getDiscretionOffsetValue() const
+    { if( !m_present[ 132 ] ) throw FIX::FieldNotFound( FIX::FIELD::DiscretionOffsetValue ); return m_DiscretionOffsetValue; }
+    bool isSetDiscretionMoveType() const { return m_present[ 133 ]; }
+    int getDiscretionMoveType() const
+    { if( !m_present[ 133 ] ) throw FIX::FieldNotFound( FIX::FIELD::DiscretionMoveType ); return m_DiscretionMoveType; }
+    bool isSetDiscretionOffsetType() const { return m_present[ 134 ]; }
+    int getDiscretionOffsetType() const
+    { if( !m_present[ 134 ] ) throw FIX::FieldNotFound( FIX::FIELD::DiscretionOffsetType ); return m_DiscretionOffsetType; }
+    bool isSetDiscretionLimitType() const { return m_present[ 135 ]; }
+    int getDiscretionLimitType() const
+    { if( !m_present[ 135 ] ) throw FIX::FieldNotFound( FIX::FIELD::DiscretionLimitType ); return m_DiscretionLimitType; }
+    bool isSetDiscretionRoundDirection() const { return m_present[ 136 ]; }
+    int getDiscretionRoundDirection() const
+    { if( !m_present[ 136 ] ) throw FIX::FieldNotFound( FIX::FIELD::DiscretionRoundDirection ); return m_DiscretionRoundDirection; }
+    bool isSetDiscretionScope() const { return m_present[ 137 ]; }
+    int getDiscretionScope() const
+    { if( !m_present[ 137 ] ) throw FIX::FieldNotFound( FIX::FIELD::DiscretionScope ); return m_DiscretionScope; }
+    bool isSetPeggedPrice() const { return m_present[ 138 ]; }
+    double getPeggedPrice() const
+    { if( !m_present[ 138 ] ) throw FIX::FieldNotFound( FIX::FIELD::PeggedPrice ); return m_PeggedPrice; }
+    bool isSetDiscretionPrice() const { return m_present[ 139 ]; }
+    double getDiscretionPrice() const
+    { if( !m_present[ 139 ] ) throw FIX::FieldNotFound( FIX::FIELD::DiscretionPrice ); return m_DiscretionPrice; }
+    bool isSetTargetStrategy() const { return m_present[ 140 ]; }
+    int getTargetStrategy() const
+    { if( !m_present[ 140 ] ) throw FIX::FieldNotFound( FIX::FIELD::TargetStrategy ); return m_TargetStrategy; }
+    bool isSetTargetStrategyParameters() const { return m_present[ 141 ]; }
+    const FIX::FieldView& getTargetStrategyParameters() const
+    { if( !m_present[ 141 ] ) throw FIX::FieldNotFound( FIX::FIELD::TargetStrategyParameters ); return m_TargetStrategyParameters; }
+    bool isSetParticipationRate() const { return m_present[ 142 ]; }
+    double getParticipationRate() const
+    { if( !m_present[ 142 ] ) throw FIX::FieldNotFound( FIX::FIELD::ParticipationRate ); return m_ParticipationRate; }
+    bool isSetTargetStrategyPerformance() const { return m_present[ 143 ]; }
+    double getTargetStrategyPerformance() const
+    { if( !m_present[ 143 ] ) throw FIX::FieldNotFound( FIX::FIELD::TargetStrategyPerformance ); return m_TargetStrategyPerformance; }
+    bool isSetCurrency() const { return m_present[ 144 ]; }
+    const FIX::FieldView& getCurrency() const
+    { if( !m_present[ 144 ] ) throw FIX::FieldNotFound( FIX::FIELD::Currency ); return m_Currency; }
+    bool isSetComplianceID() const { return m_present[ 145 ]; }
+    const FIX::FieldView& getComplianceID() const
+    { if( !m_present[ 145 ] ) throw FIX::FieldNotFound( FIX::FIELD::ComplianceID ); return m_ComplianceID; }
+    bool isSetSolicitedFlag() const { return m_present[ 146 ]; }
+    bool getSolicitedFlag() const
+    { if( !m_present[ 146 ] ) throw FIX::FieldNotFound( FIX::FIELD::SolicitedFlag ); return m_SolicitedFlag; }
+    bool isSetTimeInForce() const { return m_present[ 147 ]; }
+    char getTimeInForce() const
+    { if( !m_present[ 147 ] ) throw FIX::FieldNotFound( FIX::FIELD::TimeInForce ); return m_TimeInForce; }
+    bool isSetEffectiveTime() const { return m_present[ 148 ]; }
+    const FIX::FieldView& getEffectiveTime() const
+    { if( !m_present[ 148 ] ) throw FIX::FieldNotFound( FIX::FIELD::EffectiveTime ); return m_EffectiveTime; }
+    bool isSetExpireDate() const { return m_present[ 149 ]; }
+    const FIX::FieldView& getExpireDate() const
+    { if( !m_present[ 149 ] ) throw FIX::FieldNotFound( FIX::FIELD::ExpireDate ); return m_ExpireDate; }
+    bool isSetExpireTime() const { return m_present[ 150 ]; }
+    const FIX::FieldView& getExpireTime() const
+    { if( !m_present[ 150 ] ) throw FIX::FieldNotFound( FIX::FIELD::ExpireTime ); return m_ExpireTime; }
+    bool isSetExecInst() const { return m_present[ 151 ]; }
+    const FIX::FieldView& getExecInst() const
+    { if( !m_present[ 151 ] ) throw FIX::FieldNotFound( FIX::FIELD::ExecInst ); return m_ExecInst; }
+    bool isSetOrderCapacity() const { return m_present[ 152 ]; }
+    char getOrderCapacity() const
+    { if( !m_present[ 152 ] ) throw FIX::FieldNotFound( FIX::FIELD::OrderCapacity ); return m_OrderCapacity; }
+    bool isSetOrderRestrictions() const { return m_present[ 153 ]; }
+    const FIX::FieldView& getOrderRestrictions() const
+    { if( !m_present[ 153 ] ) throw FIX::FieldNotFound( FIX::FIELD::OrderRestrictions ); return m_OrderRestrictions; }
+    bool isSetCustOrderCapacity() const { return m_present[ 154 ]; }
+    int getCustOrderCapacity() const
+    { if( !m_present[ 154 ] ) throw FIX::FieldNotFound( FIX::FIELD::CustOrderCapacity ); return m_CustOrderCapacity; }
+    bool isSetLastQty() const { return m_present[ 155 ]; }
+    double getLastQty() const
+    { if( !m_present[ 155 ] ) throw FIX::FieldNotFound( FIX::FIELD::LastQty ); return m_LastQty; }
+    bool isSetUnderlyingLastQty() const { return m_present[ 156 ]; }
+    double getUnderlyingLastQty() const
+    { if( !m_present[ 156 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingLastQty ); return m_UnderlyingLastQty; }
+    bool isSetLastPx() const { return m_present[ 157 ]; }
+    double getLastPx() const
+    { if( !m_present[ 157 ] ) throw FIX::FieldNotFound( FIX::FIELD::LastPx ); return m_LastPx; }
+    bool isSetUnderlyingLastPx() const { return m_present[ 158 ]; }
+    double getUnderlyingLastPx() const
+    { if( !m_present[ 158 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingLastPx ); return m_UnderlyingLastPx; }
+    bool isSetLastParPx() const { return m_present[ 159 ]; }
+    double getLastParPx() const
+    { if( !m_present[ 159 ] ) throw FIX::FieldNotFound( FIX::FIELD::LastParPx ); return m_LastParPx; }
+    bool isSetLastSpotRate() const { return m_present[ 160 ]; }
+    double getLastSpotRate() const
+    { if( !m_present[ 160 ] ) throw FIX::FieldNotFound( FIX::FIELD::LastSpotRate ); return m_LastSpotRate; }
+    bool isSetLastForwardPoints() const { return m_present[ 161 ]; }
+    double getLastForwardPoints() const
+    { if( !m_present[ 161 ] ) throw FIX::FieldNotFound( FIX::FIELD::LastForwardPoints ); return m_LastForwardPoints; }
+    bool isSetLastMkt() const { return m_present[ 162 ]; }
+    const FIX::FieldView& getLastMkt() const
+    { if( !m_present[ 162 ] ) throw FIX::FieldNotFound( FIX::FIELD::LastMkt ); return m_LastMkt; }
+    bool isSetTradingSessionID() const { return m_present[ 163 ]; }
+    const FIX::FieldView& getTradingSessionID() const
+    { if( !m_present[ 163 ] ) throw FIX::FieldNotFound( FIX::FIELD::TradingSessionID ); return m_TradingSessionID; }
+    bool isSetTradingSessionSubID() const { return m_present[ 164 ]; }
+    const FIX::FieldView& getTradingSessionSubID() const
+    { if( !m_present[ 164 ] ) throw FIX::FieldNotFound( FIX::FIELD::TradingSessionSubID ); return m_TradingSessionSubID; }
+    bool isSetTimeBracket() const { return m_present[ 165 ]; }
+    const FIX::FieldView& getTimeBracket() const
+    { if( !m_present[ 165 ] ) throw FIX::FieldNotFound( FIX::FIELD::TimeBracket ); return m_TimeBracket; }
+    bool isSetLastCapacity() const { return m_present[ 166 ]; }
+    char getLastCapacity() const
+    { if( !m_present[ 166 ] ) throw FIX::FieldNotFound( FIX::FIELD::LastCapacity ); return m_LastCapacity; }
+    bool isSetLeavesQty() const { return m_present[ 167 ]; }
+    double getLeavesQty() const
+    { if( !m_present[ 167 ] ) throw FIX::FieldNotFound( FIX::FIELD::LeavesQty ); return m_LeavesQty; }
+    bool isSetCumQty() const { return m_present[ 168 ]; }
+    double getCumQty() const
+    { if( !m_present[ 168 ] ) throw FIX::FieldNotFound( FIX::FIELD::CumQty ); return m_CumQty; }
+    bool isSetAvgPx() const { return m_present[ 169 ]; }
+    double getAvgPx() const
+    { if( !m_present[ 169 ] ) throw FIX::FieldNotFound( FIX::FIELD::AvgPx ); return m_AvgPx; }
+    bool isSetDayOrderQty() const { return m_present[ 170 ]; }
+    double getDayOrderQty() const
+    { if( !m_present[ 170 ] ) throw FIX::FieldNotFound( FIX::FIELD::DayOrderQty ); return m_DayOrderQty; }
+    bool isSetDayCumQty() const { return m_present[ 171 ]; }
+    double getDayCumQty() const
+    { if( !m_present[ 171 ] ) throw FIX::FieldNotFound( FIX::FIELD::DayCumQty ); return m_DayCumQty; }
+    bool isSetDayAvgPx() const { return m_present[ 172 ]; }
+    double getDayAvgPx() const
+    { if( !m_present[ 172 ] ) throw FIX::FieldNotFound( FIX::FIELD::DayAvgPx ); return m_DayAvgPx; }
+    bool isSetGTBookingInst() const { return m_present[ 173 ]; }
+    int getGTBookingInst() const
+    { if( !m_present[ 173 ] ) throw FIX::FieldNotFound( FIX::FIELD::GTBookingInst ); return m_GTBookingInst; }
+    bool isSetTradeDate() const { return m_present[ 174 ]; }
+    const FIX::FieldView& getTradeDate() const
+    { if( !m_present[ 174 ] ) throw FIX::FieldNotFound( FIX::FIELD::TradeDate ); return m_TradeDate; }
+    bool isSetTransactTime() const { return m_present[ 175 ]; }
+    const FIX::FieldView& getTransactTime() const
+    { if( !m_present[ 175 ] ) throw FIX::FieldNotFound( FIX::FIELD::TransactTime ); return m_TransactTime; }
+    bool isSetReportToExch() const { return m_present[ 176 ]; }
+    bool getReportToExch() const
+    { if( !m_present[ 176 ] ) throw FIX::FieldNotFound( FIX::FIELD::ReportToExch ); return m_ReportToExch; }
+    bool isSetCommission() const { return m_present[ 177 ]; }
+    double getCommission() const
+    { if( !m_present[ 177 ] ) throw FIX::FieldNotFound( FIX::FIELD::Commission ); return m_Commission; }
+    bool isSetCommType() const { return m_present[ 178 ]; }
+    char getCommType() const
+    { if( !m_present[ 178 ] ) throw FIX::FieldNotFound( FIX::FIELD::CommType ); return m_CommType; }
+    bool isSetCommCurrency() const { return m_present[ 179 ]; }
+    const FIX::FieldView& getCommCurrency() const
+    { if( !m_present[ 179 ] ) throw FIX::FieldNotFound( FIX::FIELD::CommCurrency ); return m_CommCurrency; }
+    bool isSetFundRenewWaiv() const { return m_present[ 180 ]; }
+    char getFundRenewWaiv() const
+    { if( !m_present[ 180 ] ) throw FIX::FieldNotFound( FIX::FIELD::FundRenewWaiv ); return m_FundRenewWaiv; }
+    bool isSetSpread() const { return m_present[ 181 ]; }
+    double getSpread() const
+    { if( !m_present[ 181 ] ) throw FIX::FieldNotFound( FIX::FIELD::Spread ); return m_Spread; }
+    bool isSetBenchmarkCurveCurrency() const { return m_present[ 182 ]; }
+    const FIX::FieldView& getBenchmarkCurveCurrency() const
+    { if( !m_present[ 182 ] ) throw FIX::FieldNotFound( FIX::FIELD::BenchmarkCurveCurrency ); return m_BenchmarkCurveCurrency; }
+    bool isSetBenchmarkCurveName() const { return m_present[ 183 ]; }
+    const FIX::FieldView& getBenchmarkCurveName() const
+    { if( !m_present[ 183 ] ) throw FIX::FieldNotFound( FIX::FIELD::BenchmarkCurveName ); return m_BenchmarkCurveName; }
+    bool isSetBenchmarkCurvePoint() const { return m_present[ 184 ]; }
+    const FIX::FieldView& getBenchmarkCurvePoint() const
+    { if( !m_present[ 184 ] ) throw FIX::FieldNotFound( FIX::FIELD::BenchmarkCurvePoint ); return m_BenchmarkCurvePoint; }
+    bool isSetBenchmarkPrice() const { return m_present[ 185 ]; }
+    double getBenchmarkPrice() const
+    { if( !m_present[ 185 ] ) throw FIX::FieldNotFound( FIX::FIELD::BenchmarkPrice ); return m_BenchmarkPrice; }
+    bool isSetBenchmarkPriceType() const { return m_present[ 186 ]; }
+    int getBenchmarkPriceType() const
+    { if( !m_present[ 186 ] ) throw FIX::FieldNotFound( FIX::FIELD::BenchmarkPriceType ); return m_BenchmarkPriceType; }
+    bool isSetBenchmarkSecurityID() const { return m_present[ 187 ]; }
+    const FIX::FieldView& getBenchmarkSecurityID() const
+    { if( !m_present[ 187 ] ) throw FIX::FieldNotFound( FIX::FIELD::BenchmarkSecurityID ); return m_BenchmarkSecurityID; }
+    bool isSetBenchmarkSecurityIDSource() const { return m_present[ 188 ]; }
+    const FIX::FieldView& getBenchmarkSecurityIDSource() const
+    { if( !m_present[ 188 ] ) throw FIX::FieldNotFound( FIX::FIELD::BenchmarkSecurityIDSource ); return m_BenchmarkSecurityIDSource; }
+    bool isSetYieldType() const { return m_present[ 189 ]; }
+    const FIX::FieldView& getYieldType() const
+    { if( !m_present[ 189 ] ) throw FIX::FieldNotFound( FIX::FIELD::YieldType ); return m_YieldType; }
+    bool isSetYield() const { return m_present[ 190 ]; }
+    double getYield() const
+    { if( !m_present[ 190 ] ) throw FIX::FieldNotFound( FIX::FIELD::Yield ); return m_Yield; }
+    bool isSetYieldCalcDate() const { return m_present[ 191 ]; }
+    const FIX::FieldView& getYieldCalcDate() const
+    { if( !m_present[ 191 ] ) throw FIX::FieldNotFound( FIX::FIELD::YieldCalcDate ); return m_YieldCalcDate; }
+    bool isSetYieldRedemptionDate() const { return m_present[ 192 ]; }
+    const FIX::FieldView& getYieldRedemptionDate() const
+    { if( !m_present[ 192 ] ) throw FIX::FieldNotFound( FIX::FIELD::YieldRedemptionDate ); return m_YieldRedemptionDate; }
+    bool isSetYieldRedemptionPrice() const { return m_present[ 193 ]; }
+    double getYieldRedemptionPrice() const
+    { if( !m_present[ 193 ] ) throw FIX::FieldNotFound( FIX::FIELD::YieldRedemptionPrice ); return m_YieldRedemptionPrice; }
+    bool isSetYieldRedemptionPriceType() const { return m_present[ 194 ]; }
+    int getYieldRedemptionPriceType() const
+    { if( !m_present[ 194 ] ) throw FIX::FieldNotFound( FIX::FIELD::YieldRedemptionPriceType ); return m_YieldRedemptionPriceType; }
+    bool isSetGrossTradeAmt() const { return m_present[ 195 ]; }
+    double getGrossTradeAmt() const
+    { if( !m_present[ 195 ] ) throw FIX::FieldNotFound( FIX::FIELD::GrossTradeAmt ); return m_GrossTradeAmt; }
+    bool isSetNumDaysInterest() const { return m_present[ 196 ]; }
+    int getNumDaysInterest() const
+    { if( !m_present[ 196 ] ) throw FIX::FieldNotFound( FIX::FIELD::NumDaysInterest ); return m_NumDaysInterest; }
+    bool isSetExDate() const { return m_present[ 197 ]; }
+    const FIX::FieldView& getExDate() const
+    { if( !m_present[ 197 ] ) throw FIX::FieldNotFound( FIX::FIELD::ExDate ); return m_ExDate; }
+    bool isSetAccruedInterestRate() const { return m_present[ 198 ]; }
+    double getAccruedInterestRate() const
+    { if( !m_present[ 198 ] ) throw FIX::FieldNotFound( FIX::FIELD::AccruedInterestRate ); return m_AccruedInterestRate; }
+    bool isSetAccruedInterestAmt() const { return m_present[ 199 ]; }
+    double getAccruedInterestAmt() const
+    { if( !m_present[ 199 ] ) throw FIX::FieldNotFound( FIX::FIELD::AccruedInterestAmt ); return m_AccruedInterestAmt; }
+    bool isSetInterestAtMaturity() const { return m_present[ 200 ]; }
+    double getInterestAtMaturity() const
+    { if( !m_present[ 200 ] ) throw FIX::FieldNotFound( FIX::FIELD::InterestAtMaturity ); return m_InterestAtMaturity; }
+    bool isSetEndAccruedInterestAmt() const { return m_present[ 201 ]; }
+    double getEndAccruedInterestAmt() const
+    { if( !m_present[ 201 ] ) throw FIX::FieldNotFound( FIX::FIELD::EndAccruedInterestAmt ); return m_EndAccruedInterestAmt; }
+    bool isSetStartCash() const { return m_present[ 202 ]; }
+    double getStartCash() const
+    { if( !m_present[ 202 ] ) throw FIX::FieldNotFound( FIX::FIELD::StartCash ); return m_StartCash; }
+    bool isSetEndCash() const { return m_present[ 203 ]; }
+    double getEndCash() const
+    { if( !m_present[ 203 ] ) throw FIX::FieldNotFound( FIX::FIELD::EndCash ); return m_EndCash; }
+    bool isSetTradedFlatSwitch() const { return m_present[ 204 ]; }
+    bool getTradedFlatSwitch() const
+    { if( !m_present[ 204 ] ) throw FIX::FieldNotFound( FIX::FIELD::TradedFlatSwitch ); return m_TradedFlatSwitch; }
+    bool isSetBasisFeatureDate() const { return m_present[ 205 ]; }
+    const FIX::FieldView& getBasisFeatureDate() const
+    { if( !m_present[ 205 ] ) throw FIX::FieldNotFound( FIX::FIELD::BasisFeatureDate ); return m_BasisFeatureDate; }
+    bool isSetBasisFeaturePrice() const { return m_present[ 206 ]; }
+    double getBasisFeaturePrice() const
+    { if( !m_present[ 206 ] ) throw FIX::FieldNotFound( FIX::FIELD::BasisFeaturePrice ); return m_BasisFeaturePrice; }
+    bool isSetConcession() const { return m_present[ 207 ]; }
+    double getConcession() const
+    { if( !m_present[ 207 ] ) throw FIX::FieldNotFound( FIX::FIELD::Concession ); return m_Concession; }
+    bool isSetTotalTakedown() const { return m_present[ 208 ]; }
+    double getTotalTakedown() const
+    { if( !m_present[ 208 ] ) throw FIX::FieldNotFound( FIX::FIELD::TotalTakedown ); return m_TotalTakedown; }
+    bool isSetNetMoney() const { return m_present[ 209 ]; }
+    double getNetMoney() const
+    { if( !m_present[ 209 ] ) throw FIX::FieldNotFound( FIX::FIELD::NetMoney ); return m_NetMoney; }
+    bool isSetSettlCurrAmt() const { return m_present[ 210 ]; }
+    double getSettlCurrAmt() const
+    { if( !m_present[ 210 ] ) throw FIX::FieldNotFound( FIX::FIELD::SettlCurrAmt ); return m_SettlCurrAmt; }
+    bool isSetSettlCurrency() const { return m_present[ 211 ]; }
+    const FIX::FieldView& getSettlCurrency() const
+    { if( !m_present[ 211 ] ) throw FIX::FieldNotFound( FIX::FIELD::SettlCurrency ); return m_SettlCurrency; }
+    bool isSetSettlCurrFxRate() const { return m_present[ 212 ]; }
+    double getSettlCurrFxRate() const
+    { if( !m_present[ 212 ] ) throw FIX::FieldNotFound( FIX::FIELD::SettlCurrFxRate ); return m_SettlCurrFxRate; }
+    bool isSetSettlCurrFxRateCalc() const { return m_present[ 213 ]; }
+    char getSettlCurrFxRateCalc() const
+    { if( !m_present[ 213 ] ) throw FIX::FieldNotFound( FIX::FIELD::SettlCurrFxRateCalc ); return m_SettlCurrFxRateCalc; }
+    bool isSetHandlInst() const { return m_present[ 214 ]; }
+    char getHandlInst() const
+    { if( !m_present[ 214 ] ) throw FIX::FieldNotFound( FIX::FIELD::HandlInst ); return m_HandlInst; }
+    bool isSetMinQty() const { return m_present[ 215 ]; }
+    double getMinQty() const
+    { if( !m_present[ 215 ] ) throw FIX::FieldNotFound( FIX::FIELD::MinQty ); return m_MinQty; }
+    bool isSetMaxFloor() const { return m_present[ 216 ]; }
+    double getMaxFloor() const
+    { if( !m_present[ 216 ] ) throw FIX::FieldNotFound( FIX::FIELD::MaxFloor ); return m_MaxFloor; }
+    bool isSetPositionEffect() const { return m_present[ 217 ]; }
+    char getPositionEffect() const
+    { if( !m_present[ 217 ] ) throw FIX::FieldNotFound( FIX::FIELD::PositionEffect ); return m_PositionEffect; }
+    bool isSetMaxShow() const { return m_present[ 218 ]; }
+    double getMaxShow() const
+    { if( !m_present[ 218 ] ) throw FIX::FieldNotFound( FIX::FIELD::MaxShow ); return m_MaxShow; }
+    bool isSetBookingType() const { return m_present[ 219 ]; }
+    int getBookingType() const
+    { if( !m_present[ 219 ] ) throw FIX::FieldNotFound( FIX::FIELD::BookingType ); return m_BookingType; }
+    bool isSetText() const { return m_present[ 220 ]; }
+    const FIX::FieldView& getText() const
+    { if( !m_present[ 220 ] ) throw FIX::FieldNotFound( FIX::FIELD::Text ); return m_Text; }
+    bool isSetEncodedTextLen() const { return m_present[ 221 ]; }
+    int getEncodedTextLen() const
+    { if( !m_present[ 221 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedTextLen ); return m_EncodedTextLen; }
+    bool isSetEncodedText() const { return m_present[ 222 ]; }
+    const FIX::FieldView& getEncodedText() const
+    { if( !m_present[ 222 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedText ); return m_EncodedText; }
+    bool isSetSettlDate2() const { return m_present[ 223 ]; }
+    const FIX::FieldView& getSettlDate2() const
+    { if( !m_present[ 223 ] ) throw FIX::FieldNotFound( FIX::FIELD::SettlDate2 ); return m_SettlDate2; }
+    bool isSetOrderQty2() const { return m_present[ 224 ]; }
+    double getOrderQty2() const
+    { if( !m_present[ 224 ] ) throw FIX::FieldNotFound( FIX::FIELD::OrderQty2 ); return m_OrderQty2; }
+    bool isSetLastForwardPoints2() const { return m_present[ 225 ]; }
+    double getLastForwardPoints2() const
+    { if( !m_present[ 225 ] ) throw FIX::FieldNotFound( FIX::FIELD::LastForwardPoints2 ); return m_LastForwardPoints2; }
+    bool isSetMultiLegReportingType() const { return m_present[ 226 ]; }
+    char getMultiLegReportingType() const
+    { if( !m_present[ 226 ] ) throw FIX::FieldNotFound( FIX::FIELD::MultiLegReportingType ); return m_MultiLegReportingType; }
+    bool isSetCancellationRights() const { return m_present[ 227 ]; }
+    char getCancellationRights() const
+    { if( !m_present[ 227 ] ) throw FIX::FieldNotFound( FIX::FIELD::CancellationRights ); return m_CancellationRights; }
+    bool isSetMoneyLaunderingStatus() const { return m_present[ 228 ]; }
+    char getMoneyLaunderingStatus() const
+    { if( !m_present[ 228 ] ) throw FIX::FieldNotFound( FIX::FIELD::MoneyLaunderingStatus ); return m_MoneyLaunderingStatus; }
+    bool isSetRegistID() const { return m_present[ 229 ]; }
+    const FIX::FieldView& getRegistID() const
+    { if( !m_present[ 229 ] ) throw FIX::FieldNotFound( FIX::FIELD::RegistID ); return m_RegistID; }
+    bool isSetDesignation() const { return m_present[ 230 ]; }
+    const FIX::FieldView& getDesignation() const
+    { if( !m_present[ 230 ] ) throw FIX::FieldNotFound( FIX::FIELD::Designation ); return m_Designation; }
+    bool isSetTransBkdTime() const { return m_present[ 231 ]; }
+    const FIX::FieldView& getTransBkdTime() const
+    { if( !m_present[ 231 ] ) throw FIX::FieldNotFound( FIX::FIELD::TransBkdTime ); return m_TransBkdTime; }
+    bool isSetExecValuationPoint() const { return m_present[ 232 ]; }
+    const FIX::FieldView& getExecValuationPoint() const
+    { if( !m_present[ 232 ] ) throw FIX::FieldNotFound( FIX::FIELD::ExecValuationPoint ); return m_ExecValuationPoint; }
+    bool isSetExecPriceType() const { return m_present[ 233 ]; }
+    char getExecPriceType() const
+    { if( !m_present[ 233 ] ) throw FIX::FieldNotFound( FIX::FIELD::ExecPriceType ); return m_ExecPriceType; }
+    bool isSetExecPriceAdjustment() const { return m_present[ 234 ]; }
+    double getExecPriceAdjustment() const
+    { if( !m_present[ 234 ] ) throw FIX::FieldNotFound( FIX::FIELD::ExecPriceAdjustment ); return m_ExecPriceAdjustment; }
+    bool isSetPriorityIndicator() const { return m_present[ 235 ]; }
+    int getPriorityIndicator() const
+    { if( !m_present[ 235 ] ) throw FIX::FieldNotFound( FIX::FIELD::PriorityIndicator ); return m_PriorityIndicator; }
+    bool isSetPriceImprovement() const { return m_present[ 236 ]; }
+    double getPriceImprovement() const
+    { if( !m_present[ 236 ] ) throw FIX::FieldNotFound( FIX::FIELD::PriceImprovement ); return m_PriceImprovement; }
+    bool isSetLastLiquidityInd() const { return m_present[ 237 ]; }
+    int getLastLiquidityInd() const
+    { if( !m_present[ 237 ] ) throw FIX::FieldNotFound( FIX::FIELD::LastLiquidityInd ); return m_LastLiquidityInd; }
+    bool isSetNoContAmts() const { return m_present[ 238 ]; }
+    const NoContAmtsEntries& getNoContAmts() const { return m_NoContAmts; }
+    bool isSetNoLegs() const { return m_present[ 239 ]; }
+    const NoLegsEntries& getNoLegs() const { return m_NoLegs; }
+    bool isSetCopyMsgIndicator() const { return m_present[ 240 ]; }
+    bool getCopyMsgIndicator() const
+    { if( !m_present[ 240 ] ) throw FIX::FieldNotFound( FIX::FIELD::CopyMsgIndicator ); return m_CopyMsgIndicator; }
+    bool isSetNoMiscFees() const { return m_present[ 241 ]; }
+    const NoMiscFeesEntries& getNoMiscFees() const { return m_NoMiscFees; }
+    bool isSetSignatureLength() const { return m_present[ 242 ]; }
+    int getSignatureLength() const
+    { if( !m_present[ 242 ] ) throw FIX::FieldNotFound( FIX::FIELD::SignatureLength ); return m_SignatureLength; }
+    bool isSetSignature() const { return m_present[ 243 ]; }
+    const FIX::FieldView& getSignature() const
+    { if( !m_present[ 243 ] ) throw FIX::FieldNotFound( FIX::FIELD::Signature ); return m_Signature; }
+    bool isSetCheckSum() const { return m_present[ 244 ]; }
+    const FIX::FieldView& getCheckSum() const
+    { if( !m_present[ 244 ] ) throw FIX::FieldNotFound( FIX::FIELD::CheckSum ); return m_CheckSum; }
+
+  private:
+    void clear()
+    {
+      m_present.reset();
+      m_NoPartyIDs.clear();
+      m_NoContraBrokers.clear();
+      m_NoUnderlyings.clear();
+      m_NoStipulations.clear();
+      m_NoContAmts.clear();
+      m_NoLegs.clear();
+      m_NoMiscFees.clear();
+    }
+
+    const char* m_data;
+    size_t m_size;
+    std::bitset< 245 > m_present;
+    FIX::FieldView m_BeginString;
+    int m_BodyLength;
+    FIX::FieldView m_MsgType;
+    FIX::FieldView m_SenderCompID;
+    FIX::FieldView m_TargetCompID;
+    FIX::FieldView m_OnBehalfOfCompID;
+    FIX::FieldView m_DeliverToCompID;
+    int m_SecureDataLen;
+    FIX::FieldView m_SecureData;
+    int m_MsgSeqNum;
+    FIX::FieldView m_SenderSubID;
+    FIX::FieldView m_SenderLocationID;
+    FIX::FieldView m_TargetSubID;
+    FIX::FieldView m_TargetLocationID;
+    FIX::FieldView m_OnBehalfOfSubID;
+    FIX::FieldView m_OnBehalfOfLocationID;
+    FIX::FieldView m_DeliverToSubID;
+    FIX::FieldView m_DeliverToLocationID;
+    bool m_PossDupFlag;
+    bool m_PossResend;
+    FIX::FieldView m_SendingTime;
+    FIX::FieldView m_OrigSendingTime;
+    int m_XmlDataLen;
+    FIX::FieldView m_XmlData;
+    FIX::FieldView m_MessageEncoding;
+    int m_LastMsgSeqNumProcessed;
+    FIX::FieldView m_OrderID;
+    FIX::FieldView m_SecondaryOrderID;
+    FIX::FieldView m_SecondaryClOrdID;
+    FIX::FieldView m_SecondaryExecID;
+    FIX::FieldView m_ClOrdID;
+    FIX::FieldView m_OrigClOrdID;
+    FIX::FieldView m_ClOrdLinkID;
+    FIX::FieldView m_QuoteRespID;
+    FIX::FieldView m_OrdStatusReqID;
+    FIX::FieldView m_MassStatusReqID;
+    int m_TotNumReports;
+    bool m_LastRptRequested;
+    NoPartyIDsEntries m_NoPartyIDs;
+    FIX::FieldView m_TradeOriginationDate;
+    NoContraBrokersEntries m_NoContraBrokers;
+    FIX::FieldView m_ListID;
+    FIX::FieldView m_CrossID;
+    FIX::FieldView m_OrigCrossID;
+    int m_CrossType;
+    FIX::FieldView m_ExecID;
+    FIX::FieldView m_ExecRefID;
+    char m_ExecType;
+    char m_OrdStatus;
+    bool m_WorkingIndicator;
+    int m_OrdRejReason;
+    int m_ExecRestatementReason;
+    FIX::FieldView m_Account;
+    int m_AcctIDSource;
+    int m_AccountType;
+    char m_DayBookingInst;
+    char m_BookingUnit;
+    char m_PreallocMethod;
+    FIX::FieldView m_SettlType;
+    FIX::FieldView m_SettlDate;
+    char m_CashMargin;
+    FIX::FieldView m_ClearingFeeIndicator;
+    FIX::FieldView m_Symbol;
+    FIX::FieldView m_SymbolSfx;
+    FIX::FieldView m_SecurityID;
+    FIX::FieldView m_SecurityIDSource;
+    int m_Product;
+    FIX::FieldView m_CFICode;
+    FIX::FieldView m_SecurityType;
+    FIX::FieldView m_SecuritySubType;
+    FIX::FieldView m_MaturityMonthYear;
+    FIX::FieldView m_MaturityDate;
+    int m_PutOrCall;
+    FIX::FieldView m_CouponPaymentDate;
+    FIX::FieldView m_IssueDate;
+    FIX::FieldView m_RepoCollateralSecurityType;
+    int m_RepurchaseTerm;
+    double m_RepurchaseRate;
+    double m_Factor;
+    FIX::FieldView m_CreditRating;
+    FIX::FieldView m_InstrRegistry;
+    FIX::FieldView m_CountryOfIssue;
+    FIX::FieldView m_StateOrProvinceOfIssue;
+    FIX::FieldView m_LocaleOfIssue;
+    FIX::FieldView m_RedemptionDate;
+    double m_StrikePrice;
+    FIX::FieldView m_StrikeCurrency;
+    char m_OptAttribute;
+    double m_ContractMultiplier;
+    double m_CouponRate;
+    FIX::FieldView m_SecurityExchange;
+    FIX::FieldView m_Issuer;
+    int m_EncodedIssuerLen;
+    FIX::FieldView m_EncodedIssuer;
+    FIX::FieldView m_SecurityDesc;
+    int m_EncodedSecurityDescLen;
+    FIX::FieldView m_EncodedSecurityDesc;
+    FIX::FieldView m_Pool;
+    FIX::FieldView m_ContractSettlMonth;
+    int m_CPProgram;
+    FIX::FieldView m_CPRegType;
+    FIX::FieldView m_DatedDate;
+    FIX::FieldView m_InterestAccrualDate;
+    FIX::FieldView m_AgreementDesc;
+    FIX::FieldView m_AgreementID;
+    FIX::FieldView m_AgreementDate;
+    FIX::FieldView m_AgreementCurrency;
+    int m_TerminationType;
+    FIX::FieldView m_StartDate;
+    FIX::FieldView m_EndDate;
+    int m_DeliveryType;
+    double m_MarginRatio;
+    NoUnderlyingsEntries m_NoUnderlyings;
+    char m_Side;
+    NoStipulationsEntries m_NoStipulations;
+    int m_QtyType;
+    double m_OrderQty;
+    double m_CashOrderQty;
+    double m_OrderPercent;
+    char m_RoundingDirection;
+    double m_RoundingModulus;
+    char m_OrdType;
+    int m_PriceType;
+    double m_Price;
+    double m_StopPx;
+    double m_PegOffsetValue;
+    int m_PegMoveType;
+    int m_PegOffsetType;
+    int m_PegLimitType;
+    int m_PegRoundDirection;
+    int m_PegScope;
+    char m_DiscretionInst;
+    double m_DiscretionOffsetValue;
+    int m_DiscretionMoveType;
+    int m_DiscretionOffsetType;
+    int m_DiscretionLimitType;
+    int m_DiscretionRoundDirection;
+    int m_DiscretionScope;
+    double m_PeggedPrice;
+    double m_DiscretionPrice;
+    int m_TargetStrategy;
+    FIX::FieldView m_TargetStrategyParameters;
+    double m_ParticipationRate;
+    double m_TargetStrategyPerformance;
+    FIX::FieldView m_Currency;
+    FIX::FieldView m_ComplianceID;
+    bool m_SolicitedFlag;
+    char m_TimeInForce;
+    FIX::FieldView m_EffectiveTime;
+    FIX::FieldView m_ExpireDate;
+    FIX::FieldView m_ExpireTime;
+    FIX::FieldView m_ExecInst;
+    char m_OrderCapacity;
+    FIX::FieldView m_OrderRestrictions;
+    int m_CustOrderCapacity;
+    double m_LastQty;
+    double m_UnderlyingLastQty;
+    double m_LastPx;
+    double m_UnderlyingLastPx;
+    double m_LastParPx;
+    double m_LastSpotRate;
+    double m_LastForwardPoints;
+    FIX::FieldView m_LastMkt;
+    FIX::FieldView m_TradingSessionID;
+    FIX::FieldView m_TradingSessionSubID;
+    FIX::FieldView m_TimeBracket;
+    char m_LastCapacity;
+    double m_LeavesQty;
+    double m_CumQty;
+    double m_AvgPx;
+    double m_DayOrderQty;
+    double m_DayCumQty;
+    double m_DayAvgPx;
+    int m_GTBookingInst;
+    FIX::FieldView m_TradeDate;
+    FIX::FieldView m_TransactTime;
+    bool m_ReportToExch;
+    double m_Commission;
+    char m_CommType;
+    FIX::FieldView m_CommCurrency;
+    char m_FundRenewWaiv;
+    double m_Spread;
+    FIX::FieldView m_BenchmarkCurveCurrency;
+    FIX::FieldView m_BenchmarkCurveName;
+    FIX::FieldView m_BenchmarkCurvePoint;
+    double m_BenchmarkPrice;
+    int m_BenchmarkPriceType;
+    FIX::FieldView m_BenchmarkSecurityID;
+    FIX::FieldView m_BenchmarkSecurityIDSource;
+    FIX::FieldView m_YieldType;
+    double m_Yield;
+    FIX::FieldView m_YieldCalcDate;
+    FIX::FieldView m_YieldRedemptionDate;
+    double m_YieldRedemptionPrice;
+    int m_YieldRedemptionPriceType;
+    double m_GrossTradeAmt;
+    int m_NumDaysInterest;
+    FIX::FieldView m_ExDate;
+    double m_AccruedInterestRate;
+    double m_AccruedInterestAmt;
+    double m_InterestAtMaturity;
+    double m_EndAccruedInterestAmt;
+    double m_StartCash;
+    double m_EndCash;
+    bool m_TradedFlatSwitch;
+    FIX::FieldView m_BasisFeatureDate;
+    double m_BasisFeaturePrice;
+    double m_Concession;
+    double m_TotalTakedown;
+    double m_NetMoney;
+    double m_SettlCurrAmt;
+    FIX::FieldView m_SettlCurrency;
+    double m_SettlCurrFxRate;
+    char m_SettlCurrFxRateCalc;
+    char m_HandlInst;
+    double m_MinQty;
+    double m_MaxFloor;
+    char m_PositionEffect;
+    double m_MaxShow;
+    int m_BookingType;
+    FIX::FieldView m_Text;
+    int m_EncodedTextLen;
+    FIX::FieldView m_EncodedText;
+    FIX::FieldView m_SettlDate2;
+    double m_OrderQty2;
+    double m_LastForwardPoints2;
+    char m_MultiLegReportingType;
+    char m_CancellationRights;
+    char m_MoneyLaunderingStatus;
+    FIX::FieldView m_RegistID;
+    FIX::FieldView m_Designation;
+    FIX::FieldView m_TransBkdTime;
+    FIX::FieldView m_ExecValuationPoint;
+    char m_ExecPriceType;
+    double m_ExecPriceAdjustment;
+    int m_PriorityIndicator;
+    double m_PriceImprovement;
+    int m_LastLiquidityInd;
+    NoContAmtsEntries m_NoContAmts;
+    NoLegsEntries m_NoLegs;
+    bool m_CopyMsgIndicator;
+    NoMiscFeesEntries m_NoMiscFees;
+    int m_SignatureLength;
+    FIX::FieldView m_Signature;
+    FIX::FieldView m_CheckSum;
+  };
+
+}
+
+#endif
@@ -0,0 +1,1763 @@
+#ifndef FIX44_MARKETDATAINCREMENTALREFRESHDECODER_H
+#define FIX44_MARKETDATAINCREMENTALREFRESHDECODER_H
+
+#include "../FlyweightDecoder.h"
+#include "Message.h"
+
+namespace FIX44
+{
+
+  /// Decodes a raw MarketDataIncrementalRefresh in a single pass without building a FIX::Message.
+  /// Values point into the decoded buffer, which must outlive the decoder.
+  class MarketDataIncrementalRefreshDecoder
+  {
+  public:
+    class NoMDEntries
+    {
+    public:
+      class NoUnderlyings
+      {
+      public:
+        void decode( FIX::FieldCursor& cursor )
+        {
+          do
+          {
+            switch( cursor.tag() )
+            {
+            case 311:
+              m_present.set( 0 );
+              m_UnderlyingSymbol = cursor.value();
+              break;
+            case 312:
+              m_present.set( 1 );
+              m_UnderlyingSymbolSfx = cursor.value();
+              break;
+            case 309:
+              m_present.set( 2 );
+              m_UnderlyingSecurityID = cursor.value();
+              break;
+            case 305:
+              m_present.set( 3 );
+              m_UnderlyingSecurityIDSource = cursor.value();
+              break;
+            case 462:
+              m_present.set( 4 );
+              m_UnderlyingProduct = cursor.getInt();
+              break;
+            case 463:
+              m_present.set( 5 );
+              m_UnderlyingCFICode = cursor.value();
+              break;
+            case 310:
+              m_present.set( 6 );
+              m_UnderlyingSecurityType = cursor.value();
+              break;
+            case 763:
+              m_present.set( 7 );
+              m_UnderlyingSecuritySubType = cursor.value();
+              break;
+            case 313:
+              m_present.set( 8 );
+              m_UnderlyingMaturityMonthYear = cursor.value();
+              break;
+            case 542:
+              m_present.set( 9 );
+              m_UnderlyingMaturityDate = cursor.value();
+              break;
+            case 315:
+              m_present.set( 10 );
+              m_UnderlyingPutOrCall = cursor.getInt();
+              break;
+            case 241:
+              m_present.set( 11 );
+              m_UnderlyingCouponPaymentDate = cursor.value();
+              break;
+            case 242:
+              m_present.set( 12 );
+              m_UnderlyingIssueDate = cursor.value();
+              break;
+            case 243:
+              m_present.set( 13 );
+              m_UnderlyingRepoCollateralSecurityType = cursor.value();
+              break;
+            case 244:
+              m_present.set( 14 );
+              m_UnderlyingRepurchaseTerm = cursor.getInt();
+              break;
+            case 245:
+              m_present.set( 15 );
+              m_UnderlyingRepurchaseRate = cursor.getDouble();
+              break;
+            case 246:
+              m_present.set( 16 );
+              m_UnderlyingFactor = cursor.getDouble();
+              break;
+            case 256:
+              m_present.set( 17 );
+              m_UnderlyingCreditRating = cursor.value();
+              break;
+            case 595:
+              m_present.set( 18 );
+              m_UnderlyingInstrRegistry = cursor.value();
+              break;
+            case 592:
+              m_present.set( 19 );
+              m_UnderlyingCountryOfIssue = cursor.value();
+              break;
+            case 593:
+              m_present.set( 20 );
+              m_UnderlyingStateOrProvinceOfIssue = cursor.value();
+              break;
+            case 594:
+              m_present.set( 21 );
+              m_UnderlyingLocaleOfIssue = cursor.value();
+              break;
+            case 247:
+              m_present.set( 22 );
+              m_UnderlyingRedemptionDate = cursor.value();
+              break;
+            case 316:
+              m_present.set( 23 );
+              m_UnderlyingStrikePrice = cursor.getDouble();
+              break;
+            case 941:
+              m_present.set( 24 );
+              m_UnderlyingStrikeCurrency = cursor.value();
+              break;
+            case 317:
+              m_present.set( 25 );
+              m_UnderlyingOptAttribute = cursor.getChar();
+              break;
+            case 436:
+              m_present.set( 26 );
+              m_UnderlyingContractMultiplier = cursor.getDouble();
+              break;
+            case 435:
+              m_present.set( 27 );
+              m_UnderlyingCouponRate = cursor.getDouble();
+              break;
+            case 308:
+              m_present.set( 28 );
+              m_UnderlyingSecurityExchange = cursor.value();
+              break;
+            case 306:
+              m_present.set( 29 );
+              m_UnderlyingIssuer = cursor.value();
+              break;
+            case 362:
+              m_present.set( 30 );
+              m_EncodedUnderlyingIssuerLen = cursor.getInt();
+              cursor.setDataLength( 363, m_EncodedUnderlyingIssuerLen );
+              break;
+            case 363:
+              m_present.set( 31 );
+              m_EncodedUnderlyingIssuer = cursor.value();
+              break;
+            case 307:
+              m_present.set( 32 );
+              m_UnderlyingSecurityDesc = cursor.value();
+              break;
+            case 364:
+              m_present.set( 33 );
+              m_EncodedUnderlyingSecurityDescLen = cursor.getInt();
+              cursor.setDataLength( 365, m_EncodedUnderlyingSecurityDescLen );
+              break;
+            case 365:
+              m_present.set( 34 );
+              m_EncodedUnderlyingSecurityDesc = cursor.value();
+              break;
+            case 877:
+              m_present.set( 35 );
+              m_UnderlyingCPProgram = cursor.value();
+              break;
+            case 878:
+              m_present.set( 36 );
+              m_UnderlyingCPRegType = cursor.value();
+              break;
+            case 318:
+              m_present.set( 37 );
+              m_UnderlyingCurrency = cursor.value();
+              break;
+            case 879:
+              m_present.set( 38 );
+              m_UnderlyingQty = cursor.getDouble();
+              break;
+            case 810:
+              m_present.set( 39 );
+              m_UnderlyingPx = cursor.getDouble();
+              break;
+            case 882:
+              m_present.set( 40 );
+              m_UnderlyingDirtyPrice = cursor.getDouble();
+              break;
+            case 883:
+              m_present.set( 41 );
+              m_UnderlyingEndPrice = cursor.getDouble();
+              break;
+            case 884:
+              m_present.set( 42 );
+              m_UnderlyingStartValue = cursor.getDouble();
+              break;
+            case 885:
+              m_present.set( 43 );
+              m_UnderlyingCurrentValue = cursor.getDouble();
+              break;
+            case 886:
+              m_present.set( 44 );
+              m_UnderlyingEndValue = cursor.getDouble();
+              break;
+            default:
+              return;
+            }
+            cursor.next();
+          }
+          while( cursor.valid() && cursor.tag() != 311 );
+        }
+
+        void clear()
+        {
+          m_present.reset();
+        }
+        bool isSetUnderlyingSymbol() const { return m_present[ 0 ]; }
+        const FIX::FieldView& getUnderlyingSymbol() const
+        { if( !m_present[ 0 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingSymbol ); return m_UnderlyingSymbol; }
+        bool isSetUnderlyingSymbolSfx() const { return m_present[ 1 ]; }
+        const FIX::FieldView& getUnderlyingSymbolSfx() const
+        { if( !m_present[ 1 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingSymbolSfx ); return m_UnderlyingSymbolSfx; }
+        bool isSetUnderlyingSecurityID() const { return m_present[ 2 ]; }
+        const FIX::FieldView& getUnderlyingSecurityID() const
+        { if( !m_present[ 2 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingSecurityID ); return m_UnderlyingSecurityID; }
+        bool isSetUnderlyingSecurityIDSource() const { return m_present[ 3 ]; }
+        const FIX::FieldView& getUnderlyingSecurityIDSource() const
+        { if( !m_present[ 3 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingSecurityIDSource ); return m_UnderlyingSecurityIDSource; }
+        bool isSetUnderlyingProduct() const { return m_present[ 4 ]; }
+        int getUnderlyingProduct() const
+        { if( !m_present[ 4 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingProduct ); return m_UnderlyingProduct; }
+        bool isSetUnderlyingCFICode() const { return m_present[ 5 ]; }
+        const FIX::FieldView& getUnderlyingCFICode() const
+        { if( !m_present[ 5 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingCFICode ); return m_UnderlyingCFICode; }
+        bool isSetUnderlyingSecurityType() const { return m_present[ 6 ]; }
+        const FIX::FieldView& getUnderlyingSecurityType() const
+        { if( !m_present[ 6 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingSecurityType ); return m_UnderlyingSecurityType; }
+        bool isSetUnderlyingSecuritySubType() const { return m_present[ 7 ]; }
+        const FIX::FieldView& getUnderlyingSecuritySubType() const
+        { if( !m_present[ 7 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingSecuritySubType ); return m_UnderlyingSecuritySubType; }
+        bool isSetUnderlyingMaturityMonthYear() const { return m_present[ 8 ]; }
+        const FIX::FieldView& getUnderlyingMaturityMonthYear() const
+        { if( !m_present[ 8 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingMaturityMonthYear ); return m_UnderlyingMaturityMonthYear; }
+        bool isSetUnderlyingMaturityDate() const { return m_present[ 9 ]; }
+        const FIX::FieldView& getUnderlyingMaturityDate() const
+        { if( !m_present[ 9 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingMaturityDate ); return m_UnderlyingMaturityDate; }
+        bool isSetUnderlyingPutOrCall() const { return m_present[ 10 ]; }
+        int getUnderlyingPutOrCall() const
+        { if( !m_present[ 10 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingPutOrCall ); return m_UnderlyingPutOrCall; }
+        bool isSetUnderlyingCouponPaymentDate() const { return m_present[ 11 ]; }
+        const FIX::FieldView& getUnderlyingCouponPaymentDate() const
+        { if( !m_present[ 11 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingCouponPaymentDate ); return m_UnderlyingCouponPaymentDate; }
+        bool isSetUnderlyingIssueDate() const { return m_present[ 12 ]; }
+        const FIX::FieldView& getUnderlyingIssueDate() const
+        { if( !m_present[ 12 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingIssueDate ); return m_UnderlyingIssueDate; }
+        bool isSetUnderlyingRepoCollateralSecurityType() const { return m_present[ 13 ]; }
+        const FIX::FieldView& getUnderlyingRepoCollateralSecurityType() const
+        { if( !m_present[ 13 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingRepoCollateralSecurityType ); return m_UnderlyingRepoCollateralSecurityType; }
+        bool isSetUnderlyingRepurchaseTerm() const { return m_present[ 14 ]; }
+        int getUnderlyingRepurchaseTerm() const
+        { if( !m_present[ 14 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingRepurchaseTerm ); return m_UnderlyingRepurchaseTerm; }
+        bool isSetUnderlyingRepurchaseRate() const { return m_present[ 15 ]; }
+        double getUnderlyingRepurchaseRate() const
+        { if( !m_present[ 15 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingRepurchaseRate ); return m_UnderlyingRepurchaseRate; }
+        bool isSetUnderlyingFactor() const { return m_present[ 16 ]; }
+        double getUnderlyingFactor() const
+        { if( !m_present[ 16 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingFactor ); return m_UnderlyingFactor; }
+        bool isSetUnderlyingCreditRating() const { return m_present[ 17 ]; }
+        const FIX::FieldView& getUnderlyingCreditRating() const
+        { if( !m_present[ 17 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingCreditRating ); return m_UnderlyingCreditRating; }
+        bool isSetUnderlyingInstrRegistry() const { return m_present[ 18 ]; }
+        const FIX::FieldView& getUnderlyingInstrRegistry() const
+        { if( !m_present[ 18 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingInstrRegistry ); return m_UnderlyingInstrRegistry; }
+        bool isSetUnderlyingCountryOfIssue() const { return m_present[ 19 ]; }
+        const FIX::FieldView& getUnderlyingCountryOfIssue() const
+        { if( !m_present[ 19 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingCountryOfIssue ); return m_UnderlyingCountryOfIssue; }
+        bool isSetUnderlyingStateOrProvinceOfIssue() const { return m_present[ 20 ]; }
+        const FIX::FieldView& getUnderlyingStateOrProvinceOfIssue() const
+        { if( !m_present[ 20 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingStateOrProvinceOfIssue ); return m_UnderlyingStateOrProvinceOfIssue; }
+        bool isSetUnderlyingLocaleOfIssue() const { return m_present[ 21 ]; }
+        const FIX::FieldView& getUnderlyingLocaleOfIssue() const
+        { if( !m_present[ 21 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingLocaleOfIssue ); return m_UnderlyingLocaleOfIssue; }
+        bool isSetUnderlyingRedemptionDate() const { return m_present[ 22 ]; }
+        const FIX::FieldView& getUnderlyingRedemptionDate() const
+        { if( !m_present[ 22 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingRedemptionDate ); return m_UnderlyingRedemptionDate; }
+        bool isSetUnderlyingStrikePrice() const { return m_present[ 23 ]; }
+        double getUnderlyingStrikePrice() const
+        { if( !m_present[ 23 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingStrikePrice ); return m_UnderlyingStrikePrice; }
+        bool isSetUnderlyingStrikeCurrency() const { return m_present[ 24 ]; }
+        const FIX::FieldView& getUnderlyingStrikeCurrency() const
+        { if( !m_present[ 24 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingStrikeCurrency ); return m_UnderlyingStrikeCurrency; }
+        bool isSetUnderlyingOptAttribute() const { return m_present[ 25 ]; }
+        char getUnderlyingOptAttribute() const
+        { if( !m_present[ 25 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingOptAttribute ); return m_UnderlyingOptAttribute; }
+        bool isSetUnderlyingContractMultiplier() const { return m_present[ 26 ]; }
+        double getUnderlyingContractMultiplier() const
+        { if( !m_present[ 26 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingContractMultiplier ); return m_UnderlyingContractMultiplier; }
+        bool isSetUnderlyingCouponRate() const { return m_present[ 27 ]; }
+        double getUnderlyingCouponRate() const
+        { if( !m_present[ 27 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingCouponRate ); return m_UnderlyingCouponRate; }
+        bool isSetUnderlyingSecurityExchange() const { return m_present[ 28 ]; }
+        const FIX::FieldView& getUnderlyingSecurityExchange() const
+        { if( !m_present[ 28 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingSecurityExchange ); return m_UnderlyingSecurityExchange; }
+        bool isSetUnderlyingIssuer() const { return m_present[ 29 ]; }
+        const FIX::FieldView& getUnderlyingIssuer() const
+        { if( !m_present[ 29 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingIssuer ); return m_UnderlyingIssuer; }
+        bool isSetEncodedUnderlyingIssuerLen() const { return m_present[ 30 ]; }
+        int getEncodedUnderlyingIssuerLen() const
+        { if( !m_present[ 30 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedUnderlyingIssuerLen ); return m_EncodedUnderlyingIssuerLen; }
+        bool isSetEncodedUnderlyingIssuer() const { return m_present[ 31 ]; }
+        const FIX::FieldView& getEncodedUnderlyingIssuer() const
+        { if( !m_present[ 31 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedUnderlyingIssuer ); return m_EncodedUnderlyingIssuer; }
+        bool isSetUnderlyingSecurityDesc() const { return m_present[ 32 ]; }
+        const FIX::FieldView& getUnderlyingSecurityDesc() const
+        { if( !m_present[ 32 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingSecurityDesc ); return m_UnderlyingSecurityDesc; }
+        bool isSetEncodedUnderlyingSecurityDescLen() const { return m_present[ 33 ]; }
+        int getEncodedUnderlyingSecurityDescLen() const
+        { if( !m_present[ 33 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedUnderlyingSecurityDescLen ); return m_EncodedUnderlyingSecurityDescLen; }
+        bool isSetEncodedUnderlyingSecurityDesc() const { return m_present[ 34 ]; }
+        const FIX::FieldView& getEncodedUnderlyingSecurityDesc() const
+        { if( !m_present[ 34 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedUnderlyingSecurityDesc ); return m_EncodedUnderlyingSecurityDesc; }
+        bool isSetUnderlyingCPProgram() const { return m_present[ 35 ]; }
+        const FIX::FieldView& getUnderlyingCPProgram() const
+        { if( !m_present[ 35 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingCPProgram ); return m_UnderlyingCPProgram; }
+        bool isSetUnderlyingCPRegType() const { return m_present[ 36 ]; }
+        const FIX::FieldView& getUnderlyingCPRegType() const
+        { if( !m_present[ 36 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingCPRegType ); return m_UnderlyingCPRegType; }
+        bool isSetUnderlyingCurrency() const { return m_present[ 37 ]; }
+        const FIX::FieldView& getUnderlyingCurrency() const
+        { if( !m_present[ 37 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingCurrency ); return m_UnderlyingCurrency; }
+        bool isSetUnderlyingQty() const { return m_present[ 38 ]; }
+        double getUnderlyingQty() const
+        { if( !m_present[ 38 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingQty ); return m_UnderlyingQty; }
+        bool isSetUnderlyingPx() const { return m_present[ 39 ]; }
+        double getUnderlyingPx() const
+        { if( !m_present[ 39 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingPx ); return m_UnderlyingPx; }
+        bool isSetUnderlyingDirtyPrice() const { return m_present[ 40 ]; }
+        double getUnderlyingDirtyPrice() const
+        { if( !m_present[ 40 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingDirtyPrice ); return m_UnderlyingDirtyPrice; }
+        bool isSetUnderlyingEndPrice() const { return m_present[ 41 ]; }
+        double getUnderlyingEndPrice() const
+        { if( !m_present[ 41 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingEndPrice ); return m_UnderlyingEndPrice; }
+        bool isSetUnderlyingStartValue() const { return m_present[ 42 ]; }
+        double getUnderlyingStartValue() const
+        { if( !m_present[ 42 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingStartValue ); return m_UnderlyingStartValue; }
+        bool isSetUnderlyingCurrentValue() const { return m_present[ 43 ]; }
+        double getUnderlyingCurrentValue() const
+        { if( !m_present[ 43 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingCurrentValue ); return m_UnderlyingCurrentValue; }
+        bool isSetUnderlyingEndValue() const { return m_present[ 44 ]; }
+        double getUnderlyingEndValue() const
+        { if( !m_present[ 44 ] ) throw FIX::FieldNotFound( FIX::FIELD::UnderlyingEndValue ); return m_UnderlyingEndValue; }
+
+      private:
+        std::bitset< 45 > m_present;
+        FIX::FieldView m_UnderlyingSymbol;
+        FIX::FieldView m_UnderlyingSymbolSfx;
+        FIX::FieldView m_UnderlyingSecurityID;
+        FIX::FieldView m_UnderlyingSecurityIDSource;
+        int m_UnderlyingProduct;
+        FIX::FieldView m_UnderlyingCFICode;
+        FIX::FieldView m_UnderlyingSecurityType;
+        FIX::FieldView m_UnderlyingSecuritySubType;
+        FIX::FieldView m_UnderlyingMaturityMonthYear;
+        FIX::FieldView m_UnderlyingMaturityDate;
+        int m_UnderlyingPutOrCall;
+        FIX::FieldView m_UnderlyingCouponPaymentDate;
+        FIX::FieldView m_UnderlyingIssueDate;
+        FIX::FieldView m_UnderlyingRepoCollateralSecurityType;
+        int m_UnderlyingRepurchaseTerm;
+        double m_UnderlyingRepurchaseRate;
+        double m_UnderlyingFactor;
+        FIX::FieldView m_UnderlyingCreditRating;
+        FIX::FieldView m_UnderlyingInstrRegistry;
+        FIX::FieldView m_UnderlyingCountryOfIssue;
+        FIX::FieldView m_UnderlyingStateOrProvinceOfIssue;
+        FIX::FieldView m_UnderlyingLocaleOfIssue;
+        FIX::FieldView m_UnderlyingRedemptionDate;
+        double m_UnderlyingStrikePrice;
+        FIX::FieldView m_UnderlyingStrikeCurrency;
+        char m_UnderlyingOptAttribute;
+        double m_UnderlyingContractMultiplier;
+        double m_UnderlyingCouponRate;
+        FIX::FieldView m_UnderlyingSecurityExchange;
+        FIX::FieldView m_UnderlyingIssuer;
+        int m_EncodedUnderlyingIssuerLen;
+        FIX::FieldView m_EncodedUnderlyingIssuer;
+        FIX::FieldView m_UnderlyingSecurityDesc;
+        int m_EncodedUnderlyingSecurityDescLen;
+        FIX::FieldView m_EncodedUnderlyingSecurityDesc;
+        FIX::FieldView m_UnderlyingCPProgram;
+        FIX::FieldView m_UnderlyingCPRegType;
+        FIX::FieldView m_UnderlyingCurrency;
+        double m_UnderlyingQty;
+        double m_UnderlyingPx;
+        double m_UnderlyingDirtyPrice;
+        double m_UnderlyingEndPrice;
+        double m_UnderlyingStartValue;
+        double m_UnderlyingCurrentValue;
+        double m_UnderlyingEndValue;
+      };
+      typedef FIX::InlineVector< NoUnderlyings, 2 > NoUnderlyingsEntries;
+
+      class NoLegs
+      {
+      public:
+        void decode( FIX::FieldCursor& cursor )
+        {
+          do
+          {
+            switch( cursor.tag() )
+            {
+            case 600:
+              m_present.set( 0 );
+              m_LegSymbol = cursor.value();
+              break;
+            case 601:
+              m_present.set( 1 );
+              m_LegSymbolSfx = cursor.value();
+              break;
+            case 602:
+              m_present.set( 2 );
+              m_LegSecurityID = cursor.value();
+              break;
+            case 603:
+              m_present.set( 3 );
+              m_LegSecurityIDSource = cursor.value();
+              break;
+            case 607:
+              m_present.set( 4 );
+              m_LegProduct = cursor.getInt();
+              break;
+            case 608:
+              m_present.set( 5 );
+              m_LegCFICode = cursor.value();
+              break;
+            case 609:
+              m_present.set( 6 );
+              m_LegSecurityType = cursor.value();
+              break;
+            case 764:
+              m_present.set( 7 );
+              m_LegSecuritySubType = cursor.value();
+              break;
+            case 610:
+              m_present.set( 8 );
+              m_LegMaturityMonthYear = cursor.value();
+              break;
+            case 611:
+              m_present.set( 9 );
+              m_LegMaturityDate = cursor.value();
+              break;
+            case 248:
+              m_present.set( 10 );
+              m_LegCouponPaymentDate = cursor.value();
+              break;
+            case 249:
+              m_present.set( 11 );
+              m_LegIssueDate = cursor.value();
+              break;
+            case 250:
+              m_present.set( 12 );
+              m_LegRepoCollateralSecurityType = cursor.value();
+              break;
+            case 251:
+              m_present.set( 13 );
+              m_LegRepurchaseTerm = cursor.getInt();
+              break;
+            case 252:
+              m_present.set( 14 );
+              m_LegRepurchaseRate = cursor.getDouble();
+              break;
+            case 253:
+              m_present.set( 15 );
+              m_LegFactor = cursor.getDouble();
+              break;
+            case 257:
+              m_present.set( 16 );
+              m_LegCreditRating = cursor.value();
+              break;
+            case 599:
+              m_present.set( 17 );
+              m_LegInstrRegistry = cursor.value();
+              break;
+            case 596:
+              m_present.set( 18 );
+              m_LegCountryOfIssue = cursor.value();
+              break;
+            case 597:
+              m_present.set( 19 );
+              m_LegStateOrProvinceOfIssue = cursor.value();
+              break;
+            case 598:
+              m_present.set( 20 );
+              m_LegLocaleOfIssue = cursor.value();
+              break;
+            case 254:
+              m_present.set( 21 );
+              m_LegRedemptionDate = cursor.value();
+              break;
+            case 612:
+              m_present.set( 22 );
+              m_LegStrikePrice = cursor.getDouble();
+              break;
+            case 942:
+              m_present.set( 23 );
+              m_LegStrikeCurrency = cursor.value();
+              break;
+            case 613:
+              m_present.set( 24 );
+              m_LegOptAttribute = cursor.getChar();
+              break;
+            case 614:
+              m_present.set( 25 );
+              m_LegContractMultiplier = cursor.getDouble();
+              break;
+            case 615:
+              m_present.set( 26 );
+              m_LegCouponRate = cursor.getDouble();
+              break;
+            case 616:
+              m_present.set( 27 );
+              m_LegSecurityExchange = cursor.value();
+              break;
+            case 617:
+              m_present.set( 28 );
+              m_LegIssuer = cursor.value();
+              break;
+            case 618:
+              m_present.set( 29 );
+              m_EncodedLegIssuerLen = cursor.getInt();
+              cursor.setDataLength( 619, m_EncodedLegIssuerLen );
+              break;
+            case 619:
+              m_present.set( 30 );
+              m_EncodedLegIssuer = cursor.value();
+              break;
+            case 620:
+              m_present.set( 31 );
+              m_LegSecurityDesc = cursor.value();
+              break;
+            case 621:
+              m_present.set( 32 );
+              m_EncodedLegSecurityDescLen = cursor.getInt();
+              cursor.setDataLength( 622, m_EncodedLegSecurityDescLen );
+              break;
+            case 622:
+              m_present.set( 33 );
+              m_EncodedLegSecurityDesc = cursor.value();
+              break;
+            case 623:
+              m_present.set( 34 );
+              m_LegRatioQty = cursor.getDouble();
+              break;
+            case 624:
+              m_present.set( 35 );
+              m_LegSide = cursor.getChar();
+              break;
+            case 556:
+              m_present.set( 36 );
+              m_LegCurrency = cursor.value();
+              break;
+            case 740:
+              m_present.set( 37 );
+              m_LegPool = cursor.value();
+              break;
+            case 739:
+              m_present.set( 38 );
+              m_LegDatedDate = cursor.value();
+              break;
+            case 955:
+              m_present.set( 39 );
+              m_LegContractSettlMonth = cursor.value();
+              break;
+            case 956:
+              m_present.set( 40 );
+              m_LegInterestAccrualDate = cursor.value();
+              break;
+            default:
+              return;
+            }
+            cursor.next();
+          }
+          while( cursor.valid() && cursor.tag() != 600 );
+        }
+
+        void clear()
+        {
+          m_present.reset();
+        }
+        bool isSetLegSymbol() const { return m_present[ 0 ]; }
+        const FIX::FieldView& getLegSymbol() const
+        { if( !m_present[ 0 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSymbol ); return m_LegSymbol; }
+        bool isSetLegSymbolSfx() const { return m_present[ 1 ]; }
+        const FIX::FieldView& getLegSymbolSfx() const
+        { if( !m_present[ 1 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSymbolSfx ); return m_LegSymbolSfx; }
+        bool isSetLegSecurityID() const { return m_present[ 2 ]; }
+        const FIX::FieldView& getLegSecurityID() const
+        { if( !m_present[ 2 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSecurityID ); return m_LegSecurityID; }
+        bool isSetLegSecurityIDSource() const { return m_present[ 3 ]; }
+        const FIX::FieldView& getLegSecurityIDSource() const
+        { if( !m_present[ 3 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSecurityIDSource ); return m_LegSecurityIDSource; }
+        bool isSetLegProduct() const { return m_present[ 4 ]; }
+        int getLegProduct() const
+        { if( !m_present[ 4 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegProduct ); return m_LegProduct; }
+        bool isSetLegCFICode() const { return m_present[ 5 ]; }
+        const FIX::FieldView& getLegCFICode() const
+        { if( !m_present[ 5 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegCFICode ); return m_LegCFICode; }
+        bool isSetLegSecurityType() const { return m_present[ 6 ]; }
+        const FIX::FieldView& getLegSecurityType() const
+        { if( !m_present[ 6 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSecurityType ); return m_LegSecurityType; }
+        bool isSetLegSecuritySubType() const { return m_present[ 7 ]; }
+        const FIX::FieldView& getLegSecuritySubType() const
+        { if( !m_present[ 7 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSecuritySubType ); return m_LegSecuritySubType; }
+        bool isSetLegMaturityMonthYear() const { return m_present[ 8 ]; }
+        const FIX::FieldView& getLegMaturityMonthYear() const
+        { if( !m_present[ 8 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegMaturityMonthYear ); return m_LegMaturityMonthYear; }
+        bool isSetLegMaturityDate() const { return m_present[ 9 ]; }
+        const FIX::FieldView& getLegMaturityDate() const
+        { if( !m_present[ 9 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegMaturityDate ); return m_LegMaturityDate; }
+        bool isSetLegCouponPaymentDate() const { return m_present[ 10 ]; }
+        const FIX::FieldView& getLegCouponPaymentDate() const
+        { if( !m_present[ 10 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegCouponPaymentDate ); return m_LegCouponPaymentDate; }
+        bool isSetLegIssueDate() const { return m_present[ 11 ]; }
+        const FIX::FieldView& getLegIssueDate() const
+        { if( !m_present[ 11 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegIssueDate ); return m_LegIssueDate; }
+        bool isSetLegRepoCollateralSecurityType() const { return m_present[ 12 ]; }
+        const FIX::FieldView& getLegRepoCollateralSecurityType() const
+        { if( !m_present[ 12 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegRepoCollateralSecurityType ); return m_LegRepoCollateralSecurityType; }
+        bool isSetLegRepurchaseTerm() const { return m_present[ 13 ]; }
+        int getLegRepurchaseTerm() const
+        { if( !m_present[ 13 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegRepurchaseTerm ); return m_LegRepurchaseTerm; }
+        bool isSetLegRepurchaseRate() const { return m_present[ 14 ]; }
+        double getLegRepurchaseRate() const
+        { if( !m_present[ 14 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegRepurchaseRate ); return m_LegRepurchaseRate; }
+        bool isSetLegFactor() const { return m_present[ 15 ]; }
+        double getLegFactor() const
+        { if( !m_present[ 15 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegFactor ); return m_LegFactor; }
+        bool isSetLegCreditRating() const { return m_present[ 16 ]; }
+        const FIX::FieldView& getLegCreditRating() const
+        { if( !m_present[ 16 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegCreditRating ); return m_LegCreditRating; }
+        bool isSetLegInstrRegistry() const { return m_present[ 17 ]; }
+        const FIX::FieldView& getLegInstrRegistry() const
+        { if( !m_present[ 17 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegInstrRegistry ); return m_LegInstrRegistry; }
+        bool isSetLegCountryOfIssue() const { return m_present[ 18 ]; }
+        const FIX::FieldView& getLegCountryOfIssue() const
+        { if( !m_present[ 18 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegCountryOfIssue ); return m_LegCountryOfIssue; }
+        bool isSetLegStateOrProvinceOfIssue() const { return m_present[ 19 ]; }
+        const FIX::FieldView& getLegStateOrProvinceOfIssue() const
+        { if( !m_present[ 19 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegStateOrProvinceOfIssue ); return m_LegStateOrProvinceOfIssue; }
+        bool isSetLegLocaleOfIssue() const { return m_present[ 20 ]; }
+        const FIX::FieldView& getLegLocaleOfIssue() const
+        { if( !m_present[ 20 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegLocaleOfIssue ); return m_LegLocaleOfIssue; }
+        bool isSetLegRedemptionDate() const { return m_present[ 21 ]; }
+        const FIX::FieldView& getLegRedemptionDate() const
+        { if( !m_present[ 21 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegRedemptionDate ); return m_LegRedemptionDate; }
+        bool isSetLegStrikePrice() const { return m_present[ 22 ]; }
+        double getLegStrikePrice() const
+        { if( !m_present[ 22 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegStrikePrice ); return m_LegStrikePrice; }
+        bool isSetLegStrikeCurrency() const { return m_present[ 23 ]; }
+        const FIX::FieldView& getLegStrikeCurrency() const
+        { if( !m_present[ 23 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegStrikeCurrency ); return m_LegStrikeCurrency; }
+        bool isSetLegOptAttribute() const { return m_present[ 24 ]; }
+        char getLegOptAttribute() const
+        { if( !m_present[ 24 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegOptAttribute ); return m_LegOptAttribute; }
+        bool isSetLegContractMultiplier() const { return m_present[ 25 ]; }
+        double getLegContractMultiplier() const
+        { if( !m_present[ 25 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegContractMultiplier ); return m_LegContractMultiplier; }
+        bool isSetLegCouponRate() const { return m_present[ 26 ]; }
+        double getLegCouponRate() const
+        { if( !m_present[ 26 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegCouponRate ); return m_LegCouponRate; }
+        bool isSetLegSecurityExchange() const { return m_present[ 27 ]; }
+        const FIX::FieldView& getLegSecurityExchange() const
+        { if( !m_present[ 27 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSecurityExchange ); return m_LegSecurityExchange; }
+        bool isSetLegIssuer() const { return m_present[ 28 ]; }
+        const FIX::FieldView& getLegIssuer() const
+        { if( !m_present[ 28 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegIssuer ); return m_LegIssuer; }
+        bool isSetEncodedLegIssuerLen() const { return m_present[ 29 ]; }
+        int getEncodedLegIssuerLen() const
+        { if( !m_present[ 29 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedLegIssuerLen ); return m_EncodedLegIssuerLen; }
+        bool isSetEncodedLegIssuer() const { return m_present[ 30 ]; }
+        const FIX::FieldView& getEncodedLegIssuer() const
+        { if( !m_present[ 30 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedLegIssuer ); return m_EncodedLegIssuer; }
+        bool isSetLegSecurityDesc() const { return m_present[ 31 ]; }
+        const FIX::FieldView& getLegSecurityDesc() const
+        { if( !m_present[ 31 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSecurityDesc ); return m_LegSecurityDesc; }
+        bool isSetEncodedLegSecurityDescLen() const { return m_present[ 32 ]; }
+        int getEncodedLegSecurityDescLen() const
+        { if( !m_present[ 32 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedLegSecurityDescLen ); return m_EncodedLegSecurityDescLen; }
+        bool isSetEncodedLegSecurityDesc() const { return m_present[ 33 ]; }
+        const FIX::FieldView& getEncodedLegSecurityDesc() const
+        { if( !m_present[ 33 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedLegSecurityDesc ); return m_EncodedLegSecurityDesc; }
+        bool isSetLegRatioQty() const { return m_present[ 34 ]; }
+        double getLegRatioQty() const
+        { if( !m_present[ 34 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegRatioQty ); return m_LegRatioQty; }
+        bool isSetLegSide() const { return m_present[ 35 ]; }
+        char getLegSide() const
+        { if( !m_present[ 35 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegSide ); return m_LegSide; }
+        bool isSetLegCurrency() const { return m_present[ 36 ]; }
+        const FIX::FieldView& getLegCurrency() const
+        { if( !m_present[ 36 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegCurrency ); return m_LegCurrency; }
+        bool isSetLegPool() const { return m_present[ 37 ]; }
+        const FIX::FieldView& getLegPool() const
+        { if( !m_present[ 37 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegPool ); return m_LegPool; }
+        bool isSetLegDatedDate() const { return m_present[ 38 ]; }
+        const FIX::FieldView& getLegDatedDate() const
+        { if( !m_present[ 38 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegDatedDate ); return m_LegDatedDate; }
+        bool isSetLegContractSettlMonth() const { return m_present[ 39 ]; }
+        const FIX::FieldView& getLegContractSettlMonth() const
+        { if( !m_present[ 39 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegContractSettlMonth ); return m_LegContractSettlMonth; }
+        bool isSetLegInterestAccrualDate() const { return m_present[ 40 ]; }
+        const FIX::FieldView& getLegInterestAccrualDate() const
+        { if( !m_present[ 40 ] ) throw FIX::FieldNotFound( FIX::FIELD::LegInterestAccrualDate ); return m_LegInterestAccrualDate; }
+
+      private:
+        std::bitset< 41 > m_present;
+        FIX::FieldView m_LegSymbol;
+        FIX::FieldView m_LegSymbolSfx;
+        FIX::FieldView m_LegSecurityID;
+        FIX::FieldView m_LegSecurityIDSource;
+        int m_LegProduct;
+        FIX::FieldView m_LegCFICode;
+        FIX::FieldView m_LegSecurityType;
+        FIX::FieldView m_LegSecuritySubType;
+        FIX::FieldView m_LegMaturityMonthYear;
+        FIX::FieldView m_LegMaturityDate;
+        FIX::FieldView m_LegCouponPaymentDate;
+        FIX::FieldView m_LegIssueDate;
+        FIX::FieldView m_LegRepoCollateralSecurityType;
+        int m_LegRepurchaseTerm;
+        double m_LegRepurchaseRate;
+        double m_LegFactor;
+        FIX::FieldView m_LegCreditRating;
+        FIX::FieldView m_LegInstrRegistry;
+        FIX::FieldView m_LegCountryOfIssue;
+        FIX::FieldView m_LegStateOrProvinceOfIssue;
+        FIX::FieldView m_LegLocaleOfIssue;
+        FIX::FieldView m_LegRedemptionDate;
+        double m_LegStrikePrice;
+        FIX::FieldView m_LegStrikeCurrency;
+        char m_LegOptAttribute;
+        double m_LegContractMultiplier;
+        double m_LegCouponRate;
+        FIX::FieldView m_LegSecurityExchange;
+        FIX::FieldView m_LegIssuer;
+        int m_EncodedLegIssuerLen;
+        FIX::FieldView m_EncodedLegIssuer;
+        FIX::FieldView m_LegSecurityDesc;
+        int m_EncodedLegSecurityDescLen;
+        FIX::FieldView m_EncodedLegSecurityDesc;
+        double m_LegRatioQty;
+        char m_LegSide;
+        FIX::FieldView m_LegCurrency;
+        FIX::FieldView m_LegPool;
+        FIX::FieldView m_LegDatedDate;
+        FIX::FieldView m_LegContractSettlMonth;
+        FIX::FieldView m_LegInterestAccrualDate;
+      };
+      typedef FIX::InlineVector< NoLegs, 2 > NoLegsEntries;
+
+      void decode( FIX::FieldCursor& cursor )
+      {
+        do
+        {
+          switch( cursor.tag() )
+          {
+          case 279:
+            m_present.set( 0 );
+            m_MDUpdateAction = cursor.getChar();
+            break;
+          case 285:
+            m_present.set( 1 );
+            m_DeleteReason = cursor.getChar();
+            break;
+          case 269:
+            m_present.set( 2 );
+            m_MDEntryType = cursor.getChar();
+            break;
+          case 278:
+            m_present.set( 3 );
+            m_MDEntryID = cursor.value();
+            break;
+          case 280:
+            m_present.set( 4 );
+            m_MDEntryRefID = cursor.value();
+            break;
+          case 55:
+            m_present.set( 5 );
+            m_Symbol = cursor.value();
+            break;
+          case 65:
+            m_present.set( 6 );
+            m_SymbolSfx = cursor.value();
+            break;
+          case 48:
+            m_present.set( 7 );
+            m_SecurityID = cursor.value();
+            break;
+          case 22:
+            m_present.set( 8 );
+            m_SecurityIDSource = cursor.value();
+            break;
+          case 460:
+            m_present.set( 9 );
+            m_Product = cursor.getInt();
+            break;
+          case 461:
+            m_present.set( 10 );
+            m_CFICode = cursor.value();
+            break;
+          case 167:
+            m_present.set( 11 );
+            m_SecurityType = cursor.value();
+            break;
+          case 762:
+            m_present.set( 12 );
+            m_SecuritySubType = cursor.value();
+            break;
+          case 200:
+            m_present.set( 13 );
+            m_MaturityMonthYear = cursor.value();
+            break;
+          case 541:
+            m_present.set( 14 );
+            m_MaturityDate = cursor.value();
+            break;
+          case 201:
+            m_present.set( 15 );
+            m_PutOrCall = cursor.getInt();
+            break;
+          case 224:
+            m_present.set( 16 );
+            m_CouponPaymentDate = cursor.value();
+            break;
+          case 225:
+            m_present.set( 17 );
+            m_IssueDate = cursor.value();
+            break;
+          case 239:
+            m_present.set( 18 );
+            m_RepoCollateralSecurityType = cursor.value();
+            break;
+          case 226:
+            m_present.set( 19 );
+            m_RepurchaseTerm = cursor.getInt();
+            break;
+          case 227:
+            m_present.set( 20 );
+            m_RepurchaseRate = cursor.getDouble();
+            break;
+          case 228:
+            m_present.set( 21 );
+            m_Factor = cursor.getDouble();
+            break;
+          case 255:
+            m_present.set( 22 );
+            m_CreditRating = cursor.value();
+            break;
+          case 543:
+            m_present.set( 23 );
+            m_InstrRegistry = cursor.value();
+            break;
+          case 470:
+            m_present.set( 24 );
+            m_CountryOfIssue = cursor.value();
+            break;
+          case 471:
+            m_present.set( 25 );
+            m_StateOrProvinceOfIssue = cursor.value();
+            break;
+          case 472:
+            m_present.set( 26 );
+            m_LocaleOfIssue = cursor.value();
+            break;
+          case 240:
+            m_present.set( 27 );
+            m_RedemptionDate = cursor.value();
+            break;
+          case 202:
+            m_present.set( 28 );
+            m_StrikePrice = cursor.getDouble();
+            break;
+          case 947:
+            m_present.set( 29 );
+            m_StrikeCurrency = cursor.value();
+            break;
+          case 206:
+            m_present.set( 30 );
+            m_OptAttribute = cursor.getChar();
+            break;
+          case 231:
+            m_present.set( 31 );
+            m_ContractMultiplier = cursor.getDouble();
+            break;
+          case 223:
+            m_present.set( 32 );
+            m_CouponRate = cursor.getDouble();
+            break;
+          case 207:
+            m_present.set( 33 );
+            m_SecurityExchange = cursor.value();
+            break;
+          case 106:
+            m_present.set( 34 );
+            m_Issuer = cursor.value();
+            break;
+          case 348:
+            m_present.set( 35 );
+            m_EncodedIssuerLen = cursor.getInt();
+            cursor.setDataLength( 349, m_EncodedIssuerLen );
+            break;
+          case 349:
+            m_present.set( 36 );
+            m_EncodedIssuer = cursor.value();
+            break;
+          case 107:
+            m_present.set( 37 );
+            m_SecurityDesc = cursor.value();
+            break;
+          case 350:
+            m_present.set( 38 );
+            m_EncodedSecurityDescLen = cursor.getInt();
+            cursor.setDataLength( 351, m_EncodedSecurityDescLen );
+            break;
+          case 351:
+            m_present.set( 39 );
+            m_EncodedSecurityDesc = cursor.value();
+            break;
+          case 691:
+            m_present.set( 40 );
+            m_Pool = cursor.value();
+            break;
+          case 667:
+            m_present.set( 41 );
+            m_ContractSettlMonth = cursor.value();
+            break;
+          case 875:
+            m_present.set( 42 );
+            m_CPProgram = cursor.getInt();
+            break;
+          case 876:
+            m_present.set( 43 );
+            m_CPRegType = cursor.value();
+            break;
+          case 873:
+            m_present.set( 44 );
+            m_DatedDate = cursor.value();
+            break;
+          case 874:
+            m_present.set( 45 );
+            m_InterestAccrualDate = cursor.value();
+            break;
+          case 711:
+            m_present.set( 46 );
+            FIX::decodeGroups( cursor, m_NoUnderlyings, 711, 311 );
+            continue;
+          case 555:
+            m_present.set( 47 );
+            FIX::decodeGroups( cursor, m_NoLegs, 555, 600 );
+            continue;
+          case 291:
+            m_present.set( 48 );
+            m_FinancialStatus = cursor.value();
+            break;
+          case 292:
+            m_present.set( 49 );
+            m_CorporateAction = cursor.value();
+            break;
+          case 270:
+            m_present.set( 50 );
+            m_MDEntryPx = cursor.getDouble();
+            break;
+          case 15:
+            m_present.set( 51 );
+            m_Currency = cursor.value();
+            break;
+          case 271:
+            m_present.set( 52 );
+            m_MDEntrySize = cursor.getDouble();
+            break;
+          case 272:
+            m_present.set( 53 );
+            m_MDEntryDate = cursor.value();
+            break;
+          case 273:
+            m_present.set( 54 );
+            m_MDEntryTime = cursor.value();
+            break;
+          case 274:
+            m_present.set( 55 );
+            m_TickDirection = cursor.getChar();
+            break;
+          case 275:
+            m_present.set( 56 );
+            m_MDMkt = cursor.value();
+            break;
+          case 336:
+            m_present.set( 57 );
+            m_TradingSessionID = cursor.value();
+            break;
+          case 625:
+            m_present.set( 58 );
+            m_TradingSessionSubID = cursor.value();
+            break;
+          case 276:
+            m_present.set( 59 );
+            m_QuoteCondition = cursor.value();
+            break;
+          case 277:
+            m_present.set( 60 );
+            m_TradeCondition = cursor.value();
+            break;
+          case 282:
+            m_present.set( 61 );
+            m_MDEntryOriginator = cursor.value();
+            break;
+          case 283:
+            m_present.set( 62 );
+            m_LocationID = cursor.value();
+            break;
+          case 284:
+            m_present.set( 63 );
+            m_DeskID = cursor.value();
+            break;
+          case 286:
+            m_present.set( 64 );
+            m_OpenCloseSettlFlag = cursor.value();
+            break;
+          case 59:
+            m_present.set( 65 );
+            m_TimeInForce = cursor.getChar();
+            break;
+          case 432:
+            m_present.set( 66 );
+            m_ExpireDate = cursor.value();
+            break;
+          case 126:
+            m_present.set( 67 );
+            m_ExpireTime = cursor.value();
+            break;
+          case 110:
+            m_present.set( 68 );
+            m_MinQty = cursor.getDouble();
+            break;
+          case 18:
+            m_present.set( 69 );
+            m_ExecInst = cursor.value();
+            break;
+          case 287:
+            m_present.set( 70 );
+            m_SellerDays = cursor.getInt();
+            break;
+          case 37:
+            m_present.set( 71 );
+            m_OrderID = cursor.value();
+            break;
+          case 299:
+            m_present.set( 72 );
+            m_QuoteEntryID = cursor.value();
+            break;
+          case 288:
+            m_present.set( 73 );
+            m_MDEntryBuyer = cursor.value();
+            break;
+          case 289:
+            m_present.set( 74 );
+            m_MDEntrySeller = cursor.value();
+            break;
+          case 346:
+            m_present.set( 75 );
+            m_NumberOfOrders = cursor.getInt();
+            break;
+          case 290:
+            m_present.set( 76 );
+            m_MDEntryPositionNo = cursor.getInt();
+            break;
+          case 546:
+            m_present.set( 77 );
+            m_Scope = cursor.value();
+            break;
+          case 811:
+            m_present.set( 78 );
+            m_PriceDelta = cursor.getDouble();
+            break;
+          case 451:
+            m_present.set( 79 );
+            m_NetChgPrevDay = cursor.getDouble();
+            break;
+          case 58:
+            m_present.set( 80 );
+            m_Text = cursor.value();
+            break;
+          case 354:
+            m_present.set( 81 );
+            m_EncodedTextLen = cursor.getInt();
+            cursor.setDataLength( 355, m_EncodedTextLen );
+            break;
+          case 355:
+            m_present.set( 82 );
+            m_EncodedText = cursor.value();
+            break;
+          default:
+            return;
+          }
+          cursor.next();
+        }
+        while( cursor.valid() && cursor.tag() != 279 );
+      }
+
+      void clear()
+      {
+        m_present.reset();
+        m_NoUnderlyings.clear();
+        m_NoLegs.clear();
+      }
+      bool isSetMDUpdateAction() const { return m_present[ 0 ]; }
+      char getMDUpdateAction() const
+      { if( !m_present[ 0 ] ) throw FIX::FieldNotFound( FIX::FIELD::MDUpdateAction ); return m_MDUpdateAction; }
+      bool isSetDeleteReason() const { return m_present[ 1 ]; }
+      char getDeleteReason() const
+      { if( !m_present[ 1 ] ) throw FIX::FieldNotFound( FIX::FIELD::DeleteReason ); return m_DeleteReason; }
+      bool isSetMDEntryType() const { return m_present[ 2 ]; }
+      char getMDEntryType() const
+      { if( !m_present[ 2 ] ) throw FIX::FieldNotFound( FIX::FIELD::MDEntryType ); return m_MDEntryType; }
+      bool isSetMDEntryID() const { return m_present[ 3 ]; }
+      const FIX::FieldView& getMDEntryID() const
+      { if( !m_present[ 3 ] ) throw FIX::FieldNotFound( FIX::FIELD::MDEntryID ); return m_MDEntryID; }
+      bool isSetMDEntryRefID() const { return m_present[ 4 ]; }
+      const FIX::FieldView& getMDEntryRefID() const
+      { if( !m_present[ 4 ] ) throw FIX::FieldNotFound( FIX::FIELD::MDEntryRefID ); return m_MDEntryRefID; }
+      bool isSetSymbol() const { return m_present[ 5 ]; }
+      const FIX::FieldView& getSymbol() const
+      { if( !m_present[ 5 ] ) throw FIX::FieldNotFound( FIX::FIELD::Symbol ); return m_Symbol; }
+      bool isSetSymbolSfx() const { return m_present[ 6 ]; }
+      const FIX::FieldView& getSymbolSfx() const
+      { if( !m_present[ 6 ] ) throw FIX::FieldNotFound( FIX::FIELD::SymbolSfx ); return m_SymbolSfx; }
+      bool isSetSecurityID() const { return m_present[ 7 ]; }
+      const FIX::FieldView& getSecurityID() const
+      { if( !m_present[ 7 ] ) throw FIX::FieldNotFound( FIX::FIELD::SecurityID ); return m_SecurityID; }
+      bool isSetSecurityIDSource() const { return m_present[ 8 ]; }
+      const FIX::FieldView& getSecurityIDSource() const
+      { if( !m_present[ 8 ] ) throw FIX::FieldNotFound( FIX::FIELD::SecurityIDSource ); return m_SecurityIDSource; }
+      bool isSetProduct() const { return m_present[ 9 ]; }
+      int getProduct() const
+      { if( !m_present[ 9 ] ) throw FIX::FieldNotFound( FIX::FIELD::Product ); return m_Product; }
+      bool isSetCFICode() const { return m_present[ 10 ]; }
+      const FIX::FieldView& getCFICode() const
+      { if( !m_present[ 10 ] ) throw FIX::FieldNotFound( FIX::FIELD::CFICode ); return m_CFICode; }
+      bool isSetSecurityType() const { return m_present[ 11 ]; }
+      const FIX::FieldView& getSecurityType() const
+      { if( !m_present[ 11 ] ) throw FIX::FieldNotFound( FIX::FIELD::SecurityType ); return m_SecurityType; }
+      bool isSetSecuritySubType() const { return m_present[ 12 ]; }
+      const FIX::FieldView& getSecuritySubType() const
+      { if( !m_present[ 12 ] ) throw FIX::FieldNotFound( FIX::FIELD::SecuritySubType ); return m_SecuritySubType; }
+      bool isSetMaturityMonthYear() const { return m_present[ 13 ]; }
+      const FIX::FieldView& getMaturityMonthYear() const
+      { if( !m_present[ 13 ] ) throw FIX::FieldNotFound( FIX::FIELD::MaturityMonthYear ); return m_MaturityMonthYear; }
+      bool isSetMaturityDate() const { return m_present[ 14 ]; }
+      const FIX::FieldView& getMaturityDate() const
+      { if( !m_present[ 14 ] ) throw FIX::FieldNotFound( FIX::FIELD::MaturityDate ); return m_MaturityDate; }
+      bool isSetPutOrCall() const { return m_present[ 15 ]; }
+      int getPutOrCall() const
+      { if( !m_present[ 15 ] ) throw FIX::FieldNotFound( FIX::FIELD::PutOrCall ); return m_PutOrCall; }
+      bool isSetCouponPaymentDate() const { return m_present[ 16 ]; }
+      const FIX::FieldView& getCouponPaymentDate() const
+      { if( !m_present[ 16 ] ) throw FIX::FieldNotFound( FIX::FIELD::CouponPaymentDate ); return m_CouponPaymentDate; }
+      bool isSetIssueDate() const { return m_present[ 17 ]; }
+      const FIX::FieldView& getIssueDate() const
+      { if( !m_present[ 17 ] ) throw FIX::FieldNotFound( FIX::FIELD::IssueDate ); return m_IssueDate; }
+      bool isSetRepoCollateralSecurityType() const { return m_present[ 18 ]; }
+      const FIX::FieldView& getRepoCollateralSecurityType() const
+      { if( !m_present[ 18 ] ) throw FIX::FieldNotFound( FIX::FIELD::RepoCollateralSecurityType ); return m_RepoCollateralSecurityType; }
+      bool isSetRepurchaseTerm() const { return m_present[ 19 ]; }
+      int getRepurchaseTerm() const
+      { if( !m_present[ 19 ] ) throw FIX::FieldNotFound( FIX::FIELD::RepurchaseTerm ); return m_RepurchaseTerm; }
+      bool isSetRepurchaseRate() const { return m_present[ 20 ]; }
+      double getRepurchaseRate() const
+      { if( !m_present[ 20 ] ) throw FIX::FieldNotFound( FIX::FIELD::RepurchaseRate ); return m_RepurchaseRate; }
+      bool isSetFactor() const { return m_present[ 21 ]; }
+      double getFactor() const
+      { if( !m_present[ 21 ] ) throw FIX::FieldNotFound( FIX::FIELD::Factor ); return m_Factor; }
+      bool isSetCreditRating() const { return m_present[ 22 ]; }
+      const FIX::FieldView& getCreditRating() const
+      { if( !m_present[ 22 ] ) throw FIX::FieldNotFound( FIX::FIELD::CreditRating ); return m_CreditRating; }
+      bool isSetInstrRegistry() const { return m_present[ 23 ]; }
+      const FIX::FieldView& getInstrRegistry() const
+      { if( !m_present[ 23 ] ) throw FIX::FieldNotFound( FIX::FIELD::InstrRegistry ); return m_InstrRegistry; }
+      bool isSetCountryOfIssue() const { return m_present[ 24 ]; }
+      const FIX::FieldView& getCountryOfIssue() const
+      { if( !m_present[ 24 ] ) throw FIX::FieldNotFound( FIX::FIELD::CountryOfIssue ); return m_CountryOfIssue; }
+      bool isSetStateOrProvinceOfIssue() const { return m_present[ 25 ]; }
+      const FIX::FieldView& getStateOrProvinceOfIssue() const
+      { if( !m_present[ 25 ] ) throw FIX::FieldNotFound( FIX::FIELD::StateOrProvinceOfIssue ); return m_StateOrProvinceOfIssue; }
+      bool isSetLocaleOfIssue() const { return m_present[ 26 ]; }
+      const FIX::FieldView& getLocaleOfIssue() const
+      { if( !m_present[ 26 ] ) throw FIX::FieldNotFound( FIX::FIELD::LocaleOfIssue ); return m_LocaleOfIssue; }
+      bool isSetRedemptionDate() const { return m_present[ 27 ]; }
+      const FIX::FieldView& getRedemptionDate() const
+      { if( !m_present[ 27 ] ) throw FIX::FieldNotFound( FIX::FIELD::RedemptionDate ); return m_RedemptionDate; }
+      bool isSetStrikePrice() const { return m_present[ 28 ]; }
+      double getStrikePrice() const
+      { if( !m_present[ 28 ] ) throw FIX::FieldNotFound( FIX::FIELD::StrikePrice ); return m_StrikePrice; }
+      bool isSetStrikeCurrency() const { return m_present[ 29 ]; }
+      const FIX::FieldView& getStrikeCurrency() const
+      { if( !m_present[ 29 ] ) throw FIX::FieldNotFound( FIX::FIELD::StrikeCurrency ); return m_StrikeCurrency; }
+      bool isSetOptAttribute() const { return m_present[ 30 ]; }
+      char getOptAttribute() const
+      { if( !m_present[ 30 ] ) throw FIX::FieldNotFound( FIX::FIELD::OptAttribute ); return m_OptAttribute; }
+      bool isSetContractMultiplier() const { return m_present[ 31 ]; }
+      double getContractMultiplier() const
+      { if( !m_present[ 31 ] ) throw FIX::FieldNotFound( FIX::FIELD::ContractMultiplier ); return m_ContractMultiplier; }
+      bool isSetCouponRate() const { return m_present[ 32 ]; }
+      double getCouponRate() const
+      { if( !m_present[ 32 ] ) throw FIX::FieldNotFound( FIX::FIELD::CouponRate ); return m_CouponRate; }
+      bool isSetSecurityExchange() const { return m_present[ 33 ]; }
+      const FIX::FieldView& getSecurityExchange() const
+      { if( !m_present[ 33 ] ) throw FIX::FieldNotFound( FIX::FIELD::SecurityExchange ); return m_SecurityExchange; }
+      bool isSetIssuer() const { return m_present[ 34 ]; }
+      const FIX::FieldView& getIssuer() const
+      { if( !m_present[ 34 ] ) throw FIX::FieldNotFound( FIX::FIELD::Issuer ); return m_Issuer; }
+      bool isSetEncodedIssuerLen() const { return m_present[ 35 ]; }
+      int getEncodedIssuerLen() const
+      { if( !m_present[ 35 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedIssuerLen ); return m_EncodedIssuerLen; }
+      bool isSetEncodedIssuer() const { return m_present[ 36 ]; }
+      const FIX::FieldView& getEncodedIssuer() const
+      { if( !m_present[ 36 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedIssuer ); return m_EncodedIssuer; }
+      bool isSetSecurityDesc() const { return m_present[ 37 ]; }
+      const FIX::FieldView& getSecurityDesc() const
+      { if( !m_present[ 37 ] ) throw FIX::FieldNotFound( FIX::FIELD::SecurityDesc ); return m_SecurityDesc; }
+      bool isSetEncodedSecurityDescLen() const { return m_present[ 38 ]; }
+      int getEncodedSecurityDescLen() const
+      { if( !m_present[ 38 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedSecurityDescLen ); return m_EncodedSecurityDescLen; }
+      bool isSetEncodedSecurityDesc() const { return m_present[ 39 ]; }
+      const FIX::FieldView& getEncodedSecurityDesc() const
+      { if( !m_present[ 39 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedSecurityDesc ); return m_EncodedSecurityDesc; }
+      bool isSetPool() const { return m_present[ 40 ]; }
+      const FIX::FieldView& getPool() const
+      { if( !m_present[ 40 ] ) throw FIX::FieldNotFound( FIX::FIELD::Pool ); return m_Pool; }
+      bool isSetContractSettlMonth() const { return m_present[ 41 ]; }
+      const FIX::FieldView& getContractSettlMonth() const
+      { if( !m_present[ 41 ] ) throw FIX::FieldNotFound( FIX::FIELD::ContractSettlMonth ); return m_ContractSettlMonth; }
+      bool isSetCPProgram() const { return m_present[ 42 ]; }
+      int getCPProgram() const
+      { if( !m_present[ 42 ] ) throw FIX::FieldNotFound( FIX::FIELD::CPProgram ); return m_CPProgram; }
+      bool isSetCPRegType() const { return m_present[ 43 ]; }
+      const FIX::FieldView& getCPRegType() const
+      { if( !m_present[ 43 ] ) throw FIX::FieldNotFound( FIX::FIELD::CPRegType ); return m_CPRegType; }
+      bool isSetDatedDate() const { return m_present[ 44 ]; }
+      const FIX::FieldView& getDatedDate() const
+      { if( !m_present[ 44 ] ) throw FIX::FieldNotFound( FIX::FIELD::DatedDate ); return m_DatedDate; }
+      bool isSetInterestAccrualDate() const { return m_present[ 45 ]; }
+      const FIX::FieldView& getInterestAccrualDate() const
+      { if( !m_present[ 45 ] ) throw FIX::FieldNotFound( FIX::FIELD::InterestAccrualDate ); return m_InterestAccrualDate; }
+      bool isSetNoUnderlyings() const { return m_present[ 46 ]; }
+      const NoUnderlyingsEntries& getNoUnderlyings() const { return m_NoUnderlyings; }
+      bool isSetNoLegs() const { return m_present[ 47 ]; }
+      const NoLegsEntries& getNoLegs() const { return m_NoLegs; }
+      bool isSetFinancialStatus() const { return m_present[ 48 ]; }
+      const FIX::FieldView& getFinancialStatus() const
+      { if( !m_present[ 48 ] ) throw FIX::FieldNotFound( FIX::FIELD::FinancialStatus ); return m_FinancialStatus; }
+      bool isSetCorporateAction() const { return m_present[ 49 ]; }
+      const FIX::FieldView& getCorporateAction() const
+      { if( !m_present[ 49 ] ) throw FIX::FieldNotFound( FIX::FIELD::CorporateAction ); return m_CorporateAction; }
+      bool isSetMDEntryPx() const { return m_present[ 50 ]; }
+      double getMDEntryPx() const
+      { if( !m_present[ 50 ] ) throw FIX::FieldNotFound( FIX::FIELD::MDEntryPx ); return m_MDEntryPx; }
+      bool isSetCurrency() const { return m_present[ 51 ]; }
+      const FIX::FieldView& getCurrency() const
+      { if( !m_present[ 51 ] ) throw FIX::FieldNotFound( FIX::FIELD::Currency ); return m_Currency; }
+      bool isSetMDEntrySize() const { return m_present[ 52 ]; }
+      double getMDEntrySize() const
+      { if( !m_present[ 52 ] ) throw FIX::FieldNotFound( FIX::FIELD::MDEntrySize ); return m_MDEntrySize; }
+      bool isSetMDEntryDate() const { return m_present[ 53 ]; }
+      const FIX::FieldView& getMDEntryDate() const
+      { if( !m_present[ 53 ] ) throw FIX::FieldNotFound( FIX::FIELD::MDEntryDate ); return m_MDEntryDate; }
+      bool isSetMDEntryTime() const { return m_present[ 54 ]; }
+      const FIX::FieldView& getMDEntryTime() const
+      { if( !m_present[ 54 ] ) throw FIX::FieldNotFound( FIX::FIELD::MDEntryTime ); return m_MDEntryTime; }
+      bool isSetTickDirection() const { return m_present[ 55 ]; }
+      char getTickDirection() const
+      { if( !m_present[ 55 ] ) throw FIX::FieldNotFound( FIX::FIELD::TickDirection ); return m_TickDirection; }
+      bool isSetMDMkt() const { return m_present[ 56 ]; }
+      const FIX::FieldView& getMDMkt() const
+      { if( !m_present[ 56 ] ) throw FIX::FieldNotFound( FIX::FIELD::MDMkt ); return m_MDMkt; }
+      bool isSetTradingSessionID() const { return m_present[ 57 ]; }
+      const FIX::FieldView& getTradingSessionID() const
+      { if( !m_present[ 57 ] ) throw FIX::FieldNotFound( FIX::FIELD::TradingSessionID ); return m_TradingSessionID; }
+      bool isSetTradingSessionSubID() const { return m_present[ 58 ]; }
+      const FIX::FieldView& getTradingSessionSubID() const
+      { if( !m_present[ 58 ] ) throw FIX::FieldNotFound( FIX::FIELD::TradingSessionSubID ); return m_TradingSessionSubID; }
+      bool isSetQuoteCondition() const { return m_present[ 59 ]; }
+      const FIX::FieldView& getQuoteCondition() const
+      { if( !m_present[ 59 ] ) throw FIX::FieldNotFound( FIX::FIELD::QuoteCondition ); return m_QuoteCondition; }
+      bool isSetTradeCondition() const { return m_present[ 60 ]; }
+      const FIX::FieldView& getTradeCondition() const
+      { if( !m_present[ 60 ] ) throw FIX::FieldNotFound( FIX::FIELD::TradeCondition ); return m_TradeCondition; }
+      bool isSetMDEntryOriginator() const { return m_present[ 61 ]; }
+      const FIX::FieldView& getMDEntryOriginator() const
+      { if( !m_present[ 61 ] ) throw FIX::FieldNotFound( FIX::FIELD::MDEntryOriginator ); return m_MDEntryOriginator; }
+      bool isSetLocationID() const { return m_present[ 62 ]; }
+      const FIX::FieldView& getLocationID() const
+      { if( !m_present[ 62 ] ) throw FIX::FieldNotFound( FIX::FIELD::LocationID ); return m_LocationID; }
+      bool isSetDeskID() const { return m_present[ 63 ]; }
+      const FIX::FieldView& getDeskID() const
+      { if( !m_present[ 63 ] ) throw FIX::FieldNotFound( FIX::FIELD::DeskID ); return m_DeskID; }
+      bool isSetOpenCloseSettlFlag() const { return m_present[ 64 ]; }
+      const FIX::FieldView& getOpenCloseSettlFlag() const
+      { if( !m_present[ 64 ] ) throw FIX::FieldNotFound( FIX::FIELD::OpenCloseSettlFlag ); return m_OpenCloseSettlFlag; }
+      bool isSetTimeInForce() const { return m_present[ 65 ]; }
+      char getTimeInForce() const
+      { if( !m_present[ 65 ] ) throw FIX::FieldNotFound( FIX::FIELD::TimeInForce ); return m_TimeInForce; }
+      bool isSetExpireDate() const { return m_present[ 66 ]; }
+      const FIX::FieldView& getExpireDate() const
+      { if( !m_present[ 66 ] ) throw FIX::FieldNotFound( FIX::FIELD::ExpireDate ); return m_ExpireDate; }
+      bool isSetExpireTime() const { return m_present[ 67 ]; }
+      const FIX::FieldView& getExpireTime() const
+      { if( !m_present[ 67 ] ) throw FIX::FieldNotFound( FIX::FIELD::ExpireTime ); return m_ExpireTime; }
+      bool isSetMinQty() const { return m_present[ 68 ]; }
+      double getMinQty() const
+      { if( !m_present[ 68 ] ) throw FIX::FieldNotFound( FIX::FIELD::MinQty ); return m_MinQty; }
+      bool isSetExecInst() const { return m_present[ 69 ]; }
+      const FIX::FieldView& getExecInst() const
+      { if( !m_present[ 69 ] ) throw FIX::FieldNotFound( FIX::FIELD::ExecInst ); return m_ExecInst; }
+      bool isSetSellerDays() const { return m_present[ 70 ]; }
+      int getSellerDays() const
+      { if( !m_present[ 70 ] ) throw FIX::FieldNotFound( FIX::FIELD::SellerDays ); return m_SellerDays; }
+      bool isSetOrderID() const { return m_present[ 71 ]; }
+      const FIX::FieldView& getOrderID() const
+      { if( !m_present[ 71 ] ) throw FIX::FieldNotFound( FIX::FIELD::OrderID ); return m_OrderID; }
+      bool isSetQuoteEntryID() const { return m_present[ 72 ]; }
+      const FIX::FieldView& getQuoteEntryID() const
+      { if( !m_present[ 72 ] ) throw FIX::FieldNotFound( FIX::FIELD::QuoteEntryID ); return m_QuoteEntryID; }
+      bool isSetMDEntryBuyer() const { return m_present[ 73 ]; }
+      const FIX::FieldView& getMDEntryBuyer() const
+      { if( !m_present[ 73 ] ) throw FIX::FieldNotFound( FIX::FIELD::MDEntryBuyer ); return m_MDEntryBuyer; }
+      bool isSetMDEntrySeller() const { return m_present[ 74 ]; }
+      const FIX::FieldView& getMDEntrySeller() const
+      { if( !m_present[ 74 ] ) throw FIX::FieldNotFound( FIX::FIELD::MDEntrySeller ); return m_MDEntrySeller; }
+      bool isSetNumberOfOrders() const { return m_present[ 75 ]; }
+      int getNumberOfOrders() const
+      { if( !m_present[ 75 ] ) throw FIX::FieldNotFound( FIX::FIELD::NumberOfOrders ); return m_NumberOfOrders; }
+      bool isSetMDEntryPositionNo() const { return m_present[ 76 ]; }
+      int getMDEntryPositionNo() const
+      { if( !m_present[ 76 ] ) throw FIX::FieldNotFound( FIX::FIELD::MDEntryPositionNo ); return m_MDEntryPositionNo; }
+      bool isSetScope() const { return m_present[ 77 ]; }
+      const FIX::FieldView& getScope() const
+      { if( !m_present[ 77 ] ) throw FIX::FieldNotFound( FIX::FIELD::Scope ); return m_Scope; }
+      bool isSetPriceDelta() const { return m_present[ 78 ]; }
+      double getPriceDelta() const
+      { if( !m_present[ 78 ] ) throw FIX::FieldNotFound( FIX::FIELD::PriceDelta ); return m_PriceDelta; }
+      bool isSetNetChgPrevDay() const { return m_present[ 79 ]; }
+      double getNetChgPrevDay() const
+      { if( !m_present[ 79 ] ) throw FIX::FieldNotFound( FIX::FIELD::NetChgPrevDay ); return m_NetChgPrevDay; }
+      bool isSetText() const { return m_present[ 80 ]; }
+      const FIX::FieldView& getText() const
+      { if( !m_present[ 80 ] ) throw FIX::FieldNotFound( FIX::FIELD::Text ); return m_Text; }
+      bool isSetEncodedTextLen() const { return m_present[ 81 ]; }
+      int getEncodedTextLen() const
+      { if( !m_present[ 81 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedTextLen ); return m_EncodedTextLen; }
+      bool isSetEncodedText() const { return m_present[ 82 ]; }
+      const FIX::FieldView& getEncodedText() const
+      { if( !m_present[ 82 ] ) throw FIX::FieldNotFound( FIX::FIELD::EncodedText ); return m_EncodedText; }
+
+    private:
+      std::bitset< 83 > m_present;
+      char m_MDUpdateAction;
+      char m_DeleteReason;
+      char m_MDEntryType;
+      FIX::FieldView m_MDEntryID;
+      FIX::FieldView m_MDEntryRefID;
+      FIX::FieldView m_Symbol;
+      FIX::FieldView m_SymbolSfx;
+      FIX::FieldView m_SecurityID;
+      FIX::FieldView m_SecurityIDSource;
+      int m_Product;
+      FIX::FieldView m_CFICode;
+      FIX::FieldView m_SecurityType;
+      FIX::FieldView m_SecuritySubType;
+      FIX::FieldView m_MaturityMonthYear;
+      FIX::FieldView m_MaturityDate;
+      int m_PutOrCall;
+      FIX::FieldView m_CouponPaymentDate;
+      FIX::FieldView m_IssueDate;
+      FIX::FieldView m_RepoCollateralSecurityType;
+      int m_RepurchaseTerm;
+      double m_RepurchaseRate;
+      double m_Factor;
+      FIX::FieldView m_CreditRating;
+      FIX::FieldView m_InstrRegistry;
+      FIX::FieldView m_CountryOfIssue;
+      FIX::FieldView m_StateOrProvinceOfIssue;
+      FIX::FieldView m_LocaleOfIssue;
+      FIX::FieldView m_RedemptionDate;
+      double m_StrikePrice;
+      FIX::FieldView m_StrikeCurrency;
+      char m_OptAttribute;
+      double m_ContractMultiplier;
+      double m_CouponRate;
+      FIX::FieldView m_SecurityExchange;
+      FIX::FieldView m_Issuer;
+      int m_EncodedIssuerLen;
+      FIX::FieldView m_EncodedIssuer;
+      FIX::FieldView m_SecurityDesc;
+      int m_EncodedSecurityDescLen;
+      FIX::FieldView m_EncodedSecurityDesc;
+      FIX::FieldView m_Pool;
+      FIX::FieldView m_ContractSettlMonth;
+      int m_CPProgram;
+      FIX::FieldView m_CPRegType;
+      FIX::FieldView m_DatedDate;
+      FIX::FieldView m_InterestAccrualDate;
+      NoUnderlyingsEntries m_NoUnderlyings;
+      NoLegsEntries m_NoLegs;
+      FIX::FieldView m_FinancialStatus;
+      FIX::FieldView m_CorporateAction;
+      double m_MDEntryPx;
+      FIX::FieldView m_Currency;
+      double m_MDEntrySize;
+      FIX::FieldView m_MDEntryDate;
+      FIX::FieldView m_MDEntryTime;
+      char m_TickDirection;
+      FIX::FieldView m_MDMkt;
+      FIX::FieldView m_TradingSessionID;
+      FIX::FieldView m_TradingSessionSubID;
+      FIX::FieldView m_QuoteCondition;
+      FIX::FieldView m_TradeCondition;
+      FIX::FieldView m_MDEntryOriginator;
+      FIX::FieldView m_LocationID;
+      FIX::FieldView m_DeskID;
+      FIX::FieldView m_OpenCloseSettlFlag;
+      char m_TimeInForce;
+      FIX::FieldView m_ExpireDate;
+      FIX::FieldView m_ExpireTime;
+      double m_MinQty;
+      FIX::FieldView m_ExecInst;
+      int m_SellerDays;
+      FIX::FieldView m_OrderID;
+      FIX::FieldView m_QuoteEntryID;
+      FIX::FieldView m_MDEntryBuyer;
+      FIX::FieldView m_MDEntrySeller;
+      int m_NumberOfOrders;
+      int m_MDEntryPositionNo;
+      FIX::FieldView m_Scope;
+      double m_PriceDelta;
+      double m_NetChgPrevDay;
+      FIX::FieldView m_Text;
+      int m_EncodedTextLen;
+      FIX::FieldView m_EncodedText;
+    };
+    typedef FIX::InlineVector< NoMDEntries, 8 > NoMDEntriesEntries;
+
+    MarketDataIncrementalRefreshDecoder() : m_data( 0 ), m_size( 0 ) {}
+
+    void decode( const std::string& message )
+    { decode( message.data(), message.size() ); }
+    void decode( const char* data, size_t size )
+    {
+      m_data = data;
+      m_size = size;
+      clear();
+      FIX::FieldCursor cursor( data, data + size );
+      while( cursor.valid() )
+      {
+        switch( cursor.tag() )
+        {
+        case 8:
+          m_present.set( 0 );
+          m_BeginString = cursor.value();
+          break;
+        case 9:
+          m_present.set( 1 );
+          m_BodyLength = cursor.getInt();
+          break;
+        case 35:
+          m_present.set( 2 );
+          m_MsgType = cursor.value();
+          if( m_MsgType != "X" )
+            throw FIX::InvalidMessageType( m_MsgType.str() );
+          break;
+        case 49:
+          m_present.set( 3 );
+          m_SenderCompID = cursor.value();
+          break;
+        case 56:
+          m_present.set( 4 );
+          m_TargetCompID = cursor.value();
+          break;
+        case 115:
+          m_present.set( 5 );
+          m_OnBehalfOfCompID = cursor.value();
+          break;
+        case 128:
+          m_present.set( 6 );
+          m_DeliverToCompID = cursor.value();
+          break;
+        case 90:
+          m_present.set( 7 );
+          m_SecureDataLen = cursor.getInt();
+          cursor.setDataLength( 91, m_SecureDataLen );
+          break;
+        case 91:
+          m_present.set( 8 );
+          m_SecureData = cursor.value();
+          break;
+        case 34:
+          m_present.set( 9 );
+          m_MsgSeqNum = cursor.getInt();
+          break;
+        case 50:
+          m_present.set( 10 );
+          m_SenderSubID = cursor.value();
+          break;
+        case 142:
+          m_present.set( 11 );
+          m_SenderLocationID = cursor.value();
+          break;
+        case 57:
+          m_present.set( 12 );
+          m_TargetSubID = cursor.value();
+          break;
+        case 143:
+          m_present.set( 13 );
+          m_TargetLocationID = cursor.value();
+          break;
+        case 116:
+          m_present.set( 14 );
+          m_OnBehalfOfSubID = cursor.value();
+          break;
+        case 144:
+          m_present.set( 15 );
+          m_OnBehalfOfLocationID = cursor.value();
+          break;
+        case 129:
+          m_present.set( 16 );
+          m_DeliverToSubID = cursor.value();
+          break;
+        case 145:
+          m_present.set( 17 );
+          m_DeliverToLocationID = cursor.value();
+          break;
+        case 43:
+          m_present.set( 18 );
+          m_PossDupFlag = cursor.getBool();
+          break;
+        case 97:
+          m_present.set( 19 );
+          m_PossResend = cursor.getBool();
+          break;
+        case 52:
+          m_present.set( 20 );
+          m_SendingTime = cursor.value();
+          break;
+        case 122:
+          m_present.set( 21 );
+          m_OrigSendingTime = cursor.value();
+          break;
+        case 212:
+          m_present.set( 22 );
+          m_XmlDataLen = cursor.getInt();
+          cursor.setDataLength( 213, m_XmlDataLen );
+          break;
+        case 213:
+          m_present.set( 23 );
+          m_XmlData = cursor.value();
+          break;
+        case 347:
+          m_present.set( 24 );
+          m_MessageEncoding = cursor.value();
+          break;
+        case 369:
+          m_present.set( 25 );
+          m_LastMsgSeqNumProcessed = cursor.getInt();
+          break;
+        case 262:
+          m_present.set( 26 );
+          m_MDReqID = cursor.value();
+          break;
+        case 268:
+          m_present.set( 27 );
+          FIX::decodeGroups( cursor, m_NoMDEntries, 268, 279 );
+          continue;
+        case 813:
+          m_present.set( 28 );
+          m_ApplQueueDepth = cursor.getInt();
+          break;
+        case 814:
+          m_present.set( 29 );
+          m_ApplQueueResolution = cursor.getInt();
+          break;
+        case 93:
+          m_present.set( 30 );
+          m_SignatureLength = cursor.getInt();
+          cursor.setDataLength( 89, m_SignatureLength );
+          break;
+        case 89:
+          m_present.set( 31 );
+          m_Signature = cursor.value();
+          break;
+        case 10:
+          m_present.set( 32 );
+          m_CheckSum = cursor.value();
+          break;
+        default:
+          break;
+        }
+        cursor.next();
+      }
+    }
+
+    /// Parse the decoded buffer into a full message.
+    void toMessage( FIX::Message& message, const FIX::DataDictionary* pDataDictionary = 0 ) const
+    { message.setString( FIX::INCOMING_DIRECTION, std::string( m_data, m_size ), 0, pDataDictionary ); }
+
+    bool isSetBeginString() const { return m_present[ 0 ]; }
+    const FIX::FieldView& getBeginString() const
+    { if( !m_present[ 0 ] ) throw FIX::FieldNotFound( FIX::FIELD::BeginString ); return m_BeginString; }
+    bool isSetBodyLength() const { return m_present[ 1 ]; }
+    int getBodyLength() const
+    { if( !m_present[ 1 ] ) throw FIX::FieldNotFound( FIX::FIELD::BodyLength ); return m_BodyLength; }
+    bool isSetMsgType() const { return m_present[ 2 ]; }
+    const FIX::FieldView& getMsgType() const
+    { if( !m_present[ 2 ] ) throw FIX::FieldNotFound( FIX::FIELD::MsgType ); return m_MsgType; }
+    bool isSetSenderCompID() const { return m_present[ 3 ]; }
+    const FIX::FieldView& getSenderCompID() const
+    { if( !m_present[ 3 ] ) throw FIX::FieldNotFound( FIX::FIELD::SenderCompID ); return m_SenderCompID; }
+    bool isSetTargetCompID() const { return m_present[ 4 ]; }
+    const FIX::FieldView& getTargetCompID() const
+    { if( !m_present[ 4 ] ) throw FIX::FieldNotFound( FIX::FIELD::TargetCompID ); return m_TargetCompID; }
+    bool isSetOnBehalfOfCompID() const { return m_present[ 5 ]; }
+    const FIX::FieldView& getOnBehalfOfCompID() const
+    { if( !m_present[ 5 ] ) throw FIX::FieldNotFound( FIX::FIELD::OnBehalfOfCompID ); return m_OnBehalfOfCompID; }
+    bool isSetDeliverToCompID() const { return m_present[ 6 ]; }
+    const FIX::FieldView& getDeliverToCompID() const
+    { if( !m_present[ 6 ] ) throw FIX::FieldNotFound( FIX::FIELD::DeliverToCompID ); return m_DeliverToCompID; }
+    bool isSetSecureDataLen() const { return m_present[ 7 ]; }
+    int getSecureDataLen() const
+    { if( !m_present[ 7 ] ) throw FIX::FieldNotFound( FIX::FIELD::SecureDataLen ); return m_SecureDataLen; }
+    bool isSetSecureData() const { return m_present[ 8 ]; }
+    const FIX::FieldView& getSecureData() const
+    { if( !m_present[ 8 ] ) throw FIX::FieldNotFound( FIX::FIELD::SecureData ); return m_SecureData; }
+    bool isSetMsgSeqNum() const { return m_present[ 9 ]; }
+    int getMsgSeqNum() const
+    { if( !m_present[ 9 ] ) throw FIX::FieldNotFound( FIX::FIELD::MsgSeqNum ); return m_MsgSeqNum; }
+    bool isSetSenderSubID() const { return m_present[ 10 ]; }
+    const FIX::FieldView& getSenderSubID() const
+    { if( !m_present[ 10 ] ) throw FIX::FieldNotFound( FIX::FIELD::SenderSubID ); return m_SenderSubID; }
+    bool isSetSenderLocationID() const { return m_present[ 11 ]; }
+    const FIX::FieldView& getSenderLocationID() const
+    { if( !m_present[ 11 ] ) throw FIX::FieldNotFound( FIX::FIELD::SenderLocationID ); return m_SenderLocationID; }
+    bool isSetTargetSubID() const { return m_present[ 12 ]; }
+    const FIX::FieldView& getTargetSubID() const
+    { if( !m_present[ 12 ] ) throw FIX::FieldNotFound( FIX::FIELD::TargetSubID ); return m_TargetSubID; }
+    bool isSetTargetLocationID() const { return m_present[ 13 ]; }
+    const FIX::FieldView& getTargetLocationID() const
+    { if( !m_present[ 13 ] ) throw FIX::FieldNotFound( FIX::FIELD::TargetLocationID ); return m_TargetLocationID; }
+    bool isSetOnBehalfOfSubID() const { return m_present[ 14 ]; }
+    const FIX::FieldView& getOnBehalfOfSubID() const
+    { if( !m_present[ 14 ] ) throw FIX::FieldNotFound( FIX::FIELD::OnBehalfOfSubID ); return m_OnBehalfOfSubID; }
+    bool isSetOnBehalfOfLocationID() const { return m_present[ 15 ]; }
+    const FIX::FieldView& getOnBehalfOfLocationID() const
+    { if( !m_present[ 15 ] ) throw FIX::FieldNotFound( FIX::FIELD::OnBehalfOfLocationID ); return m_OnBehalfOfLocationID; }
+    bool isSetDeliverToSubID() const { return m_present[ 16 ]; }
+    const FIX::FieldView& getDeliverToSubID() const
+    { if( !m_present[ 16 ] ) throw FIX::FieldNotFound( FIX::FIELD::DeliverToSubID ); return m_DeliverToSubID; }
+    bool isSetDeliverToLocationID() const { return m_present[ 17 ]; }
+    const FIX::FieldView& getDeliverToLocationID() const
+    { if( !m_present[ 17 ] ) throw FIX::FieldNotFound( FIX::FIELD::DeliverToLocationID ); return m_DeliverToLocationID; }
+    bool isSetPossDupFlag() const { return m_present[ 18 ]; }
+    bool getPossDupFlag() const
+    { if( !m_present[ 18 ] ) throw FIX::FieldNotFound( FIX::FIELD::PossDupFlag ); return m_PossDupFlag; }
+    bool isSetPossResend() const { return m_present[ 19 ]; }
+    bool getPossResend() const
+    { if( !m_present[ 19 ] ) throw FIX::FieldNotFound( FIX::FIELD::PossResend ); return m_PossResend; }
+    bool isSetSendingTime() const { return m_present[ 20 ]; }
+    const FIX::FieldView& getSendingTime() const
+    { if( !m_present[ 20 ] ) throw FIX::FieldNotFound( FIX::FIELD::SendingTime ); return m_SendingTime; }
+    bool isSetOrigSendingTime() const { return m_present[ 21 ]; }
+    const FIX::FieldView& getOrigSendingTime() const
+    { if( !m_present[ 21 ] ) throw FIX::FieldNotFound( FIX::FIELD::OrigSendingTime ); return m_OrigSendingTime; }
+    bool isSetXmlDataLen() const { return m_present[ 22 ]; }
+    int getXmlDataLen() const
+    { if( !m_present[ 22 ] ) throw FIX::FieldNotFound( FIX::FIELD::XmlDataLen ); return m_XmlDataLen; }
+    bool isSetXmlData() const { return m_present[ 23 ]; }
+    const FIX::FieldView& getXmlData() const
+    { if( !m_present[ 23 ] ) throw FIX::FieldNotFound( FIX::FIELD::XmlData ); return m_XmlData; }
+    bool isSetMessageEncoding() const { return m_present[ 24 ]; }
+    const FIX::FieldView& getMessageEncoding() const
+    { if( !m_present[ 24 ] ) throw FIX::FieldNotFound( FIX::FIELD::MessageEncoding ); return m_MessageEncoding; }
+    bool isSetLastMsgSeqNumProcessed() const { return m_present[ 25 ]; }
+    int getLastMsgSeqNumProcessed() const
+    { if( !m_present[ 25 ] ) throw FIX::FieldNotFound( FIX::FIELD::LastMsgSeqNumProcessed ); return m_LastMsgSeqNumProcessed; }
+    bool isSetMDReqID() const { return m_present[ 26 ]; }
+    const FIX::FieldView& getMDReqID() const
+    { if( !m_present[ 26 ] ) throw FIX::FieldNotFound( FIX::FIELD::MDReqID ); return m_MDReqID; }
+    bool isSetNoMDEntries() const { return m_present[ 27 ]; }
+    const NoMDEntriesEntries& getNoMDEntries() const { return m_NoMDEntries; }
+    bool isSetApplQueueDepth() const { return m_present[ 28 ]; }
+    int getApplQueueDepth() const
+    { if( !m_present[ 28 ] ) throw FIX::FieldNotFound( FIX::FIELD::ApplQueueDepth ); return m_ApplQueueDepth; }
+    bool isSetApplQueueResolution() const { return m_present[ 29 ]; }
+    int getApplQueueResolution() const
+    { if( !m_present[ 29 ] ) throw FIX::FieldNotFound( FIX::FIELD::ApplQueueResolution ); return m_ApplQueueResolution; }
+    bool isSetSignatureLength() const { return m_present[ 30 ]; }
+    int getSignatureLength() const
+    { if( !m_present[ 30 ] ) throw FIX::FieldNotFound( FIX::FIELD::SignatureLength ); return m_SignatureLength; }
+    bool isSetSignature() const { return m_present[ 31 ]; }
+    const FIX::FieldView& getSignature() const
+    { if( !m_present[ 31 ] ) throw FIX::FieldNotFound( FIX::FIELD::Signature ); return m_Signature; }
+    bool isSetCheckSum() const { return m_present[ 32 ]; }
+    const FIX::FieldView& getCheckSum() const
+    { if( !m_present[ 32 ] ) throw FIX::FieldNotFound( FIX::FIELD::CheckSum ); return m_CheckSum; }
+
+  private:
+    void clear()
+    {
+      m_present.reset();
+      m_NoMDEntries.clear();
+    }
+
+    const char* m_data;
+    size_t m_size;
+    std::bitset< 33 > m_present;
+    FIX::FieldView m_BeginString;
+    int m_BodyLength;
+    FIX::FieldView m_MsgType;
+    FIX::FieldView m_SenderCompID;
+    FIX::FieldView m_TargetCompID;
+    FIX::FieldView m_OnBehalfOfCompID;
+    FIX::FieldView m_DeliverToCompID;
+    int m_SecureDataLen;
+    FIX::FieldView m_SecureData;
+    int m_MsgSeqNum;
+    FIX::FieldView m_SenderSubID;
+    FIX::FieldView m_SenderLocationID;
+    FIX::FieldView m_TargetSubID;
+    FIX::FieldView m_TargetLocationID;
+    FIX::FieldView m_OnBehalfOfSubID;
+    FIX::FieldView m_OnBehalfOfLocationID;
+    FIX::FieldView m_DeliverToSubID;
+    FIX::FieldView m_DeliverToLocationID;
+    bool m_PossDupFlag;
+    bool m_PossResend;
+    FIX::FieldView m_SendingTime;
+    FIX::FieldView m_OrigSendingTime;
+    int m_XmlDataLen;
+    FIX::FieldView m_XmlData;
+    FIX::FieldView m_MessageEncoding;
+    int m_LastMsgSeqNumProcessed;
+    FIX::FieldView m_MDReqID;
+    NoMDEntriesEntries m_NoMDEntries;
+    int m_ApplQueueDepth;
+    int m_ApplQueueResolution;
+    int m_SignatureLength;
+    FIX::FieldView m_Signature;
+    FIX::FieldView m_CheckSum;
+  };
+
+}
+
+#endif
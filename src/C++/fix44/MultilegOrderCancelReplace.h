@@ -40,7 +40,8 @@ namespace FIX44
     class NoPartyIDs: public FIX::Group
     {
     public:
-    NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,802,0)) {}
+    NoPartyIDs() : FIX::Group(453,448,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(448,447,452,802,0); return instance; }
       FIELD_SET(*this, FIX::PartyID);
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
@@ -48,7 +49,8 @@ namespace FIX44
       class NoPartySubIDs: public FIX::Group
       {
       public:
-      NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
+      NoPartySubIDs() : FIX::Group(802,523,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(523,803,0); return instance; }
         FIELD_SET(*this, FIX::PartySubID);
         FIELD_SET(*this, FIX::PartySubIDType);
       };
@@ -66,7 +68,8 @@ namespace FIX44
     class NoAllocs: public FIX::Group
     {
     public:
-    NoAllocs() : FIX::Group(78,79,FIX::message_order(79,661,736,467,948,80,0)) {}
+    NoAllocs() : FIX::Group(78,79,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(79,661,736,467,948,80,0); return instance; }
       FIELD_SET(*this, FIX::AllocAccount);
       FIELD_SET(*this, FIX::AllocAcctIDSource);
       FIELD_SET(*this, FIX::AllocSettlCurrency);
@@ -75,7 +78,8 @@ namespace FIX44
       class NoNested3PartyIDs: public FIX::Group
       {
       public:
-      NoNested3PartyIDs() : FIX::Group(948,949,FIX::message_order(949,950,951,952,0)) {}
+      NoNested3PartyIDs() : FIX::Group(948,949,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(949,950,951,952,0); return instance; }
         FIELD_SET(*this, FIX::Nested3PartyID);
         FIELD_SET(*this, FIX::Nested3PartyIDSource);
         FIELD_SET(*this, FIX::Nested3PartyRole);
@@ -83,7 +87,8 @@ namespace FIX44
         class NoNested3PartySubIDs: public FIX::Group
         {
         public:
-        NoNested3PartySubIDs() : FIX::Group(952,953,FIX::message_order(953,954,0)) {}
+        NoNested3PartySubIDs() : FIX::Group(952,953,order()) {}
+        static const FIX::message_order& order() { static const FIX::message_order instance(953,954,0); return instance; }
           FIELD_SET(*this, FIX::Nested3PartySubID);
           FIELD_SET(*this, FIX::Nested3PartySubIDType);
         };
@@ -103,7 +108,8 @@ namespace FIX44
     class NoTradingSessions: public FIX::Group
     {
     public:
-    NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,625,0)) {}
+    NoTradingSessions() : FIX::Group(386,336,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(336,625,0); return instance; }
       FIELD_SET(*this, FIX::TradingSessionID);
       FIELD_SET(*this, FIX::TradingSessionSubID);
     };
@@ -154,7 +160,8 @@ namespace FIX44
     class NoUnderlyings: public FIX::Group
     {
     public:
-    NoUnderlyings() : FIX::Group(711,311,FIX::message_order(311,312,309,305,462,463,310,763,313,542,315,241,242,243,244,245,246,256,595,592,593,594,247,316,941,317,436,435,308,306,362,363,307,364,365,877,878,318,879,810,882,883,884,885,886,0)) {}
+    NoUnderlyings() : FIX::Group(711,311,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(311,312,309,305,462,463,310,763,313,542,315,241,242,243,244,245,246,256,595,592,593,594,247,316,941,317,436,435,308,306,362,363,307,364,365,877,878,318,879,810,882,883,884,885,886,0); return instance; }
       FIELD_SET(*this, FIX::UnderlyingSymbol);
       FIELD_SET(*this, FIX::UnderlyingSymbolSfx);
       FIELD_SET(*this, FIX::UnderlyingSecurityID);
@@ -206,7 +213,8 @@ namespace FIX44
     class NoLegs: public FIX::Group
     {
     public:
-    NoLegs() : FIX::Group(555,600,FIX::message_order(600,601,602,603,607,608,609,764,610,611,248,249,250,251,252,253,257,599,596,597,598,254,612,942,613,614,615,616,617,618,619,620,621,622,623,624,556,740,739,955,956,687,690,683,670,564,565,539,654,566,587,588,0)) {}
+    NoLegs() : FIX::Group(555,600,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(600,601,602,603,607,608,609,764,610,611,248,249,250,251,252,253,257,599,596,597,598,254,612,942,613,614,615,616,617,618,619,620,621,622,623,624,556,740,739,955,956,687,690,683,670,564,565,539,654,566,587,588,0); return instance; }
       FIELD_SET(*this, FIX::LegSymbol);
       FIELD_SET(*this, FIX::LegSymbolSfx);
       FIELD_SET(*this, FIX::LegSecurityID);
@@ -254,7 +262,8 @@ namespace FIX44
       class NoLegStipulations: public FIX::Group
       {
       public:
-      NoLegStipulations() : FIX::Group(683,688,FIX::message_order(688,689,0)) {}
+      NoLegStipulations() : FIX::Group(683,688,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(688,689,0); return instance; }
         FIELD_SET(*this, FIX::LegStipulationType);
         FIELD_SET(*this, FIX::LegStipulationValue);
       };
@@ -262,14 +271,16 @@ namespace FIX44
       class NoLegAllocs: public FIX::Group
       {
       public:
-      NoLegAllocs() : FIX::Group(670,671,FIX::message_order(671,672,756,673,674,675,0)) {}
+      NoLegAllocs() : FIX::Group(670,671,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(671,672,756,673,674,675,0); return instance; }
         FIELD_SET(*this, FIX::LegAllocAccount);
         FIELD_SET(*this, FIX::LegIndividualAllocID);
         FIELD_SET(*this, FIX::NoNested2PartyIDs);
         class NoNested2PartyIDs: public FIX::Group
         {
         public:
-        NoNested2PartyIDs() : FIX::Group(756,757,FIX::message_order(757,758,759,806,0)) {}
+        NoNested2PartyIDs() : FIX::Group(756,757,order()) {}
+        static const FIX::message_order& order() { static const FIX::message_order instance(757,758,759,806,0); return instance; }
           FIELD_SET(*this, FIX::Nested2PartyID);
           FIELD_SET(*this, FIX::Nested2PartyIDSource);
           FIELD_SET(*this, FIX::Nested2PartyRole);
@@ -277,7 +288,8 @@ namespace FIX44
           class NoNested2PartySubIDs: public FIX::Group
           {
           public:
-          NoNested2PartySubIDs() : FIX::Group(806,760,FIX::message_order(760,807,0)) {}
+          NoNested2PartySubIDs() : FIX::Group(806,760,order()) {}
+          static const FIX::message_order& order() { static const FIX::message_order instance(760,807,0); return instance; }
             FIELD_SET(*this, FIX::Nested2PartySubID);
             FIELD_SET(*this, FIX::Nested2PartySubIDType);
           };
@@ -292,7 +304,8 @@ namespace FIX44
       class NoNestedPartyIDs: public FIX::Group
       {
       public:
-      NoNestedPartyIDs() : FIX::Group(539,524,FIX::message_order(524,525,538,804,0)) {}
+      NoNestedPartyIDs() : FIX::Group(539,524,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(524,525,538,804,0); return instance; }
         FIELD_SET(*this, FIX::NestedPartyID);
         FIELD_SET(*this, FIX::NestedPartyIDSource);
         FIELD_SET(*this, FIX::NestedPartyRole);
@@ -300,7 +313,8 @@ namespace FIX44
         class NoNestedPartySubIDs: public FIX::Group
         {
         public:
-        NoNestedPartySubIDs() : FIX::Group(804,545,FIX::message_order(545,805,0)) {}
+        NoNestedPartySubIDs() : FIX::Group(804,545,order()) {}
+        static const FIX::message_order& order() { static const FIX::message_order instance(545,805,0); return instance; }
           FIELD_SET(*this, FIX::NestedPartySubID);
           FIELD_SET(*this, FIX::NestedPartySubIDType);
         };
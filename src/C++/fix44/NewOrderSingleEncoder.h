@@ -0,0 +1,1198 @@
+#ifndef FIX44_NEWORDERSINGLEENCODER_H
+#define FIX44_NEWORDERSINGLEENCODER_H
+
+#include "../MessageEncoder.h"
+#include "../FlyweightDecoder.h"
+
+namespace FIX44
+{
+
+  /// Writes NewOrderSingle bodies without building a FIX::Message.
+  /// Reuse one instance through reset() to avoid allocating per message.
+  class NewOrderSingleEncoder : public FIX::MessageEncoder
+  {
+  public:
+    class NoPartyIDs
+    {
+    public:
+      class NoPartySubIDs
+      {
+      public:
+        void clear()
+        {
+          m_present.reset();
+        }
+
+        /// Start an entry with its delimiter, which is always written first.
+        void reset( const std::string& aPartySubID )
+        {
+          clear();
+          m_PartySubID = aPartySubID;
+          m_present.set( 0 );
+        }
+
+        void setPartySubIDType( int value )
+        { m_PartySubIDType = value; m_present.set( 1 ); }
+
+        void encode( FIX::MessageEncoder& encoder ) const
+        {
+          if( m_present[ 0 ] ) encoder.append( "523=", m_PartySubID );
+          if( m_present[ 1 ] ) encoder.append( "803=", m_PartySubIDType );
+        }
+
+      private:
+        std::bitset< 2 > m_present;
+        std::string m_PartySubID;
+        int m_PartySubIDType;
+      };
+      typedef FIX::InlineVector< NoPartySubIDs, 2 > NoPartySubIDsEntries;
+
+      void clear()
+      {
+        m_present.reset();
+        m_NoPartySubIDs.clear();
+      }
+
+      /// Start an entry with its delimiter, which is always written first.
+      void reset( const std::string& aPartyID )
+      {
+        clear();
+        m_PartyID = aPartyID;
+        m_present.set( 0 );
+      }
+
+      void setPartyIDSource( char value )
+      { m_PartyIDSource = value; m_present.set( 1 ); }
+      void setPartyRole( int value )
+      { m_PartyRole = value; m_present.set( 2 ); }
+      NoPartySubIDs& addNoPartySubIDs( const std::string& aPartySubID )
+      {
+        NoPartySubIDs& entry = m_NoPartySubIDs.push_back();
+        entry.reset( aPartySubID );
+        return entry;
+      }
+
+      void encode( FIX::MessageEncoder& encoder ) const
+      {
+        if( m_present[ 0 ] ) encoder.append( "448=", m_PartyID );
+        if( m_present[ 1 ] ) encoder.append( "447=", m_PartyIDSource );
+        if( m_present[ 2 ] ) encoder.append( "452=", m_PartyRole );
+        if( !m_NoPartySubIDs.empty() )
+        {
+          encoder.append( "802=", (int)m_NoPartySubIDs.size() );
+          for( size_t i = 0; i < m_NoPartySubIDs.size(); ++i )
+            m_NoPartySubIDs[ i ].encode( encoder );
+        }
+      }
+
+    private:
+      std::bitset< 4 > m_present;
+      std::string m_PartyID;
+      char m_PartyIDSource;
+      int m_PartyRole;
+      NoPartySubIDsEntries m_NoPartySubIDs;
+    };
+    typedef FIX::InlineVector< NoPartyIDs, 8 > NoPartyIDsEntries;
+
+    class NoAllocs
+    {
+    public:
+      class NoNestedPartyIDs
+      {
+      public:
+        class NoNestedPartySubIDs
+        {
+        public:
+          void clear()
+          {
+            m_present.reset();
+          }
+
+          /// Start an entry with its delimiter, which is always written first.
+          void reset( const std::string& aNestedPartySubID )
+          {
+            clear();
+            m_NestedPartySubID = aNestedPartySubID;
+            m_present.set( 0 );
+          }
+
+          void setNestedPartySubIDType( int value )
+          { m_NestedPartySubIDType = value; m_present.set( 1 ); }
+
+          void encode( FIX::MessageEncoder& encoder ) const
+          {
+            if( m_present[ 0 ] ) encoder.append( "545=", m_NestedPartySubID );
+            if( m_present[ 1 ] ) encoder.append( "805=", m_NestedPartySubIDType );
+          }
+
+        private:
+          std::bitset< 2 > m_present;
+          std::string m_NestedPartySubID;
+          int m_NestedPartySubIDType;
+        };
+        typedef FIX::InlineVector< NoNestedPartySubIDs, 2 > NoNestedPartySubIDsEntries;
+
+        void clear()
+        {
+          m_present.reset();
+          m_NoNestedPartySubIDs.clear();
+        }
+
+        /// Start an entry with its delimiter, which is always written first.
+        void reset( const std::string& aNestedPartyID )
+        {
+          clear();
+          m_NestedPartyID = aNestedPartyID;
+          m_present.set( 0 );
+        }
+
+        void setNestedPartyIDSource( char value )
+        { m_NestedPartyIDSource = value; m_present.set( 1 ); }
+        void setNestedPartyRole( int value )
+        { m_NestedPartyRole = value; m_present.set( 2 ); }
+        NoNestedPartySubIDs& addNoNestedPartySubIDs( const std::string& aNestedPartySubID )
+        {
+          NoNestedPartySubIDs& entry = m_NoNestedPartySubIDs.push_back();
+          entry.reset( aNestedPartySubID );
+          return entry;
+        }
+
+        void encode( FIX::MessageEncoder& encoder ) const
+        {
+          if( m_present[ 0 ] ) encoder.append( "524=", m_NestedPartyID );
+          if( m_present[ 1 ] ) encoder.append( "525=", m_NestedPartyIDSource );
+          if( m_present[ 2 ] ) encoder.append( "538=", m_NestedPartyRole );
+          if( !m_NoNestedPartySubIDs.empty() )
+          {
+            encoder.append( "804=", (int)m_NoNestedPartySubIDs.size() );
+            for( size_t i = 0; i < m_NoNestedPartySubIDs.size(); ++i )
+              m_NoNestedPartySubIDs[ i ].encode( encoder );
+          }
+        }
+
+      private:
+        std::bitset< 4 > m_present;
+        std::string m_NestedPartyID;
+        char m_NestedPartyIDSource;
+        int m_NestedPartyRole;
+        NoNestedPartySubIDsEntries m_NoNestedPartySubIDs;
+      };
+      typedef FIX::InlineVector< NoNestedPartyIDs, 2 > NoNestedPartyIDsEntries;
+
+      void clear()
+      {
+        m_present.reset();
+        m_NoNestedPartyIDs.clear();
+      }
+
+      /// Start an entry with its delimiter, which is always written first.
+      void reset( const std::string& aAllocAccount )
+      {
+        clear();
+        m_AllocAccount = aAllocAccount;
+        m_present.set( 0 );
+      }
+
+      void setAllocAcctIDSource( int value )
+      { m_AllocAcctIDSource = value; m_present.set( 1 ); }
+      void setAllocSettlCurrency( const std::string& value )
+      { m_AllocSettlCurrency = value; m_present.set( 2 ); }
+      void setIndividualAllocID( const std::string& value )
+      { m_IndividualAllocID = value; m_present.set( 3 ); }
+      NoNestedPartyIDs& addNoNestedPartyIDs( const std::string& aNestedPartyID )
+      {
+        NoNestedPartyIDs& entry = m_NoNestedPartyIDs.push_back();
+        entry.reset( aNestedPartyID );
+        return entry;
+      }
+      void setAllocQty( double value )
+      { m_AllocQty = value; m_present.set( 5 ); }
+
+      void encode( FIX::MessageEncoder& encoder ) const
+      {
+        if( m_present[ 0 ] ) encoder.append( "79=", m_AllocAccount );
+        if( m_present[ 1 ] ) encoder.append( "661=", m_AllocAcctIDSource );
+        if( m_present[ 2 ] ) encoder.append( "736=", m_AllocSettlCurrency );
+        if( m_present[ 3 ] ) encoder.append( "467=", m_IndividualAllocID );
+        if( !m_NoNestedPartyIDs.empty() )
+        {
+          encoder.append( "539=", (int)m_NoNestedPartyIDs.size() );
+          for( size_t i = 0; i < m_NoNestedPartyIDs.size(); ++i )
+            m_NoNestedPartyIDs[ i ].encode( encoder );
+        }
+        if( m_present[ 5 ] ) encoder.append( "80=", m_AllocQty );
+      }
+
+    private:
+      std::bitset< 6 > m_present;
+      std::string m_AllocAccount;
+      int m_AllocAcctIDSource;
+      std::string m_AllocSettlCurrency;
+      std::string m_IndividualAllocID;
+      NoNestedPartyIDsEntries m_NoNestedPartyIDs;
+      double m_AllocQty;
+    };
+    typedef FIX::InlineVector< NoAllocs, 8 > NoAllocsEntries;
+
+    class NoTradingSessions
+    {
+    public:
+      void clear()
+      {
+        m_present.reset();
+      }
+
+      /// Start an entry with its delimiter, which is always written first.
+      void reset( const std::string& aTradingSessionID )
+      {
+        clear();
+        m_TradingSessionID = aTradingSessionID;
+        m_present.set( 0 );
+      }
+
+      void setTradingSessionSubID( const std::string& value )
+      { m_TradingSessionSubID = value; m_present.set( 1 ); }
+
+      void encode( FIX::MessageEncoder& encoder ) const
+      {
+        if( m_present[ 0 ] ) encoder.append( "336=", m_TradingSessionID );
+        if( m_present[ 1 ] ) encoder.append( "625=", m_TradingSessionSubID );
+      }
+
+    private:
+      std::bitset< 2 > m_present;
+      std::string m_TradingSessionID;
+      std::string m_TradingSessionSubID;
+    };
+    typedef FIX::InlineVector< NoTradingSessions, 8 > NoTradingSessionsEntries;
+
+    class NoUnderlyings
+    {
+    public:
+      void clear()
+      {
+        m_present.reset();
+      }
+
+      /// Start an entry with its delimiter, which is always written first.
+      void reset( const std::string& aUnderlyingSymbol )
+      {
+        clear();
+        m_UnderlyingSymbol = aUnderlyingSymbol;
+        m_present.set( 0 );
+      }
+
+      void setUnderlyingSymbolSfx( const std::string& value )
+      { m_UnderlyingSymbolSfx = value; m_present.set( 1 ); }
+      void setUnderlyingSecurityID( const std::string& value )
+      { m_UnderlyingSecurityID = value; m_present.set( 2 ); }
+      void setUnderlyingSecurityIDSource( const std::string& value )
+      { m_UnderlyingSecurityIDSource = value; m_present.set( 3 ); }
+      void setUnderlyingProduct( int value )
+      { m_UnderlyingProduct = value; m_present.set( 4 ); }
+      void setUnderlyingCFICode( const std::string& value )
+      { m_UnderlyingCFICode = value; m_present.set( 5 ); }
+      void setUnderlyingSecurityType( const std::string& value )
+      { m_UnderlyingSecurityType = value; m_present.set( 6 ); }
+      void setUnderlyingSecuritySubType( const std::string& value )
+      { m_UnderlyingSecuritySubType = value; m_present.set( 7 ); }
+      void setUnderlyingMaturityMonthYear( const std::string& value )
+      { m_UnderlyingMaturityMonthYear = value; m_present.set( 8 ); }
+      void setUnderlyingMaturityDate( const std::string& value )
+      { m_UnderlyingMaturityDate = value; m_present.set( 9 ); }
+      void setUnderlyingPutOrCall( int value )
+      { m_UnderlyingPutOrCall = value; m_present.set( 10 ); }
+      void setUnderlyingCouponPaymentDate( const std::string& value )
+      { m_UnderlyingCouponPaymentDate = value; m_present.set( 11 ); }
+      void setUnderlyingIssueDate( const std::string& value )
+      { m_UnderlyingIssueDate = value; m_present.set( 12 ); }
+      void setUnderlyingRepoCollateralSecurityType( const std::string& value )
+      { m_UnderlyingRepoCollateralSecurityType = value; m_present.set( 13 ); }
+      void setUnderlyingRepurchaseTerm( int value )
+      { m_UnderlyingRepurchaseTerm = value; m_present.set( 14 ); }
+      void setUnderlyingRepurchaseRate( double value )
+      { m_UnderlyingRepurchaseRate = value; m_present.set( 15 ); }
+      void setUnderlyingFactor( double value )
+      { m_UnderlyingFactor = value; m_present.set( 16 ); }
+      void setUnderlyingCreditRating( const std::string& value )
+      { m_UnderlyingCreditRating = value; m_present.set( 17 ); }
+      void setUnderlyingInstrRegistry( const std::string& value )
+      { m_UnderlyingInstrRegistry = value; m_present.set( 18 ); }
+      void setUnderlyingCountryOfIssue( const std::string& value )
+      { m_UnderlyingCountryOfIssue = value; m_present.set( 19 ); }
+      void setUnderlyingStateOrProvinceOfIssue( const std::string& value )
+      { m_UnderlyingStateOrProvinceOfIssue = value; m_present.set( 20 ); }
+      void setUnderlyingLocaleOfIssue( const std::string& value )
+      { m_UnderlyingLocaleOfIssue = value; m_present.set( 21 ); }
+      void setUnderlyingRedemptionDate( const std::string& value )
+      { m_UnderlyingRedemptionDate = value; m_present.set( 22 ); }
+      void setUnderlyingStrikePrice( double value )
+      { m_UnderlyingStrikePrice = value; m_present.set( 23 ); }
+      void setUnderlyingStrikeCurrency( const std::string& value )
+      { m_UnderlyingStrikeCurrency = value; m_present.set( 24 ); }
+      void setUnderlyingOptAttribute( char value )
+      { m_UnderlyingOptAttribute = value; m_present.set( 25 ); }
+      void setUnderlyingContractMultiplier( double value )
+      { m_UnderlyingContractMultiplier = value; m_present.set( 26 ); }
+      void setUnderlyingCouponRate( double value )
+      { m_UnderlyingCouponRate = value; m_present.set( 27 ); }
+      void setUnderlyingSecurityExchange( const std::string& value )
+      { m_UnderlyingSecurityExchange = value; m_present.set( 28 ); }
+      void setUnderlyingIssuer( const std::string& value )
+      { m_UnderlyingIssuer = value; m_present.set( 29 ); }
+      void setEncodedUnderlyingIssuerLen( int value )
+      { m_EncodedUnderlyingIssuerLen = value; m_present.set( 30 ); }
+      void setEncodedUnderlyingIssuer( const std::string& value )
+      { m_EncodedUnderlyingIssuer = value; m_present.set( 31 ); }
+      void setUnderlyingSecurityDesc( const std::string& value )
+      { m_UnderlyingSecurityDesc = value; m_present.set( 32 ); }
+      void setEncodedUnderlyingSecurityDescLen( int value )
+      { m_EncodedUnderlyingSecurityDescLen = value; m_present.set( 33 ); }
+      void setEncodedUnderlyingSecurityDesc( const std::string& value )
+      { m_EncodedUnderlyingSecurityDesc = value; m_present.set( 34 ); }
+      void setUnderlyingCPProgram( const std::string& value )
+      { m_UnderlyingCPProgram = value; m_present.set( 35 ); }
+      void setUnderlyingCPRegType( const std::string& value )
+      { m_UnderlyingCPRegType = value; m_present.set( 36 ); }
+      void setUnderlyingCurrency( const std::string& value )
+      { m_UnderlyingCurrency = value; m_present.set( 37 ); }
+      void setUnderlyingQty( double value )
+      { m_UnderlyingQty = value; m_present.set( 38 ); }
+      void setUnderlyingPx( double value )
+      { m_UnderlyingPx = value; m_present.set( 39 ); }
+      void setUnderlyingDirtyPrice( double value )
+      { m_UnderlyingDirtyPrice = value; m_present.set( 40 ); }
+      void setUnderlyingEndPrice( double value )
+      { m_UnderlyingEndPrice = value; m_present.set( 41 ); }
+      void setUnderlyingStartValue( double value )
+      { m_UnderlyingStartValue = value; m_present.set( 42 ); }
+      void setUnderlyingCurrentValue( double value )
+      { m_UnderlyingCurrentValue = value; m_present.set( 43 ); }
+      void setUnderlyingEndValue( double value )
+      { m_UnderlyingEndValue = value; m_present.set( 44 ); }
+
+      void encode( FIX::MessageEncoder& encoder ) const
+      {
+        if( m_present[ 0 ] ) encoder.append( "311=", m_UnderlyingSymbol );
+        if( m_present[ 1 ] ) encoder.append( "312=", m_UnderlyingSymbolSfx );
+        if( m_present[ 2 ] ) encoder.append( "309=", m_UnderlyingSecurityID );
+        if( m_present[ 3 ] ) encoder.append( "305=", m_UnderlyingSecurityIDSource );
+        if( m_present[ 4 ] ) encoder.append( "462=", m_UnderlyingProduct );
+        if( m_present[ 5 ] ) encoder.append( "463=", m_UnderlyingCFICode );
+        if( m_present[ 6 ] ) encoder.append( "310=", m_UnderlyingSecurityType );
+        if( m_present[ 7 ] ) encoder.append( "763=", m_UnderlyingSecuritySubType );
+        if( m_present[ 8 ] ) encoder.append( "313=", m_UnderlyingMaturityMonthYear );
+        if( m_present[ 9 ] ) encoder.append( "542=", m_UnderlyingMaturityDate );
+        if( m_present[ 10 ] ) encoder.append( "315=", m_UnderlyingPutOrCall );
+        if( m_present[ 11 ] ) encoder.append( "241=", m_UnderlyingCouponPaymentDate );
+        if( m_present[ 12 ] ) encoder.append( "242=", m_UnderlyingIssueDate );
+        if( m_present[ 13 ] ) encoder.append( "243=", m_UnderlyingRepoCollateralSecurityType );
+        if( m_present[ 14 ] ) encoder.append( "244=", m_UnderlyingRepurchaseTerm );
+        if( m_present[ 15 ] ) encoder.append( "245=", m_UnderlyingRepurchaseRate );
+        if( m_present[ 16 ] ) encoder.append( "246=", m_UnderlyingFactor );
+        if( m_present[ 17 ] ) encoder.append( "256=", m_UnderlyingCreditRating );
+        if( m_present[ 18 ] ) encoder.append( "595=", m_UnderlyingInstrRegistry );
+        if( m_present[ 19 ] ) encoder.append( "592=", m_UnderlyingCountryOfIssue );
+        if( m_present[ 20 ] ) encoder.append( "593=", m_UnderlyingStateOrProvinceOfIssue );
+        if( m_present[ 21 ] ) encoder.append( "594=", m_UnderlyingLocaleOfIssue );
+        if( m_present[ 22 ] ) encoder.append( "247=", m_UnderlyingRedemptionDate );
+        if( m_present[ 23 ] ) encoder.append( "316=", m_UnderlyingStrikePrice );
+        if( m_present[ 24 ] ) encoder.append( "941=", m_UnderlyingStrikeCurrency );
+        if( m_present[ 25 ] ) encoder.append( "317=", m_UnderlyingOptAttribute );
+        if( m_present[ 26 ] ) encoder.append( "436=", m_UnderlyingContractMultiplier );
+        if( m_present[ 27 ] ) encoder.append( "435=", m_UnderlyingCouponRate );
+        if( m_present[ 28 ] ) encoder.append( "308=", m_UnderlyingSecurityExchange );
+        if( m_present[ 29 ] ) encoder.append( "306=", m_UnderlyingIssuer );
+        if( m_present[ 30 ] ) encoder.append( "362=", m_EncodedUnderlyingIssuerLen );
+        if( m_present[ 31 ] ) encoder.append( "363=", m_EncodedUnderlyingIssuer );
+        if( m_present[ 32 ] ) encoder.append( "307=", m_UnderlyingSecurityDesc );
+        if( m_present[ 33 ] ) encoder.append( "364=", m_EncodedUnderlyingSecurityDescLen );
+        if( m_present[ 34 ] ) encoder.append( "365=", m_EncodedUnderlyingSecurityDesc );
+        if( m_present[ 35 ] ) encoder.append( "877=", m_UnderlyingCPProgram );
+        if( m_present[ 36 ] ) encoder.append( "878=", m_UnderlyingCPRegType );
+        if( m_present[ 37 ] ) encoder.append( "318=", m_UnderlyingCurrency );
+        if( m_present[ 38 ] ) encoder.append( "879=", m_UnderlyingQty );
+        if( m_present[ 39 ] ) encoder.append( "810=", m_UnderlyingPx );
+        if( m_present[ 40 ] ) encoder.append( "882=", m_UnderlyingDirtyPrice );
+        if( m_present[ 41 ] ) encoder.append( "883=", m_UnderlyingEndPrice );
+        if( m_present[ 42 ] ) encoder.append( "884=", m_UnderlyingStartValue );
+        if( m_present[ 43 ] ) encoder.append( "885=", m_UnderlyingCurrentValue );
+        if( m_present[ 44 ] ) encoder.append( "886=", m_UnderlyingEndValue );
+      }
+
+    private:
+      std::bitset< 45 > m_present;
+      std::string m_UnderlyingSymbol;
+      std::string m_UnderlyingSymbolSfx;
+      std::string m_UnderlyingSecurityID;
+      std::string m_UnderlyingSecurityIDSource;
+      int m_UnderlyingProduct;
+      std::string m_UnderlyingCFICode;
+      std::string m_UnderlyingSecurityType;
+      std::string m_UnderlyingSecuritySubType;
+      std::string m_UnderlyingMaturityMonthYear;
+      std::string m_UnderlyingMaturityDate;
+      int m_UnderlyingPutOrCall;
+      std::string m_UnderlyingCouponPaymentDate;
+      std::string m_UnderlyingIssueDate;
+      std::string m_UnderlyingRepoCollateralSecurityType;
+      int m_UnderlyingRepurchaseTerm;
+      double m_UnderlyingRepurchaseRate;
+      double m_UnderlyingFactor;
+      std::string m_UnderlyingCreditRating;
+      std::string m_UnderlyingInstrRegistry;
+      std::string m_UnderlyingCountryOfIssue;
+      std::string m_UnderlyingStateOrProvinceOfIssue;
+      std::string m_UnderlyingLocaleOfIssue;
+      std::string m_UnderlyingRedemptionDate;
+      double m_UnderlyingStrikePrice;
+      std::string m_UnderlyingStrikeCurrency;
+      char m_UnderlyingOptAttribute;
+      double m_UnderlyingContractMultiplier;
+      double m_UnderlyingCouponRate;
+      std::string m_UnderlyingSecurityExchange;
+      std::string m_UnderlyingIssuer;
+      int m_EncodedUnderlyingIssuerLen;
+      std::string m_EncodedUnderlyingIssuer;
+      std::string m_UnderlyingSecurityDesc;
+      int m_EncodedUnderlyingSecurityDescLen;
+      std::string m_EncodedUnderlyingSecurityDesc;
+      std::string m_UnderlyingCPProgram;
+      std::string m_UnderlyingCPRegType;
+      std::string m_UnderlyingCurrency;
+      double m_UnderlyingQty;
+      double m_UnderlyingPx;
+      double m_UnderlyingDirtyPrice;
+      double m_UnderlyingEndPrice;
+      double m_UnderlyingStartValue;
+      double m_UnderlyingCurrentValue;
+      double m_UnderlyingEndValue;
+    };
+    typedef FIX::InlineVector< NoUnderlyings, 8 > NoUnderlyingsEntries;
+
+    class NoStipulations
+    {
+    public:
+      void clear()
+      {
+        m_present.reset();
+      }
+
+      /// Start an entry with its delimiter, which is always written first.
+      void reset( const std::string& aStipulationType )
+      {
+        clear();
+        m_StipulationType = aStipulationType;
+        m_present.set( 0 );
+      }
+
+      void setStipulationValue( const std::string& value )
+      { m_StipulationValue = value; m_present.set( 1 ); }
+
+      void encode( FIX::MessageEncoder& encoder ) const
+      {
+        if( m_present[ 0 ] ) encoder.append( "233=", m_StipulationType );
+        if( m_present[ 1 ] ) encoder.append( "234=", m_StipulationValue );
+      }
+
+    private:
+      std::bitset< 2 > m_present;
+      std::string m_StipulationType;
+      std::string m_StipulationValue;
+    };
+    typedef FIX::InlineVector< NoStipulations, 8 > NoStipulationsEntries;
+
+    NewOrderSingleEncoder( const std::string& aClOrdID, char aSide, const FIX::UtcTimeStamp& aTransactTime, char aOrdType )
+    : FIX::MessageEncoder( "D" )
+    { reset( aClOrdID, aSide, aTransactTime, aOrdType ); }
+
+    /// Start a new message, keeping the buffers of the last one.
+    void reset( const std::string& aClOrdID, char aSide, const FIX::UtcTimeStamp& aTransactTime, char aOrdType )
+    {
+      clear();
+      m_ClOrdID = aClOrdID;
+      m_present.set( 0 );
+      m_Side = aSide;
+      m_present.set( 77 );
+      m_TransactTime = aTransactTime;
+      m_present.set( 79 );
+      m_OrdType = aOrdType;
+      m_present.set( 87 );
+    }
+
+    void setSecondaryClOrdID( const std::string& value )
+    { m_SecondaryClOrdID = value; m_present.set( 1 ); }
+    void setClOrdLinkID( const std::string& value )
+    { m_ClOrdLinkID = value; m_present.set( 2 ); }
+    NoPartyIDs& addNoPartyIDs( const std::string& aPartyID )
+    {
+      NoPartyIDs& entry = m_NoPartyIDs.push_back();
+      entry.reset( aPartyID );
+      return entry;
+    }
+    void setTradeOriginationDate( const std::string& value )
+    { m_TradeOriginationDate = value; m_present.set( 4 ); }
+    void setTradeDate( const std::string& value )
+    { m_TradeDate = value; m_present.set( 5 ); }
+    void setAccount( const std::string& value )
+    { m_Account = value; m_present.set( 6 ); }
+    void setAcctIDSource( int value )
+    { m_AcctIDSource = value; m_present.set( 7 ); }
+    void setAccountType( int value )
+    { m_AccountType = value; m_present.set( 8 ); }
+    void setDayBookingInst( char value )
+    { m_DayBookingInst = value; m_present.set( 9 ); }
+    void setBookingUnit( char value )
+    { m_BookingUnit = value; m_present.set( 10 ); }
+    void setPreallocMethod( char value )
+    { m_PreallocMethod = value; m_present.set( 11 ); }
+    void setAllocID( const std::string& value )
+    { m_AllocID = value; m_present.set( 12 ); }
+    NoAllocs& addNoAllocs( const std::string& aAllocAccount )
+    {
+      NoAllocs& entry = m_NoAllocs.push_back();
+      entry.reset( aAllocAccount );
+      return entry;
+    }
+    void setSettlType( const std::string& value )
+    { m_SettlType = value; m_present.set( 14 ); }
+    void setSettlDate( const std::string& value )
+    { m_SettlDate = value; m_present.set( 15 ); }
+    void setCashMargin( char value )
+    { m_CashMargin = value; m_present.set( 16 ); }
+    void setClearingFeeIndicator( const std::string& value )
+    { m_ClearingFeeIndicator = value; m_present.set( 17 ); }
+    void setHandlInst( char value )
+    { m_HandlInst = value; m_present.set( 18 ); }
+    void setExecInst( const std::string& value )
+    { m_ExecInst = value; m_present.set( 19 ); }
+    void setMinQty( double value )
+    { m_MinQty = value; m_present.set( 20 ); }
+    void setMaxFloor( double value )
+    { m_MaxFloor = value; m_present.set( 21 ); }
+    void setExDestination( const std::string& value )
+    { m_ExDestination = value; m_present.set( 22 ); }
+    NoTradingSessions& addNoTradingSessions( const std::string& aTradingSessionID )
+    {
+      NoTradingSessions& entry = m_NoTradingSessions.push_back();
+      entry.reset( aTradingSessionID );
+      return entry;
+    }
+    void setProcessCode( char value )
+    { m_ProcessCode = value; m_present.set( 24 ); }
+    void setSymbol( const std::string& value )
+    { m_Symbol = value; m_present.set( 25 ); }
+    void setSymbolSfx( const std::string& value )
+    { m_SymbolSfx = value; m_present.set( 26 ); }
+    void setSecurityID( const std::string& value )
+    { m_SecurityID = value; m_present.set( 27 ); }
+    void setSecurityIDSource( const std::string& value )
+    { m_SecurityIDSource = value; m_present.set( 28 ); }
+    void setProduct( int value )
+    { m_Product = value; m_present.set( 29 ); }
+    void setCFICode( const std::string& value )
+    { m_CFICode = value; m_present.set( 30 ); }
+    void setSecurityType( const std::string& value )
+    { m_SecurityType = value; m_present.set( 31 ); }
+    void setSecuritySubType( const std::string& value )
+    { m_SecuritySubType = value; m_present.set( 32 ); }
+    void setMaturityMonthYear( const std::string& value )
+    { m_MaturityMonthYear = value; m_present.set( 33 ); }
+    void setMaturityDate( const std::string& value )
+    { m_MaturityDate = value; m_present.set( 34 ); }
+    void setPutOrCall( int value )
+    { m_PutOrCall = value; m_present.set( 35 ); }
+    void setCouponPaymentDate( const std::string& value )
+    { m_CouponPaymentDate = value; m_present.set( 36 ); }
+    void setIssueDate( const std::string& value )
+    { m_IssueDate = value; m_present.set( 37 ); }
+    void setRepoCollateralSecurityType( const std::string& value )
+    { m_RepoCollateralSecurityType = value; m_present.set( 38 ); }
+    void setRepurchaseTerm( int value )
+    { m_RepurchaseTerm = value; m_present.set( 39 ); }
+    void setRepurchaseRate( double value )
+    { m_RepurchaseRate = value; m_present.set( 40 ); }
+    void setFactor( double value )
+    { m_Factor = value; m_present.set( 41 ); }
+    void setCreditRating( const std::string& value )
+    { m_CreditRating = value; m_present.set( 42 ); }
+    void setInstrRegistry( const std::string& value )
+    { m_InstrRegistry = value; m_present.set( 43 ); }
+    void setCountryOfIssue( const std::string& value )
+    { m_CountryOfIssue = value; m_present.set( 44 ); }
+    void setStateOrProvinceOfIssue( const std::string& value )
+    { m_StateOrProvinceOfIssue = value; m_present.set( 45 ); }
+    void setLocaleOfIssue( const std::string& value )
+    { m_LocaleOfIssue = value; m_present.set( 46 ); }
+    void setRedemptionDate( const std::string& value )
+    { m_RedemptionDate = value; m_present.set( 47 ); }
+    void setStrikePrice( double value )
+    { m_StrikePrice = value; m_present.set( 48 ); }
+    void setStrikeCurrency( const std::string& value )
+    { m_StrikeCurrency = value; m_present.set( 49 ); }
+    void setOptAttribute( char value )
+    { m_OptAttribute = value; m_present.set( 50 ); }
+    void setContractMultiplier( double value )
+    { m_ContractMultiplier = value; m_present.set( 51 ); }
+    void setCouponRate( double value )
+    { m_CouponRate = value; m_present.set( 52 ); }
+    void setSecurityExchange( const std::string& value )
+    { m_SecurityExchange = value; m_present.set( 53 ); }
+    void setIssuer( const std::string& value )
+    { m_Issuer = value; m_present.set( 54 ); }
+    void setEncodedIssuerLen( int value )
+    { m_EncodedIssuerLen = value; m_present.set( 55 ); }
+    void setEncodedIssuer( const std::string& value )
+    { m_EncodedIssuer = value; m_present.set( 56 ); }
+    void setSecurityDesc( const std::string& value )
+    { m_SecurityDesc = value; m_present.set( 57 ); }
+    void setEncodedSecurityDescLen( int value )
+    { m_EncodedSecurityDescLen = value; m_present.set( 58 ); }
+    void setEncodedSecurityDesc( const std::string& value )
+    { m_EncodedSecurityDesc = value; m_present.set( 59 ); }
+    void setPool( const std::string& value )
+    { m_Pool = value; m_present.set( 60 ); }
+    void setContractSettlMonth( const std::string& value )
+    { m_ContractSettlMonth = value; m_present.set( 61 ); }
+    void setCPProgram( int value )
+    { m_CPProgram = value; m_present.set( 62 ); }
+    void setCPRegType( const std::string& value )
+    { m_CPRegType = value; m_present.set( 63 ); }
+    void setDatedDate( const std::string& value )
+    { m_DatedDate = value; m_present.set( 64 ); }
+    void setInterestAccrualDate( const std::string& value )
+    { m_InterestAccrualDate = value; m_present.set( 65 ); }
+    void setAgreementDesc( const std::string& value )
+    { m_AgreementDesc = value; m_present.set( 66 ); }
+    void setAgreementID( const std::string& value )
+    { m_AgreementID = value; m_present.set( 67 ); }
+    void setAgreementDate( const std::string& value )
+    { m_AgreementDate = value; m_present.set( 68 ); }
+    void setAgreementCurrency( const std::string& value )
+    { m_AgreementCurrency = value; m_present.set( 69 ); }
+    void setTerminationType( int value )
+    { m_TerminationType = value; m_present.set( 70 ); }
+    void setStartDate( const std::string& value )
+    { m_StartDate = value; m_present.set( 71 ); }
+    void setEndDate( const std::string& value )
+    { m_EndDate = value; m_present.set( 72 ); }
+    void setDeliveryType( int value )
+    { m_DeliveryType = value; m_present.set( 73 ); }
+    void setMarginRatio( double value )
+    { m_MarginRatio = value; m_present.set( 74 ); }
+    NoUnderlyings& addNoUnderlyings( const std::string& aUnderlyingSymbol )
+    {
+      NoUnderlyings& entry = m_NoUnderlyings.push_back();
+      entry.reset( aUnderlyingSymbol );
+      return entry;
+    }
+    void setPrevClosePx( double value )
+    { m_PrevClosePx = value; m_present.set( 76 ); }
+    void setLocateReqd( bool value )
+    { m_LocateReqd = value; m_present.set( 78 ); }
+    NoStipulations& addNoStipulations( const std::string& aStipulationType )
+    {
+      NoStipulations& entry = m_NoStipulations.push_back();
+      entry.reset( aStipulationType );
+      return entry;
+    }
+    void setQtyType( int value )
+    { m_QtyType = value; m_present.set( 81 ); }
+    void setOrderQty( double value )
+    { m_OrderQty = value; m_present.set( 82 ); }
+    void setCashOrderQty( double value )
+    { m_CashOrderQty = value; m_present.set( 83 ); }
+    void setOrderPercent( double value )
+    { m_OrderPercent = value; m_present.set( 84 ); }
+    void setRoundingDirection( char value )
+    { m_RoundingDirection = value; m_present.set( 85 ); }
+    void setRoundingModulus( double value )
+    { m_RoundingModulus = value; m_present.set( 86 ); }
+    void setPriceType( int value )
+    { m_PriceType = value; m_present.set( 88 ); }
+    void setPrice( double value )
+    { m_Price = value; m_present.set( 89 ); }
+    void setStopPx( double value )
+    { m_StopPx = value; m_present.set( 90 ); }
+    void setSpread( double value )
+    { m_Spread = value; m_present.set( 91 ); }
+    void setBenchmarkCurveCurrency( const std::string& value )
+    { m_BenchmarkCurveCurrency = value; m_present.set( 92 ); }
+    void setBenchmarkCurveName( const std::string& value )
+    { m_BenchmarkCurveName = value; m_present.set( 93 ); }
+    void setBenchmarkCurvePoint( const std::string& value )
+    { m_BenchmarkCurvePoint = value; m_present.set( 94 ); }
+    void setBenchmarkPrice( double value )
+    { m_BenchmarkPrice = value; m_present.set( 95 ); }
+    void setBenchmarkPriceType( int value )
+    { m_BenchmarkPriceType = value; m_present.set( 96 ); }
+    void setBenchmarkSecurityID( const std::string& value )
+    { m_BenchmarkSecurityID = value; m_present.set( 97 ); }
+    void setBenchmarkSecurityIDSource( const std::string& value )
+    { m_BenchmarkSecurityIDSource = value; m_present.set( 98 ); }
+    void setYieldType( const std::string& value )
+    { m_YieldType = value; m_present.set( 99 ); }
+    void setYield( double value )
+    { m_Yield = value; m_present.set( 100 ); }
+    void setYieldCalcDate( const std::string& value )
+    { m_YieldCalcDate = value; m_present.set( 101 ); }
+    void setYieldRedemptionDate( const std::string& value )
+    { m_YieldRedemptionDate = value; m_present.set( 102 ); }
+    void setYieldRedemptionPrice( double value )
+    { m_YieldRedemptionPrice = value; m_present.set( 103 ); }
+    void setYieldRedemptionPriceType( int value )
+    { m_YieldRedemptionPriceType = value; m_present.set( 104 ); }
+    void setCurrency( const std::string& value )
+    { m_Currency = value; m_present.set( 105 ); }
+    void setComplianceID( const std::string& value )
+    { m_ComplianceID = value; m_present.set( 106 ); }
+    void setSolicitedFlag( bool value )
+    { m_SolicitedFlag = value; m_present.set( 107 ); }
+    void setIOIID( const std::string& value )
+    { m_IOIID = value; m_present.set( 108 ); }
+    void setQuoteID( const std::string& value )
+    { m_QuoteID = value; m_present.set( 109 ); }
+    void setTimeInForce( char value )
+    { m_TimeInForce = value; m_present.set( 110 ); }
+    void setEffectiveTime( const FIX::UtcTimeStamp& value )
+    { m_EffectiveTime = value; m_present.set( 111 ); }
+    void setExpireDate( const std::string& value )
+    { m_ExpireDate = value; m_present.set( 112 ); }
+    void setExpireTime( const FIX::UtcTimeStamp& value )
+    { m_ExpireTime = value; m_present.set( 113 ); }
+    void setGTBookingInst( int value )
+    { m_GTBookingInst = value; m_present.set( 114 ); }
+    void setCommission( double value )
+    { m_Commission = value; m_present.set( 115 ); }
+    void setCommType( char value )
+    { m_CommType = value; m_present.set( 116 ); }
+    void setCommCurrency( const std::string& value )
+    { m_CommCurrency = value; m_present.set( 117 ); }
+    void setFundRenewWaiv( char value )
+    { m_FundRenewWaiv = value; m_present.set( 118 ); }
+    void setOrderCapacity( char value )
+    { m_OrderCapacity = value; m_present.set( 119 ); }
+    void setOrderRestrictions( const std::string& value )
+    { m_OrderRestrictions = value; m_present.set( 120 ); }
+    void setCustOrderCapacity( int value )
+    { m_CustOrderCapacity = value; m_present.set( 121 ); }
+    void setForexReq( bool value )
+    { m_ForexReq = value; m_present.set( 122 ); }
+    void setSettlCurrency( const std::string& value )
+    { m_SettlCurrency = value; m_present.set( 123 ); }
+    void setBookingType( int value )
+    { m_BookingType = value; m_present.set( 124 ); }
+    void setText( const std::string& value )
+    { m_Text = value; m_present.set( 125 ); }
+    void setEncodedTextLen( int value )
+    { m_EncodedTextLen = value; m_present.set( 126 ); }
+    void setEncodedText( const std::string& value )
+    { m_EncodedText = value; m_present.set( 127 ); }
+    void setSettlDate2( const std::string& value )
+    { m_SettlDate2 = value; m_present.set( 128 ); }
+    void setOrderQty2( double value )
+    { m_OrderQty2 = value; m_present.set( 129 ); }
+    void setPrice2( double value )
+    { m_Price2 = value; m_present.set( 130 ); }
+    void setPositionEffect( char value )
+    { m_PositionEffect = value; m_present.set( 131 ); }
+    void setCoveredOrUncovered( int value )
+    { m_CoveredOrUncovered = value; m_present.set( 132 ); }
+    void setMaxShow( double value )
+    { m_MaxShow = value; m_present.set( 133 ); }
+    void setPegOffsetValue( double value )
+    { m_PegOffsetValue = value; m_present.set( 134 ); }
+    void setPegMoveType( int value )
+    { m_PegMoveType = value; m_present.set( 135 ); }
+    void setPegOffsetType( int value )
+    { m_PegOffsetType = value; m_present.set( 136 ); }
+    void setPegLimitType( int value )
+    { m_PegLimitType = value; m_present.set( 137 ); }
+    void setPegRoundDirection( int value )
+    { m_PegRoundDirection = value; m_present.set( 138 ); }
+    void setPegScope( int value )
+    { m_PegScope = value; m_present.set( 139 ); }
+    void setDiscretionInst( char value )
+    { m_DiscretionInst = value; m_present.set( 140 ); }
+    void setDiscretionOffsetValue( double value )
+    { m_DiscretionOffsetValue = value; m_present.set( 141 ); }
+    void setDiscretionMoveType( int value )
+    { m_DiscretionMoveType = value; m_present.set( 142 ); }
+    void setDiscretionOffsetType( int value )
+    { m_DiscretionOffsetType = value; m_present.set( 143 ); }
+    void setDiscretionLimitType( int value )
+    { m_DiscretionLimitType = value; m_present.set( 144 ); }
+    void setDiscretionRoundDirection( int value )
+    { m_DiscretionRoundDirection = value; m_present.set( 145 ); }
+    void setDiscretionScope( int value )
+    { m_DiscretionScope = value; m_present.set( 146 ); }
+    void setTargetStrategy( int value )
+    { m_TargetStrategy = value; m_present.set( 147 ); }
+    void setTargetStrategyParameters( const std::string& value )
+    { m_TargetStrategyParameters = value; m_present.set( 148 ); }
+    void setParticipationRate( double value )
+    { m_ParticipationRate = value; m_present.set( 149 ); }
+    void setCancellationRights( char value )
+    { m_CancellationRights = value; m_present.set( 150 ); }
+    void setMoneyLaunderingStatus( char value )
+    { m_MoneyLaunderingStatus = value; m_present.set( 151 ); }
+    void setRegistID( const std::string& value )
+    { m_RegistID = value; m_present.set( 152 ); }
+    void setDesignation( const std::string& value )
+    { m_Designation = value; m_present.set( 153 ); }
+
+  protected:
+    void encode()
+    {
+      if( m_present[ 0 ] ) append( "11=", m_ClOrdID );
+      if( m_present[ 1 ] ) append( "526=", m_SecondaryClOrdID );
+      if( m_present[ 2 ] ) append( "583=", m_ClOrdLinkID );
+      if( !m_NoPartyIDs.empty() )
+      {
+        append( "453=", (int)m_NoPartyIDs.size() );
+        for( size_t i = 0; i < m_NoPartyIDs.size(); ++i )
+          m_NoPartyIDs[ i ].encode( *this );
+      }
+      if( m_present[ 4 ] ) append( "229=", m_TradeOriginationDate );
+      if( m_present[ 5 ] ) append( "75=", m_TradeDate );
+      if( m_present[ 6 ] ) append( "1=", m_Account );
+      if( m_present[ 7 ] ) append( "660=", m_AcctIDSource );
+      if( m_present[ 8 ] ) append( "581=", m_AccountType );
+      if( m_present[ 9 ] ) append( "589=", m_DayBookingInst );
+      if( m_present[ 10 ] ) append( "590=", m_BookingUnit );
+      if( m_present[ 11 ] ) append( "591=", m_PreallocMethod );
+      if( m_present[ 12 ] ) append( "70=", m_AllocID );
+      if( !m_NoAllocs.empty() )
+      {
+        append( "78=", (int)m_NoAllocs.size() );
+        for( size_t i = 0; i < m_NoAllocs.size(); ++i )
+          m_NoAllocs[ i ].encode( *this );
+      }
+      if( m_present[ 14 ] ) append( "63=", m_SettlType );
+      if( m_present[ 15 ] ) append( "64=", m_SettlDate );
+      if( m_present[ 16 ] ) append( "544=", m_CashMargin );
+      if( m_present[ 17 ] ) append( "635=", m_ClearingFeeIndicator );
+      if( m_present[ 18 ] ) append( "21=", m_HandlInst );
+      if( m_present[ 19 ] ) append( "18=", m_ExecInst );
+      if( m_present[ 20 ] ) append( "110=", m_MinQty );
+      if( m_present[ 21 ] ) append( "111=", m_MaxFloor );
+      if( m_present[ 22 ] ) append( "100=", m_ExDestination );
+      if( !m_NoTradingSessions.empty() )
+      {
+        append( "386=", (int)m_NoTradingSessions.size() );
+        for( size_t i = 0; i < m_NoTradingSessions.size(); ++i )
+          m_NoTradingSessions[ i ].encode( *this );
+      }
+      if( m_present[ 24 ] ) append( "81=", m_ProcessCode );
+      if( m_present[ 25 ] ) append( "55=", m_Symbol );
+      if( m_present[ 26 ] ) append( "65=", m_SymbolSfx );
+      if( m_present[ 27 ] ) append( "48=", m_SecurityID );
+      if( m_present[ 28 ] ) append( "22=", m_SecurityIDSource );
+      if( m_present[ 29 ] ) append( "460=", m_Product );
+      if( m_present[ 30 ] ) append( "461=", m_CFICode );
+      if( m_present[ 31 ] ) append( "167=", m_SecurityType );
+      if( m_present[ 32 ] ) append( "762=", m_SecuritySubType );
+      if( m_present[ 33 ] ) append( "200=", m_MaturityMonthYear );
+      if( m_present[ 34 ] ) append( "541=", m_MaturityDate );
+      if( m_present[ 35 ] ) append( "201=", m_PutOrCall );
+      if( m_present[ 36 ] ) append( "224=", m_CouponPaymentDate );
+      if( m_present[ 37 ] ) append( "225=", m_IssueDate );
+      if( m_present[ 38 ] ) append( "239=", m_RepoCollateralSecurityType );
+      if( m_present[ 39 ] ) append( "226=", m_RepurchaseTerm );
+      if( m_present[ 40 ] ) append( "227=", m_RepurchaseRate );
+      if( m_present[ 41 ] ) append( "228=", m_Factor );
+      if( m_present[ 42 ] ) append( "255=", m_CreditRating );
+      if( m_present[ 43 ] ) append( "543=", m_InstrRegistry );
+      if( m_present[ 44 ] ) append( "470=", m_CountryOfIssue );
+      if( m_present[ 45 ] ) append( "471=", m_StateOrProvinceOfIssue );
+      if( m_present[ 46 ] ) append( "472=", m_LocaleOfIssue );
+      if( m_present[ 47 ] ) append( "240=", m_RedemptionDate );
+      if( m_present[ 48 ] ) append( "202=", m_StrikePrice );
+      if( m_present[ 49 ] ) append( "947=", m_StrikeCurrency );
+      if( m_present[ 50 ] ) append( "206=", m_OptAttribute );
+      if( m_present[ 51 ] ) append( "231=", m_ContractMultiplier );
+      if( m_present[ 52 ] ) append( "223=", m_CouponRate );
+      if( m_present[ 53 ] ) append( "207=", m_SecurityExchange );
+      if( m_present[ 54 ] ) append( "106=", m_Issuer );
+      if( m_present[ 55 ] ) append( "348=", m_EncodedIssuerLen );
+      if( m_present[ 56 ] ) append( "349=", m_EncodedIssuer );
+      if( m_present[ 57 ] ) append( "107=", m_SecurityDesc );
+      if( m_present[ 58 ] ) append( "350=", m_EncodedSecurityDescLen );
+      if( m_present[ 59 ] ) append( "351=", m_EncodedSecurityDesc );
+      if( m_present[ 60 ] ) append( "691=", m_Pool );
+      if( m_present[ 61 ] ) append( "667=", m_ContractSettlMonth );
+      if( m_present[ 62 ] ) append( "875=", m_CPProgram );
+      if( m_present[ 63 ] ) append( "876=", m_CPRegType );
+      if( m_present[ 64 ] ) append( "873=", m_DatedDate );
+      if( m_present[ 65 ] ) append( "874=", m_InterestAccrualDate );
+      if( m_present[ 66 ] ) append( "913=", m_AgreementDesc );
+      if( m_present[ 67 ] ) append( "914=", m_AgreementID );
+      if( m_present[ 68 ] ) append( "915=", m_AgreementDate );
+      if( m_present[ 69 ] ) append( "918=", m_AgreementCurrency );
+      if( m_present[ 70 ] ) append( "788=", m_TerminationType );
+      if( m_present[ 71 ] ) append( "916=", m_StartDate );
+      if( m_present[ 72 ] ) append( "917=", m_EndDate );
+      if( m_present[ 73 ] ) append( "919=", m_DeliveryType );
+      if( m_present[ 74 ] ) append( "898=", m_MarginRatio );
+      if( !m_NoUnderlyings.empty() )
+      {
+        append( "711=", (int)m_NoUnderlyings.size() );
+        for( size_t i = 0; i < m_NoUnderlyings.size(); ++i )
+          m_NoUnderlyings[ i ].encode( *this );
+      }
+      if( m_present[ 76 ] ) append( "140=", m_PrevClosePx );
+      if( m_present[ 77 ] ) append( "54=", m_Side );
+      if( m_present[ 78 ] ) append( "114=", m_LocateReqd );
+      if( m_present[ 79 ] ) append( "60=", m_TransactTime );
+      if( !m_NoStipulations.empty() )
+      {
+        append( "232=", (int)m_NoStipulations.size() );
+        for( size_t i = 0; i < m_NoStipulations.size(); ++i )
+          m_NoStipulations[ i ].encode( *this );
+      }
+      if( m_present[ 81 ] ) append( "854=", m_QtyType );
+      if( m_present[ 82 ] ) append( "38=", m_OrderQty );
+      if( m_present[ 83 ] ) append( "152=", m_CashOrderQty );
+      if( m_present[ 84 ] ) append( "516=", m_OrderPercent );
+      if( m_present[ 85 ] ) append( "468=", m_RoundingDirection );
+      if( m_present[ 86 ] ) append( "469=", m_RoundingModulus );
+      if( m_present[ 87 ] ) append( "40=", m_OrdType );
+      if( m_present[ 88 ] ) append( "423=", m_PriceType );
+      if( m_present[ 89 ] ) append( "44=", m_Price );
+      if( m_present[ 90 ] ) append( "99=", m_StopPx );
+      if( m_present[ 91 ] ) append( "218=", m_Spread );
+      if( m_present[ 92 ] ) append( "220=", m_BenchmarkCurveCurrency );
+      if( m_present[ 93 ] ) append( "221=", m_BenchmarkCurveName );
+      if( m_present[ 94 ] ) append( "222=", m_BenchmarkCurvePoint );
+      if( m_present[ 95 ] ) append( "662=", m_BenchmarkPrice );
+      if( m_present[ 96 ] ) append( "663=", m_BenchmarkPriceType );
+      if( m_present[ 97 ] ) append( "699=", m_BenchmarkSecurityID );
+      if( m_present[ 98 ] ) append( "761=", m_BenchmarkSecurityIDSource );
+      if( m_present[ 99 ] ) append( "235=", m_YieldType );
+      if( m_present[ 100 ] ) append( "236=", m_Yield );
+      if( m_present[ 101 ] ) append( "701=", m_YieldCalcDate );
+      if( m_present[ 102 ] ) append( "696=", m_YieldRedemptionDate );
+      if( m_present[ 103 ] ) append( "697=", m_YieldRedemptionPrice );
+      if( m_present[ 104 ] ) append( "698=", m_YieldRedemptionPriceType );
+      if( m_present[ 105 ] ) append( "15=", m_Currency );
+      if( m_present[ 106 ] ) append( "376=", m_ComplianceID );
+      if( m_present[ 107 ] ) append( "377=", m_SolicitedFlag );
+      if( m_present[ 108 ] ) append( "23=", m_IOIID );
+      if( m_present[ 109 ] ) append( "117=", m_QuoteID );
+      if( m_present[ 110 ] ) append( "59=", m_TimeInForce );
+      if( m_present[ 111 ] ) append( "168=", m_EffectiveTime );
+      if( m_present[ 112 ] ) append( "432=", m_ExpireDate );
+      if( m_present[ 113 ] ) append( "126=", m_ExpireTime );
+      if( m_present[ 114 ] ) append( "427=", m_GTBookingInst );
+      if( m_present[ 115 ] ) append( "12=", m_Commission );
+      if( m_present[ 116 ] ) append( "13=", m_CommType );
+      if( m_present[ 117 ] ) append( "479=", m_CommCurrency );
+      if( m_present[ 118 ] ) append( "497=", m_FundRenewWaiv );
+      if( m_present[ 119 ] ) append( "528=", m_OrderCapacity );
+      if( m_present[ 120 ] ) append( "529=", m_OrderRestrictions );
+      if( m_present[ 121 ] ) append( "582=", m_CustOrderCapacity );
+      if( m_present[ 122 ] ) append( "121=", m_ForexReq );
+      if( m_present[ 123 ] ) append( "120=", m_SettlCurrency );
+      if( m_present[ 124 ] ) append( "775=", m_BookingType );
+      if( m_present[ 125 ] ) append( "58=", m_Text );
+      if( m_present[ 126 ] ) append( "354=", m_EncodedTextLen );
+      if( m_present[ 127 ] ) append( "355=", m_EncodedText );
+      if( m_present[ 128 ] ) append( "193=", m_SettlDate2 );
+      if( m_present[ 129 ] ) append( "192=", m_OrderQty2 );
+      if( m_present[ 130 ] ) append( "640=", m_Price2 );
+      if( m_present[ 131 ] ) append( "77=", m_PositionEffect );
+      if( m_present[ 132 ] ) append( "203=", m_CoveredOrUncovered );
+      if( m_present[ 133 ] ) append( "210=", m_MaxShow );
+      if( m_present[ 134 ] ) append( "211=", m_PegOffsetValue );
+      if( m_present[ 135 ] ) append( "835=", m_PegMoveType );
+      if( m_present[ 136 ] ) append( "836=", m_PegOffsetType );
+      if( m_present[ 137 ] ) append( "837=", m_PegLimitType );
+      if( m_present[ 138 ] ) append( "838=", m_PegRoundDirection );
+      if( m_present[ 139 ] ) append( "840=", m_PegScope );
+      if( m_present[ 140 ] ) append( "388=", m_DiscretionInst );
+      if( m_present[ 141 ] ) append( "389=", m_DiscretionOffsetValue );
+      if( m_present[ 142 ] ) append( "841=", m_DiscretionMoveType );
+      if( m_present[ 143 ] ) append( "842=", m_DiscretionOffsetType );
+      if( m_present[ 144 ] ) append( "843=", m_DiscretionLimitType );
+      if( m_present[ 145 ] ) append( "844=", m_DiscretionRoundDirection );
+      if( m_present[ 146 ] ) append( "846=", m_DiscretionScope );
+      if( m_present[ 147 ] ) append( "847=", m_TargetStrategy );
+      if( m_present[ 148 ] ) append( "848=", m_TargetStrategyParameters );
+      if( m_present[ 149 ] ) append( "849=", m_ParticipationRate );
+      if( m_present[ 150 ] ) append( "480=", m_CancellationRights );
+      if( m_present[ 151 ] ) append( "481=", m_MoneyLaunderingStatus );
+      if( m_present[ 152 ] ) append( "513=", m_RegistID );
+      if( m_present[ 153 ] ) append( "494=", m_Designation );
+    }
+
+  private:
+    void clear()
+    {
+      m_present.reset();
+      m_NoPartyIDs.clear();
+      m_NoAllocs.clear();
+      m_NoTradingSessions.clear();
+      m_NoUnderlyings.clear();
+      m_NoStipulations.clear();
+    }
+
+    std::bitset< 154 > m_present;
+    std::string m_ClOrdID;
+    std::string m_SecondaryClOrdID;
+    std::string m_ClOrdLinkID;
+    NoPartyIDsEntries m_NoPartyIDs;
+    std::string m_TradeOriginationDate;
+    std::string m_TradeDate;
+    std::string m_Account;
+    int m_AcctIDSource;
+    int m_AccountType;
+    char m_DayBookingInst;
+    char m_BookingUnit;
+    char m_PreallocMethod;
+    std::string m_AllocID;
+    NoAllocsEntries m_NoAllocs;
+    std::string m_SettlType;
+    std::string m_SettlDate;
+    char m_CashMargin;
+    std::string m_ClearingFeeIndicator;
+    char m_HandlInst;
+    std::string m_ExecInst;
+    double m_MinQty;
+    double m_MaxFloor;
+    std::string m_ExDestination;
+    NoTradingSessionsEntries m_NoTradingSessions;
+    char m_ProcessCode;
+    std::string m_Symbol;
+    std::string m_SymbolSfx;
+    std::string m_SecurityID;
+    std::string m_SecurityIDSource;
+    int m_Product;
+    std::string m_CFICode;
+    std::string m_SecurityType;
+    std::string m_SecuritySubType;
+    std::string m_MaturityMonthYear;
+    std::string m_MaturityDate;
+    int m_PutOrCall;
+    std::string m_CouponPaymentDate;
+    std::string m_IssueDate;
+    std::string m_RepoCollateralSecurityType;
+    int m_RepurchaseTerm;
+    double m_RepurchaseRate;
+    double m_Factor;
+    std::string m_CreditRating;
+    std::string m_InstrRegistry;
+    std::string m_CountryOfIssue;
+    std::string m_StateOrProvinceOfIssue;
+    std::string m_LocaleOfIssue;
+    std::string m_RedemptionDate;
+    double m_StrikePrice;
+    std::string m_StrikeCurrency;
+    char m_OptAttribute;
+    double m_ContractMultiplier;
+    double m_CouponRate;
+    std::string m_SecurityExchange;
+    std::string m_Issuer;
+    int m_EncodedIssuerLen;
+    std::string m_EncodedIssuer;
+    std::string m_SecurityDesc;
+    int m_EncodedSecurityDescLen;
+    std::string m_EncodedSecurityDesc;
+    std::string m_Pool;
+    std::string m_ContractSettlMonth;
+    int m_CPProgram;
+    std::string m_CPRegType;
+    std::string m_DatedDate;
+    std::string m_InterestAccrualDate;
+    std::string m_AgreementDesc;
+    std::string m_AgreementID;
+    std::string m_AgreementDate;
+    std::string m_AgreementCurrency;
+    int m_TerminationType;
+    std::string m_StartDate;
+    std::string m_EndDate;
+    int m_DeliveryType;
+    double m_MarginRatio;
+    NoUnderlyingsEntries m_NoUnderlyings;
+    double m_PrevClosePx;
+    char m_Side;
+    bool m_LocateReqd;
+    FIX::UtcTimeStamp m_TransactTime;
+    NoStipulationsEntries m_NoStipulations;
+    int m_QtyType;
+    double m_OrderQty;
+    double m_CashOrderQty;
+    double m_OrderPercent;
+    char m_RoundingDirection;
+    double m_RoundingModulus;
+    char m_OrdType;
+    int m_PriceType;
+    double m_Price;
+    double m_StopPx;
+    double m_Spread;
+    std::string m_BenchmarkCurveCurrency;
+    std::string m_BenchmarkCurveName;
+    std::string m_BenchmarkCurvePoint;
+    double m_BenchmarkPrice;
+    int m_BenchmarkPriceType;
+    std::string m_BenchmarkSecurityID;
+    std::string m_BenchmarkSecurityIDSource;
+    std::string m_YieldType;
+    double m_Yield;
+    std::string m_YieldCalcDate;
+    std::string m_YieldRedemptionDate;
+    double m_YieldRedemptionPrice;
+    int m_YieldRedemptionPriceType;
+    std::string m_Currency;
+    std::string m_ComplianceID;
+    bool m_SolicitedFlag;
+    std::string m_IOIID;
+    std::string m_QuoteID;
+    char m_TimeInForce;
+    FIX::UtcTimeStamp m_EffectiveTime;
+    std::string m_ExpireDate;
+    FIX::UtcTimeStamp m_ExpireTime;
+    int m_GTBookingInst;
+    double m_Commission;
+    char m_CommType;
+    std::string m_CommCurrency;
+    char m_FundRenewWaiv;
+    char m_OrderCapacity;
+    std::string m_OrderRestrictions;
+    int m_CustOrderCapacity;
+    bool m_ForexReq;
+    std::string m_SettlCurrency;
+    int m_BookingType;
+    std::string m_Text;
+    int m_EncodedTextLen;
+    std::string m_EncodedText;
+    std::string m_SettlDate2;
+    double m_OrderQty2;
+    double m_Price2;
+    char m_PositionEffect;
+    int m_CoveredOrUncovered;
+    double m_MaxShow;
+    double m_PegOffsetValue;
+    int m_PegMoveType;
+    int m_PegOffsetType;
+    int m_PegLimitType;
+    int m_PegRoundDirection;
+    int m_PegScope;
+    char m_DiscretionInst;
+    double m_DiscretionOffsetValue;
+    int m_DiscretionMoveType;
+    int m_DiscretionOffsetType;
+    int m_DiscretionLimitType;
+    int m_DiscretionRoundDirection;
+    int m_DiscretionScope;
+    int m_TargetStrategy;
+    std::string m_TargetStrategyParameters;
+    double m_ParticipationRate;
+    char m_CancellationRights;
+    char m_MoneyLaunderingStatus;
+    std::string m_RegistID;
+    std::string m_Designation;
+  };
+
+}
+
+#endif
@@ -0,0 +1,640 @@
+#ifndef FIX44_ORDERCANCELREQUESTENCODER_H
+#define FIX44_ORDERCANCELREQUESTENCODER_H
+
+#include "../MessageEncoder.h"
+#include "../FlyweightDecoder.h"
+
+namespace FIX44
+{
+
+  /// Writes OrderCancelRequest bodies without building a FIX::Message.
+  /// Reuse one instance through reset() to avoid allocating per message.
+  class OrderCancelRequestEncoder : public FIX::MessageEncoder
+  {
+  public:
+    class NoPartyIDs
+    {
+    public:
+      class NoPartySubIDs
+      {
+      public:
+        void clear()
+        {
+          m_present.reset();
+        }
+
+        /// Start an entry with its delimiter, which is always written first.
+        void reset( const std::string& aPartySubID )
+        {
+          clear();
+          m_PartySubID = aPartySubID;
+          m_present.set( 0 );
+        }
+
+        void setPartySubIDType( int value )
+        { m_PartySubIDType = value; m_present.set( 1 ); }
+
+        void encode( FIX::MessageEncoder& encoder ) const
+        {
+          if( m_present[ 0 ] ) encoder.append( "523=", m_PartySubID );
+          if( m_present[ 1 ] ) encoder.append( "803=", m_PartySubIDType );
+        }
+
+      private:
+        std::bitset< 2 > m_present;
+        std::string m_PartySubID;
+        int m_PartySubIDType;
+      };
+      typedef FIX::InlineVector< NoPartySubIDs, 2 > NoPartySubIDsEntries;
+
+      void clear()
+      {
+        m_present.reset();
+        m_NoPartySubIDs.clear();
+      }
+
+      /// Start an entry with its delimiter, which is always written first.
+      void reset( const std::string& aPartyID )
+      {
+        clear();
+        m_PartyID = aPartyID;
+        m_present.set( 0 );
+      }
+
+      void setPartyIDSource( char value )
+      { m_PartyIDSource = value; m_present.set( 1 ); }
+      void setPartyRole( int value )
+      { m_PartyRole = value; m_present.set( 2 ); }
+      NoPartySubIDs& addNoPartySubIDs( const std::string& aPartySubID )
+      {
+        NoPartySubIDs& entry = m_NoPartySubIDs.push_back();
+        entry.reset( aPartySubID );
+        return entry;
+      }
+
+      void encode( FIX::MessageEncoder& encoder ) const
+      {
+        if( m_present[ 0 ] ) encoder.append( "448=", m_PartyID );
+        if( m_present[ 1 ] ) encoder.append( "447=", m_PartyIDSource );
+        if( m_present[ 2 ] ) encoder.append( "452=", m_PartyRole );
+        if( !m_NoPartySubIDs.empty() )
+        {
+          encoder.append( "802=", (int)m_NoPartySubIDs.size() );
+          for( size_t i = 0; i < m_NoPartySubIDs.size(); ++i )
+            m_NoPartySubIDs[ i ].encode( encoder );
+        }
+      }
+
+    private:
+      std::bitset< 4 > m_present;
+      std::string m_PartyID;
+      char m_PartyIDSource;
+      int m_PartyRole;
+      NoPartySubIDsEntries m_NoPartySubIDs;
+    };
+    typedef FIX::InlineVector< NoPartyIDs, 8 > NoPartyIDsEntries;
+
+    class NoUnderlyings
+    {
+    public:
+      void clear()
+      {
+        m_present.reset();
+      }
+
+      /// Start an entry with its delimiter, which is always written first.
+      void reset( const std::string& aUnderlyingSymbol )
+      {
+        clear();
+        m_UnderlyingSymbol = aUnderlyingSymbol;
+        m_present.set( 0 );
+      }
+
+      void setUnderlyingSymbolSfx( const std::string& value )
+      { m_UnderlyingSymbolSfx = value; m_present.set( 1 ); }
+      void setUnderlyingSecurityID( const std::string& value )
+      { m_UnderlyingSecurityID = value; m_present.set( 2 ); }
+      void setUnderlyingSecurityIDSource( const std::string& value )
+      { m_UnderlyingSecurityIDSource = value; m_present.set( 3 ); }
+      void setUnderlyingProduct( int value )
+      { m_UnderlyingProduct = value; m_present.set( 4 ); }
+      void setUnderlyingCFICode( const std::string& value )
+      { m_UnderlyingCFICode = value; m_present.set( 5 ); }
+      void setUnderlyingSecurityType( const std::string& value )
+      { m_UnderlyingSecurityType = value; m_present.set( 6 ); }
+      void setUnderlyingSecuritySubType( const std::string& value )
+      { m_UnderlyingSecuritySubType = value; m_present.set( 7 ); }
+      void setUnderlyingMaturityMonthYear( const std::string& value )
+      { m_UnderlyingMaturityMonthYear = value; m_present.set( 8 ); }
+      void setUnderlyingMaturityDate( const std::string& value )
+      { m_UnderlyingMaturityDate = value; m_present.set( 9 ); }
+      void setUnderlyingPutOrCall( int value )
+      { m_UnderlyingPutOrCall = value; m_present.set( 10 ); }
+      void setUnderlyingCouponPaymentDate( const std::string& value )
+      { m_UnderlyingCouponPaymentDate = value; m_present.set( 11 ); }
+      void setUnderlyingIssueDate( const std::string& value )
+      { m_UnderlyingIssueDate = value; m_present.set( 12 ); }
+      void setUnderlyingRepoCollateralSecurityType( const std::string& value )
+      { m_UnderlyingRepoCollateralSecurityType = value; m_present.set( 13 ); }
+      void setUnderlyingRepurchaseTerm( int value )
+      { m_UnderlyingRepurchaseTerm = value; m_present.set( 14 ); }
+      void setUnderlyingRepurchaseRate( double value )
+      { m_UnderlyingRepurchaseRate = value; m_present.set( 15 ); }
+      void setUnderlyingFactor( double value )
+      { m_UnderlyingFactor = value; m_present.set( 16 ); }
+      void setUnderlyingCreditRating( const std::string& value )
+      { m_UnderlyingCreditRating = value; m_present.set( 17 ); }
+      void setUnderlyingInstrRegistry( const std::string& value )
+      { m_UnderlyingInstrRegistry = value; m_present.set( 18 ); }
+      void setUnderlyingCountryOfIssue( const std::string& value )
+      { m_UnderlyingCountryOfIssue = value; m_present.set( 19 ); }
+      void setUnderlyingStateOrProvinceOfIssue( const std::string& value )
+      { m_UnderlyingStateOrProvinceOfIssue = value; m_present.set( 20 ); }
+      void setUnderlyingLocaleOfIssue( const std::string& value )
+      { m_UnderlyingLocaleOfIssue = value; m_present.set( 21 ); }
+      void setUnderlyingRedemptionDate( const std::string& value )
+      { m_UnderlyingRedemptionDate = value; m_present.set( 22 ); }
+      void setUnderlyingStrikePrice( double value )
+      { m_UnderlyingStrikePrice = value; m_present.set( 23 ); }
+      void setUnderlyingStrikeCurrency( const std::string& value )
+      { m_UnderlyingStrikeCurrency = value; m_present.set( 24 ); }
+      void setUnderlyingOptAttribute( char value )
+      { m_UnderlyingOptAttribute = value; m_present.set( 25 ); }
+      void setUnderlyingContractMultiplier( double value )
+      { m_UnderlyingContractMultiplier = value; m_present.set( 26 ); }
+      void setUnderlyingCouponRate( double value )
+      { m_UnderlyingCouponRate = value; m_present.set( 27 ); }
+      void setUnderlyingSecurityExchange( const std::string& value )
+      { m_UnderlyingSecurityExchange = value; m_present.set( 28 ); }
+      void setUnderlyingIssuer( const std::string& value )
+      { m_UnderlyingIssuer = value; m_present.set( 29 ); }
+      void setEncodedUnderlyingIssuerLen( int value )
+      { m_EncodedUnderlyingIssuerLen = value; m_present.set( 30 ); }
+      void setEncodedUnderlyingIssuer( const std::string& value )
+      { m_EncodedUnderlyingIssuer = value; m_present.set( 31 ); }
+      void setUnderlyingSecurityDesc( const std::string& value )
+      { m_UnderlyingSecurityDesc = value; m_present.set( 32 ); }
+      void setEncodedUnderlyingSecurityDescLen( int value )
+      { m_EncodedUnderlyingSecurityDescLen = value; m_present.set( 33 ); }
+      void setEncodedUnderlyingSecurityDesc( const std::string& value )
+      { m_EncodedUnderlyingSecurityDesc = value; m_present.set( 34 ); }
+      void setUnderlyingCPProgram( const std::string& value )
+      { m_UnderlyingCPProgram = value; m_present.set( 35 ); }
+      void setUnderlyingCPRegType( const std::string& value )
+      { m_UnderlyingCPRegType = value; m_present.set( 36 ); }
+      void setUnderlyingCurrency( const std::string& value )
+      { m_UnderlyingCurrency = value; m_present.set( 37 ); }
+      void setUnderlyingQty( double value )
+      { m_UnderlyingQty = value; m_present.set( 38 ); }
+      void setUnderlyingPx( double value )
+      { m_UnderlyingPx = value; m_present.set( 39 ); }
+      void setUnderlyingDirtyPrice( double value )
+      { m_UnderlyingDirtyPrice = value; m_present.set( 40 ); }
+      void setUnderlyingEndPrice( double value )
+      { m_UnderlyingEndPrice = value; m_present.set( 41 ); }
+      void setUnderlyingStartValue( double value )
+      { m_UnderlyingStartValue = value; m_present.set( 42 ); }
+      void setUnderlyingCurrentValue( double value )
+      { m_UnderlyingCurrentValue = value; m_present.set( 43 ); }
+      void setUnderlyingEndValue( double value )
+      { m_UnderlyingEndValue = value; m_present.set( 44 ); }
+
+      void encode( FIX::MessageEncoder& encoder ) const
+      {
+        if( m_present[ 0 ] ) encoder.append( "311=", m_UnderlyingSymbol );
+        if( m_present[ 1 ] ) encoder.append( "312=", m_UnderlyingSymbolSfx );
+        if( m_present[ 2 ] ) encoder.append( "309=", m_UnderlyingSecurityID );
+        if( m_present[ 3 ] ) encoder.append( "305=", m_UnderlyingSecurityIDSource );
+        if( m_present[ 4 ] ) encoder.append( "462=", m_UnderlyingProduct );
+        if( m_present[ 5 ] ) encoder.append( "463=", m_UnderlyingCFICode );
+        if( m_present[ 6 ] ) encoder.append( "310=", m_UnderlyingSecurityType );
+        if( m_present[ 7 ] ) encoder.append( "763=", m_UnderlyingSecuritySubType );
+        if( m_present[ 8 ] ) encoder.append( "313=", m_UnderlyingMaturityMonthYear );
+        if( m_present[ 9 ] ) encoder.append( "542=", m_UnderlyingMaturityDate );
+        if( m_present[ 10 ] ) encoder.append( "315=", m_UnderlyingPutOrCall );
+        if( m_present[ 11 ] ) encoder.append( "241=", m_UnderlyingCouponPaymentDate );
+        if( m_present[ 12 ] ) encoder.append( "242=", m_UnderlyingIssueDate );
+        if( m_present[ 13 ] ) encoder.append( "243=", m_UnderlyingRepoCollateralSecurityType );
+        if( m_present[ 14 ] ) encoder.append( "244=", m_UnderlyingRepurchaseTerm );
+        if( m_present[ 15 ] ) encoder.append( "245=", m_UnderlyingRepurchaseRate );
+        if( m_present[ 16 ] ) encoder.append( "246=", m_UnderlyingFactor );
+        if( m_present[ 17 ] ) encoder.append( "256=", m_UnderlyingCreditRating );
+        if( m_present[ 18 ] ) encoder.append( "595=", m_UnderlyingInstrRegistry );
+        if( m_present[ 19 ] ) encoder.append( "592=", m_UnderlyingCountryOfIssue );
+        if( m_present[ 20 ] ) encoder.append( "593=", m_UnderlyingStateOrProvinceOfIssue );
+        if( m_present[ 21 ] ) encoder.append( "594=", m_UnderlyingLocaleOfIssue );
+        if( m_present[ 22 ] ) encoder.append( "247=", m_UnderlyingRedemptionDate );
+        if( m_present[ 23 ] ) encoder.append( "316=", m_UnderlyingStrikePrice );
+        if( m_present[ 24 ] ) encoder.append( "941=", m_UnderlyingStrikeCurrency );
+        if( m_present[ 25 ] ) encoder.append( "317=", m_UnderlyingOptAttribute );
+        if( m_present[ 26 ] ) encoder.append( "436=", m_UnderlyingContractMultiplier );
+        if( m_present[ 27 ] ) encoder.append( "435=", m_UnderlyingCouponRate );
+        if( m_present[ 28 ] ) encoder.append( "308=", m_UnderlyingSecurityExchange );
+        if( m_present[ 29 ] ) encoder.append( "306=", m_UnderlyingIssuer );
+        if( m_present[ 30 ] ) encoder.append( "362=", m_EncodedUnderlyingIssuerLen );
+        if( m_present[ 31 ] ) encoder.append( "363=", m_EncodedUnderlyingIssuer );
+        if( m_present[ 32 ] ) encoder.append( "307=", m_UnderlyingSecurityDesc );
+        if( m_present[ 33 ] ) encoder.append( "364=", m_EncodedUnderlyingSecurityDescLen );
+        if( m_present[ 34 ] ) encoder.append( "365=", m_EncodedUnderlyingSecurityDesc );
+        if( m_present[ 35 ] ) encoder.append( "877=", m_UnderlyingCPProgram );
+        if( m_present[ 36 ] ) encoder.append( "878=", m_UnderlyingCPRegType );
+        if( m_present[ 37 ] ) encoder.append( "318=", m_UnderlyingCurrency );
+        if( m_present[ 38 ] ) encoder.append( "879=", m_UnderlyingQty );
+        if( m_present[ 39 ] ) encoder.append( "810=", m_UnderlyingPx );
+        if( m_present[ 40 ] ) encoder.append( "882=", m_UnderlyingDirtyPrice );
+        if( m_present[ 41 ] ) encoder.append( "883=", m_UnderlyingEndPrice );
+        if( m_present[ 42 ] ) encoder.append( "884=", m_UnderlyingStartValue );
+        if( m_present[ 43 ] ) encoder.append( "885=", m_UnderlyingCurrentValue );
+        if( m_present[ 44 ] ) encoder.append( "886=", m_UnderlyingEndValue );
+      }
+
+    private:
+      std::bitset< 45 > m_present;
+      std::string m_UnderlyingSymbol;
+      std::string m_UnderlyingSymbolSfx;
+      std::string m_UnderlyingSecurityID;
+      std::string m_UnderlyingSecurityIDSource;
+      int m_UnderlyingProduct;
+      std::string m_UnderlyingCFICode;
+      std::string m_UnderlyingSecurityType;
+      std::string m_UnderlyingSecuritySubType;
+      std::string m_UnderlyingMaturityMonthYear;
+      std::string m_UnderlyingMaturityDate;
+      int m_UnderlyingPutOrCall;
+      std::string m_UnderlyingCouponPaymentDate;
+      std::string m_UnderlyingIssueDate;
+      std::string m_UnderlyingRepoCollateralSecurityType;
+      int m_UnderlyingRepurchaseTerm;
+      double m_UnderlyingRepurchaseRate;
+      double m_UnderlyingFactor;
+      std::string m_UnderlyingCreditRating;
+      std::string m_UnderlyingInstrRegistry;
+      std::string m_UnderlyingCountryOfIssue;
+      std::string m_UnderlyingStateOrProvinceOfIssue;
+      std::string m_UnderlyingLocaleOfIssue;
+      std::string m_UnderlyingRedemptionDate;
+      double m_UnderlyingStrikePrice;
+      std::string m_UnderlyingStrikeCurrency;
+      char m_UnderlyingOptAttribute;
+      double m_UnderlyingContractMultiplier;
+      double m_UnderlyingCouponRate;
+      std::string m_UnderlyingSecurityExchange;
+      std::string m_UnderlyingIssuer;
+      int m_EncodedUnderlyingIssuerLen;
+      std::string m_EncodedUnderlyingIssuer;
+      std::string m_UnderlyingSecurityDesc;
+      int m_EncodedUnderlyingSecurityDescLen;
+      std::string m_EncodedUnderlyingSecurityDesc;
+      std::string m_UnderlyingCPProgram;
+      std::string m_UnderlyingCPRegType;
+      std::string m_UnderlyingCurrency;
+      double m_UnderlyingQty;
+      double m_UnderlyingPx;
+      double m_UnderlyingDirtyPrice;
+      double m_UnderlyingEndPrice;
+      double m_UnderlyingStartValue;
+      double m_UnderlyingCurrentValue;
+      double m_UnderlyingEndValue;
+    };
+    typedef FIX::InlineVector< NoUnderlyings, 8 > NoUnderlyingsEntries;
+
+    OrderCancelRequestEncoder( const std::string& aOrigClOrdID, const std::string& aClOrdID, char aSide, const FIX::UtcTimeStamp& aTransactTime )
+    : FIX::MessageEncoder( "F" )
+    { reset( aOrigClOrdID, aClOrdID, aSide, aTransactTime ); }
+
+    /// Start a new message, keeping the buffers of the last one.
+    void reset( const std::string& aOrigClOrdID, const std::string& aClOrdID, char aSide, const FIX::UtcTimeStamp& aTransactTime )
+    {
+      clear();
+      m_OrigClOrdID = aOrigClOrdID;
+      m_present.set( 0 );
+      m_ClOrdID = aClOrdID;
+      m_present.set( 2 );
+      m_Side = aSide;
+      m_present.set( 62 );
+      m_TransactTime = aTransactTime;
+      m_present.set( 63 );
+    }
+
+    void setOrderID( const std::string& value )
+    { m_OrderID = value; m_present.set( 1 ); }
+    void setSecondaryClOrdID( const std::string& value )
+    { m_SecondaryClOrdID = value; m_present.set( 3 ); }
+    void setClOrdLinkID( const std::string& value )
+    { m_ClOrdLinkID = value; m_present.set( 4 ); }
+    void setListID( const std::string& value )
+    { m_ListID = value; m_present.set( 5 ); }
+    void setOrigOrdModTime( const FIX::UtcTimeStamp& value )
+    { m_OrigOrdModTime = value; m_present.set( 6 ); }
+    void setAccount( const std::string& value )
+    { m_Account = value; m_present.set( 7 ); }
+    void setAcctIDSource( int value )
+    { m_AcctIDSource = value; m_present.set( 8 ); }
+    void setAccountType( int value )
+    { m_AccountType = value; m_present.set( 9 ); }
+    NoPartyIDs& addNoPartyIDs( const std::string& aPartyID )
+    {
+      NoPartyIDs& entry = m_NoPartyIDs.push_back();
+      entry.reset( aPartyID );
+      return entry;
+    }
+    void setSymbol( const std::string& value )
+    { m_Symbol = value; m_present.set( 11 ); }
+    void setSymbolSfx( const std::string& value )
+    { m_SymbolSfx = value; m_present.set( 12 ); }
+    void setSecurityID( const std::string& value )
+    { m_SecurityID = value; m_present.set( 13 ); }
+    void setSecurityIDSource( const std::string& value )
+    { m_SecurityIDSource = value; m_present.set( 14 ); }
+    void setProduct( int value )
+    { m_Product = value; m_present.set( 15 ); }
+    void setCFICode( const std::string& value )
+    { m_CFICode = value; m_present.set( 16 ); }
+    void setSecurityType( const std::string& value )
+    { m_SecurityType = value; m_present.set( 17 ); }
+    void setSecuritySubType( const std::string& value )
+    { m_SecuritySubType = value; m_present.set( 18 ); }
+    void setMaturityMonthYear( const std::string& value )
+    { m_MaturityMonthYear = value; m_present.set( 19 ); }
+    void setMaturityDate( const std::string& value )
+    { m_MaturityDate = value; m_present.set( 20 ); }
+    void setPutOrCall( int value )
+    { m_PutOrCall = value; m_present.set( 21 ); }
+    void setCouponPaymentDate( const std::string& value )
+    { m_CouponPaymentDate = value; m_present.set( 22 ); }
+    void setIssueDate( const std::string& value )
+    { m_IssueDate = value; m_present.set( 23 ); }
+    void setRepoCollateralSecurityType( const std::string& value )
+    { m_RepoCollateralSecurityType = value; m_present.set( 24 ); }
+    void setRepurchaseTerm( int value )
+    { m_RepurchaseTerm = value; m_present.set( 25 ); }
+    void setRepurchaseRate( double value )
+    { m_RepurchaseRate = value; m_present.set( 26 ); }
+    void setFactor( double value )
+    { m_Factor = value; m_present.set( 27 ); }
+    void setCreditRating( const std::string& value )
+    { m_CreditRating = value; m_present.set( 28 ); }
+    void setInstrRegistry( const std::string& value )
+    { m_InstrRegistry = value; m_present.set( 29 ); }
+    void setCountryOfIssue( const std::string& value )
+    { m_CountryOfIssue = value; m_present.set( 30 ); }
+    void setStateOrProvinceOfIssue( const std::string& value )
+    { m_StateOrProvinceOfIssue = value; m_present.set( 31 ); }
+    void setLocaleOfIssue( const std::string& value )
+    { m_LocaleOfIssue = value; m_present.set( 32 ); }
+    void setRedemptionDate( const std::string& value )
+    { m_RedemptionDate = value; m_present.set( 33 ); }
+    void setStrikePrice( double value )
+    { m_StrikePrice = value; m_present.set( 34 ); }
+    void setStrikeCurrency( const std::string& value )
+    { m_StrikeCurrency = value; m_present.set( 35 ); }
+    void setOptAttribute( char value )
+    { m_OptAttribute = value; m_present.set( 36 ); }
+    void setContractMultiplier( double value )
+    { m_ContractMultiplier = value; m_present.set( 37 ); }
+    void setCouponRate( double value )
+    { m_CouponRate = value; m_present.set( 38 ); }
+    void setSecurityExchange( const std::string& value )
+    { m_SecurityExchange = value; m_present.set( 39 ); }
+    void setIssuer( const std::string& value )
+    { m_Issuer = value; m_present.set( 40 ); }
+    void setEncodedIssuerLen( int value )
+    { m_EncodedIssuerLen = value; m_present.set( 41 ); }
+    void setEncodedIssuer( const std::string& value )
+    { m_EncodedIssuer = value; m_present.set( 42 ); }
+    void setSecurityDesc( const std::string& value )
+    { m_SecurityDesc = value; m_present.set( 43 ); }
+    void setEncodedSecurityDescLen( int value )
+    { m_EncodedSecurityDescLen = value; m_present.set( 44 ); }
+    void setEncodedSecurityDesc( const std::string& value )
+    { m_EncodedSecurityDesc = value; m_present.set( 45 ); }
+    void setPool( const std::string& value )
+    { m_Pool = value; m_present.set( 46 ); }
+    void setContractSettlMonth( const std::string& value )
+    { m_ContractSettlMonth = value; m_present.set( 47 ); }
+    void setCPProgram( int value )
+    { m_CPProgram = value; m_present.set( 48 ); }
+    void setCPRegType( const std::string& value )
+    { m_CPRegType = value; m_present.set( 49 ); }
+    void setDatedDate( const std::string& value )
+    { m_DatedDate = value; m_present.set( 50 ); }
+    void setInterestAccrualDate( const std::string& value )
+    { m_InterestAccrualDate = value; m_present.set( 51 ); }
+    void setAgreementDesc( const std::string& value )
+    { m_AgreementDesc = value; m_present.set( 52 ); }
+    void setAgreementID( const std::string& value )
+    { m_AgreementID = value; m_present.set( 53 ); }
+    void setAgreementDate( const std::string& value )
+    { m_AgreementDate = value; m_present.set( 54 ); }
+    void setAgreementCurrency( const std::string& value )
+    { m_AgreementCurrency = value; m_present.set( 55 ); }
+    void setTerminationType( int value )
+    { m_TerminationType = value; m_present.set( 56 ); }
+    void setStartDate( const std::string& value )
+    { m_StartDate = value; m_present.set( 57 ); }
+    void setEndDate( const std::string& value )
+    { m_EndDate = value; m_present.set( 58 ); }
+    void setDeliveryType( int value )
+    { m_DeliveryType = value; m_present.set( 59 ); }
+    void setMarginRatio( double value )
+    { m_MarginRatio = value; m_present.set( 60 ); }
+    NoUnderlyings& addNoUnderlyings( const std::string& aUnderlyingSymbol )
+    {
+      NoUnderlyings& entry = m_NoUnderlyings.push_back();
+      entry.reset( aUnderlyingSymbol );
+      return entry;
+    }
+    void setOrderQty( double value )
+    { m_OrderQty = value; m_present.set( 64 ); }
+    void setCashOrderQty( double value )
+    { m_CashOrderQty = value; m_present.set( 65 ); }
+    void setOrderPercent( double value )
+    { m_OrderPercent = value; m_present.set( 66 ); }
+    void setRoundingDirection( char value )
+    { m_RoundingDirection = value; m_present.set( 67 ); }
+    void setRoundingModulus( double value )
+    { m_RoundingModulus = value; m_present.set( 68 ); }
+    void setComplianceID( const std::string& value )
+    { m_ComplianceID = value; m_present.set( 69 ); }
+    void setText( const std::string& value )
+    { m_Text = value; m_present.set( 70 ); }
+    void setEncodedTextLen( int value )
+    { m_EncodedTextLen = value; m_present.set( 71 ); }
+    void setEncodedText( const std::string& value )
+    { m_EncodedText = value; m_present.set( 72 ); }
+
+  protected:
+    void encode()
+    {
+      if( m_present[ 0 ] ) append( "41=", m_OrigClOrdID );
+      if( m_present[ 1 ] ) append( "37=", m_OrderID );
+      if( m_present[ 2 ] ) append( "11=", m_ClOrdID );
+      if( m_present[ 3 ] ) append( "526=", m_SecondaryClOrdID );
+      if( m_present[ 4 ] ) append( "583=", m_ClOrdLinkID );
+      if( m_present[ 5 ] ) append( "66=", m_ListID );
+      if( m_present[ 6 ] ) append( "586=", m_OrigOrdModTime );
+      if( m_present[ 7 ] ) append( "1=", m_Account );
+      if( m_present[ 8 ] ) append( "660=", m_AcctIDSource );
+      if( m_present[ 9 ] ) append( "581=", m_AccountType );
+      if( !m_NoPartyIDs.empty() )
+      {
+        append( "453=", (int)m_NoPartyIDs.size() );
+        for( size_t i = 0; i < m_NoPartyIDs.size(); ++i )
+          m_NoPartyIDs[ i ].encode( *this );
+      }
+      if( m_present[ 11 ] ) append( "55=", m_Symbol );
+      if( m_present[ 12 ] ) append( "65=", m_SymbolSfx );
+      if( m_present[ 13 ] ) append( "48=", m_SecurityID );
+      if( m_present[ 14 ] ) append( "22=", m_SecurityIDSource );
+      if( m_present[ 15 ] ) append( "460=", m_Product );
+      if( m_present[ 16 ] ) append( "461=", m_CFICode );
+      if( m_present[ 17 ] ) append( "167=", m_SecurityType );
+      if( m_present[ 18 ] ) append( "762=", m_SecuritySubType );
+      if( m_present[ 19 ] ) append( "200=", m_MaturityMonthYear );
+      if( m_present[ 20 ] ) append( "541=", m_MaturityDate );
+      if( m_present[ 21 ] ) append( "201=", m_PutOrCall );
+      if( m_present[ 22 ] ) append( "224=", m_CouponPaymentDate );
+      if( m_present[ 23 ] ) append( "225=", m_IssueDate );
+      if( m_present[ 24 ] ) append( "239=", m_RepoCollateralSecurityType );
+      if( m_present[ 25 ] ) append( "226=", m_RepurchaseTerm );
+      if( m_present[ 26 ] ) append( "227=", m_RepurchaseRate );
+      if( m_present[ 27 ] ) append( "228=", m_Factor );
+      if( m_present[ 28 ] ) append( "255=", m_CreditRating );
+      if( m_present[ 29 ] ) append( "543=", m_InstrRegistry );
+      if( m_present[ 30 ] ) append( "470=", m_CountryOfIssue );
+      if( m_present[ 31 ] ) append( "471=", m_StateOrProvinceOfIssue );
+      if( m_present[ 32 ] ) append( "472=", m_LocaleOfIssue );
+      if( m_present[ 33 ] ) append( "240=", m_RedemptionDate );
+      if( m_present[ 34 ] ) append( "202=", m_StrikePrice );
+      if( m_present[ 35 ] ) append( "947=", m_StrikeCurrency );
+      if( m_present[ 36 ] ) append( "206=", m_OptAttribute );
+      if( m_present[ 37 ] ) append( "231=", m_ContractMultiplier );
+      if( m_present[ 38 ] ) append( "223=", m_CouponRate );
+      if( m_present[ 39 ] ) append( "207=", m_SecurityExchange );
+      if( m_present[ 40 ] ) append( "106=", m_Issuer );
+      if( m_present[ 41 ] ) append( "348=", m_EncodedIssuerLen );
+      if( m_present[ 42 ] ) append( "349=", m_EncodedIssuer );
+      if( m_present[ 43 ] ) append( "107=", m_SecurityDesc );
+      if( m_present[ 44 ] ) append( "350=", m_EncodedSecurityDescLen );
+      if( m_present[ 45 ] ) append( "351=", m_EncodedSecurityDesc );
+      if( m_present[ 46 ] ) append( "691=", m_Pool );
+      if( m_present[ 47 ] ) append( "667=", m_ContractSettlMonth );
+      if( m_present[ 48 ] ) append( "875=", m_CPProgram );
+      if( m_present[ 49 ] ) append( "876=", m_CPRegType );
+      if( m_present[ 50 ] ) append( "873=", m_DatedDate );
+      if( m_present[ 51 ] ) append( "874=", m_InterestAccrualDate );
+      if( m_present[ 52 ] ) append( "913=", m_AgreementDesc );
+      if( m_present[ 53 ] ) append( "914=", m_AgreementID );
+      if( m_present[ 54 ] ) append( "915=", m_AgreementDate );
+      if( m_present[ 55 ] ) append( "918=", m_AgreementCurrency );
+      if( m_present[ 56 ] ) append( "788=", m_TerminationType );
+      if( m_present[ 57 ] ) append( "916=", m_StartDate );
+      if( m_present[ 58 ] ) append( "917=", m_EndDate );
+      if( m_present[ 59 ] ) append( "919=", m_DeliveryType );
+      if( m_present[ 60 ] ) append( "898=", m_MarginRatio );
+      if( !m_NoUnderlyings.empty() )
+      {
+        append( "711=", (int)m_NoUnderlyings.size() );
+        for( size_t i = 0; i < m_NoUnderlyings.size(); ++i )
+          m_NoUnderlyings[ i ].encode( *this );
+      }
+      if( m_present[ 62 ] ) append( "54=", m_Side );
+      if( m_present[ 63 ] ) append( "60=", m_TransactTime );
+      if( m_present[ 64 ] ) append( "38=", m_OrderQty );
+      if( m_present[ 65 ] ) append( "152=", m_CashOrderQty );
+      if( m_present[ 66 ] ) append( "516=", m_OrderPercent );
+      if( m_present[ 67 ] ) append( "468=", m_RoundingDirection );
+      if( m_present[ 68 ] ) append( "469=", m_RoundingModulus );
+      if( m_present[ 69 ] ) append( "376=", m_ComplianceID );
+      if( m_present[ 70 ] ) append( "58=", m_Text );
+      if( m_present[ 71 ] ) append( "354=", m_EncodedTextLen );
+      if( m_present[ 72 ] ) append( "355=", m_EncodedText );
+    }
+
+  private:
+    void clear()
+    {
+      m_present.reset();
+      m_NoPartyIDs.clear();
+      m_NoUnderlyings.clear();
+    }
+
+    std::bitset< 73 > m_present;
+    std::string m_OrigClOrdID;
+    std::string m_OrderID;
+    std::string m_ClOrdID;
+    std::string m_SecondaryClOrdID;
+    std::string m_ClOrdLinkID;
+    std::string m_ListID;
+    FIX::UtcTimeStamp m_OrigOrdModTime;
+    std::string m_Account;
+    int m_AcctIDSource;
+    int m_AccountType;
+    NoPartyIDsEntries m_NoPartyIDs;
+    std::string m_Symbol;
+    std::string m_SymbolSfx;
+    std::string m_SecurityID;
+    std::string m_SecurityIDSource;
+    int m_Product;
+    std::string m_CFICode;
+    std::string m_SecurityType;
+    std::string m_SecuritySubType;
+    std::string m_MaturityMonthYear;
+    std::string m_MaturityDate;
+    int m_PutOrCall;
+    std::string m_CouponPaymentDate;
+    std::string m_IssueDate;
+    std::string m_RepoCollateralSecurityType;
+    int m_RepurchaseTerm;
+    double m_RepurchaseRate;
+    double m_Factor;
+    std::string m_CreditRating;
+    std::string m_InstrRegistry;
+    std::string m_CountryOfIssue;
+    std::string m_StateOrProvinceOfIssue;
+    std::string m_LocaleOfIssue;
+    std::string m_RedemptionDate;
+    double m_StrikePrice;
+    std::string m_StrikeCurrency;
+    char m_OptAttribute;
+    double m_ContractMultiplier;
+    double m_CouponRate;
+    std::string m_SecurityExchange;
+    std::string m_Issuer;
+    int m_EncodedIssuerLen;
+    std::string m_EncodedIssuer;
+    std::string m_SecurityDesc;
+    int m_EncodedSecurityDescLen;
+    std::string m_EncodedSecurityDesc;
+    std::string m_Pool;
+    std::string m_ContractSettlMonth;
+    int m_CPProgram;
+    std::string m_CPRegType;
+    std::string m_DatedDate;
+    std::string m_InterestAccrualDate;
+    std::string m_AgreementDesc;
+    std::string m_AgreementID;
+    std::string m_AgreementDate;
+    std::string m_AgreementCurrency;
+    int m_TerminationType;
+    std::string m_StartDate;
+    std::string m_EndDate;
+    int m_DeliveryType;
+    double m_MarginRatio;
+    NoUnderlyingsEntries m_NoUnderlyings;
+    char m_Side;
+    FIX::UtcTimeStamp m_TransactTime;
+    double m_OrderQty;
+    double m_CashOrderQty;
+    double m_OrderPercent;
+    char m_RoundingDirection;
+    double m_RoundingModulus;
+    std::string m_ComplianceID;
+    std::string m_Text;
+    int m_EncodedTextLen;
+    std::string m_EncodedText;
+  };
+
+}
+
+#endif
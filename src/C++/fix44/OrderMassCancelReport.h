@@ -38,7 +38,8 @@ namespace FIX44
     class NoAffectedOrders: public FIX::Group
     {
     public:
-    NoAffectedOrders() : FIX::Group(534,41,FIX::message_order(41,535,536,0)) {}
+    NoAffectedOrders() : FIX::Group(534,41,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(41,535,536,0); return instance; }
       FIELD_SET(*this, FIX::OrigClOrdID);
       FIELD_SET(*this, FIX::AffectedOrderID);
       FIELD_SET(*this, FIX::AffectedSecondaryOrderID);
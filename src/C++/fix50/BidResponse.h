@@ -21,7 +21,8 @@ namespace FIX50
     class NoBidComponents: public FIX::Group
     {
     public:
-    NoBidComponents() : FIX::Group(420,12,FIX::message_order(12,13,479,497,66,421,54,44,423,406,430,63,64,336,625,58,354,355,0)) {}
+    NoBidComponents() : FIX::Group(420,12,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(12,13,479,497,66,421,54,44,423,406,430,63,64,336,625,58,354,355,0); return instance; }
       FIELD_SET(*this, FIX::Commission);
       FIELD_SET(*this, FIX::CommType);
       FIELD_SET(*this, FIX::CommCurrency);
@@ -28,7 +28,8 @@ namespace FIX50
     class NoAltMDSource: public FIX::Group
     {
     public:
-    NoAltMDSource() : FIX::Group(816,817,FIX::message_order(817,0)) {}
+    NoAltMDSource() : FIX::Group(816,817,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(817,0); return instance; }
       FIELD_SET(*this, FIX::AltMDSourceID);
     };
     FIELD_SET(*this, FIX::Text);
@@ -30,7 +30,8 @@ namespace FIX50
     class NoCompIDs: public FIX::Group
     {
     public:
-    NoCompIDs() : FIX::Group(936,930,FIX::message_order(930,931,283,284,0)) {}
+    NoCompIDs() : FIX::Group(936,930,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(930,931,283,284,0); return instance; }
       FIELD_SET(*this, FIX::RefCompID);
       FIELD_SET(*this, FIX::RefSubID);
       FIELD_SET(*this, FIX::LocationID);
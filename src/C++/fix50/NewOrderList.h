@@ -48,7 +48,8 @@ namespace FIX50
     class NoRootPartyIDs: public FIX::Group
     {
     public:
-    NoRootPartyIDs() : FIX::Group(1116,1117,FIX::message_order(1117,1118,1119,1120,0)) {}
+    NoRootPartyIDs() : FIX::Group(1116,1117,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(1117,1118,1119,1120,0); return instance; }
       FIELD_SET(*this, FIX::RootPartyID);
       FIELD_SET(*this, FIX::RootPartyIDSource);
       FIELD_SET(*this, FIX::RootPartyRole);
@@ -56,7 +57,8 @@ namespace FIX50
       class NoRootPartySubIDs: public FIX::Group
       {
       public:
-      NoRootPartySubIDs() : FIX::Group(1120,1121,FIX::message_order(1121,1122,0)) {}
+      NoRootPartySubIDs() : FIX::Group(1120,1121,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(1121,1122,0); return instance; }
         FIELD_SET(*this, FIX::RootPartySubID);
         FIELD_SET(*this, FIX::RootPartySubIDType);
       };
@@ -65,7 +67,8 @@ namespace FIX50
     class NoOrders: public FIX::Group
     {
     public:
-    NoOrders() : FIX::Group(73,11,FIX::message_order(11,526,67,583,160,453,229,75,1,660,581,589,590,70,591,78,63,64,544,635,21,18,110,1089,1090,1138,1082,1083,1084,1085,1086,1087,1088,111,100,1133,386,81,55,65,48,22,460,461,167,762,200,541,1079,201,966,1049,965,224,225,239,226,227,228,255,543,470,471,472,240,202,947,967,968,206,231,969,996,997,223,207,970,971,106,348,349,107,350,351,691,667,875,876,873,874,711,140,54,401,114,60,232,854,38,152,516,468,469,40,423,44,1092,99,1100,1101,1102,1103,1104,1105,1106,1107,1108,1109,1110,1111,1112,1113,1114,218,220,221,222,662,663,699,761,235,236,701,696,697,698,15,376,377,23,117,1080,1081,59,168,432,126,427,12,13,479,497,528,529,1091,582,121,120,775,58,354,355,193,192,640,77,203,210,211,1094,835,836,837,838,840,1096,1097,1098,1099,388,389,841,842,843,844,846,847,957,848,849,494,0)) {}
+    NoOrders() : FIX::Group(73,11,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(11,526,67,583,160,453,229,75,1,660,581,589,590,70,591,78,63,64,544,635,21,18,110,1089,1090,1138,1082,1083,1084,1085,1086,1087,1088,111,100,1133,386,81,55,65,48,22,460,461,167,762,200,541,1079,201,966,1049,965,224,225,239,226,227,228,255,543,470,471,472,240,202,947,967,968,206,231,969,996,997,223,207,970,971,106,348,349,107,350,351,691,667,875,876,873,874,711,140,54,401,114,60,232,854,38,152,516,468,469,40,423,44,1092,99,1100,1101,1102,1103,1104,1105,1106,1107,1108,1109,1110,1111,1112,1113,1114,218,220,221,222,662,663,699,761,235,236,701,696,697,698,15,376,377,23,117,1080,1081,59,168,432,126,427,12,13,479,497,528,529,1091,582,121,120,775,58,354,355,193,192,640,77,203,210,211,1094,835,836,837,838,840,1096,1097,1098,1099,388,389,841,842,843,844,846,847,957,848,849,494,0); return instance; }
       FIELD_SET(*this, FIX::ClOrdID);
       FIELD_SET(*this, FIX::SecondaryClOrdID);
       FIELD_SET(*this, FIX::ListSeqNo);
@@ -75,7 +78,8 @@ namespace FIX50
       class NoPartyIDs: public FIX::Group
       {
       public:
-      NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,802,0)) {}
+      NoPartyIDs() : FIX::Group(453,448,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(448,447,452,802,0); return instance; }
         FIELD_SET(*this, FIX::PartyID);
         FIELD_SET(*this, FIX::PartyIDSource);
         FIELD_SET(*this, FIX::PartyRole);
@@ -83,7 +87,8 @@ namespace FIX50
         class NoPartySubIDs: public FIX::Group
         {
         public:
-        NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
+        NoPartySubIDs() : FIX::Group(802,523,order()) {}
+        static const FIX::message_order& order() { static const FIX::message_order instance(523,803,0); return instance; }
           FIELD_SET(*this, FIX::PartySubID);
           FIELD_SET(*this, FIX::PartySubIDType);
         };
@@ -101,7 +106,8 @@ namespace FIX50
       class NoAllocs: public FIX::Group
       {
       public:
-      NoAllocs() : FIX::Group(78,79,FIX::message_order(79,661,736,467,539,80,0)) {}
+      NoAllocs() : FIX::Group(78,79,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(79,661,736,467,539,80,0); return instance; }
         FIELD_SET(*this, FIX::AllocAccount);
         FIELD_SET(*this, FIX::AllocAcctIDSource);
         FIELD_SET(*this, FIX::AllocSettlCurrency);
@@ -110,7 +116,8 @@ namespace FIX50
         class NoNestedPartyIDs: public FIX::Group
         {
         public:
-        NoNestedPartyIDs() : FIX::Group(539,524,FIX::message_order(524,525,538,804,0)) {}
+        NoNestedPartyIDs() : FIX::Group(539,524,order()) {}
+        static const FIX::message_order& order() { static const FIX::message_order instance(524,525,538,804,0); return instance; }
           FIELD_SET(*this, FIX::NestedPartyID);
           FIELD_SET(*this, FIX::NestedPartyIDSource);
           FIELD_SET(*this, FIX::NestedPartyRole);
@@ -118,7 +125,8 @@ namespace FIX50
           class NoNestedPartySubIDs: public FIX::Group
           {
           public:
-          NoNestedPartySubIDs() : FIX::Group(804,545,FIX::message_order(545,805,0)) {}
+          NoNestedPartySubIDs() : FIX::Group(804,545,order()) {}
+          static const FIX::message_order& order() { static const FIX::message_order instance(545,805,0); return instance; }
             FIELD_SET(*this, FIX::NestedPartySubID);
             FIELD_SET(*this, FIX::NestedPartySubIDType);
           };
@@ -149,7 +157,8 @@ namespace FIX50
       class NoTradingSessions: public FIX::Group
       {
       public:
-      NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,625,0)) {}
+      NoTradingSessions() : FIX::Group(386,336,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(336,625,0); return instance; }
         FIELD_SET(*this, FIX::TradingSessionID);
         FIELD_SET(*this, FIX::TradingSessionSubID);
       };
@@ -210,7 +219,8 @@ namespace FIX50
       class NoUnderlyings: public FIX::Group
       {
       public:
-      NoUnderlyings() : FIX::Group(711,311,FIX::message_order(311,312,309,305,462,463,310,763,313,542,315,241,242,243,244,245,246,256,595,592,593,594,247,316,941,317,436,998,1000,435,308,306,362,363,307,364,365,877,878,972,318,879,975,973,974,810,882,883,884,885,886,1044,1045,1046,1038,1039,0)) {}
+      NoUnderlyings() : FIX::Group(711,311,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(311,312,309,305,462,463,310,763,313,542,315,241,242,243,244,245,246,256,595,592,593,594,247,316,941,317,436,998,1000,435,308,306,362,363,307,364,365,877,878,972,318,879,975,973,974,810,882,883,884,885,886,1044,1045,1046,1038,1039,0); return instance; }
         FIELD_SET(*this, FIX::UnderlyingSymbol);
         FIELD_SET(*this, FIX::UnderlyingSymbolSfx);
         FIELD_SET(*this, FIX::UnderlyingSecurityID);
@@ -277,7 +287,8 @@ namespace FIX50
       class NoStipulations: public FIX::Group
       {
       public:
-      NoStipulations() : FIX::Group(232,233,FIX::message_order(233,234,0)) {}
+      NoStipulations() : FIX::Group(232,233,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(233,234,0); return instance; }
         FIELD_SET(*this, FIX::StipulationType);
         FIELD_SET(*this, FIX::StipulationValue);
       };
@@ -376,7 +387,8 @@ namespace FIX50
       class NoStrategyParameters: public FIX::Group
       {
       public:
-      NoStrategyParameters() : FIX::Group(957,958,FIX::message_order(958,959,960,0)) {}
+      NoStrategyParameters() : FIX::Group(957,958,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(958,959,960,0); return instance; }
         FIELD_SET(*this, FIX::StrategyParameterName);
         FIELD_SET(*this, FIX::StrategyParameterType);
         FIELD_SET(*this, FIX::StrategyParameterValue);
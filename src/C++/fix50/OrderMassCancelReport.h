@@ -38,7 +38,8 @@ namespace FIX50
     class NoAffectedOrders: public FIX::Group
     {
     public:
-    NoAffectedOrders() : FIX::Group(534,41,FIX::message_order(41,535,536,0)) {}
+    NoAffectedOrders() : FIX::Group(534,41,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(41,535,536,0); return instance; }
       FIELD_SET(*this, FIX::OrigClOrdID);
       FIELD_SET(*this, FIX::AffectedOrderID);
       FIELD_SET(*this, FIX::AffectedSecondaryOrderID);
@@ -49,7 +50,8 @@ namespace FIX50
     class NoPartyIDs: public FIX::Group
     {
     public:
-    NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,802,0)) {}
+    NoPartyIDs() : FIX::Group(453,448,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(448,447,452,802,0); return instance; }
       FIELD_SET(*this, FIX::PartyID);
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
@@ -57,7 +59,8 @@ namespace FIX50
       class NoPartySubIDs: public FIX::Group
       {
       public:
-      NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
+      NoPartySubIDs() : FIX::Group(802,523,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(523,803,0); return instance; }
         FIELD_SET(*this, FIX::PartySubID);
         FIELD_SET(*this, FIX::PartySubIDType);
       };
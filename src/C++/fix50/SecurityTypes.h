@@ -35,7 +35,8 @@ namespace FIX50
     class NoSecurityTypes: public FIX::Group
     {
     public:
-    NoSecurityTypes() : FIX::Group(558,167,FIX::message_order(167,762,460,461,0)) {}
+    NoSecurityTypes() : FIX::Group(558,167,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(167,762,460,461,0); return instance; }
       FIELD_SET(*this, FIX::SecurityType);
       FIELD_SET(*this, FIX::SecuritySubType);
       FIELD_SET(*this, FIX::Product);
@@ -20,7 +20,8 @@ namespace FIX50
     class NoTradingSessions: public FIX::Group
     {
     public:
-    NoTradingSessions() : FIX::Group(386,336,FIX::message_order(336,625,207,338,339,325,340,567,341,342,343,344,345,387,58,354,355,0)) {}
+    NoTradingSessions() : FIX::Group(386,336,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(336,625,207,338,339,325,340,567,341,342,343,344,345,387,58,354,355,0); return instance; }
       FIELD_SET(*this, FIX::TradingSessionID);
       FIELD_SET(*this, FIX::TradingSessionSubID);
       FIELD_SET(*this, FIX::SecurityExchange);
@@ -30,7 +30,8 @@ namespace FIX50SP1
     class NoApplIDs: public FIX::Group
     {
     public:
-    NoApplIDs() : FIX::Group(1351,1355,FIX::message_order(1355,1399,1357,0)) {}
+    NoApplIDs() : FIX::Group(1351,1355,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(1355,1399,1357,0); return instance; }
       FIELD_SET(*this, FIX::RefApplID);
       FIELD_SET(*this, FIX::ApplNewSeqNum);
       FIELD_SET(*this, FIX::RefApplLastSeqNum);
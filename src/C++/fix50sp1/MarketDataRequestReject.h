@@ -27,7 +27,8 @@ namespace FIX50SP1
     class NoPartyIDs: public FIX::Group
     {
     public:
-    NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,802,0)) {}
+    NoPartyIDs() : FIX::Group(453,448,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(448,447,452,802,0); return instance; }
       FIELD_SET(*this, FIX::PartyID);
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
@@ -35,7 +36,8 @@ namespace FIX50SP1
       class NoPartySubIDs: public FIX::Group
       {
       public:
-      NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
+      NoPartySubIDs() : FIX::Group(802,523,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(523,803,0); return instance; }
         FIELD_SET(*this, FIX::PartySubID);
         FIELD_SET(*this, FIX::PartySubIDType);
       };
@@ -45,7 +47,8 @@ namespace FIX50SP1
     class NoAltMDSource: public FIX::Group
     {
     public:
-    NoAltMDSource() : FIX::Group(816,817,FIX::message_order(817,0)) {}
+    NoAltMDSource() : FIX::Group(816,817,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(817,0); return instance; }
       FIELD_SET(*this, FIX::AltMDSourceID);
     };
     FIELD_SET(*this, FIX::Text);
@@ -51,21 +51,24 @@ namespace FIX50SP1
     class NoOrdTypeRules: public FIX::Group
     {
     public:
-    NoOrdTypeRules() : FIX::Group(1237,40,FIX::message_order(40,0)) {}
+    NoOrdTypeRules() : FIX::Group(1237,40,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(40,0); return instance; }
       FIELD_SET(*this, FIX::OrdType);
     };
     FIELD_SET(*this, FIX::NoTimeInForceRules);
     class NoTimeInForceRules: public FIX::Group
     {
     public:
-    NoTimeInForceRules() : FIX::Group(1239,59,FIX::message_order(59,0)) {}
+    NoTimeInForceRules() : FIX::Group(1239,59,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(59,0); return instance; }
       FIELD_SET(*this, FIX::TimeInForce);
     };
     FIELD_SET(*this, FIX::NoExecInstRules);
     class NoExecInstRules: public FIX::Group
     {
     public:
-    NoExecInstRules() : FIX::Group(1232,1308,FIX::message_order(1308,0)) {}
+    NoExecInstRules() : FIX::Group(1232,1308,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(1308,0); return instance; }
       FIELD_SET(*this, FIX::ExecInstValue);
     };
     FIELD_SET(*this, FIX::TransactTime);
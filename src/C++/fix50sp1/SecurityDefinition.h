@@ -99,7 +99,8 @@ namespace FIX50SP1
     class NoUnderlyings: public FIX::Group
     {
     public:
-    NoUnderlyings() : FIX::Group(711,311,FIX::message_order(311,312,309,305,462,463,310,763,313,542,1213,241,242,243,244,245,246,256,595,592,593,594,247,316,941,317,436,998,1423,1424,1425,1000,1419,435,308,306,362,363,307,364,365,877,878,972,318,879,975,973,974,810,882,883,884,885,886,1044,1045,1046,1038,1039,315,0)) {}
+    NoUnderlyings() : FIX::Group(711,311,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(311,312,309,305,462,463,310,763,313,542,1213,241,242,243,244,245,246,256,595,592,593,594,247,316,941,317,436,998,1423,1424,1425,1000,1419,435,308,306,362,363,307,364,365,877,878,972,318,879,975,973,974,810,882,883,884,885,886,1044,1045,1046,1038,1039,315,0); return instance; }
       FIELD_SET(*this, FIX::UnderlyingSymbol);
       FIELD_SET(*this, FIX::UnderlyingSymbolSfx);
       FIELD_SET(*this, FIX::UnderlyingSecurityID);
@@ -170,7 +171,8 @@ namespace FIX50SP1
     class NoStipulations: public FIX::Group
     {
     public:
-    NoStipulations() : FIX::Group(232,233,FIX::message_order(233,234,0)) {}
+    NoStipulations() : FIX::Group(232,233,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(233,234,0); return instance; }
       FIELD_SET(*this, FIX::StipulationType);
       FIELD_SET(*this, FIX::StipulationValue);
     };
@@ -178,7 +180,8 @@ namespace FIX50SP1
     class NoLegs: public FIX::Group
     {
     public:
-    NoLegs() : FIX::Group(555,600,FIX::message_order(600,601,602,603,607,608,609,764,610,611,1212,248,249,250,251,252,253,257,599,596,597,598,254,612,942,613,614,999,1224,1421,1422,1001,1420,615,616,617,618,619,620,621,622,623,624,556,740,739,955,956,1358,1017,0)) {}
+    NoLegs() : FIX::Group(555,600,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(600,601,602,603,607,608,609,764,610,611,1212,248,249,250,251,252,253,257,599,596,597,598,254,612,942,613,614,999,1224,1421,1422,1001,1420,615,616,617,618,619,620,621,622,623,624,556,740,739,955,956,1358,1017,0); return instance; }
       FIELD_SET(*this, FIX::LegSymbol);
       FIELD_SET(*this, FIX::LegSymbolSfx);
       FIELD_SET(*this, FIX::LegSecurityID);
@@ -248,14 +251,16 @@ namespace FIX50SP1
     class NoMarketSegments: public FIX::Group
     {
     public:
-    NoMarketSegments() : FIX::Group(1310,1301,FIX::message_order(1301,1300,1201,0)) {}
+    NoMarketSegments() : FIX::Group(1310,1301,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(1301,1300,1201,0); return instance; }
       FIELD_SET(*this, FIX::MarketID);
       FIELD_SET(*this, FIX::MarketSegmentID);
       FIELD_SET(*this, FIX::NoStrikeRules);
       class NoStrikeRules: public FIX::Group
       {
       public:
-      NoStrikeRules() : FIX::Group(1201,1223,FIX::message_order(1223,1202,1203,1204,1304,1236,0)) {}
+      NoStrikeRules() : FIX::Group(1201,1223,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(1223,1202,1203,1204,1304,1236,0); return instance; }
         FIELD_SET(*this, FIX::StrikeRuleID);
         FIELD_SET(*this, FIX::StartStrikePxRange);
         FIELD_SET(*this, FIX::EndStrikePxRange);
@@ -265,7 +270,8 @@ namespace FIX50SP1
         class NoMaturityRules: public FIX::Group
         {
         public:
-        NoMaturityRules() : FIX::Group(1236,1222,FIX::message_order(1222,1303,1302,1241,1226,1229,0)) {}
+        NoMaturityRules() : FIX::Group(1236,1222,order()) {}
+        static const FIX::message_order& order() { static const FIX::message_order instance(1222,1303,1302,1241,1226,1229,0); return instance; }
           FIELD_SET(*this, FIX::MaturityRuleID);
           FIELD_SET(*this, FIX::MaturityMonthYearFormat);
           FIELD_SET(*this, FIX::MaturityMonthYearIncrementUnits);
@@ -40,7 +40,8 @@ namespace FIX50SP1
     class NoSettlOblig: public FIX::Group
     {
     public:
-    NoSettlOblig() : FIX::Group(1165,430,FIX::message_order(430,1161,1162,1163,1157,119,15,120,155,64,55,65,48,22,460,1227,1151,461,167,762,200,541,1079,966,1049,965,224,225,239,226,227,228,255,543,470,471,472,240,202,947,967,968,206,231,969,1146,996,1147,1191,1192,1193,1194,1195,1196,1197,1198,1199,1200,201,1244,1242,997,223,207,970,971,106,348,349,107,350,351,691,667,875,876,873,874,453,168,126,779,1158,0)) {}
+    NoSettlOblig() : FIX::Group(1165,430,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(430,1161,1162,1163,1157,119,15,120,155,64,55,65,48,22,460,1227,1151,461,167,762,200,541,1079,966,1049,965,224,225,239,226,227,228,255,543,470,471,472,240,202,947,967,968,206,231,969,1146,996,1147,1191,1192,1193,1194,1195,1196,1197,1198,1199,1200,201,1244,1242,997,223,207,970,971,106,348,349,107,350,351,691,667,875,876,873,874,453,168,126,779,1158,0); return instance; }
       FIELD_SET(*this, FIX::NetGrossInd);
       FIELD_SET(*this, FIX::SettlObligID);
       FIELD_SET(*this, FIX::SettlObligTransType);
@@ -123,7 +124,8 @@ namespace FIX50SP1
       class NoPartyIDs: public FIX::Group
       {
       public:
-      NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,802,0)) {}
+      NoPartyIDs() : FIX::Group(453,448,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(448,447,452,802,0); return instance; }
         FIELD_SET(*this, FIX::PartyID);
         FIELD_SET(*this, FIX::PartyIDSource);
         FIELD_SET(*this, FIX::PartyRole);
@@ -131,7 +133,8 @@ namespace FIX50SP1
         class NoPartySubIDs: public FIX::Group
         {
         public:
-        NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
+        NoPartySubIDs() : FIX::Group(802,523,order()) {}
+        static const FIX::message_order& order() { static const FIX::message_order instance(523,803,0); return instance; }
           FIELD_SET(*this, FIX::PartySubID);
           FIELD_SET(*this, FIX::PartySubIDType);
         };
@@ -143,13 +146,15 @@ namespace FIX50SP1
       class NoSettlDetails: public FIX::Group
       {
       public:
-      NoSettlDetails() : FIX::Group(1158,1164,FIX::message_order(1164,781,0)) {}
+      NoSettlDetails() : FIX::Group(1158,1164,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(1164,781,0); return instance; }
         FIELD_SET(*this, FIX::SettlObligSource);
         FIELD_SET(*this, FIX::NoSettlPartyIDs);
         class NoSettlPartyIDs: public FIX::Group
         {
         public:
-        NoSettlPartyIDs() : FIX::Group(781,782,FIX::message_order(782,783,784,801,0)) {}
+        NoSettlPartyIDs() : FIX::Group(781,782,order()) {}
+        static const FIX::message_order& order() { static const FIX::message_order instance(782,783,784,801,0); return instance; }
           FIELD_SET(*this, FIX::SettlPartyID);
           FIELD_SET(*this, FIX::SettlPartyIDSource);
           FIELD_SET(*this, FIX::SettlPartyRole);
@@ -157,7 +162,8 @@ namespace FIX50SP1
           class NoSettlPartySubIDs: public FIX::Group
           {
           public:
-          NoSettlPartySubIDs() : FIX::Group(801,785,FIX::message_order(785,786,0)) {}
+          NoSettlPartySubIDs() : FIX::Group(801,785,order()) {}
+          static const FIX::message_order& order() { static const FIX::message_order instance(785,786,0); return instance; }
             FIELD_SET(*this, FIX::SettlPartySubID);
             FIELD_SET(*this, FIX::SettlPartySubIDType);
           };
@@ -40,7 +40,8 @@ namespace FIX50SP2
     class NoPartyIDs: public FIX::Group
     {
     public:
-    NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,802,0)) {}
+    NoPartyIDs() : FIX::Group(453,448,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(448,447,452,802,0); return instance; }
       FIELD_SET(*this, FIX::PartyID);
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
@@ -48,7 +49,8 @@ namespace FIX50SP2
       class NoPartySubIDs: public FIX::Group
       {
       public:
-      NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
+      NoPartySubIDs() : FIX::Group(802,523,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(523,803,0); return instance; }
         FIELD_SET(*this, FIX::PartySubID);
         FIELD_SET(*this, FIX::PartySubIDType);
       };
@@ -212,7 +214,8 @@ namespace FIX50SP2
     class NoTargetPartyIDs: public FIX::Group
     {
     public:
-    NoTargetPartyIDs() : FIX::Group(1461,1462,FIX::message_order(1462,1463,1464,0)) {}
+    NoTargetPartyIDs() : FIX::Group(1461,1462,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(1462,1463,1464,0); return instance; }
       FIELD_SET(*this, FIX::TargetPartyID);
       FIELD_SET(*this, FIX::TargetPartyIDSource);
       FIELD_SET(*this, FIX::TargetPartyRole);
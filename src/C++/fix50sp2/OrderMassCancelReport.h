@@ -41,7 +41,8 @@ namespace FIX50SP2
     class NoAffectedOrders: public FIX::Group
     {
     public:
-    NoAffectedOrders() : FIX::Group(534,41,FIX::message_order(41,535,536,0)) {}
+    NoAffectedOrders() : FIX::Group(534,41,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(41,535,536,0); return instance; }
       FIELD_SET(*this, FIX::OrigClOrdID);
       FIELD_SET(*this, FIX::AffectedOrderID);
       FIELD_SET(*this, FIX::AffectedSecondaryOrderID);
@@ -50,7 +51,8 @@ namespace FIX50SP2
     class NoNotAffectedOrders: public FIX::Group
     {
     public:
-    NoNotAffectedOrders() : FIX::Group(1370,1372,FIX::message_order(1372,1371,0)) {}
+    NoNotAffectedOrders() : FIX::Group(1370,1372,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(1372,1371,0); return instance; }
       FIELD_SET(*this, FIX::NotAffOrigClOrdID);
       FIELD_SET(*this, FIX::NotAffectedOrderID);
     };
@@ -60,7 +62,8 @@ namespace FIX50SP2
     class NoPartyIDs: public FIX::Group
     {
     public:
-    NoPartyIDs() : FIX::Group(453,448,FIX::message_order(448,447,452,802,0)) {}
+    NoPartyIDs() : FIX::Group(453,448,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(448,447,452,802,0); return instance; }
       FIELD_SET(*this, FIX::PartyID);
       FIELD_SET(*this, FIX::PartyIDSource);
       FIELD_SET(*this, FIX::PartyRole);
@@ -68,7 +71,8 @@ namespace FIX50SP2
       class NoPartySubIDs: public FIX::Group
       {
       public:
-      NoPartySubIDs() : FIX::Group(802,523,FIX::message_order(523,803,0)) {}
+      NoPartySubIDs() : FIX::Group(802,523,order()) {}
+      static const FIX::message_order& order() { static const FIX::message_order instance(523,803,0); return instance; }
         FIELD_SET(*this, FIX::PartySubID);
         FIELD_SET(*this, FIX::PartySubIDType);
       };
@@ -234,7 +238,8 @@ namespace FIX50SP2
     class NoTargetPartyIDs: public FIX::Group
     {
     public:
-    NoTargetPartyIDs() : FIX::Group(1461,1462,FIX::message_order(1462,1463,1464,0)) {}
+    NoTargetPartyIDs() : FIX::Group(1461,1462,order()) {}
+    static const FIX::message_order& order() { static const FIX::message_order instance(1462,1463,1464,0); return instance; }
       FIELD_SET(*this, FIX::TargetPartyID);
       FIELD_SET(*this, FIX::TargetPartyIDSource);
       FIELD_SET(*this, FIX::TargetPartyRole);
@@ -0,0 +1,186 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <ConnectScheduler.h>
+
+using namespace FIX;
+
+SUITE(ConnectSchedulerTests)
+{
+
+static SessionID session( const char* target )
+{
+  return SessionID( BeginString( "FIX.4.2" ), SenderCompID( "TW" ), TargetCompID( target ) );
+}
+
+TEST(dueInOrder)
+{
+  ConnectScheduler object;
+  object.add( session( "A" ), "host", 30, 10 );
+  object.add( session( "B" ), "host", 30, 5 );
+  object.add( session( "C" ), "host", 30, 20 );
+
+  SessionID sessionID;
+  CHECK( !object.next( 4, sessionID ) );
+  CHECK( object.next( 10, sessionID ) );
+  CHECK_EQUAL( session( "B" ), sessionID );
+  CHECK( object.next( 10, sessionID ) );
+  CHECK_EQUAL( session( "A" ), sessionID );
+  CHECK( !object.next( 10, sessionID ) );
+  CHECK_EQUAL( 20, object.getNextAttempt( session( "C" ) ) );
+}
+
+TEST(backoff)
+{
+  ConnectScheduler object;
+  object.setMaxInterval( 8 );
+  object.add( session( "A" ), "host", 1, 0 );
+
+  // each failed attempt doubles the wait up to the limit
+  SessionID sessionID;
+  time_t now = 0;
+  const time_t waits[] = { 2, 4, 8, 8 };
+  for( int i = 0; i < 4; ++i )
+  {
+    CHECK( object.next( now, sessionID ) );
+    object.pending( sessionID, now );
+    object.disconnected( sessionID, now );
+    CHECK_EQUAL( i + 1, object.getFailures( sessionID ) );
+    CHECK_EQUAL( now + waits[ i ], object.getNextAttempt( sessionID ) );
+    now = object.getNextAttempt( sessionID );
+  }
+
+  // a connection dropped before logon still counts as a failure
+  CHECK( object.next( now, sessionID ) );
+  object.pending( sessionID, now );
+  object.connected( sessionID, now );
+  CHECK_EQUAL( 4, object.getFailures( sessionID ) );
+  CHECK_EQUAL( 1U, object.getAwaitingLogon().count( sessionID ) );
+  object.disconnected( sessionID, now );
+  CHECK_EQUAL( 5, object.getFailures( sessionID ) );
+  CHECK_EQUAL( now + 8, object.getNextAttempt( sessionID ) );
+  CHECK( object.getAwaitingLogon().empty() );
+  now = object.getNextAttempt( sessionID );
+
+  // a logon starts the count again
+  CHECK( object.next( now, sessionID ) );
+  object.pending( sessionID, now );
+  object.connected( sessionID, now );
+  object.loggedOn( sessionID );
+  CHECK_EQUAL( 0, object.getFailures( sessionID ) );
+  CHECK( object.getAwaitingLogon().empty() );
+  object.disconnected( sessionID, now );
+  CHECK_EQUAL( 0, object.getFailures( sessionID ) );
+  CHECK_EQUAL( now + 1, object.getNextAttempt( sessionID ) );
+}
+
+TEST(jitter)
+{
+  ConnectScheduler object;
+  object.setJitter( 5 );
+  object.add( session( "A" ), "host", 10, 0 );
+
+  SessionID sessionID;
+  CHECK( object.next( 0, sessionID ) );
+  object.pending( sessionID, 0 );
+  object.connected( sessionID, 0 );
+  object.loggedOn( sessionID );
+  object.disconnected( sessionID, 100 );
+  CHECK( object.getNextAttempt( sessionID ) >= 110 );
+  CHECK( object.getNextAttempt( sessionID ) <= 115 );
+}
+
+TEST(hostLimit)
+{
+  ConnectScheduler object;
+  object.setHostLimit( 1 );
+  object.add( session( "A" ), "host", 30, 0 );
+  object.add( session( "B" ), "host", 30, 0 );
+  object.add( session( "C" ), "other", 30, 0 );
+
+  SessionID first;
+  CHECK( object.next( 0, first ) );
+  object.pending( first, 0 );
+
+  // the other session on the busy host waits for the attempt in flight
+  SessionID sessionID;
+  CHECK( object.next( 0, sessionID ) );
+  CHECK_EQUAL( session( "C" ), sessionID );
+  object.pending( sessionID, 0 );
+  CHECK( !object.next( 0, sessionID ) );
+
+  object.connected( first, 3 );
+  CHECK( object.next( 3, sessionID ) );
+  CHECK( sessionID.getTargetCompID() != first.getTargetCompID() );
+  CHECK( sessionID.getTargetCompID() != "C" );
+}
+
+TEST(retry)
+{
+  ConnectScheduler object;
+  object.add( session( "A" ), "host", 30, 0 );
+
+  // a session that could not start is not counted as a failure
+  SessionID sessionID;
+  CHECK( object.next( 0, sessionID ) );
+  object.retry( sessionID, 0 );
+  CHECK_EQUAL( 0, object.getFailures( sessionID ) );
+  CHECK_EQUAL( 30, object.getNextAttempt( sessionID ) );
+
+  // nor is one that started in the meantime moved
+  CHECK( object.next( 30, sessionID ) );
+  object.pending( sessionID, 30 );
+  object.retry( sessionID, 30 );
+  CHECK_EQUAL( 0, object.getNextAttempt( sessionID ) );
+  CHECK( !object.next( 100, sessionID ) );
+}
+
+TEST(wake)
+{
+  ConnectScheduler object;
+  object.setHostLimit( 1 );
+  object.add( session( "A" ), "host", 30, 0 );
+  object.add( session( "B" ), "host", 30, 100 );
+
+  SessionID sessionID;
+  CHECK( object.next( 0, sessionID ) );
+  object.pending( sessionID, 0 );
+
+  // a woken session is due again but still waits for room on its host
+  object.wake( session( "B" ), 5 );
+  CHECK_EQUAL( 5, object.getNextAttempt( session( "B" ) ) );
+  CHECK( !object.next( 5, sessionID ) );
+  object.connected( session( "A" ), 6 );
+  CHECK( object.next( 6, sessionID ) );
+  CHECK( sessionID == session( "B" ) );
+
+  // only a session waiting out its interval is moved
+  object.wake( sessionID, 6 );
+  CHECK_EQUAL( 0, object.getNextAttempt( sessionID ) );
+}
+
+}
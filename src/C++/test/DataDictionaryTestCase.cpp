@@ -349,6 +349,30 @@ TEST_FIXTURE( checkValidFormatFixture, checkValidFormat )
   CHECK_THROW( object.validate( FIX::INCOMING_DIRECTION, message ), IncorrectDataFormat );
 }
 
+TEST_FIXTURE( checkValidFormatFixture, lazyValidationDefersFormat )
+{
+  ValidationRules vr;
+  vr.setValidateFieldsOutOfOrder( true );
+  vr.setValidateFieldsHaveValues( true );
+  vr.setValidateUserDefinedFields( true );
+  vr.setValidateLazily( true );
+
+  FIX40::TestRequest message;
+  message.setField( TestReqID( "+200" ) );
+  object.validate( FIX::INCOMING_DIRECTION, message, &vr );
+
+  FIX::IntField testReqID( FIELD::TestReqID );
+  message.getField( testReqID );
+  CHECK_THROW( testReqID.getValue(), IncorrectDataFormat );
+
+  message.setField( TestReqID( "" ) );
+  CHECK_THROW( object.validate( FIX::INCOMING_DIRECTION, message, &vr ), NoTagValue );
+
+  message.setField( TestReqID( "+200" ) );
+  vr.setValidateLazily( false );
+  CHECK_THROW( object.validate( FIX::INCOMING_DIRECTION, message, &vr ), IncorrectDataFormat );
+}
+
 struct checkValueFixture
 {
   checkValueFixture()
@@ -392,6 +416,35 @@ TEST_FIXTURE( checkValueFixture, checkValue )
   object.validate( FIX::INCOMING_DIRECTION, message );
 }
 
+TEST_FIXTURE( checkValueFixture, lazyValidationDefersValues )
+{
+  FIX40::NewOrderSingle message;
+  message.setField( OrdType( '2' ) );
+  message.setField( OrderRestrictions( "1" ) );
+  CHECK_THROW( object.validate( FIX::INCOMING_DIRECTION, message ), IncorrectTagValue );
+
+  ValidationRules vr;
+  vr.setValidateFieldsOutOfOrder( true );
+  vr.setValidateFieldsHaveValues( true );
+  vr.setValidateUserDefinedFields( true );
+  vr.setValidateLazily( true );
+  object.validate( FIX::INCOMING_DIRECTION, message, &vr );
+
+  // the value is rejected when the field is first read
+  OrdType ordType;
+  CHECK_THROW( message.getField( ordType ), IncorrectTagValue );
+  CHECK_THROW( message.getFieldRef( FIELD::OrdType ), IncorrectTagValue );
+  OrderRestrictions orderRestrictions;
+  message.getField( orderRestrictions );
+  CHECK_EQUAL( "1", orderRestrictions );
+
+  DataDictionary::validate( FIX::INCOMING_DIRECTION, message, &object, &object, 0, true );
+  CHECK_THROW( message.getField( ordType ), IncorrectTagValue );
+
+  // a full validation still checks everything up front
+  CHECK_THROW( object.validate( FIX::INCOMING_DIRECTION, message ), IncorrectTagValue );
+}
+
 TEST( checkRepeatedTag )
 {
   DataDictionary object;
@@ -497,6 +550,61 @@ TEST( checkGroupRequiredFields )
   object.validate( FIX::INCOMING_DIRECTION, message, &vr );
 }
 
+TEST( validateAdminMessages )
+{
+  DataDictionary object( "../spec/FIX42.xml" );
+  ValidationRules vr;
+  vr.setShouldValidate(false);
+  Message message;
+
+  message.setString(FIX::INCOMING_DIRECTION, "8=FIX.4.2\0019=49\00135=0\00149=TW\00156=ISLD\00134=2\00152=20050225-16:54:32\00110=000\001", &vr, &object);
+  object.validate( FIX::INCOMING_DIRECTION, message );
+
+  message.setString(FIX::INCOMING_DIRECTION, "8=FIX.4.2\0019=55\00135=1\00149=TW\00156=ISLD\00134=2\00152=20050225-16:54:32\001112=\00110=000\001", &vr, &object);
+  CHECK_THROW( object.validate( FIX::INCOMING_DIRECTION, message ), NoTagValue );
+
+  message.setString(FIX::INCOMING_DIRECTION, "8=FIX.4.2\0019=49\00135=0\00149=TW\00156=ISLD\00134=x\00152=20050225-16:54:32\00110=000\001", &vr, &object);
+  CHECK_THROW( object.validate( FIX::INCOMING_DIRECTION, message ), IncorrectDataFormat );
+
+  message.setString(FIX::INCOMING_DIRECTION, "8=FIX.4.2\0019=55\00135=0\00149=TW\00156=ISLD\00134=2\00152=20050225-16:54:32\00158=hi\00110=000\001", &vr, &object);
+  CHECK_THROW( object.validate( FIX::INCOMING_DIRECTION, message ), TagNotDefinedForMessage );
+
+  message.setString(FIX::INCOMING_DIRECTION, "8=FIX.4.2\0019=62\00135=A\00149=TW\00156=ISLD\00134=1\00152=20050225-16:54:32\00198=0\001108=30\00110=000\001", &vr, &object);
+  object.validate( FIX::INCOMING_DIRECTION, message );
+
+  message.setString(FIX::INCOMING_DIRECTION, "8=FIX.4.2\0019=62\00135=A\00149=TW\00156=ISLD\00134=1\00152=20050225-16:54:32\00198=9\001108=30\00110=000\001", &vr, &object);
+  CHECK_THROW( object.validate( FIX::INCOMING_DIRECTION, message ), IncorrectTagValue );
+
+  message.setString(FIX::INCOMING_DIRECTION, "8=FIX.4.2\0019=55\00135=A\00149=TW\00156=ISLD\00134=1\00152=20050225-16:54:32\00198=0\00110=000\001", &vr, &object);
+  CHECK_THROW( object.validate( FIX::INCOMING_DIRECTION, message ), RequiredTagMissing );
+}
+
+TEST( validateAdminMessagesFromLayouts )
+{
+  DataDictionary object( "../spec/FIX42.xml" );
+  ValidationRules vr;
+  vr.setShouldValidate(false);
+  Message message;
+
+  message.setString(FIX::INCOMING_DIRECTION, "8=FIX.4.2\0019=49\00135=0\00149=TW\00156=ISLD\00134=2\00152=20050225-16:54:32\00110=000\001", &vr, &object);
+  CHECK( object.isValidAdmin( message ) );
+  message.setString(FIX::INCOMING_DIRECTION, "8=FIX.4.2\0019=49\00135=0\00149=TW\00156=ISLD\00134=x\00152=20050225-16:54:32\00110=000\001", &vr, &object);
+  CHECK( !object.isValidAdmin( message ) );
+  message.setString(FIX::INCOMING_DIRECTION, "8=FIX.4.2\0019=49\00135=D\00149=TW\00156=ISLD\00134=2\00152=20050225-16:54:32\00110=000\001", &vr, &object);
+  CHECK( !object.isValidAdmin( message ) );
+
+  // FIXT sessions validate admin messages against the transport dictionary
+  DataDictionary transport( "../spec/FIXT11.xml" );
+  message.setString(FIX::INCOMING_DIRECTION, "8=FIXT.1.1\0019=49\00135=0\00149=TW\00156=ISLD\00134=2\00152=20050225-16:54:32\00110=000\001", &vr, &transport);
+  CHECK( transport.isValidAdmin( message ) );
+  transport.validate( FIX::INCOMING_DIRECTION, message );
+  message.setString(FIX::INCOMING_DIRECTION, "8=FIXT.1.1\0019=62\00135=A\00149=TW\00156=ISLD\00134=1\00152=20050225-16:54:32\00198=0\001108=30\0011137=9\00110=000\001", &vr, &transport);
+  CHECK( transport.isValidAdmin( message ) );
+  message.setString(FIX::INCOMING_DIRECTION, "8=FIXT.1.1\0019=62\00135=A\00149=TW\00156=ISLD\00134=1\00152=20050225-16:54:32\00198=9\001108=30\0011137=9\00110=000\001", &vr, &transport);
+  CHECK( !transport.isValidAdmin( message ) );
+  CHECK_THROW( transport.validate( FIX::INCOMING_DIRECTION, message ), IncorrectTagValue );
+}
+
 TEST( readFromFile )
 {
   DataDictionary object( "../spec/FIX43.xml" );
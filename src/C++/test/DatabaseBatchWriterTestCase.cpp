@@ -0,0 +1,124 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <DatabaseBatchWriter.h>
+
+using namespace FIX;
+
+SUITE(DatabaseBatchWriterTests)
+{
+
+// stands in for a database connection, recording each batch it is handed
+struct recordingSink : public DatabaseBatchSink < int >
+{
+  recordingSink() : delay( 0 ) {}
+
+  void write( const std::vector < int > & batch )
+  {
+    if( delay ) process_sleep( delay );
+    Locker locker( mutex );
+    batches.push_back( batch );
+  }
+
+  std::vector < int > written()
+  {
+    Locker locker( mutex );
+    std::vector < int > result;
+    for( size_t i = 0; i < batches.size(); ++i )
+      result.insert( result.end(), batches[i].begin(), batches[i].end() );
+    return result;
+  }
+
+  size_t largestBatch()
+  {
+    Locker locker( mutex );
+    size_t result = 0;
+    for( size_t i = 0; i < batches.size(); ++i )
+      if( batches[i].size() > result ) result = batches[i].size();
+    return result;
+  }
+
+  double delay;
+  Mutex mutex;
+  std::vector < std::vector < int > > batches;
+};
+
+TEST(flushWritesInBatches)
+{
+  recordingSink sink;
+  DatabaseBatchWriter < int > writer( sink, 60000, 2, 100 );
+  for( int i = 0; i < 5; ++i )
+    writer.push( i );
+  writer.flush();
+
+  std::vector < int > written = sink.written();
+  CHECK_EQUAL( 5U, written.size() );
+  for( int i = 0; i < 5; ++i )
+    CHECK_EQUAL( i, written[i] );
+  CHECK_EQUAL( 2U, sink.largestBatch() );
+  CHECK_EQUAL( 0U, writer.size() );
+}
+
+TEST(flushIntervalWritesPartialBatch)
+{
+  recordingSink sink;
+  DatabaseBatchWriter < int > writer( sink, 10, 100, 1000 );
+  writer.push( 1 );
+
+  for( int i = 0; i < 200 && sink.written().empty(); ++i )
+    process_sleep( 0.01 );
+  CHECK_EQUAL( 1U, sink.written().size() );
+}
+
+TEST(destructorDrainsQueue)
+{
+  recordingSink sink;
+  {
+    DatabaseBatchWriter < int > writer( sink, 60000, 100, 1000 );
+    writer.push( 1 );
+    writer.push( 2 );
+    writer.push( 3 );
+  }
+  CHECK_EQUAL( 3U, sink.written().size() );
+}
+
+TEST(pushBlocksAtQueueSize)
+{
+  recordingSink sink;
+  sink.delay = 0.005;
+  DatabaseBatchWriter < int > writer( sink, 1, 2, 4 );
+  for( int i = 0; i < 20; ++i )
+  {
+    writer.push( i );
+    CHECK( writer.size() <= 4 );
+  }
+  writer.flush();
+  CHECK_EQUAL( 20U, sink.written().size() );
+}
+
+}
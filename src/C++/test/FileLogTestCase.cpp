@@ -121,4 +121,36 @@ TEST_FIXTURE(generateFileNameFixture, generateFileName)
   CHECK( file_exists("log/backup/FIX.4.2-GENERATEFILENAME-TEST.event.backup.4.log") );
   CHECK( file_exists("log/backup/FIX.4.2-GENERATEFILENAME-TEST.messages.backup.4.log") );
 }
+
+TEST(executorWrites)
+{
+  deleteLogSession( "EXECUTOR", "TEST" );
+  SessionID sessionID( BeginString( "FIX.4.2" ),
+                       SenderCompID( "EXECUTOR" ), TargetCompID( "TEST" ) );
+
+  {
+    IOExecutor executor( 1 );
+    FileLog log( "log", sessionID );
+    log.setExecutor( &executor );
+    log.onIncoming( "INCOMING1" );
+    log.onOutgoing( "OUTGOING1" );
+    log.onEvent( "EVENT1" );
+  }
+
+  // lines reach the files in the order they were logged
+  std::ifstream messages( "log/FIX.4.2-EXECUTOR-TEST.messages.current.log" );
+  std::string line;
+  CHECK( !std::getline( messages, line ).fail() );
+  CHECK( line.find( " received: INCOMING1" ) != std::string::npos );
+  CHECK( !std::getline( messages, line ).fail() );
+  CHECK( line.find( " sent: OUTGOING1" ) != std::string::npos );
+  messages.close();
+
+  std::ifstream events( "log/FIX.4.2-EXECUTOR-TEST.event.current.log" );
+  CHECK( !std::getline( events, line ).fail() );
+  CHECK( line.find( " : EVENT1" ) != std::string::npos );
+  events.close();
+
+  deleteLogSession( "EXECUTOR", "TEST" );
+}
 }
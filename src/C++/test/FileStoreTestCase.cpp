@@ -93,6 +93,29 @@ TEST_FIXTURE(resetBeforeAndAfterFileStoreFixture, setGetWithQuote)
   CHECK_MESSAGE_STORE_SET_GET_WITH_QUOTE;
 }
 
+TEST_FIXTURE(resetBeforeAndAfterFileStoreFixture, cursor)
+{
+  CHECK_MESSAGE_STORE_CURSOR
+}
+
+TEST_FIXTURE(resetBeforeAndAfterFileStoreFixture, cursorAfterReset)
+{
+  object->set( 1, "message1" );
+  object->set( 2, "message2" );
+
+  std::string msg;
+  std::unique_ptr<MessageStoreCursor> pCursor( object->cursor( 1, 2 ) );
+  CHECK( pCursor->next( msg ) );
+  object->refresh();
+  CHECK( !pCursor->next( msg ) );
+
+  pCursor.reset( object->cursor( 1, 2 ) );
+  CHECK( pCursor->next( msg ) );
+  CHECK_EQUAL( "message1", msg );
+  object->reset();
+  CHECK( !pCursor->next( msg ) );
+}
+
 TEST_FIXTURE(resetBeforeFileStoreFixture, other)
 {
   CHECK_MESSAGE_STORE_OTHER
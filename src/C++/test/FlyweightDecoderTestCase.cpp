@@ -0,0 +1,187 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <FlyweightDecoder.h>
+#include <fix44/ExecutionReportDecoder.h>
+#include <fix44/MarketDataIncrementalRefresh.h>
+#include <fix44/MarketDataIncrementalRefreshDecoder.h>
+
+using namespace FIX;
+
+SUITE(FlyweightDecoderTests)
+{
+
+TEST(fieldCursor)
+{
+  std::string message = "8=FIX.4.4\0019=12\00195=3\00196=a\001c\001";
+  FieldCursor cursor( message.data(), message.data() + message.size() );
+  CHECK_EQUAL( 8, cursor.tag() );
+  CHECK_EQUAL( "FIX.4.4", cursor.value().str() );
+  cursor.next();
+  CHECK_EQUAL( 12, cursor.getInt() );
+  cursor.next();
+  CHECK_EQUAL( 95, cursor.tag() );
+  cursor.setDataLength( 96, cursor.getInt() );
+  cursor.next();
+  CHECK_EQUAL( "a\001c", cursor.value().str() );
+  CHECK_THROW( cursor.getInt(), IncorrectDataFormat );
+  cursor.next();
+  CHECK( !cursor.valid() );
+
+  message = "8=FIX.4.4\0019=12";
+  FieldCursor truncated( message.data(), message.data() + message.size() );
+  CHECK_THROW( truncated.next(), InvalidMessage );
+}
+
+TEST(inlineVector)
+{
+  struct Entry
+  {
+    Entry() : cleared( false ) {}
+    void clear() { cleared = true; }
+    bool cleared;
+  };
+
+  InlineVector< Entry, 2 > object;
+  CHECK( object.empty() );
+  for( int i = 0; i < 5; ++i )
+    CHECK( object.push_back().cleared );
+  CHECK_EQUAL( 5U, object.size() );
+  CHECK( object[ 4 ].cleared );
+  object.clear();
+  CHECK( object.empty() );
+}
+
+TEST(decodeExecutionReport)
+{
+  // built from the base message, the generated class would clash with
+  // the FIX42 one other tests use unqualified
+  MsgType msgType( MsgType_ExecutionReport );
+  FIX44::Message executionReport( msgType );
+  executionReport.getHeader().setField( MsgSeqNum( 7 ) );
+  executionReport.setField( OrderID( "ORDER" ) );
+  executionReport.setField( ExecID( "EXEC" ) );
+  executionReport.setField( ExecType( ExecType_TRADE ) );
+  executionReport.setField( OrdStatus( OrdStatus_FILLED ) );
+  executionReport.setField( Side( Side_BUY ) );
+  executionReport.setField( LeavesQty( 0 ) );
+  executionReport.setField( CumQty( 100 ) );
+  executionReport.setField( AvgPx( 10.5 ) );
+  executionReport.setField( LastPx( 10.5 ) );
+  executionReport.setField( Text( "filled" ) );
+
+  Group contraBroker( FIELD::NoContraBrokers, FIELD::ContraBroker );
+  contraBroker.setField( ContraBroker( "BROKER1" ) );
+  contraBroker.setField( ContraTradeQty( 60 ) );
+  executionReport.addGroup( contraBroker );
+  contraBroker.setField( ContraBroker( "BROKER2" ) );
+  contraBroker.setField( ContraTradeQty( 40 ) );
+  executionReport.addGroup( contraBroker );
+
+  std::string raw = executionReport.toString();
+  FIX44::ExecutionReportDecoder object;
+  object.decode( raw );
+
+  CHECK_EQUAL( 7, object.getMsgSeqNum() );
+  CHECK( object.getOrderID() == "ORDER" );
+  CHECK_EQUAL( ExecType_TRADE, object.getExecType() );
+  CHECK_EQUAL( Side_BUY, object.getSide() );
+  CHECK_EQUAL( 100, object.getCumQty() );
+  CHECK_EQUAL( 10.5, object.getLastPx() );
+  CHECK_EQUAL( "filled", object.getText().str() );
+  CHECK( !object.isSetPrice() );
+  CHECK_THROW( object.getPrice(), FieldNotFound );
+
+  CHECK_EQUAL( 2U, object.getNoContraBrokers().size() );
+  CHECK_EQUAL( "BROKER2", object.getNoContraBrokers()[ 1 ].getContraBroker().str() );
+  CHECK_EQUAL( 40, object.getNoContraBrokers()[ 1 ].getContraTradeQty() );
+
+  DataDictionary dataDictionary( "../spec/FIX44.xml" );
+  Message message;
+  object.toMessage( message, &dataDictionary );
+  CHECK_EQUAL( raw, message.toString() );
+
+  FIX44::MarketDataIncrementalRefreshDecoder wrongType;
+  CHECK_THROW( wrongType.decode( raw ), InvalidMessageType );
+}
+
+TEST(decodeGroupCountMismatch)
+{
+  MsgType msgType( MsgType_ExecutionReport );
+  FIX44::Message executionReport( msgType );
+  executionReport.setField( OrderID( "ORDER" ) );
+  Group contraBroker( FIELD::NoContraBrokers, FIELD::ContraBroker );
+  contraBroker.setField( ContraBroker( "BROKER1" ) );
+  executionReport.addGroup( contraBroker );
+  contraBroker.setField( ContraBroker( "BROKER2" ) );
+  executionReport.addGroup( contraBroker );
+
+  std::string raw = executionReport.toString();
+  std::string::size_type count = raw.find( "\001382=2\001" );
+  CHECK( count != std::string::npos );
+  FIX44::ExecutionReportDecoder object;
+
+  raw[ count + 5 ] = '3';
+  CHECK_THROW( object.decode( raw ), RepeatingGroupCountMismatch );
+  raw[ count + 5 ] = '1';
+  CHECK_THROW( object.decode( raw ), RepeatingGroupCountMismatch );
+  raw[ count + 5 ] = 'x';
+  CHECK_THROW( object.decode( raw ), IncorrectDataFormat );
+  raw[ count + 5 ] = '2';
+  object.decode( raw );
+  CHECK_EQUAL( 2U, object.getNoContraBrokers().size() );
+}
+
+TEST(decodeMarketDataIncrementalRefresh)
+{
+  FIX44::MarketDataIncrementalRefresh refresh;
+  FIX44::MarketDataIncrementalRefresh::NoMDEntries entry;
+  for( int i = 0; i < 12; ++i )
+  {
+    entry.set( MDUpdateAction( MDUpdateAction_NEW ) );
+    entry.set( MDEntryType( MDEntryType_BID ) );
+    entry.set( Symbol( "QQQQ" ) );
+    entry.set( MDEntryPx( 40 + i ) );
+    entry.set( MDEntrySize( 100 ) );
+    refresh.addGroup( entry );
+  }
+
+  std::string raw = refresh.toString();
+  FIX44::MarketDataIncrementalRefreshDecoder object;
+  object.decode( raw );
+  object.decode( raw );
+
+  const FIX44::MarketDataIncrementalRefreshDecoder::NoMDEntriesEntries& entries =
+    object.getNoMDEntries();
+  CHECK_EQUAL( 12U, entries.size() );
+  CHECK_EQUAL( 51, entries[ 11 ].getMDEntryPx() );
+  CHECK_EQUAL( "QQQQ", entries[ 11 ].getSymbol().str() );
+  CHECK( !entries[ 11 ].isSetMDEntryID() );
+}
+
+}
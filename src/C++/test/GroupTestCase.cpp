@@ -51,4 +51,66 @@ TEST(copy)
   CHECK_EQUAL( originalString, copyString );
 }
 
+TEST(move)
+{
+  Group object(1, 10, message_order(10, 9, 8, 7, 0));
+  object.setField(10, "10");
+  object.setField(9, "9");
+  object.setField(8, "8");
+  object.setField(7, "7");
+  Group nested(5, 6);
+  nested.setField(6, "6");
+  object.addGroup( nested );
+
+  std::string originalString;
+  object.calculateString( originalString );
+
+  Group moved = std::move( object );
+  std::string movedString;
+  moved.calculateString( movedString );
+  CHECK_EQUAL( originalString, movedString );
+  CHECK_EQUAL( 1U, moved.groupCount( 5 ) );
+
+  FieldMap parent;
+  parent.addGroup( 1, std::move( moved ) );
+  std::string parentString;
+  parent.getGroupRef( 1, 1 ).calculateString( parentString );
+  CHECK_EQUAL( originalString, parentString );
+  CHECK_EQUAL( "1", parent.getField( 1 ) );
+}
+
+TEST(emplaceGroup)
+{
+  struct Entry : public Group
+  {
+    Entry() : Group(1, 10, message_order(10, 9, 0)) {}
+  };
+
+  FieldMap parent;
+  Entry& entry = parent.emplaceGroup< Entry >();
+  entry.setField(9, "9");
+  entry.setField(10, "10");
+  parent.emplaceGroup< Entry >().setField(10, "20");
+
+  std::string entryString;
+  parent.getGroupRef( 1, 1 ).calculateString( entryString );
+  CHECK_EQUAL( "10=10\0019=9\001", entryString );
+  CHECK_EQUAL( "2", parent.getField( 1 ) );
+}
+
+TEST(insertOrder)
+{
+  Group object(1, 10, message_order(10, 9, 8, 0));
+  object.setField(FieldBase(10, "10"), false);
+  object.setField(FieldBase(9, "9"), false);
+  object.setField(FieldBase(20, "20"), false);
+  object.setField(FieldBase(8, "8"), false);
+  object.setField(FieldBase(7, "7"), false);
+  object.setField(9, "99");
+
+  std::string objectString;
+  object.calculateString( objectString );
+  CHECK_EQUAL( "10=10\0019=99\0018=8\0017=7\00120=20\001", objectString );
+}
+
 }
\ No newline at end of file
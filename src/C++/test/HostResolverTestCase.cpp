@@ -0,0 +1,75 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <HostResolver.h>
+
+using namespace FIX;
+
+SUITE(HostResolverTests)
+{
+
+TEST(resolveNumeric)
+{
+  HostResolver object;
+  HostResolver::Addresses addresses;
+
+  CHECK_EQUAL( HostResolver::RESOLVED, object.resolve( "127.0.0.1", 5001, addresses ) );
+  CHECK_EQUAL( 1U, addresses.size() );
+  CHECK_EQUAL( AF_INET, addresses[ 0 ].family() );
+  CHECK_EQUAL( "127.0.0.1", addresses[ 0 ].toString() );
+  CHECK_EQUAL( 5001, addresses[ 0 ].port() );
+
+  CHECK_EQUAL( HostResolver::RESOLVED, object.resolve( "::1", 5002, addresses ) );
+  CHECK_EQUAL( 1U, addresses.size() );
+  CHECK_EQUAL( AF_INET6, addresses[ 0 ].family() );
+  CHECK_EQUAL( "::1", addresses[ 0 ].toString() );
+  CHECK_EQUAL( 5002, addresses[ 0 ].port() );
+}
+
+TEST(resolveInBackground)
+{
+  HostResolver object;
+  HostResolver::Addresses addresses;
+
+  CHECK_EQUAL( HostResolver::PENDING, object.resolve( "localhost", 5001, addresses ) );
+  CHECK( addresses.empty() );
+
+  HostResolver::Result result = HostResolver::PENDING;
+  for( int i = 0; i < 100 && result == HostResolver::PENDING; ++i )
+  {
+    process_sleep( 0.05 );
+    result = object.resolve( "localhost", 5001, addresses );
+  }
+  CHECK_EQUAL( HostResolver::RESOLVED, result );
+  CHECK( !addresses.empty() );
+
+  // answered from the cache, with the port of this request
+  CHECK_EQUAL( HostResolver::RESOLVED, object.resolve( "localhost", 5003, addresses ) );
+  CHECK_EQUAL( 5003, addresses[ 0 ].port() );
+}
+
+}
@@ -0,0 +1,116 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <IOExecutor.h>
+#include <sstream>
+
+using namespace FIX;
+
+SUITE(IOExecutorTests)
+{
+
+/// Moves queued values to its output, like a log moving lines to disk.
+class RecordingWriter : public IOExecutor::Writer
+{
+public:
+  RecordingWriter() : writes( 0 ), running( 0 ), overlapped( false ) {}
+
+  void push( IOExecutor& executor, int value )
+  {
+    {
+      Locker locker( mutex );
+      pending.push_back( value );
+    }
+    executor.schedule( *this );
+  }
+
+  void write()
+  {
+    std::vector < int > values;
+    {
+      Locker locker( mutex );
+      if( running++ ) overlapped = true;
+      values.swap( pending );
+    }
+    process_sleep( 0.001 );
+
+    Locker locker( mutex );
+    output.insert( output.end(), values.begin(), values.end() );
+    ++writes;
+    --running;
+  }
+
+  std::vector < int > pending;
+  std::vector < int > output;
+  int writes;
+  int running;
+  bool overlapped;
+  Mutex mutex;
+};
+
+TEST(orderedAndCoalesced)
+{
+  IOExecutor executor( 4 );
+  RecordingWriter writers[ 3 ];
+  for( int i = 0; i < 300; ++i )
+    writers[ i % 3 ].push( executor, i );
+
+  for( int i = 0; i < 3; ++i )
+  {
+    executor.wait( writers[ i ] );
+    RecordingWriter& writer = writers[ i ];
+    CHECK( !writer.overlapped );
+    CHECK_EQUAL( 100U, writer.output.size() );
+    for( size_t j = 0; j < writer.output.size(); ++j )
+      CHECK_EQUAL( (int)( j * 3 + i ), writer.output[ j ] );
+    // values pushed while a write ran went out together in the next
+    CHECK( writer.writes < 100 );
+  }
+}
+
+TEST(stopFinishesWrites)
+{
+  RecordingWriter writer;
+  {
+    IOExecutor executor( 1 );
+    for( int i = 0; i < 10; ++i )
+      writer.push( executor, i );
+  }
+  CHECK_EQUAL( 10U, writer.output.size() );
+}
+
+TEST(shared)
+{
+  IOExecutor* pFirst = IOExecutor::acquire( 2 );
+  IOExecutor* pSecond = IOExecutor::acquire( 4 );
+  CHECK( pFirst == pSecond );
+  CHECK_EQUAL( 2, pFirst->getThreads() );
+  IOExecutor::release( pSecond );
+  IOExecutor::release( pFirst );
+}
+
+}
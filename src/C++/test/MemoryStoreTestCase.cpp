@@ -26,6 +26,7 @@
 
 #include <UnitTest++.h>
 #include <MessageStore.h>
+#include "MessageStoreTestCase.h"
 
 namespace FIX
 {
@@ -49,4 +50,19 @@ struct memoryStoreFixture
   MessageStore* object;
 };
 
+SUITE(MemoryStoreTests)
+{
+
+TEST_FIXTURE(memoryStoreFixture, setGet)
+{
+  CHECK_MESSAGE_STORE_SET_GET;
+}
+
+TEST_FIXTURE(memoryStoreFixture, cursor)
+{
+  CHECK_MESSAGE_STORE_CURSOR
+}
+
+}
+
 }
@@ -0,0 +1,121 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <MessageEncoder.h>
+#include <DataDictionary.h>
+#include <fix44/NewOrderSingleEncoder.h>
+
+using namespace FIX;
+
+SUITE(MessageEncoderTests)
+{
+
+struct encoderFixture
+{
+  encoderFixture()
+  : dataDictionary( "../spec/FIX44.xml" ),
+    object( "ORDER1", Side_BUY, UtcTimeStamp( 1, 2, 3, 4, 5, 2014 ), OrdType_LIMIT )
+  {
+    header.setField( BeginString( "FIX.4.4" ) );
+    header.setField( MsgType( object.getMsgType() ) );
+    header.setField( SenderCompID( "SENDER" ) );
+    header.setField( TargetCompID( "TARGET" ) );
+    header.setField( MsgSeqNum( 1 ) );
+    header.setField( SendingTime( UtcTimeStamp( 1, 2, 3, 4, 5, 2014 ) ) );
+  }
+
+  Message parse()
+  {
+    object.toString( header, raw );
+    Message message( INCOMING_DIRECTION, raw, dataDictionary, 0 );
+    dataDictionary.validate( INCOMING_DIRECTION, message );
+    return message;
+  }
+
+  DataDictionary dataDictionary;
+  FIX44::NewOrderSingleEncoder object;
+  Header header;
+  std::string raw;
+};
+
+TEST_FIXTURE(encoderFixture, encodeNewOrderSingle)
+{
+  object.setSymbol( "QQQQ" );
+  object.setOrderQty( 100 );
+  object.setPrice( 40.25 );
+  FIX44::NewOrderSingleEncoder::NoPartyIDs& party = object.addNoPartyIDs( "PARTY" );
+  party.setPartyIDSource( PartyIDSource_PROPRIETARY_CUSTOM_CODE );
+  party.setPartyRole( PartyRole_CLIENT_ID );
+
+  Message message = parse();
+  CHECK_EQUAL( "D", message.getHeader().getField( FIELD::MsgType ) );
+  CHECK_EQUAL( message.bodyLength(), IntConvertor::convert( message.getHeader().getField( FIELD::BodyLength ) ) );
+  CHECK_EQUAL( message.checkSum(), IntConvertor::convert( message.getTrailer().getField( FIELD::CheckSum ) ) );
+  CHECK_EQUAL( "ORDER1", message.getField( FIELD::ClOrdID ) );
+  CHECK_EQUAL( "20140504-01:02:03", message.getField( FIELD::TransactTime ) );
+  CHECK_EQUAL( "40.25", message.getField( FIELD::Price ) );
+  CHECK_EQUAL( 1U, message.groupCount( FIELD::NoPartyIDs ) );
+  CHECK( raw.find( "453=1\001448=PARTY\001447=D\001452=3\001" ) != std::string::npos );
+}
+
+TEST_FIXTURE(encoderFixture, resetEncoder)
+{
+  object.setPrice( 40.25 );
+  object.addNoPartyIDs( "PARTY" );
+  parse();
+
+  object.reset( "ORDER2", Side_SELL, UtcTimeStamp( 1, 2, 3, 4, 5, 2014 ), OrdType_MARKET );
+  Message message = parse();
+  CHECK_EQUAL( "ORDER2", message.getField( FIELD::ClOrdID ) );
+  CHECK( !message.isSetField( FIELD::Price ) );
+  CHECK_EQUAL( 0U, message.groupCount( FIELD::NoPartyIDs ) );
+}
+
+TEST_FIXTURE(encoderFixture, encodeGroupDelimiterFirst)
+{
+  // an entry can only be started with its delimiter
+  object.addNoPartyIDs( "PARTY" ).setPartyRole( PartyRole_CLIENT_ID );
+  object.addNoPartyIDs( "OTHER" );
+
+  Message message = parse();
+  CHECK_EQUAL( 2U, message.groupCount( FIELD::NoPartyIDs ) );
+  CHECK( raw.find( "453=2\001448=PARTY\001452=3\001448=OTHER\001" ) != std::string::npos );
+}
+
+TEST_FIXTURE(encoderFixture, encodeMilliseconds)
+{
+  object.reset( "ORDER1", Side_BUY, UtcTimeStamp( 1, 2, 3, 456, 4, 5, 2014 ), OrdType_LIMIT );
+  parse();
+  CHECK( raw.find( "60=20140504-01:02:03\001" ) != std::string::npos );
+
+  object.setShowMilliseconds( true );
+  parse();
+  CHECK( raw.find( "60=20140504-01:02:03.456\001" ) != std::string::npos );
+}
+
+}
@@ -150,6 +150,10 @@ TEST(groupOrder)
 
   CHECK( sorter(49, 48) );
   CHECK( sorter(49, 51) );
+
+  CHECK( sorter(13, 51) );
+  CHECK( sorter(99, 101) );
+  CHECK( !sorter(101, 99) );
 }
 
 }
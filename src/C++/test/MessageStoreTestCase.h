@@ -23,6 +23,7 @@
 #include <fix42/ExecutionReport.h>
 #include <MessageStore.h>
 #include <SessionID.h>
+#include <memory>
 
 #define CHECK_MESSAGE_STORE_SET_GET                         \
   FIX42::Logon logon;                                       \
@@ -77,6 +78,37 @@
   CHECK_EQUAL( bothQuote.toString(), messages[2] );   \
   CHECK_EQUAL( escape.toString(), messages[3] );
 
+#define CHECK_MESSAGE_STORE_CURSOR                                  \
+  FIX42::Logon logon;                                               \
+  logon.getHeader().setField( MsgSeqNum( 1 ) );                     \
+  object->set( 1, logon.toString() );                               \
+                                                                    \
+  FIX42::Heartbeat heartbeat;                                       \
+  heartbeat.getHeader().setField( MsgSeqNum( 2 ) );                 \
+  object->set( 2, heartbeat.toString() );                           \
+                                                                    \
+  FIX42::NewOrderSingle newOrderSingle;                             \
+  newOrderSingle.getHeader().setField( MsgSeqNum( 4 ) );            \
+  object->set( 4, newOrderSingle.toString() );                      \
+                                                                    \
+  std::string message;                                              \
+  std::unique_ptr<MessageStoreCursor> pCursor( object->cursor( 1, 4 ) ); \
+  CHECK( pCursor->next( message ) );                                \
+  CHECK_EQUAL( logon.toString(), message );                         \
+  CHECK( pCursor->next( message ) );                                \
+  CHECK_EQUAL( heartbeat.toString(), message );                     \
+  CHECK( pCursor->next( message ) );                                \
+  CHECK_EQUAL( newOrderSingle.toString(), message );                \
+  CHECK( !pCursor->next( message ) );                               \
+                                                                    \
+  pCursor.reset( object->cursor( 5, 8 ) );                          \
+  CHECK( !pCursor->next( message ) );                               \
+                                                                    \
+  pCursor.reset( object->cursor( 3, 8 ) );                          \
+  CHECK( pCursor->next( message ) );                                \
+  CHECK_EQUAL( newOrderSingle.toString(), message );                \
+  CHECK( !pCursor->next( message ) );
+
 #define CHECK_MESSAGE_STORE_OTHER                       \
   object->setNextSenderMsgSeqNum( 10 );                 \
   CHECK_EQUAL( 10, object->getNextSenderMsgSeqNum() );  \
@@ -64,6 +64,65 @@ TEST(identifyType)
   CHECK_EQUAL( "A", FIX::identifyType( "8=FIX.4.2\0019=12\00135=A\001108=30\00110=031\001" ) );
   CHECK_EQUAL( "AB", FIX::identifyType( "8=FIX.4.2\0019=12\00135=AB\001108=30\00110=031\001" ) );
   CHECK_THROW( FIX::identifyType( "8=FIX.4.2\0019=12\001108=30\00110=031\001" ), std::logic_error );
+  CHECK_EQUAL( "0", FIX::identifyType( "8=FIX.4.2\0019=12\001108=30\00135=0\00110=031\001" ) );
+}
+
+TEST(sniffHeader)
+{
+  std::string string =
+    "8=FIX.4.2\0019=75\00135=D\00134=12\00149=TW\00156=ISLD\00143=Y\001"
+    "52=20000426-12:05:06\00111=ID\00149=XX\00110=000\001";
+  HeaderSniffer header( string );
+  CHECK( header.valid() );
+  CHECK( !header.isAdmin() );
+  CHECK_EQUAL( "FIX.4.2", header.beginString().str() );
+  CHECK_EQUAL( "75", header.bodyLength().str() );
+  CHECK( header.msgType() == "D" );
+  CHECK( header.senderCompID() == "TW" );
+  CHECK( header.targetCompID() == "ISLD" );
+  CHECK( header.possDupFlag() == "Y" );
+  CHECK( !header.applVerID().found() );
+  int msgSeqNum = 0;
+  CHECK( header.msgSeqNum().getInt( msgSeqNum ) );
+  CHECK_EQUAL( 12, msgSeqNum );
+  CHECK( header.senderCompID().data >= string.data() );
+  CHECK( header.senderCompID().data < string.data() + string.size() );
+}
+
+TEST(sniffHeaderStopsAtBody)
+{
+  HeaderSniffer header( "8=FIXT.1.1\0019=10\00135=A\00111=ID\00149=TW\00110=000\001" );
+  CHECK( header.valid() );
+  CHECK( header.isAdmin() );
+  CHECK( !header.senderCompID().found() );
+}
+
+TEST(sniffHeaderOrder)
+{
+  HeaderSniffer outOfOrder( "9=10\0018=FIX.4.2\00135=0\00149=TW\001" );
+  CHECK( !outOfOrder.valid() );
+  CHECK( outOfOrder.msgType() == "0" );
+  CHECK( outOfOrder.senderCompID() == "TW" );
+
+  HeaderSniffer truncated( "8=FIX.4.2\0019=10\00135=0\00149=T" );
+  CHECK( truncated.valid() );
+  CHECK( !truncated.senderCompID().found() );
+
+  CHECK( !HeaderSniffer( "8=FIX.4.2\0019=10\001" ).valid() );
+  CHECK( !HeaderSniffer( "garbage" ).valid() );
+  CHECK( !HeaderSniffer( "" ).valid() );
+}
+
+TEST(sniffHeaderLongTag)
+{
+  // 4294967345 wraps to 49 in 32 bits, it must end the scan instead
+  HeaderSniffer header( "8=FIX.4.2\0019=10\00135=0\0014294967345=TW\00156=ISLD\001" );
+  CHECK( header.valid() );
+  CHECK( !header.senderCompID().found() );
+  CHECK( !header.targetCompID().found() );
+
+  HeaderSniffer longest( "8=FIX.4.2\0019=10\00135=0\001000000049=TW\001" );
+  CHECK( longest.senderCompID() == "TW" );
 }
 
 TEST(isAdminMsgType)
@@ -345,6 +404,39 @@ TEST(checkSum)
   CHECK_EQUAL( chksum, object.checkSum() );
 }
 
+TEST(totalsFollowChanges)
+{
+  FIX::Message object;
+  object.getHeader().setField( FIX::BeginString( "FIX.4.4" ) );
+  object.getHeader().setField( FIX::MsgType( "D" ) );
+  object.getHeader().setField( FIX::SendingTime( FIX::UtcTimeStamp( 6, 5, 4, 26, 4, 2000 ) ) );
+  object.setField( FIX::ClOrdID( "ORDERID" ) );
+  object.setField( FIX::Text( "REMOVED" ) );
+  FIX::Group group( FIX::FIELD::NoPartyIDs, FIX::FIELD::PartyID );
+  group.setField( FIX::PartyID( "PARTY" ) );
+  object.addGroup( group );
+  object.toString();
+
+  // changes made after the totals were counted, as a resend makes them
+  object.getHeader().setField( FIX::PossDupFlag( true ) );
+  object.getHeader().setField( FIX::SendingTime( FIX::UtcTimeStamp( 7, 5, 4, 26, 4, 2000 ) ) );
+  object.removeField( FIX::FIELD::Text );
+  object.getGroupRef( 1, FIX::FIELD::NoPartyIDs ).setField( FIX::PartyID( "OTHERPARTY" ) );
+  object.addGroup( group );
+
+  const std::string str = object.toString();
+  const std::string::size_type bodyStart = str.find( "35=" ) + 1;
+  const std::string::size_type checkSumStart = str.rfind( "10=" );
+  int chksum = 0;
+  for ( std::string::size_type i = 0; i < checkSumStart; chksum += ( unsigned char ) str[ i++ ] ) {}
+
+  CHECK_EQUAL( ( int ) ( checkSumStart - bodyStart ), object.bodyLength() );
+  CHECK_EQUAL( chksum % 256, object.checkSum() );
+  CHECK( str.find( "43=Y" ) != std::string::npos );
+  CHECK( str.find( "58=" ) == std::string::npos );
+  CHECK( str.find( "448=OTHERPARTY" ) != std::string::npos );
+}
+
 TEST(headerFieldsFirst)
 {
   FIX::Message object;
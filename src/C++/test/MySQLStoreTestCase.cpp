@@ -90,6 +90,11 @@ TEST_FIXTURE(resetMySQLStoreFixture, setGetWithQuote)
   CHECK_MESSAGE_STORE_SET_GET_WITH_QUOTE;
 }
 
+TEST_FIXTURE(resetMySQLStoreFixture, cursor)
+{
+  CHECK_MESSAGE_STORE_CURSOR
+}
+
 TEST_FIXTURE(resetMySQLStoreFixture, other)
 {
   CHECK_MESSAGE_STORE_OTHER
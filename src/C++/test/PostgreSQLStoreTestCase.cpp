@@ -90,6 +90,11 @@ TEST_FIXTURE(resetPostgreSQLStoreFixture, setGetWithQuote)
   //CHECK_MESSAGE_STORE_SET_GET_WITH_QUOTE;
 }
 
+TEST_FIXTURE(resetPostgreSQLStoreFixture, cursor)
+{
+  CHECK_MESSAGE_STORE_CURSOR
+}
+
 TEST_FIXTURE(resetPostgreSQLStoreFixture, other)
 {
   CHECK_MESSAGE_STORE_OTHER
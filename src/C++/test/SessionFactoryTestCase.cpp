@@ -26,6 +26,7 @@
 
 #include <UnitTest++.h>
 #include <SessionFactory.h>
+#include <Session.h>
 #include <Application.h>
 #include <MessageStore.h>
 
@@ -69,4 +70,32 @@ TEST(startDayAndEndDayAreDifferent)
   object.destroy(object.create(sessionID, settings));
 }
 
+TEST(sessionsShareDataDictionary)
+{
+  NullApplication application;
+  MemoryStoreFactory messageStoreFactory;
+  SessionFactory object(application, messageStoreFactory, 0);
+
+  Dictionary settings;
+  settings.setString(CONNECTION_TYPE, "initiator");
+  settings.setString(DATA_DICTIONARY, "../spec/FIX42.xml");
+  settings.setString(START_TIME, "12:00:00");
+  settings.setString(END_TIME, "12:00:00");
+  settings.setString(HEARTBTINT, "30");
+
+  BeginString beginString("FIX.4.2");
+  Session* pSession1 = object.create(SessionID("FIX.4.2", "SENDER", "TARGET1"), settings);
+  Session* pSession2 = object.create(SessionID("FIX.4.2", "SENDER", "TARGET2"), settings);
+
+  const DataDictionary& dictionary1 =
+    pSession1->getDataDictionaryProvider().getSessionDataDictionary(beginString);
+  const DataDictionary& dictionary2 =
+    pSession2->getDataDictionaryProvider().getSessionDataDictionary(beginString);
+  CHECK( dictionary1.isMsgType("D") );
+  CHECK_EQUAL( &dictionary1, &dictionary2 );
+
+  object.destroy(pSession1);
+  object.destroy(pSession2);
+}
+
 }
@@ -0,0 +1,137 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <SessionMetrics.h>
+#include <sstream>
+
+using namespace FIX;
+
+SUITE(SessionMetricsTests)
+{
+
+TEST(histogramEmpty)
+{
+  LatencyHistogram histogram;
+  CHECK_EQUAL( 0U, histogram.count() );
+  CHECK_EQUAL( 0U, histogram.percentile( 0.5 ) );
+}
+
+TEST(histogramSmallValuesAreExact)
+{
+  LatencyHistogram histogram;
+  for( unsigned long long i = 1; i <= 8; ++i )
+    histogram.record( i );
+
+  CHECK_EQUAL( 8U, histogram.count() );
+  CHECK_EQUAL( 36U, histogram.sum() );
+  CHECK_EQUAL( 8U, histogram.max() );
+  CHECK_EQUAL( 4U, histogram.percentile( 0.5 ) );
+  CHECK_EQUAL( 8U, histogram.percentile( 1.0 ) );
+}
+
+TEST(histogramPercentilesWithinPrecision)
+{
+  LatencyHistogram histogram;
+  for( unsigned long long i = 1; i <= 1000; ++i )
+    histogram.record( i * 1000 );
+
+  unsigned long long p50 = histogram.percentile( 0.5 );
+  unsigned long long p99 = histogram.percentile( 0.99 );
+  CHECK( p50 >= 500000 && p50 <= 500000 + 500000 / 8 );
+  CHECK( p99 >= 990000 && p99 <= 1000000 );
+  CHECK_EQUAL( 1000000U, histogram.percentile( 1.0 ) );
+}
+
+TEST(histogramClampsLargeValues)
+{
+  LatencyHistogram histogram;
+  histogram.record( 1ULL << 50 );
+  CHECK_EQUAL( 1U, histogram.count() );
+  CHECK_EQUAL( 1ULL << 50, histogram.max() );
+  CHECK( histogram.percentile( 0.5 ) < ( 1ULL << 50 ) );
+}
+
+TEST(stageTimerDisabled)
+{
+  SessionMetrics::StageTimer timer( 0, SessionMetrics::PARSE );
+}
+
+TEST(stageTimerRecords)
+{
+  SessionMetrics metrics;
+  {
+    SessionMetrics::StageTimer timer( &metrics, SessionMetrics::SEND );
+  }
+  CHECK_EQUAL( 1U, metrics.get( SessionMetrics::SEND ).count() );
+  CHECK_EQUAL( 0U, metrics.get( SessionMetrics::PARSE ).count() );
+}
+
+TEST(toJSON)
+{
+  SessionMetrics metrics;
+  metrics.increment( SessionMetrics::MESSAGES_IN );
+  metrics.increment( SessionMetrics::BYTES_IN, 42 );
+  metrics.set( SessionMetrics::QUEUED_MESSAGES, 3 );
+  metrics.record( SessionMetrics::PARSE, 5 );
+
+  SessionMetrics::Sessions sessions;
+  sessions.push_back( std::make_pair( SessionID( "FIX.4.2", "TW", "ISLD" ), &metrics ) );
+
+  std::stringstream stream;
+  SessionMetrics::toJSON( stream, sessions );
+  std::string json = stream.str();
+
+  CHECK_EQUAL( 0U, json.find( "{\"sessions\":[{\"sessionID\":\"FIX.4.2:TW->ISLD\"" ) );
+  CHECK( json.find( "\"messagesIn\":1," ) != std::string::npos );
+  CHECK( json.find( "\"bytesIn\":42," ) != std::string::npos );
+  CHECK( json.find( "\"queuedMessages\":3," ) != std::string::npos );
+  CHECK( json.find( "\"parse\":{\"count\":1,\"sum\":5,\"max\":5,\"p50\":5" ) != std::string::npos );
+  CHECK_EQUAL( "]}", json.substr( json.size() - 2 ) );
+}
+
+TEST(toPrometheus)
+{
+  SessionMetrics metrics;
+  metrics.increment( SessionMetrics::MESSAGES_OUT, 7 );
+  metrics.record( SessionMetrics::STORE, 2000 );
+
+  SessionMetrics::Sessions sessions;
+  sessions.push_back( std::make_pair( SessionID( "FIX.4.2", "TW", "ISLD" ), &metrics ) );
+
+  std::stringstream stream;
+  SessionMetrics::toPrometheus( stream, sessions );
+  std::string text = stream.str();
+
+  CHECK( text.find( "# TYPE quickfix_messages_out_total counter\n" ) != std::string::npos );
+  CHECK( text.find( "quickfix_messages_out_total{session=\"FIX.4.2:TW->ISLD\"} 7\n" ) != std::string::npos );
+  CHECK( text.find( "# TYPE quickfix_store_seconds summary\n" ) != std::string::npos );
+  CHECK( text.find( "quickfix_store_seconds{session=\"FIX.4.2:TW->ISLD\",quantile=\"0.99\"} 2e-06\n" ) != std::string::npos );
+  CHECK( text.find( "quickfix_store_seconds_count{session=\"FIX.4.2:TW->ISLD\"} 1\n" ) != std::string::npos );
+}
+
+}
@@ -45,6 +45,7 @@
 #include <fixt11/Logon.h>
 #include <fixt11/ResendRequest.h>
 #include <fix50/ExecutionReport.h>
+#include <fix44/NewOrderSingleEncoder.h>
 
 using namespace FIX;
 
@@ -1060,6 +1061,62 @@ TEST_FIXTURE(acceptorFixture, nextResendRequest)
   CHECK_EQUAL( 11, resent );
 }
 
+TEST_FIXTURE(acceptorFixture, nextResendRequestChunked)
+{
+  object->setResendChunkSize( 2 );
+  object->next( createLogon( "ISLD", "TW", 1 ), UtcTimeStamp() );
+  object->next( createTestRequest( "ISLD", "TW", 2, "HELLO" ), UtcTimeStamp() );
+  object->next( createTestRequest( "ISLD", "TW", 3, "HELLO" ), UtcTimeStamp() );
+  object->next( createTestRequest( "ISLD", "TW", 4, "HELLO" ), UtcTimeStamp() );
+  object->next( createResendRequest( "ISLD", "TW", 5, 1, 4 ), UtcTimeStamp() );
+  CHECK_EQUAL( 1, toSequenceReset );
+  CHECK_EQUAL( 0, resent );
+
+  FIX::Message message = createNewOrderSingle( "ISLD", "TW", 6 );
+  CHECK( object->send( message ) );
+  message = createNewOrderSingle( "ISLD", "TW", 7 );
+  CHECK( object->send( message ) );
+  message = createNewOrderSingle( "ISLD", "TW", 8 );
+  CHECK( object->send( message ) );
+  object->next( createResendRequest( "ISLD", "TW", 6, 5, 7 ), UtcTimeStamp() );
+  CHECK_EQUAL( 1, toSequenceReset );
+  CHECK_EQUAL( 3, resent );
+
+  object->next( createResendRequest( "ISLD", "TW", 7, 1, 0 ), UtcTimeStamp() );
+  CHECK_EQUAL( 2, toSequenceReset );
+  CHECK_EQUAL( 6, resent );
+}
+
+struct disconnectOnResendFixture : public acceptorFixture
+{
+  void toApp( FIX::Message& message, const SessionID& sessionID )
+  throw( DoNotSend )
+  {
+    acceptorFixture::toApp( message, sessionID );
+    if( resent == 2 )
+      object->disconnect();
+  }
+};
+
+TEST_FIXTURE(disconnectOnResendFixture, nextResendRequestChunkedAborts)
+{
+  object->setResendChunkSize( 2 );
+  object->next( createLogon( "ISLD", "TW", 1 ), UtcTimeStamp() );
+
+  FIX::Message message = createNewOrderSingle( "ISLD", "TW", 2 );
+  CHECK( object->send( message ) );
+  message = createNewOrderSingle( "ISLD", "TW", 3 );
+  CHECK( object->send( message ) );
+  message = createNewOrderSingle( "ISLD", "TW", 4 );
+  CHECK( object->send( message ) );
+  object->next( createResendRequest( "ISLD", "TW", 2, 2, 4 ), UtcTimeStamp() );
+
+  // the rest of the range is dropped once the connection has gone
+  CHECK_EQUAL( 1, disconnected );
+  CHECK_EQUAL( 2, resent );
+  CHECK_EQUAL( 0, toSequenceReset );
+}
+
 TEST_FIXTURE(acceptorFixture, nextResendRequestRepeatingGroup)
 {
   object->next( createLogon( "ISLD", "TW", 1 ), UtcTimeStamp() );
@@ -1453,6 +1510,188 @@ TEST_FIXTURE(acceptorFixture, processQueuedMessages)
   CHECK_EQUAL( 2, toResendRequest );
 }
 
+class CountingStore : public MemoryStore
+{
+public:
+  CountingStore( int& writes ) : m_writes( writes ) {}
+
+  void setNextTargetMsgSeqNum( int value ) throw ( IOException )
+  { ++m_writes; MemoryStore::setNextTargetMsgSeqNum( value ); }
+  void incrNextTargetMsgSeqNum() throw ( IOException )
+  { ++m_writes; MemoryStore::incrNextTargetMsgSeqNum(); }
+
+private:
+  int& m_writes;
+};
+
+struct nextBatchFixture : public TestCallback, public MessageStoreFactory
+{
+  nextBatchFixture( const std::string& schedule = "" ) : targetWrites( 0 )
+  {
+    SessionID sessionID( BeginString( "FIX.4.2" ),
+                         SenderCompID( "TW" ), TargetCompID( "ISLD" ) );
+
+    DataDictionaryProvider provider;
+    provider.addTransportDataDictionary( sessionID.getBeginString(), "../spec/FIX42.xml" );
+    object = new Session( *this, *this, sessionID, provider,
+                          createSchedule( schedule.empty() ? createScheduleDescriptor() : schedule ), 0, 0 );
+    object->setResponder( this );
+  }
+
+  ~nextBatchFixture()
+  {
+    delete object;
+  }
+
+  MessageStore* create( const SessionID& ) { return new CountingStore( targetWrites ); }
+  void destroy( MessageStore* pStore ) { delete pStore; }
+
+  Session* object;
+  int targetWrites;
+};
+
+TEST_FIXTURE(nextBatchFixture, nextBatch)
+{
+  std::vector<std::string> messages;
+  messages.push_back( createLogon( "ISLD", "TW", 1 ).toString() );
+  messages.push_back( createHeartbeat( "ISLD", "TW", 2 ).toString() );
+  messages.push_back( createHeartbeat( "ISLD", "TW", 4 ).toString() );
+  messages.push_back( createTestRequest( "ISLD", "TW", 3, "HELLO" ).toString() );
+
+  const int writes = targetWrites;
+  object->nextBatch( messages, UtcTimeStamp() );
+
+  // the gap is found and filled inside the batch as it would be one by one
+  CHECK( object->isLoggedOn() );
+  CHECK_EQUAL( 1, toResendRequest );
+  CHECK_EQUAL( 2, fromHeartbeat );
+  CHECK_EQUAL( 1, fromTestRequest );
+  CHECK_EQUAL( 5, object->getExpectedTargetNum() );
+  // but the store is only updated once
+  CHECK_EQUAL( writes + 1, targetWrites );
+}
+
+struct nextBatchLogoutFixture : public nextBatchFixture
+{
+  nextBatchLogoutFixture()
+  : nextBatchFixture( "W|0,6|00:00|00:00|NoAutoEOD|NoAutoReconnect|60|AutoConnect|AutoDisconnect" ),
+    batching( false ), writtenAtDisconnect( 0 ) {}
+
+  bool send( const std::string& msg )
+  {
+    ( batching ? held : written ).push_back( msg );
+    return true;
+  }
+  void beginBatch() { batching = true; }
+  void endBatch()
+  {
+    batching = false;
+    written.insert( written.end(), held.begin(), held.end() );
+    held.clear();
+  }
+  void disconnect()
+  {
+    disconnected++;
+    writtenAtDisconnect = written.size();
+  }
+
+  bool batching;
+  std::vector<std::string> held;
+  std::vector<std::string> written;
+  size_t writtenAtDisconnect;
+};
+
+TEST_FIXTURE(nextBatchLogoutFixture, nextBatchLogout)
+{
+  std::vector<std::string> messages;
+  messages.push_back( createLogon( "ISLD", "TW", 1 ).toString() );
+  messages.push_back( createLogout( "ISLD", "TW", 2 ).toString() );
+
+  object->nextBatch( messages, UtcTimeStamp() );
+
+  CHECK_EQUAL( 1, fromLogout );
+  CHECK_EQUAL( 1, toLogout );
+  CHECK_EQUAL( 1, disconnected );
+  // the Logon and Logout replies go out before the connection is closed
+  CHECK_EQUAL( 2U, writtenAtDisconnect );
+  CHECK( held.empty() );
+  CHECK_EQUAL( "5", identifyType( written.back() ).getValue() );
+}
+
+struct sendEncoderFixture : public TestCallback
+{
+  sendEncoderFixture()
+  : toAppMessages( 0 ), toAppEncoders( 0 ),
+    handleEncoder( false ), doNotSend( false ),
+    encoder( "ORDER1", Side_BUY, UtcTimeStamp(), OrdType_MARKET )
+  {
+    SessionID sessionID( BeginString( "FIX.4.4" ),
+                         SenderCompID( "TW" ), TargetCompID( "ISLD" ) );
+
+    DataDictionaryProvider provider;
+    provider.addTransportDataDictionary( sessionID.getBeginString(), "../spec/FIX44.xml" );
+    object = new Session( *this, factory, sessionID, provider,
+                          createSchedule( createScheduleDescriptor() ), 0, 0 );
+    object->setResponder( this );
+  }
+
+  ~sendEncoderFixture()
+  {
+    delete object;
+  }
+
+  void toApp( FIX::Message& message, const SessionID& )
+  throw( DoNotSend )
+  {
+    ++toAppMessages;
+    clOrdID = message.getField( FIELD::ClOrdID );
+    if( doNotSend ) throw DoNotSend();
+  }
+
+  bool toApp( MessageEncoder&, const SessionID& )
+  throw( DoNotSend )
+  {
+    ++toAppEncoders;
+    if( doNotSend ) throw DoNotSend();
+    return handleEncoder;
+  }
+
+  Session* object;
+  int toAppMessages;
+  int toAppEncoders;
+  bool handleEncoder;
+  bool doNotSend;
+  std::string clOrdID;
+  FIX44::NewOrderSingleEncoder encoder;
+};
+
+TEST_FIXTURE(sendEncoderFixture, sendEncoderAsMessage)
+{
+  CHECK( object->send( encoder ) );
+  CHECK_EQUAL( 1, toAppEncoders );
+  CHECK_EQUAL( 1, toAppMessages );
+  CHECK_EQUAL( "ORDER1", clOrdID );
+  CHECK_EQUAL( 2, object->getExpectedSenderNum() );
+}
+
+TEST_FIXTURE(sendEncoderFixture, sendEncoderHandled)
+{
+  handleEncoder = true;
+  CHECK( object->send( encoder ) );
+  CHECK_EQUAL( 1, toAppEncoders );
+  CHECK_EQUAL( 0, toAppMessages );
+  CHECK_EQUAL( 2, object->getExpectedSenderNum() );
+}
+
+TEST_FIXTURE(sendEncoderFixture, sendEncoderDoNotSend)
+{
+  doNotSend = true;
+  CHECK( !object->send( encoder ) );
+  handleEncoder = true;
+  CHECK( !object->send( encoder ) );
+  CHECK_EQUAL( 1, object->getExpectedSenderNum() );
+}
+
 struct initiatorCreatedBeforeStartTimeFixture : public TestCallback
 {
   static const int HEARTBTINT = 30;
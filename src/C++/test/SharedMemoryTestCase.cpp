@@ -0,0 +1,173 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#ifndef _MSC_VER
+
+#include <UnitTest++.h>
+#include <SharedMemoryAcceptor.h>
+#include <SharedMemoryInitiator.h>
+#include <Session.h>
+#include <Utility.h>
+#include <sstream>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include "TestHelper.h"
+
+using namespace FIX;
+
+SUITE(SharedMemoryTests)
+{
+
+TEST(sendAndReceive)
+{
+  SharedMemoryConnection* acceptor =
+    SharedMemoryConnection::create( "quickfix_test_ring", 1 );
+  CHECK( !acceptor->isConnected() );
+
+  SharedMemoryConnection* initiator =
+    SharedMemoryConnection::open( "quickfix_test_ring" );
+  CHECK( initiator != 0 );
+  if( !initiator )
+  {
+    delete acceptor;
+    return;
+  }
+  CHECK( acceptor->isConnected() );
+
+  // only one initiator can attach
+  CHECK( SharedMemoryConnection::open( "quickfix_test_ring" ) == 0 );
+
+  // several passes around the smallest ring
+  std::string msg;
+  for( int i = 0; i < 20; ++i )
+  {
+    std::string first( 1000, (char)( 'a' + i ) );
+    std::string second( 700 + i, (char)( 'A' + i ) );
+    CHECK( initiator->send( first ) );
+    CHECK( initiator->send( second ) );
+    CHECK( acceptor->send( second ) );
+
+    CHECK( acceptor->receive( msg ) );
+    CHECK( first == msg );
+    CHECK( acceptor->receive( msg ) );
+    CHECK( second == msg );
+    CHECK( !acceptor->receive( msg ) );
+    CHECK( initiator->receive( msg ) );
+    CHECK( second == msg );
+  }
+
+  CHECK( !initiator->send( std::string( 4096, 'x' ) ) );
+
+  delete initiator;
+  CHECK( acceptor->isClosed() );
+  CHECK( !acceptor->send( "8=FIX.4.2" ) );
+  delete acceptor;
+}
+
+TEST(liveSegmentIsNotReplaced)
+{
+  SharedMemoryConnection* acceptor =
+    SharedMemoryConnection::create( "quickfix_test_live", 1 );
+  CHECK_THROW( SharedMemoryConnection::create( "quickfix_test_live", 1 ), RuntimeError );
+  CHECK( !acceptor->isClosed() );
+
+  SharedMemoryConnection* initiator =
+    SharedMemoryConnection::open( "quickfix_test_live" );
+  CHECK( initiator != 0 );
+  delete initiator;
+  delete acceptor;
+}
+
+TEST(foreignSegmentIsRejected)
+{
+  shm_unlink( "/quickfix_test_foreign" );
+  int fd = shm_open( "/quickfix_test_foreign", O_CREAT | O_EXCL | O_RDWR, 0600 );
+  CHECK( fd >= 0 );
+  if( fd < 0 )
+    return;
+  // every word reads as a listening state
+  std::vector < int > garbage( 2048, 1 );
+  const ssize_t size = (ssize_t)( garbage.size() * sizeof( int ) );
+  CHECK( write( fd, &garbage[ 0 ], size ) == size );
+  close( fd );
+
+  CHECK_THROW( SharedMemoryConnection::open( "quickfix_test_foreign" ), RuntimeError );
+  CHECK_THROW( SharedMemoryConnection::create( "quickfix_test_foreign", 1 ), RuntimeError );
+  shm_unlink( "/quickfix_test_foreign" );
+}
+
+TEST(logon)
+{
+  SessionSettings acceptorSettings;
+  std::stringstream acceptorStream(
+    "[DEFAULT]\n"
+    "ConnectionType=acceptor\n"
+    "Schedule=D|0,1,2,3,4,5,6|00:00:00|23:59:59|NoAutoEOD|AutoReconnect|1|AutoConnect|NoAutoDisconnect\n"
+    "UseDataDictionary=N\n"
+    "CheckLatency=N\n"
+    "[SESSION]\n"
+    "BeginString=FIX.4.2\n"
+    "SenderCompID=ISLD\n"
+    "TargetCompID=TW\n"
+    "SharedMemoryName=quickfix_test_logon\n"
+    "SharedMemorySize=65536\n" );
+  acceptorStream >> acceptorSettings;
+
+  SessionSettings initiatorSettings;
+  std::stringstream initiatorStream(
+    "[DEFAULT]\n"
+    "ConnectionType=initiator\n"
+    "Schedule=D|0,1,2,3,4,5,6|00:00:00|23:59:59|NoAutoEOD|AutoReconnect|1|AutoConnect|NoAutoDisconnect\n"
+    "HeartBtInt=30\n"
+    "ReconnectInterval=1\n"
+    "UseDataDictionary=N\n"
+    "CheckLatency=N\n"
+    "[SESSION]\n"
+    "BeginString=FIX.4.2\n"
+    "SenderCompID=TW\n"
+    "TargetCompID=ISLD\n"
+    "SharedMemoryName=quickfix_test_logon\n" );
+  initiatorStream >> initiatorSettings;
+
+  TestApplication application;
+  MemoryStoreFactory factory;
+  SharedMemoryAcceptor acceptor( application, factory, acceptorSettings );
+  SharedMemoryInitiator initiator( application, factory, initiatorSettings );
+  acceptor.start();
+  initiator.start();
+
+  for( int i = 0; i < 100 && !( acceptor.isLoggedOn() && initiator.isLoggedOn() ); ++i )
+    process_sleep( 0.1 );
+
+  CHECK( acceptor.isLoggedOn() );
+  CHECK( initiator.isLoggedOn() );
+
+  initiator.stop();
+  acceptor.stop( true );
+}
+}
+
+#endif
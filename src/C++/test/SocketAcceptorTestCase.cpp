@@ -26,6 +26,7 @@
 
 #include <UnitTest++.h>
 #include <SocketAcceptor.h>
+#include <Session.h>
 #include <Utility.h>
 #include <fix42/Logon.h>
 #include <sstream>
@@ -115,4 +116,57 @@ TEST_FIXTURE(receivePartialMessageFixture, receivePartialMessage)
   CHECK( socket_send( s, secondPart.c_str(), (int)strlen(secondPart.c_str()) ) );
   object->poll();
 }
+
+#ifdef SO_REUSEPORT
+TEST(acceptThreads)
+{
+  SessionSettings settings;
+  std::string input =
+    "[DEFAULT]\n"
+    "ConnectionType=acceptor\n"
+    "SocketAcceptPort=5000\n"
+    "SocketAcceptThreads=2\n"
+    "Schedule=D|0,1,2,3,4,5,6|00:00:00|23:59:59|NoAutoEOD|AutoReconnect|1|AutoConnect|NoAutoDisconnect\n"
+    "UseDataDictionary=N\n"
+    "CheckLatency=N\n"
+    "[SESSION]\n"
+    "BeginString=FIX.4.2\n"
+    "SenderCompID=ISLD\n"
+    "TargetCompID=TW\n";
+  std::stringstream stream( input );
+  stream >> settings;
+
+  TestApplication application;
+  MemoryStoreFactory factory;
+  SocketAcceptor object( application, factory, settings );
+  object.poll();
+
+  Session* pSession = Session::lookupSession( SessionID( "FIX.4.2", "ISLD", "TW" ) );
+  CHECK( pSession != 0 );
+  if( !pSession ) return;
+  CHECK_EQUAL( -1, pSession->getEventLoop() );
+
+  FIX42::Logon logon;
+  logon.getHeader().set( SenderCompID("TW") );
+  logon.getHeader().set( TargetCompID("ISLD") );
+  logon.getHeader().set( MsgSeqNum(1) );
+  logon.getHeader().set( SendingTime() );
+  logon.set( HeartBtInt(30) );
+
+  // either loop may accept, the first one only runs while polled
+  int s = createSocket( 5000, "127.0.0.1" );
+  CHECK( socket_send( s, logon.toString().c_str(), (int)logon.toString().size() ) );
+  for( int i = 0; i < 50 && !pSession->isLoggedOn(); ++i )
+  {
+    process_sleep( 0.1 );
+    object.poll();
+  }
+
+  CHECK( pSession->isLoggedOn() );
+  CHECK( pSession->getEventLoop() == 0 || pSession->getEventLoop() == 1 );
+
+  object.stop( true );
+  destroySocket( s );
+}
+#endif
 }
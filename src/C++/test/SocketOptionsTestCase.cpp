@@ -0,0 +1,99 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <SocketOptions.h>
+#include <SessionSettings.h>
+#include <Utility.h>
+#include "TestHelper.h"
+
+using namespace FIX;
+
+SUITE(SocketOptionsTests)
+{
+
+TEST(read)
+{
+  Dictionary settings;
+  SocketOptions options;
+  options.read( settings );
+  CHECK( !options.m_quickAck );
+  CHECK_EQUAL( -1, options.m_tos );
+  CHECK_EQUAL( "", options.apply( socket_createConnector() ) );
+
+  settings.setBool( SOCKET_QUICK_ACK, true );
+  settings.setInt( SOCKET_TOS, 0x10 );
+  settings.setBool( SOCKET_KEEP_ALIVE, true );
+  settings.setInt( SOCKET_KEEP_ALIVE_IDLE, 30 );
+  options.read( settings );
+  CHECK( options.m_quickAck );
+  CHECK_EQUAL( 0x10, options.m_tos );
+  CHECK( options.m_keepAlive );
+  CHECK_EQUAL( 30, options.m_keepAliveIdle );
+
+  settings.setInt( SOCKET_USER_TIMEOUT, -1 );
+  CHECK_THROW( options.read( settings ), ConfigError );
+  settings.setInt( SOCKET_USER_TIMEOUT, 0 );
+  settings.setInt( SOCKET_TOS, 256 );
+  CHECK_THROW( options.read( settings ), ConfigError );
+}
+
+#ifdef __linux__
+TEST(apply)
+{
+  int acceptor = socket_createAcceptor( 0, true );
+  int port = socket_hostport( acceptor );
+  int client = socket_createConnector();
+  socket_connect( client, "127.0.0.1", port );
+  int server = socket_accept( acceptor );
+  socket_close( acceptor );
+
+  SocketOptions options;
+  options.m_quickAck = true;
+  options.m_userTimeout = 5000;
+  options.m_tos = 0x10;
+  options.m_keepAlive = true;
+  options.m_keepAliveIdle = 30;
+  options.m_keepAliveCount = 3;
+  CHECK_EQUAL( "", options.apply( client ) );
+
+  int value = 0;
+  socklen_t length = sizeof( value );
+  getsockopt( client, SOL_SOCKET, SO_KEEPALIVE, &value, &length );
+  CHECK_EQUAL( 1, value );
+  getsockopt( client, IPPROTO_TCP, TCP_KEEPIDLE, &value, &length );
+  CHECK_EQUAL( 30, value );
+  getsockopt( client, IPPROTO_TCP, TCP_USER_TIMEOUT, &value, &length );
+  CHECK_EQUAL( 5000, value );
+  getsockopt( client, IPPROTO_IP, IP_TOS, &value, &length );
+  CHECK_EQUAL( 0x10, value );
+
+  socket_close( client );
+  socket_close( server );
+}
+#endif
+
+}
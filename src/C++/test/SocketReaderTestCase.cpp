@@ -0,0 +1,97 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <SocketReader.h>
+#include <Utility.h>
+#include "TestHelper.h"
+
+using namespace FIX;
+
+SUITE(SocketReaderTests)
+{
+
+TEST(readBurst)
+{
+  std::pair<int, int> sockets = socket_createpair();
+  socket_setnonblock( sockets.second );
+
+  const std::string msg = "8=FIX.4.2\0019=5\00135=0\00110=000\001";
+  std::string burst;
+  for( int i = 0; i < 1000; ++i )
+    burst += msg;
+  CHECK_EQUAL( (ssize_t)burst.size(), socket_send( sockets.first, burst.c_str(), burst.size() ) );
+
+  // the whole burst is taken in one call, growing the buffer as it fills
+  SocketReader reader( sockets.second );
+  Parser parser;
+  CHECK_EQUAL( (ssize_t)burst.size(), reader.read( parser ) );
+  CHECK( reader.getBufferSize() > SocketReader::MIN_SIZE );
+  CHECK( reader.read( parser ) < 0 );
+
+  SocketReader::Messages messages;
+  SocketReader::readMessages( parser, messages );
+  CHECK_EQUAL( 1000U, messages.size() );
+  CHECK_EQUAL( msg, messages.front() );
+  CHECK_EQUAL( msg, messages.back() );
+
+  // a run of small reads hands the memory back
+  const size_t grown = reader.getBufferSize();
+  for( int i = 0; i < 64; ++i )
+  {
+    CHECK_EQUAL( (ssize_t)msg.size(), socket_send( sockets.first, msg.c_str(), msg.size() ) );
+    CHECK_EQUAL( (ssize_t)msg.size(), reader.read( parser ) );
+  }
+  CHECK_EQUAL( grown / 2, reader.getBufferSize() );
+
+  socket_close( sockets.first );
+  socket_close( sockets.second );
+}
+
+TEST(readMessagesSkipsGarbled)
+{
+  Parser parser;
+  parser.addToStream( "8=FIX.4.2\0019=5\00135=0\00110=000\001"
+                      "8=FIX.4.2\0019=A\00135=0\00110=000\001" );
+
+  SocketReader::Messages messages;
+  SocketReader::readMessages( parser, messages );
+  CHECK_EQUAL( 1U, messages.size() );
+
+  // framing carries on with the next read, a partial message waits for more
+  parser.addToStream( "8=FIX.4.2\0019=5\00135=1\00110=000\001"
+                      "8=FIX.4.2\0019=5\00135" );
+  SocketReader::readMessages( parser, messages );
+  CHECK_EQUAL( 2U, messages.size() );
+  CHECK_EQUAL( "8=FIX.4.2\0019=5\00135=1\00110=000\001", messages.back() );
+
+  parser.addToStream( "=2\00110=000\001" );
+  SocketReader::readMessages( parser, messages );
+  CHECK_EQUAL( 3U, messages.size() );
+  CHECK_EQUAL( "8=FIX.4.2\0019=5\00135=2\00110=000\001", messages.back() );
+}
+
+}
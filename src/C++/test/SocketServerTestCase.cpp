@@ -142,4 +142,18 @@ TEST_FIXTURE(socketServerFixture, close)
   object.block( *this );
 }
 
+#ifdef SO_REUSEPORT
+TEST(reusePort)
+{
+  SocketServer first( 0 );
+  SocketServer second( 0 );
+  SocketServer third( 0 );
+  CHECK( first.add( TestSettings::port, true, true, 0, 0, true ) >= 0 );
+  CHECK( second.add( TestSettings::port, true, true, 0, 0, true ) >= 0 );
+  CHECK_THROW( third.add( TestSettings::port, true, true ), SocketException );
+  first.close();
+  second.close();
+}
+#endif
+
 }
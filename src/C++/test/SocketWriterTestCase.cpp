@@ -0,0 +1,170 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <SocketWriter.h>
+#include <SessionMetrics.h>
+#include <Utility.h>
+#include "TestHelper.h"
+
+using namespace FIX;
+
+SUITE(SocketWriterTests)
+{
+
+static std::string drain( SocketWriter& writer, int reader, size_t expected )
+{
+  std::string result;
+  char buffer[ 4096 ];
+  for( int i = 0; i < 10000 && result.size() < expected; ++i )
+  {
+    CHECK( writer.write() );
+    int size = recv( reader, buffer, sizeof( buffer ), 0 );
+    if( size > 0 )
+      result.append( buffer, size );
+  }
+  return result;
+}
+
+TEST(gatheredWrites)
+{
+  std::pair<int, int> sockets = socket_createpair();
+  socket_setnonblock( sockets.first );
+  socket_setnonblock( sockets.second );
+  socket_setsockopt( sockets.first, SO_SNDBUF, 4096 );
+
+  // more messages than one write gathers and more bytes than the socket
+  // takes, so writes end part way through a message and resume there
+  SocketWriter writer( sockets.first );
+  std::string expected;
+  for( int i = 0; i < 200; ++i )
+  {
+    std::string msg( 100 + i, (char)( 'a' + i % 26 ) );
+    writer.push( msg );
+    expected += msg;
+  }
+  CHECK_EQUAL( 200U, writer.size() );
+
+  std::string received = drain( writer, sockets.second, expected.size() );
+  CHECK( expected == received );
+  CHECK( writer.empty() );
+  CHECK_EQUAL( 0U, writer.pinned() );
+
+  socket_close( sockets.first );
+  socket_close( sockets.second );
+}
+
+TEST(zeroCopyWrites)
+{
+  int acceptor = socket_createAcceptor( 0, true );
+  int port = socket_hostport( acceptor );
+  int client = socket_createConnector();
+  socket_connect( client, "127.0.0.1", port );
+  int server = socket_accept( acceptor );
+  socket_close( acceptor );
+  socket_setnonblock( client );
+  socket_setnonblock( server );
+
+  SocketWriter writer( client );
+  // copying is used where the kernel can not send in place
+  bool zeroCopy = writer.setZeroCopy( 1024 );
+
+  std::string expected;
+  for( int i = 0; i < 50; ++i )
+  {
+    std::string msg( 1000 + i, (char)( 'a' + i % 26 ) );
+    writer.push( msg );
+    expected += msg;
+  }
+
+  std::string received = drain( writer, server, expected.size() );
+  CHECK( expected == received );
+  CHECK( writer.empty() );
+
+  // every pinned message is released once the kernel reports it sent
+  for( int i = 0; i < 1000 && writer.pinned(); ++i )
+  {
+    process_sleep( 0.001 );
+    writer.reap();
+  }
+  CHECK_EQUAL( 0U, writer.pinned() );
+  if( !zeroCopy )
+    CHECK( writer.setZeroCopy( 0 ) );
+
+  socket_close( client );
+  socket_close( server );
+}
+
+#ifdef __linux__
+TEST(timestamps)
+{
+  int acceptor = socket_createAcceptor( 0, true );
+  int port = socket_hostport( acceptor );
+  int client = socket_createConnector();
+  socket_connect( client, "127.0.0.1", port );
+  int server = socket_accept( acceptor );
+  socket_close( acceptor );
+  socket_setnonblock( client );
+  CHECK( socket_settimestamping( server ) );
+
+  SocketWriter writer( client );
+  CHECK( writer.setTimestamping() );
+
+  SessionMetrics metrics;
+  writer.push( "8=FIX.4.2\0019=5\00135=0\00110=000\001" );
+  CHECK( writer.write( &metrics ) );
+
+  // the transmit time comes back on the error queue
+  const LatencyHistogram& wireOut = metrics.get( SessionMetrics::WIRE_OUT );
+  for( int i = 0; i < 1000 && !wireOut.count(); ++i )
+  {
+    process_sleep( 0.001 );
+    writer.reap( &metrics );
+  }
+  CHECK_EQUAL( 1U, wireOut.count() );
+
+  // the kernel turns receive stamping on lazily, so early packets may miss it
+  char buffer[ 256 ];
+  unsigned long long timestamp = 0;
+  for( int i = 0; i < 100 && !timestamp; ++i )
+  {
+    if( i )
+    {
+      writer.push( "8=FIX.4.2\0019=5\00135=0\00110=000\001" );
+      writer.write();
+      process_sleep( 0.01 );
+    }
+    CHECK( socket_recvtimestamp( server, buffer, sizeof( buffer ), 0, timestamp ) > 0 );
+  }
+  CHECK( timestamp > 0 );
+  CHECK( timestamp <= time_realtime() );
+
+  socket_close( client );
+  socket_close( server );
+}
+#endif
+
+}
@@ -0,0 +1,107 @@
+/****************************************************************************
+** Copyright (c) 2001-2014
+**
+** This file is part of the QuickFIX FIX Engine
+**
+** This file may be distributed under the terms of the quickfixengine.org
+** license as defined by quickfixengine.org and appearing in the file
+** LICENSE included in the packaging of this file.
+**
+** This file is provided AS IS with NO WARRANTY OF ANY KIND, INCLUDING THE
+** WARRANTY OF DESIGN, MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
+**
+** See http://www.quickfixengine.org/LICENSE for licensing information.
+**
+** Contact ask@quickfixengine.org if any conditions of this licensing are
+** not clear to you.
+**
+****************************************************************************/
+
+
+#ifdef _MSC_VER
+#pragma warning( disable : 4503 4355 4786 )
+#include "stdafx.h"
+#else
+#include "config.h"
+#endif
+
+#include <UnitTest++.h>
+#include <ValidationRules.h>
+#include <Values.h>
+
+using namespace FIX;
+
+SUITE(ValidationRulesTests)
+{
+
+TEST(noRulesToleratesNothing)
+{
+  ValidationRules object;
+  CHECK( !object.shouldTolerateEmptyTag( INCOMING_DIRECTION, "D", 44 ) );
+  CHECK( !object.shouldTolerateMissingTag( OUTGOING_DIRECTION, "D", 44 ) );
+  CHECK( !object.shouldTolerateMissingMessageType( INCOMING_DIRECTION ) );
+  CHECK( !object.shouldTolerateVersionMismatch( INCOMING_DIRECTION ) );
+}
+
+TEST(validationRuleIsDirectional)
+{
+  ValidationRules object;
+  object.setValidationRules( "1-5-D-44" );
+  CHECK( object.shouldTolerateEmptyTag( INCOMING_DIRECTION, "D", 44 ) );
+  CHECK( object.shouldTolerateEmptyTag( INCOMING_DIRECTION, "8", 44 ) );
+  CHECK( !object.shouldTolerateEmptyTag( OUTGOING_DIRECTION, "D", 44 ) );
+  CHECK( !object.shouldTolerateEmptyTag( INCOMING_DIRECTION, "D", 45 ) );
+  CHECK( !object.shouldTolerateMissingTag( INCOMING_DIRECTION, "D", 44 ) );
+}
+
+TEST(allowedFieldsApplyToEveryRule)
+{
+  ValidationRules object;
+  object.setAllowedFields( "D:44,55" );
+  CHECK( object.shouldTolerateEmptyTag( INCOMING_DIRECTION, "D", 44 ) );
+  CHECK( object.shouldTolerateMissingTag( OUTGOING_DIRECTION, "D", 55 ) );
+  CHECK( object.shouldTolerateBadFormatTag( 0, "D", 55 ) );
+  CHECK( !object.shouldTolerateEmptyTag( INCOMING_DIRECTION, "8", 44 ) );
+}
+
+TEST(anyMsgTypeOnlyWhenTypeHasNoEntry)
+{
+  ValidationRules object;
+  object.setAllowedFields( "?:58;D:44" );
+  CHECK( object.shouldTolerateEmptyTag( INCOMING_DIRECTION, "8", 58 ) );
+  CHECK( !object.shouldTolerateEmptyTag( INCOMING_DIRECTION, "D", 58 ) );
+  CHECK( object.shouldTolerateEmptyTag( INCOMING_DIRECTION, "D", 44 ) );
+}
+
+TEST(versionMismatchAndLargeTags)
+{
+  ValidationRules object;
+  object.setValidationRules( "1-104,0-2-?-50000" );
+  CHECK( object.shouldTolerateVersionMismatch( INCOMING_DIRECTION ) );
+  CHECK( !object.shouldTolerateVersionMismatch( OUTGOING_DIRECTION ) );
+  CHECK( object.shouldTolerateMissingTag( OUTGOING_DIRECTION, "D", 50000 ) );
+  CHECK( !object.shouldTolerateMissingTag( INCOMING_DIRECTION, "D", 50000 ) );
+}
+
+TEST(msgTypesOfEveryLength)
+{
+  ValidationRules object;
+  object.setAllowedFields( "A:44;AE:55;UCUSTOMTYPE:58" );
+  CHECK( object.shouldTolerateEmptyTag( INCOMING_DIRECTION, "A", 44 ) );
+  CHECK( !object.shouldTolerateEmptyTag( INCOMING_DIRECTION, "A", 55 ) );
+  CHECK( object.shouldTolerateEmptyTag( INCOMING_DIRECTION, "AE", 55 ) );
+  CHECK( !object.shouldTolerateEmptyTag( INCOMING_DIRECTION, "AE", 44 ) );
+  CHECK( object.shouldTolerateEmptyTag( INCOMING_DIRECTION, "UCUSTOMTYPE", 58 ) );
+  CHECK( !object.shouldTolerateEmptyTag( INCOMING_DIRECTION, "UCUSTOM", 58 ) );
+  CHECK( !object.shouldTolerateEmptyTag( INCOMING_DIRECTION, "", 44 ) );
+}
+
+TEST(copyKeepsCompiledRules)
+{
+  ValidationRules object;
+  object.setAllowedFields( "D:44" );
+  ValidationRules copy( object );
+  CHECK( copy.shouldTolerateEmptyTag( INCOMING_DIRECTION, "D", 44 ) );
+}
+
+}
@@ -27,6 +27,9 @@
 #endif
 
 #include <memory>
+#include <new>
+#include <atomic>
+#include <cstdlib>
 #include "getopt-repl.h"
 #include <iostream>
 #include "Application.h"
@@ -42,9 +45,14 @@
 #include "SocketInitiator.h"
 #include "ThreadedSocketAcceptor.h"
 #include "ThreadedSocketInitiator.h"
+#ifndef _MSC_VER
+#include "SharedMemoryAcceptor.h"
+#include "SharedMemoryInitiator.h"
+#endif
 #include "fix42/Heartbeat.h"
 #include "fix42/NewOrderSingle.h"
 #include "fix42/QuoteRequest.h"
+#include "fix42/MarketDataSnapshotFullRefresh.h"
 
 long testIntegerToString( int );
 long testStringToInteger( int );
@@ -55,11 +63,16 @@ long testIdentifyType( int );
 long testSerializeToStringHeartbeat( int );
 long testSerializeFromStringHeartbeat( int );
 long testSerializeFromStringAndValidateHeartbeat( int );
+long testValidateDictHeartbeat( int );
 long testCreateNewOrderSingle( int );
 long testSerializeToStringNewOrderSingle( int );
 long testSerializeFromStringNewOrderSingle( int );
 long testSerializeFromStringAndValidateNewOrderSingle( int );
 long testCreateQuoteRequest( int );
+long testCreateQuoteRequestMovingGroups( int );
+long testCreateMarketDataSnapshot( int );
+long testSerializeToStringMarketDataSnapshot( int );
+long testSerializeFromStringMarketDataSnapshot( int );
 long testReadFromQuoteRequest( int );
 long testSerializeToStringQuoteRequest( int );
 long testSerializeFromStringQuoteRequest( int );
@@ -71,6 +84,7 @@ long testValidateQuoteRequest( int );
 long testValidateDictQuoteRequest( int );
 long testSendOnSocket( int, short );
 long testSendOnThreadedSocket( int, short );
+long testSendOnSharedMemory( int );
 void report( long, int );
 
 #ifndef _MSC_VER
@@ -86,6 +100,26 @@ long GetTickCount()
 }
 #endif
 
+// Heap allocations made by every test, reported per message
+static std::atomic<long> s_allocations( 0 );
+static std::atomic<long> s_allocatedBytes( 0 );
+static long s_reportedAllocations = 0;
+static long s_reportedBytes = 0;
+
+void* operator new( std::size_t size ) throw( std::bad_alloc )
+{
+  ++s_allocations;
+  s_allocatedBytes += (long)size;
+  void* p = malloc( size ? size : 1 );
+  if( !p ) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete( void* p ) throw()
+{
+  free( p );
+}
+
 std::unique_ptr<FIX::DataDictionary> s_dataDictionary;
 const bool VALIDATE = true;
 const bool DONT_VALIDATE = false;
@@ -115,6 +149,8 @@ int main( int argc, char** argv )
   }
 
   s_dataDictionary.reset( new FIX::DataDictionary( "../spec/FIX42.xml" ) );
+  s_reportedAllocations = s_allocations;
+  s_reportedBytes = s_allocatedBytes;
 
   std::cout << "Converting integers to strings: ";
   report( testIntegerToString( count ), count );
@@ -143,6 +179,9 @@ int main( int argc, char** argv )
   std::cout << "Serializing Heartbeat messages from strings and validation: ";
   report( testSerializeFromStringAndValidateHeartbeat( count ), count );
 
+  std::cout << "Validating Heartbeat messages with data dictionary: ";
+  report( testValidateDictHeartbeat( count ), count );
+
   std::cout << "Creating NewOrderSingle messages: ";
   report( testCreateNewOrderSingle( count ), count );
 
@@ -158,6 +197,9 @@ int main( int argc, char** argv )
   std::cout << "Creating QuoteRequest messages: ";
   report( testCreateQuoteRequest( count ), count );
 
+  std::cout << "Creating QuoteRequest messages moving groups: ";
+  report( testCreateQuoteRequestMovingGroups( count ), count );
+
   std::cout << "Serializing QuoteRequest messages to strings: ";
   report( testSerializeToStringQuoteRequest( count ), count );
 
@@ -167,6 +209,15 @@ int main( int argc, char** argv )
   std::cout << "Serializing QuoteRequest messages from strings and validation: ";
   report( testSerializeFromStringAndValidateQuoteRequest( count ), count );
 
+  std::cout << "Creating MarketDataSnapshotFullRefresh messages with 100 entries: ";
+  report( testCreateMarketDataSnapshot( count ), count );
+
+  std::cout << "Serializing MarketDataSnapshotFullRefresh messages to strings: ";
+  report( testSerializeToStringMarketDataSnapshot( count ), count );
+
+  std::cout << "Serializing MarketDataSnapshotFullRefresh messages from strings: ";
+  report( testSerializeFromStringMarketDataSnapshot( count ), count );
+
   std::cout << "Reading fields from QuoteRequest message: ";
   report( testReadFromQuoteRequest( count ), count );
 
@@ -191,6 +242,11 @@ int main( int argc, char** argv )
   std::cout << "Sending/Receiving NewOrderSingle/ExecutionReports on ThreadedSocket";
   report( testSendOnThreadedSocket( count, port ), count );
 
+#ifndef _MSC_VER
+  std::cout << "Sending/Receiving NewOrderSingle/ExecutionReports on SharedMemory";
+  report( testSendOnSharedMemory( count ), count );
+#endif
+
   return 0;
 }
 
@@ -198,9 +254,15 @@ void report( long time, int count )
 {
   double seconds = ( double ) time / 1000;
   double num_per_second = count / seconds;
+  double allocations = s_allocations - s_reportedAllocations;
+  s_reportedAllocations = s_allocations;
+  double bytes = s_allocatedBytes - s_reportedBytes;
+  s_reportedBytes = s_allocatedBytes;
   std::cout << std::endl << "    num: " << count
   << ", seconds: " << seconds
-  << ", num_per_second: " << num_per_second << std::endl;
+  << ", num_per_second: " << num_per_second
+  << ", allocations_per_num: " << allocations / count
+  << ", bytes_per_num: " << bytes / count << std::endl;
 }
 
 long testIntegerToString( int count )
@@ -458,6 +520,51 @@ long testCreateQuoteRequest( int count )
   return GetTickCount() - start;
 }
 
+long testCreateQuoteRequestMovingGroups( int count )
+{
+  count = count - 1;
+
+  long start = GetTickCount();
+  FIX::Symbol symbol;
+  FIX::MaturityMonthYear maturityMonthYear;
+  FIX::PutOrCall putOrCall;
+  FIX::StrikePrice strikePrice;
+  FIX::Side side;
+  FIX::OrderQty orderQty;
+  FIX::Currency currency;
+  FIX::OrdType ordType;
+
+  for ( int i = 0; i <= count; ++i )
+  {
+    FIX42::QuoteRequest massQuote( FIX::QuoteReqID("1") );
+    FIX42::QuoteRequest::NoRelatedSym noRelatedSym;
+
+    for( int j = 1; j <= 10; ++j )
+    {
+      symbol.setValue( "IBM" );
+      maturityMonthYear.setValue( FIX::DateTime() );
+      putOrCall.setValue( FIX::PutOrCall_PUT );
+      strikePrice.setValue( 120 );
+      side.setValue( FIX::Side_BUY );
+      orderQty.setValue( 100 );
+      currency.setValue( "USD" );
+      ordType.setValue( FIX::OrdType_MARKET );
+      noRelatedSym.set( symbol );
+      noRelatedSym.set( maturityMonthYear );
+      noRelatedSym.set( putOrCall );
+      noRelatedSym.set( strikePrice );
+      noRelatedSym.set( side );
+      noRelatedSym.set( orderQty );
+      noRelatedSym.set( currency );
+      noRelatedSym.set( ordType );
+      massQuote.addGroup( std::move( noRelatedSym ) );
+      noRelatedSym.clear();
+    }
+  }
+
+  return GetTickCount() - start;
+}
+
 long testSerializeToStringQuoteRequest( int count )
 {
   FIX42::QuoteRequest message( FIX::QuoteReqID("1") );
@@ -548,6 +655,67 @@ long testSerializeFromStringAndValidateQuoteRequest( int count )
   return GetTickCount() - start;
 }
 
+void createMarketDataSnapshot( FIX42::MarketDataSnapshotFullRefresh& message )
+{
+  FIX42::MarketDataSnapshotFullRefresh::NoMDEntries noMDEntries;
+  for( int i = 0; i < 100; ++i )
+  {
+    noMDEntries.set( FIX::MDEntryType( i % 2 ? FIX::MDEntryType_OFFER : FIX::MDEntryType_BID ) );
+    noMDEntries.set( FIX::MDEntryPx( 120 + i * 0.25 ) );
+    noMDEntries.set( FIX::MDEntrySize( 100 * i ) );
+    noMDEntries.set( FIX::QuoteEntryID( "ENTRY" + FIX::IntConvertor::convert( i ) ) );
+    message.addGroup( std::move( noMDEntries ) );
+    noMDEntries.clear();
+  }
+}
+
+long testCreateMarketDataSnapshot( int count )
+{
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    FIX42::MarketDataSnapshotFullRefresh message( FIX::Symbol( "IBM" ) );
+    createMarketDataSnapshot( message );
+  }
+  return GetTickCount() - start;
+}
+
+long testSerializeToStringMarketDataSnapshot( int count )
+{
+  FIX42::MarketDataSnapshotFullRefresh message( FIX::Symbol( "IBM" ) );
+  createMarketDataSnapshot( message );
+  std::string string;
+
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    message.toString( string );
+  }
+  return GetTickCount() - start;
+}
+
+long testSerializeFromStringMarketDataSnapshot( int count )
+{
+  FIX42::MarketDataSnapshotFullRefresh message( FIX::Symbol( "IBM" ) );
+  createMarketDataSnapshot( message );
+  std::string string = message.toString();
+  FIX::ValidationRules vr;
+  vr.setShouldValidate(false);
+
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    message.setString( FIX::OUTGOING_DIRECTION, string, &vr, s_dataDictionary.get() );
+  }
+  return GetTickCount() - start;
+}
+
 long testReadFromQuoteRequest( int count )
 {
   count = count - 1;
@@ -690,6 +858,25 @@ long testValidateDictNewOrderSingle( int count )
   return GetTickCount() - start;
 }
 
+long testValidateDictHeartbeat( int count )
+{
+  FIX42::Heartbeat heartbeat;
+  heartbeat.getHeader().set( FIX::SenderCompID( "SENDER" ) );
+  heartbeat.getHeader().set( FIX::TargetCompID( "TARGET" ) );
+  heartbeat.getHeader().set( FIX::MsgSeqNum( 1 ) );
+  heartbeat.getHeader().set( FIX::SendingTime() );
+  FIX::Message message( FIX::INCOMING_DIRECTION, heartbeat.toString() );
+
+  count = count - 1;
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+  {
+    s_dataDictionary->validate( FIX::INCOMING_DIRECTION, message );
+  }
+  return GetTickCount() - start;
+}
+
 long testValidateQuoteRequest( int count )
 {
   FIX42::QuoteRequest message( FIX::QuoteReqID("1") );
@@ -887,3 +1074,63 @@ long testSendOnThreadedSocket( int count, short port )
 
   return ticks;
 }
+
+#ifndef _MSC_VER
+long testSendOnSharedMemory( int count )
+{
+  std::stringstream stream;
+  stream
+    << "[DEFAULT]" << std::endl
+    << "SharedMemoryName=quickfix_pt" << std::endl
+    << "StartTime=00:00:00" << std::endl
+    << "EndTime=00:00:00" << std::endl
+    << "UseDataDictionary=N" << std::endl
+    << "BeginString=FIX.4.2" << std::endl
+    << "PersistMessages=N" << std::endl
+    << "[SESSION]" << std::endl
+    << "ConnectionType=acceptor" << std::endl
+    << "SenderCompID=SERVER" << std::endl
+    << "TargetCompID=CLIENT" << std::endl
+    << "[SESSION]" << std::endl
+    << "ConnectionType=initiator" << std::endl
+    << "SenderCompID=CLIENT" << std::endl
+    << "TargetCompID=SERVER" << std::endl
+    << "HeartBtInt=30" << std::endl;
+
+  FIX::ClOrdID clOrdID( "ORDERID" );
+  FIX::HandlInst handlInst( '1' );
+  FIX::Symbol symbol( "LNUX" );
+  FIX::Side side( FIX::Side_BUY );
+  FIX::TransactTime transactTime;
+  FIX::OrdType ordType( FIX::OrdType_MARKET );
+  FIX42::NewOrderSingle message( clOrdID, handlInst, symbol, side, transactTime, ordType );
+
+  FIX::SessionID sessionID( "FIX.4.2", "CLIENT", "SERVER" );
+
+  TestApplication application;
+  FIX::MemoryStoreFactory factory;
+  FIX::SessionSettings settings( stream );
+
+  FIX::SharedMemoryAcceptor acceptor( application, factory, settings );
+  acceptor.start();
+
+  FIX::SharedMemoryInitiator initiator( application, factory, settings );
+  initiator.start();
+
+  FIX::process_sleep( 1 );
+
+  long start = GetTickCount();
+  for ( int i = 0; i <= count; ++i )
+    FIX::Session::sendToTarget( message, sessionID );
+
+  while( application.getCount() < count )
+    FIX::process_sleep( 0.1 );
+
+  long ticks = GetTickCount() - start;
+
+  initiator.stop();
+  acceptor.stop();
+
+  return ticks;
+}
+#endif
@@ -28,6 +28,7 @@
 #include "C++/SessionSettings.h"
 #ifndef _MSC_VER
 #include <DataDictionaryTestCase.cpp>
+#include <DatabaseBatchWriterTestCase.cpp>
 #include <DictionaryTestCase.cpp>
 #include <FieldBaseTestCase.cpp>
 #include <FieldConvertorsTestCase.cpp>
@@ -35,6 +36,12 @@
 #include <FileStoreFactoryTestCase.cpp>
 #include <FileStoreTestCase.cpp>
 #include <FileUtilitiesTestCase.cpp>
+#include <FlyweightDecoderTestCase.cpp>
+#include <HostResolverTestCase.cpp>
+#include <IOExecutorTestCase.cpp>
+#include <ConnectSchedulerTestCase.cpp>
+#include <MessageEncoderTestCase.cpp>
+#include <GroupTestCase.cpp>
 #include <HttpMessageTestCase.cpp>
 #include <HttpParserTestCase.cpp>
 #include <MemoryStoreTestCase.cpp>
@@ -46,17 +53,23 @@
 #include <ParserTestCase.cpp>
 #include <PostgreSQLStoreTestCase.cpp>
 #include <SessionIDTestCase.cpp>
+#include <SessionMetricsTestCase.cpp>
 #include <SessionSettingsTestCase.cpp>
 #include <SessionTestCase.cpp>
 #include <SessionFactoryTestCase.cpp>
 #include <SettingsTestCase.cpp>
+#include <SharedMemoryTestCase.cpp>
 #include <SocketAcceptorTestCase.cpp>
 #include <SocketConnectorTestCase.cpp>
+#include <SocketOptionsTestCase.cpp>
+#include <SocketReaderTestCase.cpp>
 #include <SocketServerTestCase.cpp>
+#include <SocketWriterTestCase.cpp>
 #include <TestHelper.cpp>
 #include <TimeRangeTestCase.cpp>
 #include <UtcTimeOnlyTestCase.cpp>
 #include <UtcTimeStampTestCase.cpp>
+#include <ValidationRulesTestCase.cpp>
 #endif
 #include <UnitTest++.h>
 #include <TestReporterStdout.h>